@@ -1,18 +1,103 @@
 #include "Source/Framework/D3DFramework.h"
+#include "Source/Framework/TransformBenchmark.h"
+#include "Source/Framework/SelfCheck.h"
+
+// 실행 인자로 물리 시뮬레이션의 기록(-record 파일명) 또는 재생(-replay 파일명)을 지정한다.
+static void ParsePhysicsRecordArgs(D3DFramework& framework, const std::string& cmdLine)
+{
+	const std::pair<const char*, PhysicsRecordMode> options[] =
+	{
+		{ "-record", PhysicsRecordMode::Record },
+		{ "-replay", PhysicsRecordMode::Replay },
+	};
+
+	for (const auto& [option, mode] : options)
+	{
+		size_t pos = cmdLine.find(option);
+		if (pos == std::string::npos)
+			continue;
+
+		pos = cmdLine.find_first_not_of(' ', pos + strlen(option));
+		if (pos == std::string::npos)
+			continue;
+
+		const size_t end = cmdLine.find(' ', pos);
+		framework.SetPhysicsRecordMode(mode, cmdLine.substr(pos, end - pos));
+		return;
+	}
+}
+
+// 실행 인자로 -headless 프레임수가 주어지면 창 없이 널 백엔드로 그만큼의 프레임을 실행한다.
+// 실행할 프레임의 수를 반환하며, 헤드리스로 실행하지 않는다면 0을 반환한다.
+static UINT32 ParseHeadlessArgs(const std::string& cmdLine)
+{
+	constexpr UINT32 defaultFrameCount = 1000;
+	const char* option = "-headless";
+
+	const size_t pos = cmdLine.find(option);
+	if (pos == std::string::npos)
+		return 0;
+
+	const UINT32 frameCount = (UINT32)std::strtoul(cmdLine.c_str() + pos + strlen(option), nullptr, 10);
+	return frameCount > 0 ? frameCount : defaultFrameCount;
+}
+
+// 실행 인자로 -transformbench 객체수가 주어지면 트랜스폼 계산의 벤치마크만 실행한다.
+// 벤치마크할 객체의 수를 반환하며, 벤치마크를 실행하지 않는다면 0을 반환한다.
+static UINT32 ParseTransformBenchmarkArgs(const std::string& cmdLine)
+{
+	constexpr UINT32 defaultObjectCount = 100000;
+	const char* option = "-transformbench";
+
+	const size_t pos = cmdLine.find(option);
+	if (pos == std::string::npos)
+		return 0;
+
+	const UINT32 objectCount = (UINT32)std::strtoul(cmdLine.c_str() + pos + strlen(option), nullptr, 10);
+	return objectCount > 0 ? objectCount : defaultObjectCount;
+}
+
+// 실행 인자로 -selfcheck가 주어지면 CPU에서 실행할 수 있는 렌더링 보조 함수들의 검사만 실행한다.
+static bool ParseSelfCheckArgs(const std::string& cmdLine)
+{
+	return cmdLine.find("-selfcheck") != std::string::npos;
+}
 
 int WINAPI WinMain(HINSTANCE hInstance, HINSTANCE prevInstance, PSTR cmdLine, int showCmd)
 {
-	// ǽð ޸ ˻縦 ȰȭѴ.
+	// 실시간 메모리 검사를 활성화한다.
 #if defined(DEBUG) | defined(_DEBUG)
 	_CrtSetDbgFlag(_CRTDBG_ALLOC_MEM_DF | _CRTDBG_LEAK_CHECK_DF);
 #endif
 
+	// 벤치마크는 장치를 만들지 않고 실행한 후 바로 종료한다.
+	const UINT32 benchmarkObjectCount = ParseTransformBenchmarkArgs(cmdLine);
+	if (benchmarkObjectCount > 0)
+	{
+		RunTransformBenchmark(benchmarkObjectCount);
+		return 0;
+	}
+
+	// 검사는 창을 만들지 않고 실행하며, 실패한 검사가 있다면 1을 반환한다.
+	if (ParseSelfCheckArgs(cmdLine))
+		return RunSelfChecks() == 0 ? 0 : 1;
+
 	try
 	{
 		D3DFramework framework(hInstance, 1280, 900, L"D3DFramework");
+		ParsePhysicsRecordArgs(framework, cmdLine);
+
+		const UINT32 headlessFrameCount = ParseHeadlessArgs(cmdLine);
+		if (headlessFrameCount > 0)
+			framework.SetRenderBackend(RenderBackend::Null);
+
 		if (!framework.Initialize())
 			return 0;
 
+		// 헤드리스 실행은 고정된 60fps의 시간 간격으로 진행한다.
+		if (headlessFrameCount > 0)
+			return framework.RunHeadless(headlessFrameCount, 1.0f / 60.0f);
+
 		return framework.Run();
 	}
 	catch (DxException& e)
@@ -31,10 +31,10 @@ groupshared float4 gCache[CacheSize];
 [numthreads(N, 1, 1)]
 void CS_BlurHorz(int3 groupThreadID : SV_GroupThreadID, int3 dispatchThreadID : SV_DispatchThreadID)
 {
-	// 콺 ġ Ѵ.
+	// 가우스 가중치를 나열한다.
 	float weights[11] = { w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10 };
 
-	// ȭ ȼ     Ѵ.
+	// 화면의 픽셀 범위를 벗어나는 값에 대해 정의한다.
 	if (groupThreadID.x < gBlurRadius)
 	{
 		int x = max(dispatchThreadID.x - gBlurRadius, 0);
@@ -48,29 +48,29 @@ void CS_BlurHorz(int3 groupThreadID : SV_GroupThreadID, int3 dispatchThreadID :
 
 	gCache[groupThreadID.x + gBlurRadius] = gInput[min(dispatchThreadID.xy, gInput.Length.xy - 1)];
 
-	// ׷ 尡 ⿡   ٸ.
+	// 그룹 스레드가 여기에 도달할 때까지 기다린다.
 	GroupMemoryBarrierWithGroupSync();
 
 	float4 blurColor = 0.0f;
 
 	for (int i = -gBlurRadius; i <= gBlurRadius; ++i)
 	{
-		// ġ Ͽ  κ ȼ ´.
+		// 가중치를 사용하여 수평 부분 픽셀을 섞는다.
 		int k = groupThreadID.x + gBlurRadius + i;
 		blurColor += weights[i + gBlurRadius] * gCache[k];
 	}
 
-	//  Ѵ.
+	// 결과값을 저장한다.
 	gOutput[dispatchThreadID.xy] = blurColor;
 }
 
 [numthreads(1, N, 1)]
 void CS_BlurVert(int3 groupThreadID : SV_GroupThreadID, int3 dispatchThreadID : SV_DispatchThreadID)
 {
-	// 콺 ġ Ѵ.
+	// 가우스 가중치를 나열한다.
 	float weights[11] = { w0, w1, w2, w3, w4, w5, w6, w7, w8, w9, w10 };
 
-	// ȭ ȼ     Ѵ.
+	// 화면의 픽셀 범위를 벗어나는 값에 대해 정의한다.
 	if (groupThreadID.y < gBlurRadius)
 	{
 		int y = max(dispatchThreadID.y - gBlurRadius, 0);
@@ -84,18 +84,18 @@ void CS_BlurVert(int3 groupThreadID : SV_GroupThreadID, int3 dispatchThreadID :
 
 	gCache[groupThreadID.y + gBlurRadius] = gInput[min(dispatchThreadID.xy, gInput.Length.xy - 1)];
 
-	// ׷ 尡 ⿡   ٸ.
+	// 그룹 스레드가 여기에 도달할 때까지 기다린다.
 	GroupMemoryBarrierWithGroupSync();
 
 	float4 blurColor = float4(0, 0, 0, 0);
 
 	for (int i = -gBlurRadius; i <= gBlurRadius; ++i)
 	{
-		// ġ Ͽ  κ ȼ ´.
+		// 가중치를 사용하여 수직 부분 픽셀을 섞는다.
 		int k = groupThreadID.y + gBlurRadius + i;
 		blurColor += weights[i + gBlurRadius] * gCache[k];
 	}
 
-	//  Ѵ.
+	// 결과값을 저장한다.
 	gOutput[dispatchThreadID.xy] = blurColor;
 }
\ No newline at end of file
@@ -21,6 +21,27 @@ Texture2D gBluredSsrMap : register(t8, space2);
 StructuredBuffer<Light> gLights : register(t0, space3);
 StructuredBuffer<MaterialData> gMaterialData : register(t1, space3);
 
+// 객체의 상수 버퍼를 구조적 버퍼로 읽기 위한 구조체
+// 상수 버퍼의 원소는 256바이트 단위로 정렬되므로 같은 크기가 되도록 채운다.
+struct ObjectData
+{
+	float4x4 world;
+	uint materialIndex;
+	uint3 objPad0;
+	float4 objPad1[11];
+};
+
+StructuredBuffer<ObjectData> gObjects : register(t2, space3);
+// 인스턴스마다 읽을 객체의 인덱스
+StructuredBuffer<uint> gInstanceIndices : register(t3, space3);
+
+// 그리기마다 루트 상수로 바뀌는 묶음의 시작 위치
+// SV_InstanceID는 StartInstanceLocation을 더하지 않으므로 ExecuteIndirect에서도 이 값을 바꾼다.
+cbuffer cbInstance : register(b2)
+{
+	uint gInstanceBase;
+};
+
 SamplerState gsamPointWrap        : register(s0);
 SamplerState gsamPointClamp       : register(s1);
 SamplerState gsamLinearWrap       : register(s2);
@@ -29,6 +50,7 @@ SamplerState gsamAnisotropicWrap  : register(s4);
 SamplerState gsamAnisotropicClamp : register(s5);
 SamplerComparisonState gsamShadow : register(s6);
 
+// DrawList를 거치지 않는 위젯은 여전히 상수 버퍼로 객체의 상수를 받는다.
 cbuffer cbPerObject : register(b0)
 {
     float4x4 gObjWorld;
@@ -38,20 +60,26 @@ cbuffer cbPerObject : register(b0)
 	uint gObjPad2;
 };
 
-//   ǥ World Space ȯѴ.
+// SV_InstanceID번째 인스턴스로 그려지는 객체의 상수를 가져온다.
+ObjectData GetInstanceData(uint instanceID)
+{
+	return gObjects[gInstanceIndices[gInstanceBase + instanceID]];
+}
+
+// 법선 맵 표본을 World Space로 변환한다.
 float3 NormalSampleToWorldSpace(float3 normalMapSample, float3 unitNormalW, float3 tangentW)
 {
-	//   [0,1] [-1,1] Ѵ.
+	// 각 성분을 [0,1]에서 [-1,1]로 사상한다.
 	float3 normalT = 2.0f*normalMapSample - 1.0f;
 
-	//   Ѵ.
+	// 정규직교 기저를 구축한다.
 	float3 n = unitNormalW;
 	float3 t = normalize(tangentW - dot(tangentW, n)*n);
 	float3 b = cross(n, t);
 
 	float3x3 tbn = float3x3(t, b, n);
 
-	// Tangent Space World Space ȯѴ.
+	// Tangent Space에서 World Space로 변환한다.
 	float3 bumpedNormalW = mul(normalT, tbn);
 
 	return bumpedNormalW;
@@ -59,44 +87,44 @@ float3 NormalSampleToWorldSpace(float3 normalMapSample, float3 unitNormalW, floa
 
 float3 BoxCubeMapLookup(float3 rayOrigin, float3 unitRayDir, float3 boxCenter, float3 boxExtents)
 {
-	//  ߽  д.
+	// 상자의 중심을 원점으로 둔다.
 	float3 p = rayOrigin - boxCenter;
 
-	// AABB i°        .
+	// AABB의 i번째 평판 반직선 대 평면 교차 공식은 다음과 같다.
 	// t1 = (-dot(n_i), p) + h_i) / dot(n_i, d) = (-p_i + h_i) / d_i;
 	// t2 = (-dot(n_i), p) - h_i) / dot(n_i, d) = (-p_i - h_i) / d_i;
 
-	// ȭ   鿡      Ѳ Ѵ.
+	// 벡터화한 후 모든 평면에 대해 반직선 대 평면 공식을 한꺼번에 적용한다.
 	float3 t1 = (-p + boxExtents) / unitRayDir;
 	float3 t2 = (-p - boxExtents) / unitRayDir;
 
-	//  ǥ ִ밪 ã´.
-	//   ο ִٰ ϹǷ,  Ű ִ밪 ã ȴ.
+	// 각 좌표성분의 최대값을 찾는다.
+	// 반직선이 상자 내부에 있다고 가정하므로, 교차 매개변수의 최대값만 찾으면 된다.
 	float3 tmax = max(t1, t2);
 
-	// tmax   ּڰ Ѵ.
+	// tmax의 모든 성분의 최솟값을 구한다.
 	float t = min(min(tmax.x, tmax.y), tmax.z);
 
-	// ť  ȸ ͷ   ֵ  ߽ɿ  ǥ .
+	// 큐브 맵의 조회 벡터로 사용할 수 있도록 상자의 중심에 상대적인 좌표로 만든다.
 	return p + t * unitRayDir;
 }
 
 float CalcShadowFactor(float4 shadowPosH, int shadowMapIndex)
 {
-	// w ν  ϷѴ.
+	// w를 나눔으로써 투영을 완료한다.
 	shadowPosH.xyz /= shadowPosH.w;
 
-	// ׸      ׸ڸ 帮 ʴ´.
+	// 그림자 맵의 범위를 벗어난 것은 라이팅을 그림자를 드리우지 않는다.
 	if (shadowPosH.x < 0.0f || shadowPosH.x > 1.0f || shadowPosH.y < 0.0f || shadowPosH.y > 1.0f)
 		return 1.0f;
 
-	// NDC  
+	// NDC 공간에서의 깊이
 	float depth = shadowPosH.z;
 
 	uint width, height, numMips;
 	gShadowMaps[shadowMapIndex].GetDimensions(0, width, height, numMips);
 
-	// ؼ 
+	// 텍셀 사이즈
 	float dx = 1.0f / (float)width;
 
 	float percentLit = 0.0f;
@@ -110,13 +138,13 @@ float CalcShadowFactor(float4 shadowPosH, int shadowMapIndex)
 	[unroll]
 	for (int i = 0; i < 9; ++i)
 	{
-		// 4ǥ PCF ڵ ȴ.
+		// 4표본 PCF가 자동으로 수행된다.
 		percentLit += gShadowMaps[shadowMapIndex].SampleCmpLevelZero(gsamShadow,
 			shadowPosH.xy + offsets[i], depth).r;
 	}
 
-	// 0 ־   ׸ ȿ ִٴ ̰,
-	// 1 ׸ڸ  ٴ ̴.
+	// 0은 주어진 점이 완전히 그림자 안에 있다는 뜻이고,
+	// 1은 그림자를 완전히 벗어났다는 뜻이다.
 	return percentLit / 9.0f;
 }
 
@@ -129,7 +157,7 @@ float4 ComputeShadowLighting(StructuredBuffer<Light> lights, Material mat, float
 		if (lights[i].enabled == 0)
 			continue;
 
-		// ٸ ü    shadowFactor ȼ Ӱ Ѵ.
+		// 다른 물체에 가려진 정도에 따라 shadowFactor로 픽셀을 어둡게 한다.
 		float4 shadowPosH = mul(float4(pos, 1.0f), gLights[i].shadowTransform);
 		float3 shadowFactor = CalcShadowFactor(shadowPosH, i);
 
@@ -151,7 +179,7 @@ float4 ComputeShadowLighting(StructuredBuffer<Light> lights, Material mat, float
 }
 
 /*
-Ȱ Ӽ   ´.
+안개 속성에 따라 색상을 섞는다.
 */
 float4 FogBlend(float4 litColor, float distToEye)
 {
@@ -161,21 +189,21 @@ float4 FogBlend(float4 litColor, float distToEye)
 	{
 	case FOG_LINEAR:
 	{
-		// Ÿ  Ȱ    Ѵ.
+		// 거리에 따라 안개 색상을 선형 감쇠로 계산한다.
 		float fogAmount = saturate((distToEye - gFogStart) / gFogRange);
 		result = lerp(litColor, gFogColor, fogAmount);
 		break;
 	}
 	case FOG_EXPONENTIAL:
 	{
-		//  ָ  Ȱ  β.
+		// 지수적으로 멀리 있을수록 안개가 더 두꺼워진다.
 		float fogAmount = exp(-distToEye * gFogDensity);
 		result = lerp(gFogColor, litColor, fogAmount);
 		break;
 	}
 	case FOG_EXPONENTIAL2:
 	{
-		// ſ β Ȱ Ÿ.
+		// 매우 두꺼운 안개를 나타낸다.
 		float fogAmount = exp(-pow(distToEye * gFogDensity, 2));
 		result = lerp(gFogColor, litColor, fogAmount);
 		break;
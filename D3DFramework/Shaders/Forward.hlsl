@@ -17,35 +17,39 @@ struct VertexOut
 	float3 tangentW  : TANGENT;
 	float3 binormalW : BINORMAL;
 	float2 texC      : TEXCOORD;
+	nointerpolation uint materialIndex : MATERIAL;
 };
 
-VertexOut VS(VertexIn vin)
+VertexOut VS(VertexIn vin, uint instanceID : SV_InstanceID)
 {
 	VertexOut vout = (VertexOut)0.0f;
 
-    // World Space ȯѴ.
-    float4 posW = mul(float4(vin.posL, 1.0f), gObjWorld);
+	ObjectData objData = GetInstanceData(instanceID);
+	vout.materialIndex = objData.materialIndex;
+
+    // World Space로 변환한다.
+    float4 posW = mul(float4(vin.posL, 1.0f), objData.world);
     vout.posW = posW.xyz;
 
-	//    ȯѴ.
+	// 동차 절단 공간으로 변환한다.
 	vout.posH = mul(posW, gViewProj);
 
-	// World Matrix յ ʰ ٰ ϰ Normal ȯѴ.
-	// յ ʰ ִٸ ġ  ؾ Ѵ.
-    vout.normalW = mul(vin.normalL, (float3x3)gObjWorld);
-	vout.tangentW = mul(vin.tangentU, (float3x3)gObjWorld);
-	vout.binormalW = mul(vin.binormalU, (float3x3)gObjWorld);
+	// World Matrix에 비균등 비례가 없다고 가정하고 Normal을 변환한다.
+	// 비균등 비례가 있다면 역전치 행렬을 사용해야 한다.
+    vout.normalW = mul(vin.normalL, (float3x3)objData.world);
+	vout.tangentW = mul(vin.tangentU, (float3x3)objData.world);
+	vout.binormalW = mul(vin.binormalU, (float3x3)objData.world);
 	
-	//   Ư  ﰢ  ȴ.
-	vout.texC = mul(float4(vin.texC, 0.0f, 1.0f), GetMaterialTransform(gObjMaterialIndex)).xy;
+	// 출력 정점 특성들은 이후 삼각형을 따라 보간된다.
+	vout.texC = mul(float4(vin.texC, 0.0f, 1.0f), GetMaterialTransform(objData.materialIndex)).xy;
 	
     return vout;
 }
 
 float4 PS(VertexOut pin) : SV_Target
 {
-	//  ȼ  ͸ ͸ ´.
-	MaterialData materialData = gMaterialData[gObjMaterialIndex];
+	// 이 픽셀에 사용할 머터리얼 데이터를 가져온다.
+	MaterialData materialData = gMaterialData[pin.materialIndex];
 
 	float4 diffuse = materialData.diffuseAlbedo;
 	float3 specular = materialData.specular;
@@ -56,10 +60,10 @@ float4 PS(VertexOut pin) : SV_Target
 	if (diffuseMapIndex != DISABLED)
 		diffuse *= gTextureMaps[diffuseMapIndex].Sample(gsamAnisotropicWrap, pin.texC);
 
-    // ؽó İ 0.1  ȼ Ѵ. 
+    // 텍스처 알파가 0.1보다 작으면 픽셀을 폐기한다. 
     clip(diffuse.a - 0.1f);
 
-	//  ϸ  ̰ ƴϰ   Ƿ ٽ ȭѴ.
+	// 법선을 보간하면 단위 길이가 아니게 될 수 있으므로 다시 정규화한다.
     pin.normalW = normalize(pin.normalW);
 	pin.tangentW = normalize(pin.tangentW);
 	pin.binormalW = normalize(pin.binormalW);
@@ -69,44 +73,44 @@ float4 PS(VertexOut pin) : SV_Target
 	{
 		float4 normalMapSample = gTextureMaps[normalMapIndex].Sample(gsamAnisotropicWrap, pin.texC);
 
-		// ָʿ Tangent Space  World Space ַ ȯѴ.
+		// 노멀맵에서 Tangent Space의 노멀을 World Space의 노멀로 변환한다.
 		float3 normalT = 2.0f * normalMapSample.rgb - 1.0f;
 		float3x3 tbn = float3x3(pin.tangentW, pin.binormalW, pin.normalW);
 		bumpedNormalW = mul(normalT, tbn);
 		bumpedNormalW = normalize(bumpedNormalW);
 	}
 
-    // Ǵ ȼ  
+    // 조명되는 픽셀에서 눈으로의 벡터
 	float3 toEyeW = gEyePosW - pin.posW;
 	float distToEye = length(toEyeW);
 	toEyeW /= distToEye; // normalize
 
-	// Diffuse  ִ Ambient
+	// Diffuse를 전반적으로 밝혀주는 Ambient항
 	float4 ambient = gAmbientLight * diffuse;
 
-	// roughness normal ̿Ͽ shininess Ѵ.
+	// roughness와 normal를 이용하여 shininess를 계산한다.
 	const float shininess = 1.0f - roughness;
     Material mat = { diffuse, specular, shininess };
 
-	// Lighting ǽѴ.
+	// Lighting을 실시한다.
     float4 directLight = ComputeShadowLighting(gLights, mat, pin.posW, bumpedNormalW, toEyeW);
 	float4 litColor = ambient + directLight;
 
 #ifdef SSAO
-	// SSAO ϴ  Ssaoʿ 󵵸 ͼ 
-	//  ⸦ δ.
+	// SSAO를 사용하는 경우 Ssao맵에서 차폐도를 가져와서 
+	// 빛의 세기를 줄인다.
 	float4 ssaoPosH = mul(float4(pin.posW, 1.0f), gViewProjTex);
 	ssaoPosH /= ssaoPosH.w;
 	float ambientAccess = gSsaoMap.Sample(gsamLinearClamp, ssaoPosH.xy, 0.0f).r;
 	litColor *= ambientAccess;
 #endif
 
-	// л  ĸ ´.
+	// 분산 재질에서 알파를 가져온다.
 	litColor.a = diffuse.a;
 
 	if (gFogEnabled)
 	{
-		// Ȱ Ѵٸ Ȱ    ´.
+		// 안개를 사용한다면 안개의 설정에 따라 색을 섞는다.
 		litColor = FogBlend(litColor, distToEye);
 	}
 
@@ -13,41 +13,41 @@ float4 PS(VertexOut pin) : SV_Target
 	float3 normal = gNormalMap.Load(texCoord).xyz;
 	float depth = gDepthMap.Load(texCoord).r;
 
-	// ش ȼ ϵǾ ִ ȮѴ.
+	// 해당 픽셀이 기록되어 있는지 확인한다.
 	if (diffuse.a <= 0.0f)
 		return 0.0f;
 
-	// Ǵ ȼ  
+	// 조명되는 픽셀에서 눈으로의 벡터
 	float3 toEyeW = gEyePosW - position.xyz;
 	float distToEye = length(toEyeW);
 	toEyeW /= distToEye; // normalize
 
-	// Diffuse  ִ Ambient
+	// Diffuse를 전반적으로 밝혀주는 Ambient항
 	float4 ambient = gAmbientLight * diffuse;
 
-	// roughness normal ̿Ͽ shininess Ѵ.
+	// roughness와 normal를 이용하여 shininess를 계산한다.
 	const float shininess = 1.0f - roughness;
 	Material mat = { diffuse, specular, shininess };
 
-	// Lighting ǽѴ.
+	// Lighting을 실시한다.
 	float4 directLight = ComputeShadowLighting(gLights, mat, position.xyz, normal, toEyeW);
 	float4 litColor = ambient + directLight;
 
 #ifdef SSAO
-	// SSAO ϴ  Ssaoʿ 󵵸 ͼ 
-	//  ⸦ δ.
+	// SSAO를 사용하는 경우 Ssao맵에서 차폐도를 가져와서 
+	// 빛의 세기를 줄인다.
 	float4 ssaoPosH = mul(float4(position.xyz, 1.0f), gViewProjTex);
 	ssaoPosH /= ssaoPosH.w;
 	float ambientAccess = gSsaoMap.Sample(gsamLinearClamp, ssaoPosH.xy, 0.0f).r;
 	litColor *= ambientAccess;
 #endif
 
-	// Diferred rendering  ü  ϴ.
+	// Diferred rendering에서는 불투명한 물체만 렌더링 가능하다.
 	litColor.a = 1.0f;
 
 	if (gFogEnabled)
 	{
-		// Ȱ Ѵٸ Ȱ    ´.
+		// 안개를 사용한다면 안개의 설정에 따라 색을 섞는다.
 		litColor = FogBlend(litColor, distToEye);
 	}
 
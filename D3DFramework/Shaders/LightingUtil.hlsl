@@ -22,15 +22,15 @@ struct Light
 	float padding0;
 };
 
-//   ϴ    Ѵ.
+// 점광과 점적광에 적용하는 선형 감쇠 계수를 계산한다.
 float CalcAttenuation(float d, float falloffStart, float falloffEnd)
 {
     return saturate((falloffEnd-d) / (falloffEnd - falloffStart));
 }
 
-//    ٻ縦 Ѵ.
-// ,  n ǥ鿡  ȿ  ݻǴ  
-//   L ǥ  n   ٰؼ ٻѴ.
+// 프레넬 방정식의 슐릭 근사를 구한다.
+// 즉, 번섭이 n인 표면에서 프레넬 효과에 의해 반사되는 빛의 비율을
+// 빛 벡터 L과 표면 법선 n 사이의 각도에 근거해서 근사한다.
 float3 SchlickFresnel(float3 r0, float3 normal, float3 lightVec)
 {
     float cosIncidentAngle = saturate(dot(normal, lightVec));
@@ -41,8 +41,8 @@ float3 SchlickFresnel(float3 r0, float3 normal, float3 lightVec)
     return reflectPercent;
 }
 
-//   ݻ籤  Ѵ.
-// , л ݻ ݿ ݻ  Ѵ.
+// 눈에 도달한 반사광의 양을 계산한다.
+// 즉, 분산 반사와 반영 반사의 합을 구한다.
 float3 BlinnPhong(float3 lightStrength, float3 lightVec, float3 normal, float3 toEye, Material mat)
 {
     const float m = mat.shininess * 256.0f;
@@ -53,8 +53,8 @@ float3 BlinnPhong(float3 lightStrength, float3 lightVec, float3 normal, float3 t
 
     float3 specAlbedo = specularFactor * roughnessFactor;
 
-    // ݿ ݻ  [0,1]  ٱ    ,
-	// 츮 LDR  ϹǷ, ݻ 1̸ .
+    // 반영 반사율 공식이 [0,1] 구간 바깥의 값을 낼 수도 있지만,
+	// 우리는 LDR 렌더링을 구현하므로, 반사율을 1미만으로 낮춘다.
     specAlbedo = specAlbedo / (specAlbedo + 1.0f);
 
     return (mat.diffuseAlbedo.rgb + specAlbedo) * lightStrength;
@@ -62,10 +62,10 @@ float3 BlinnPhong(float3 lightStrength, float3 lightVec, float3 normal, float3 t
 
 float3 ComputeDirectionalLight(Light light, Material mat, float3 normal, float3 toEye)
 {
-    //  ʹ  ư  ݴ  Ų.
+    // 빛 벡터는 광선들이 나아가는 방향의 반대 방향을 가리킨다.
     float3 lightVec = -light.direction;
 
-    // Ʈ ڻ Ģ   ⸦ δ.
+    // 람베트르 코사인 법칙에 따라 빛의 세기를 줄인다.
     float ndotl = max(dot(lightVec, normal), 0.0f);
     float3 lightStrength = light.strength * ndotl;
 
@@ -74,24 +74,24 @@ float3 ComputeDirectionalLight(Light light, Material mat, float3 normal, float3
 
 float3 ComputePointLight(Light light, Material mat, float3 pos, float3 normal, float3 toEye)
 {
-    // ǥ鿡  
+    // 표면에서 광원으로의 벡터
     float3 lightVec = light.position - pos;
 
-    //  ǥ  Ÿ
+    // 광원과 표면 사이의 거리
     float d = length(lightVec);
 
-    // 
+    //범위 판정
     if(d > light.falloffEnd)
 		return float3(0.0f, 0.0f, 0.0f);
 
-    //  ͸ ȭѴ.
+    // 빛 벡터를 정규화한다.
     lightVec /= d;
 
-    // Ʈ ڻ Ģ   ⸦ δ.
+    // 람베트르 코사인 법칙에 따라 빛의 세기를 줄인다.
     float ndotl = max(dot(lightVec, normal), 0.0f);
     float3 lightStrength = light.strength * ndotl;
 
-    // Ÿ   Ѵ.
+    // 거리에 따라 빛을 감쇠한다.
     float att = CalcAttenuation(d, light.falloffStart, light.falloffEnd);
     lightStrength = lightStrength * att;
 
@@ -100,24 +100,24 @@ float3 ComputePointLight(Light light, Material mat, float3 pos, float3 normal, f
 
 float3 ComputeSpotLight(Light light, Material mat, float3 pos, float3 normal, float3 toEye)
 {
-    // ǥ鿡  
+    // 표면에서 광원으로의 벡터
     float3 lightVec = light.position - pos;
 
-    //  ǥ  Ÿ
+    // 광원과 표면 사이의 거리
     float d = length(lightVec);
 
-    //  
+    // 범위 판정
 	if (d > light.falloffEnd)
 		return float3(0.0f, 0.0f, 0.0f);
 
-    //  ͸ ȭѴ.
+    // 빛 벡터를 정규화한다.
     lightVec /= d;
 
-    // Ʈ ڻ Ģ   ⸦ δ.
+    // 람베트르 코사인 법칙에 따라 빛의 세기를 줄인다.
     float ndotl = max(dot(lightVec, normal), 0.0f);
     float3 lightStrength = light.strength * ndotl;
 
-    // Ÿ   Ѵ.
+    // 거리에 따라 빛을 감쇠한다.
     float att = CalcAttenuation(d, light.falloffStart, light.falloffEnd);
     lightStrength *= att;
 
@@ -125,7 +125,7 @@ float3 ComputeSpotLight(Light light, Material mat, float3 pos, float3 normal, fl
 	float maxCos = lerp(minCos, 1.0f, 0.5f);
 	float cosAngle = max(dot(-lightVec, light.direction), 0.0f);
 
-	// Angle   Ѵ.
+	// Angle에 따라 빛을 감쇠한다.
 	float spotIntensity = smoothstep(minCos, maxCos, cosAngle);
     lightStrength *= spotIntensity;
 
@@ -133,7 +133,7 @@ float3 ComputeSpotLight(Light light, Material mat, float3 pos, float3 normal, fl
 }
 
 /*
-ȼ  Ͽ  Ѵ.
+픽셀 정점에 대하여 라이팅을 계산한다.
 */
 float4 ComputeLighting(StructuredBuffer<Light> lights, Material mat, float3 pos, float3 normal, float3 toEye)
 {
@@ -162,7 +162,7 @@ float4 ComputeLighting(StructuredBuffer<Light> lights, Material mat, float3 pos,
 }
 
 /*
- Ʈ  ⼺ Ʈ Ͽ Ѵ.
+모든 라이트 중 방향성 라이트만 사용하여 계산한다.
 */
 float4 ComputeOnlyDirectionalLight(StructuredBuffer<Light> lights, Material mat, float3 normal, float3 toEye)
 {
@@ -1,6 +1,6 @@
 #include "Common.hlsl"
 
-/*ؽ ̴  ؽ ̴ Ѵ.*/
+/*버텍스 쉐이더는 위젯의 버텍스 쉐이더를 사용한다.*/
 
 struct VertexOut
 {
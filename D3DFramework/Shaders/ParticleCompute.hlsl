@@ -22,41 +22,41 @@ void CS_Emit(uint3 gropuThreadID : SV_GroupThreadID, uint3 groupID : SV_GroupID)
 	{
 		ParticleData p = (ParticleData)0.0f;
 
-		//   ƼŬ ε Ѵ.
+		// 현재 생성할 파티클 인덱스를 계산한다.
 		uint index = gCounter[1] + myID;
 		if (gMaxParticleNum <= index)
 		{
 			index -= gMaxParticleNum;
 		}
 
-		// ƼŬ  ϰ Ѵ.
+		// 파티클의 방향은 랜덤하게 조정한다.
 		float3 randVec = float3(rand(float2(myID, index)), rand(float2(index, myID)), rand(float2(myID - index, index - myID)));
 		p.direction = normalize(reflect(direction[gropuThreadID.x], randVec));
 
-		// ƼŬ  ġ ƼŬ ü ߽ ġ̴.
+		// 파티클의 스폰 위치는 파티클 객체의 중심 위치이다.
 		p.position = gEmitterLocation;
 
-		// start ͸ ̿Ͽ ƼŬ ͸ Ѵ.
+		// start 데이터를 이용하여 파티클 데이터를 설정한다.
 		p.lifeTime = gStart.lifeTime;
 		p.color = gStart.color;
 		p.speed = gStart.speed;
 		p.size = gStart.size;
 
-		// ش ƼŬ ͸ ȰȭѴ.
+		// 해당 파티클 데이터를 활성화한다.
 		p.isActive = true;
 
-		// ȭ Լ Ͽ ī͸ Ų.
+		// 동기화 함수를 사용하여 카운터를 증가시킨다.
 		InterlockedAdd(gCounter[0], 1);
 
 		gParticles[index] = p;
 	}
 
-	// ׷ 尡 ⿡   ٸ.
+	// 그룹 스레드가 여기에 도달할 때까지 기다린다.
 	GroupMemoryBarrierWithGroupSync();
 
 	if (myID == 0)
 	{
-		//   ƼŬ ε Ѵ.
+		// 새로 갱신할 파티클 인덱스를 계산한다.
 		if (gMaxParticleNum <= gCounter[1] + gEmitNum)
 		{
 			gCounter[1] += gEmitNum - gMaxParticleNum;
@@ -80,16 +80,16 @@ void CS_Update(uint3 dispatchThreadID : SV_DispatchThreadID)
 		{
 			if (gParticles[myID].lifeTime < 0.0f)
 			{
-				//    ƼŬ ȰȭѴ.
+				// 수명이 다 된 파티클은 비활성화한다.
 				gParticles[myID].isActive = false;
 				InterlockedAdd(gCounter[0], -1);
 			}
 			else
 			{
-				//  ðŭ  δ.
+				// 지난 시간만큼 수명을 줄인다.
 				gParticles[myID].lifeTime -= gDeltaTime;
 
-				// ƼŬ ͸ ð  ƮѴ.
+				// 파티클 데이터를 시간에 따라 업데이트한다.
 				float period = saturate(gParticles[myID].lifeTime / gStart.lifeTime);
 				gParticles[myID].color = lerp(gEnd.color, gStart.color, period);
 				gParticles[myID].speed = lerp(gEnd.speed, gStart.speed, period);
@@ -98,7 +98,7 @@ void CS_Update(uint3 dispatchThreadID : SV_DispatchThreadID)
 
 				if (gEnabledGravity == 1)
 				{
-					// ƼŬ Ϳ ߷ Ѵ.
+					// 파티클 데이터에 중력을 적용한다.
 					gParticles[myID].position.y -= GA * gDeltaTime;
 				}
 			}
@@ -53,19 +53,19 @@ void GS(point VertexOut gin[1],
 	if (gin[0].isActive == false)
 		return;
 
-	// 尡 xz 鿡 پ y   ¿ ī޶
-	// ׻ ϰ       ǥ踦 Ѵ.
+	// 빌보드가 xz 평면에 붙어서 y 방향으로 세워진 상태에서 카메라를
+	// 항상 향하게 만드는 세계 공간 기준 빌보드 지역 좌표계를 계산한다.
 	float3 centerV = mul(float4(gin[0].posW, 1.0f), gView).xyz;
 	float3 up = float3(0.0f, 1.0f, 0.0f);
 	float3 look = gEyePosW - gin[0].posW;
 	look = normalize(look);
 	float3 right = cross(up, look);
 
-	//    ﰢ  (簢 ϴ) Ѵ.
+	// 세계 공간 기준의 삼각형 띠 정점들(사각형을 구성하는)을 계산한다.
 	float halfWidth = 0.5f * gin[0].size.x;
 	float halfHeight = 0.5f * gin[0].size.y;
 
-	//    ǥ Ѵ.
+	// 각 정점의 월드 좌표를 계산한다.
 	float4 v[4];
 	v[0] = float4(gin[0].posW + halfWidth * right - halfHeight * up, 1.0f);
 	v[1] = float4(gin[0].posW + halfWidth * right + halfHeight * up, 1.0f);
@@ -14,33 +14,37 @@ struct VertexOut
 {
 	float4 posH    : SV_POSITION;
 	float2 texC    : TEXCOORD;
+	nointerpolation uint materialIndex : MATERIAL;
 };
 
-VertexOut VS(VertexIn vin)
+VertexOut VS(VertexIn vin, uint instanceID : SV_InstanceID)
 {
 	VertexOut vout = (VertexOut)0.0f;
 
-	//   ȯѴ.
-	float4 posW = mul(float4(vin.posL, 1.0f), gObjWorld);
+	ObjectData objData = GetInstanceData(instanceID);
+	vout.materialIndex = objData.materialIndex;
 
-	//    ȯѴ.
+	// 세계 공간으로 변환한다.
+	float4 posW = mul(float4(vin.posL, 1.0f), objData.world);
+
+	// 동차 절단 공간으로 변환한다.
 	vout.posH = mul(posW, gViewProj);
 
-	//   Ư  ﰢ  ȴ.
-	vout.texC = mul(float4(vin.texC, 0.0f, 1.0f), GetMaterialTransform(gObjMaterialIndex)).xy;
+	// 출력 정점 특성들은 이후 삼각형을 따라 보간된다.
+	vout.texC = mul(float4(vin.texC, 0.0f, 1.0f), GetMaterialTransform(objData.materialIndex)).xy;
 
 	return vout;
 }
 
 void PS(VertexOut pin)
 {
-	//  ȼ  ͸ ͸ ´.
-	MaterialData materialData = gMaterialData[gObjMaterialIndex];
+	// 이 픽셀에 사용할 머터리얼 데이터를 가져온다.
+	MaterialData materialData = gMaterialData[pin.materialIndex];
 
 	float4 diffuse = materialData.diffuseAlbedo;
 	uint diffuseMapIndex = materialData.diffuseMapIndex;
 
-	// ؽó 迭 ؽó  ȸѴ.
+	// 텍스처 배열의 텍스처를 동적으로 조회한다.
 	if (diffuseMapIndex != DISABLED)
 	{
 		diffuse *= gTextureMaps[diffuseMapIndex].Sample(gsamAnisotropicWrap, pin.texC);
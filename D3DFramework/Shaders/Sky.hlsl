@@ -15,21 +15,25 @@ struct VertexOut
 	float4 posH : SV_POSITION;
 	float3 posW : POSITION;
 	float2 texC : TEXCOORD;
+	nointerpolation uint materialIndex : MATERIAL;
 };
 
-VertexOut VS(VertexIn vin)
+VertexOut VS(VertexIn vin, uint instanceID : SV_InstanceID)
 {
 	VertexOut vout = (VertexOut)0.0f;
 
-	// World Space ȯѴ.
-	float4 posW = mul(float4(vin.posL, 1.0f), gObjWorld);
+	ObjectData objData = GetInstanceData(instanceID);
+	vout.materialIndex = objData.materialIndex;
+
+	// World Space로 변환한다.
+	float4 posW = mul(float4(vin.posL, 1.0f), objData.world);
 	vout.posW = posW.xyz;
 
-	// z = w̸ ش ȼ ׻ far plane ġִ.
+	// z = w이면 해당 픽셀은 항상 far plane에 위치해있다.
 	vout.posH = mul(posW, gViewProj).xyww;
 
-	//   Ư  ﰢ  ȴ.
-	vout.texC = mul(float4(vin.texC, 0.0f, 1.0f), GetMaterialTransform(gObjMaterialIndex)).xy;
+	// 출력 정점 특성들은 이후 삼각형을 따라 보간된다.
+	vout.texC = mul(float4(vin.texC, 0.0f, 1.0f), GetMaterialTransform(objData.materialIndex)).xy;
 
 	return vout;
 }
@@ -37,27 +41,27 @@ VertexOut VS(VertexIn vin)
 [earlydepthstencil]
 float4 PS(VertexOut pin) : SV_Target
 {
-	uint diffuseMapIndex = gMaterialData[gObjMaterialIndex].diffuseMapIndex;
+	uint diffuseMapIndex = gMaterialData[pin.materialIndex].diffuseMapIndex;
 	float diffuseIntensity = 1.0f;
 
-	// ؽó 迭 ؽó  ȸѴ.
+	// 텍스처 배열의 텍스처를 동적으로 조회한다.
 	if (diffuseMapIndex != DISABLED)
 	{
-		// ؽó R   κи ϵ Ѵ.
+		// 텍스처의 R값만을 가져와 구름 부분만을 렌더링하도록 한다.
 		diffuseIntensity = gTextureMaps[diffuseMapIndex].Sample(gsamAnisotropicWrap, pin.texC).r;
 	}
 
-	// ϴ ̴ [0, 1]̷ ȭѴ.
+	// 하늘의 높이는 [0, 1]사이로 정규화한다.
 	float height = pin.posW.y / gSkyScale;
 	if (height < 0.0f)
 	{
-		//  Ʒ Ī· ȴ.
+		// 위와 아래는 대칭형태로 렌더링된다.
 		height *= -1.0f;
 	}
 	
-	// ̿   κа ߽ κ  ´.
+	// 높이에 따라 꼭대기 부분과 중심 부분의 색을 섞는다.
 	float4 skyColor = lerp(gTopColor, gCenterColor, height);
-	// ϴÿ  Ѵ.
+	// 하늘에 구름을 렌더링한다.
 	float4 outColor = skyColor + diffuseIntensity;
 
 	return outColor;
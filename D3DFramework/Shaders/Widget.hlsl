@@ -27,19 +27,19 @@ float4 PS(VertexOut pin) : SV_Target
 	if (gObjMaterialIndex == DISABLED)
 		return float4(0.0f, 0.0f, 0.0f, 1.0f);
 
-	//  ȼ  Material Data ´.
+	// 이 픽셀에 사용할 Material Data를 가져온다.
 	MaterialData matData = gMaterialData[gObjMaterialIndex];
 
 	float4 diffuseAlbedo = matData.diffuseAlbedo;
 	uint diffuseMapIndex = matData.diffuseMapIndex;
 
-	// ؽó 迭 ؽó  ȸѴ.
+	// 텍스처 배열의 텍스처를 동적으로 조회한다.
 	if (diffuseMapIndex != DISABLED)
 	{
 		diffuseAlbedo *= gTextureMaps[diffuseMapIndex].Sample(gsamLinearWrap, pin.texC);
 	}
 
-	// ؽó İ 0.1  ȼ Ѵ. 
+	// 텍스처 알파가 0.1보다 작으면 픽셀을 폐기한다. 
 	clip(diffuseAlbedo.a - 0.1f);
 
 	return diffuseAlbedo;
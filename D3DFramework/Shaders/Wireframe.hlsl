@@ -12,11 +12,11 @@ struct VertexOut
 	float4 color: COLOR;
 };
 
-VertexOut VS(VertexIn vin)
+VertexOut VS(VertexIn vin, uint instanceID : SV_InstanceID)
 {
 	VertexOut vout = (VertexOut)0.0f;
 
-	float4 posW = mul(float4(vin.posL, 1.0f), gObjWorld);
+	float4 posW = mul(float4(vin.posL, 1.0f), GetInstanceData(instanceID).world);
 	vout.posH = mul(posW, gViewProj);
 
 	vout.color = vin.color;
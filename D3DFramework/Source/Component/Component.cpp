@@ -1,5 +1,6 @@
 #include "../PrecompiledHeader/pch.h"
 #include "Component.h"
+#include "../Framework/DeferredCommands.h"
 
 Component::Component(std::string&& name) : mName(std::move(name)) 
 {
@@ -49,4 +50,9 @@ std::string Component::GetName() const
 UINT64 Component::GetUID() const
 {
 	return uid; 
-}
\ No newline at end of file
+}
+
+void Component::Defer(std::function<void()>&& command) const
+{
+	DeferredCommands::GetInstance()->Push(uid, std::move(command));
+}
@@ -8,9 +8,10 @@
 #include <wrl.h>
 #include <memory>
 #include <string>
+#include <functional>
 
 /*
-ӿũ Ǵ ü  Ǵ Ŭ
+프레임워크에 사용되는 객체들의 기반이 되는 클래스
 */
 class Component
 {
@@ -19,44 +20,48 @@ public:
 	virtual ~Component();
 
 public:
-	// UID  ü  Ȯ
+	// UID로 두 객체가 같은지 확인
 	bool operator==(const Component& rhs);
-	// ̸  ü  Ȯ
+	// 이름으로 두 객체가 같은지 확인
 	bool operator==(const std::string& str);
-	// UID ̸  string ȯѴ.
+	// UID와 이름을 합쳐 string으로 반환한다.
 	std::string ToString() const;
 
 public:
-	// ü  ,  ൿ Ѵ.
+	// 객체를 시작할 때, 할 행동으 정의한다.
 	virtual void BeginPlay() { };
-	//   ü  ൿ Ѵ.
+	// 매 프레임 객체가 할 행동을 정의한다.
+	// 여러 객체의 Tick이 병렬로 실행되므로 자신 외의 상태를 바꾸는 작업은 Defer로 미룬다.
 	virtual void Tick(float deltaTime) { };
-	// ü ı , ൿ Ѵ.
+	// 객체가 파괴될 때, 행동을 정의한다.
 	virtual void Destroy() { };
 
 public:
-	// ش ü ƮǾ ȮѴ.
+	// 해당 객체가 업데이트되었는지 확인한다.
 	bool IsUpdate() const;
-	// ش ü NUM_FRAME_RESOURCESŭ ƮѴ. 
+	// 해당 객체를 NUM_FRAME_RESOURCES값만큼 업데이트한다. 
 	void UpdateNumFrames();
-	// frame 1ν    ǥѴ.
+	// frame값을 1줄임으로써 프레임이 지나간 것을 표현한다.
 	void DecreaseNumFrames();
 
 	std::string GetName() const;
 	UINT64 GetUID() const;
 
+	// 병렬 Tick 도중 다른 객체를 수정하는 작업은 병렬 구간이 끝난 뒤 실행되도록 미룬다.
+	void Defer(std::function<void()>&& command) const;
+
 private:
 	static inline UINT64 currUID = 0;
 
 private:
 	std::string mName;
 
-	// ü Ǻϱ   ID
+	// 객체를 판별하기 위한 유일한 ID값
 	UINT64 uid;
 
-	//  ؼ ش  ۸ ؾ ϴ θ Ÿ  ÷
-	// FrameResource ü  ۰ Ƿ, FrameResouce  ؾ Ѵ.
-	// , ü ڷḦ   ݵ mNumFramesDiry = NUM_FRAME_RESOURCES
-	// ؾ Ѵ.
+	// 재질이 변해서 해당 상수 버퍼를 갱신해야 하는지의 여부를 나타내는 더러움 플래그
+	// FrameResource마다 물체의 상수 버퍼가 있으므로, FrameResouce마다 갱신을 적용해야 한다.
+	// 따라서, 물체의 자료를 수정할 때에는 반드시 mNumFramesDiry = NUM_FRAME_RESOURCES을
+	// 적용해야 한다.
 	INT32 mNumFramesDirty = NUM_FRAME_RESOURCES;
 };
\ No newline at end of file
@@ -8,17 +8,17 @@ Mesh::~Mesh() { }
 void Mesh::BuildVertices(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
 	void* vertices, const UINT32 vertexCount, const UINT32 vertexStride)
 {
-	//   ũ⸦ Ѵ.
+	// 복사할 데이터 크기를 계산한다.
 	const UINT32 vbByteSize = vertexCount * vertexStride;
 
-	//   ũ⸸ŭ Ѵ.
+	// 정점들을 데이터 크기만큼 복사한다.
 	ThrowIfFailed(D3DCreateBlob(vbByteSize, &vertexBufferCPU));
 	CopyMemory(vertexBufferCPU->GetBufferPointer(), vertices, vbByteSize);
 
-	// ε ۸ Ͽ  ۿ ͸ Ѵ.
+	// 업로드 버퍼를 통하여 정점 버퍼에 데이터를 복사한다.
 	vertexBufferGPU = D3DUtil::CreateDefaultBuffer(device, commandList, vertices, vbByteSize, vertexBufferUploader);
 
-	//  並 Ѵ.
+	// 서술자 뷰를 정의한다.
 	vertexBufferView.BufferLocation = vertexBufferGPU->GetGPUVirtualAddress();
 	vertexBufferView.StrideInBytes = vertexStride;
 	vertexBufferView.SizeInBytes = vbByteSize;
@@ -28,17 +28,17 @@ void Mesh::BuildVertices(ID3D12Device* device, ID3D12GraphicsCommandList* comman
 void Mesh::BuildIndices(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
 	 UINT16* indices, const UINT32 indexCount, const UINT32 indexStride)
 {
-	//   ũ⸦ Ѵ.
+	// 복사할 데이터 크기를 계산한다.
 	const UINT32 ibByteSize = indexCount * indexStride;
 
-	// ε  ũ⸸ŭ Ѵ.
+	// 인덱스들을 데이터 크기만큼 복사한다.
 	ThrowIfFailed(D3DCreateBlob(ibByteSize, &indexBufferCPU));
 	CopyMemory(indexBufferCPU->GetBufferPointer(), indices, ibByteSize);
 
-	// ε ۸ Ͽ ε ۿ ͸ Ѵ.
+	// 업로드 버퍼를 통하여 인덱스 버퍼에 데이터를 복사한다.
 	indexBufferGPU = D3DUtil::CreateDefaultBuffer(device, commandList, indices, ibByteSize, indexBufferUploader);
 
-	//  並 Ѵ.
+	// 서술자 뷰를 정의한다.
 	indexBufferView.BufferLocation = indexBufferGPU->GetGPUVirtualAddress();
 	indexBufferView.Format = DXGI_FORMAT_R16_UINT;
 	indexBufferView.SizeInBytes = ibByteSize;
@@ -47,7 +47,7 @@ void Mesh::BuildIndices(ID3D12Device* device, ID3D12GraphicsCommandList* command
 
 void Mesh::BuildCollisionBound(XMFLOAT3* points, const UINT32 vertexCount, const UINT32 stride, const CollisionType type)
 {
-	// 浹 ŸԿ  浹 ٿ带 Ѵ.
+	// 충돌 타입에 따라 충돌 바운드를 생성한다.
 	collisionType = type;
 	switch (collisionType)
 	{
@@ -79,8 +79,8 @@ void Mesh::SetDynamicVertexBuffer(ID3D12Resource* vb, const UINT32 vertexCount,
 {
 	const UINT32 vbByteSize = vertexCount * vertexStride;
 
-	//   ۷μ   並 Ѵ.
-	//   ۴  ڿ Ѵ.
+	// 동적 정점 버퍼로서 사용할 서술자 뷰를 정의한다.
+	// 실제 정점 버퍼는 프레임 자원에 존재한다.
 	vertexBufferGPU = vb;
 	vertexBufferView.BufferLocation = vertexBufferGPU->GetGPUVirtualAddress();
 	vertexBufferView.StrideInBytes = vertexStride;
@@ -122,7 +122,7 @@ void Mesh::Render(ID3D12GraphicsCommandList* commandList, const UINT32 instanceC
 
 void Mesh::DisposeUploaders()
 {
-	// ε  ޸𸮸 Ѵ.
+	// 업로드 버퍼의 메모리를 해제한다.
 	vertexBufferUploader = nullptr;
 	indexBufferUploader = nullptr;
 }
@@ -165,4 +165,44 @@ CollisionType Mesh::GetCollisionType() const
 std::any Mesh::GetCollisionBounding() const
 {
 	return collisionBounding; 
-}
\ No newline at end of file
+}
+
+UINT32 Mesh::GetVertexCount() const
+{
+	return vertexCount;
+}
+
+UINT32 Mesh::GetIndexCount() const
+{
+	return indexCount;
+}
+
+UINT32 Mesh::GetVertexStride() const
+{
+	return vertexCount > 0 ? vertexBufferView.StrideInBytes : 0;
+}
+
+D3D12_PRIMITIVE_TOPOLOGY Mesh::GetPrimitiveType() const
+{
+	return primitiveType;
+}
+
+const D3D12_VERTEX_BUFFER_VIEW& Mesh::GetVertexBufferView() const
+{
+	return vertexBufferView;
+}
+
+const D3D12_INDEX_BUFFER_VIEW& Mesh::GetIndexBufferView() const
+{
+	return indexBufferView;
+}
+
+const void* Mesh::GetVertexData() const
+{
+	return vertexBufferCPU ? vertexBufferCPU->GetBufferPointer() : nullptr;
+}
+
+const UINT16* Mesh::GetIndexData() const
+{
+	return indexBufferCPU ? static_cast<const UINT16*>(indexBufferCPU->GetBufferPointer()) : nullptr;
+}
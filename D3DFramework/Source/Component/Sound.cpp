@@ -12,7 +12,7 @@ Sound::~Sound()
 
 void Sound::CreateSoundBuffer2D(IDirectSound8* d3dSound, FILE* waveFile, const WaveHeaderType& waveFileHeader)
 {
-	// ̺  Ѵ.
+	// 웨이브 포맷을 정의한다.
 	WAVEFORMATEX waveFormat;
 	waveFormat.wFormatTag = waveFileHeader.audioFormat;
 	waveFormat.nSamplesPerSec = waveFileHeader.sampleRate;
@@ -22,7 +22,7 @@ void Sound::CreateSoundBuffer2D(IDirectSound8* d3dSound, FILE* waveFile, const W
 	waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
 	waveFormat.cbSize = 0;
 
-	//  ڸ Ѵ.
+	// 버퍼 서술자를 정의한다.
 	DSBUFFERDESC bufferDesc;
 	bufferDesc.dwSize = sizeof(DSBUFFERDESC);
 	bufferDesc.dwFlags = DSBCAPS_CTRLFREQUENCY | DSBCAPS_CTRLPAN | DSBCAPS_CTRLVOLUME | DSBCAPS_LOCSOFTWARE | DSBCAPS_STATIC;
@@ -31,19 +31,19 @@ void Sound::CreateSoundBuffer2D(IDirectSound8* d3dSound, FILE* waveFile, const W
 	bufferDesc.lpwfxFormat = &waveFormat;
 	bufferDesc.guid3DAlgorithm = GUID_NULL;
 
-	//  ۸ Ѵ.
+	// 사운드 버퍼를 생성한다.
 	IDirectSoundBuffer* tempBuffer = nullptr;
 	ThrowIfFailed(d3dSound->CreateSoundBuffer(&bufferDesc, &tempBuffer, NULL));
 	tempBuffer->QueryInterface(IID_IDirectSoundBuffer8, (void**)soundBuffer.GetAddressOf());
 	tempBuffer->Release();
 
-	// ε  ͸ Ѵ.
+	// 로드한 사운드 데이터를 복사한다.
 	unsigned char* waveData = new unsigned char[waveFileHeader.dataSize];
 	fseek(waveFile, sizeof(WaveHeaderType), SEEK_SET);
 	fread(waveData, 1, waveFileHeader.dataSize, waveFile);
 	fclose(waveFile);
 
-	// gpu  ͸ Ѵ.
+	// gpu로 사운드 데이터를 복사한다.
 	unsigned char* bufferPtr = nullptr;
 	unsigned long bufferSize = 0;
 	ThrowIfFailed(soundBuffer->Lock(0, waveFileHeader.dataSize, (void**)&bufferPtr, (DWORD*)&bufferSize, NULL, 0, 0));
@@ -52,14 +52,14 @@ void Sound::CreateSoundBuffer2D(IDirectSound8* d3dSound, FILE* waveFile, const W
 
 	soundBuffer->SetFormat(&waveFormat);
 
-	//  ʹ ̻ ʿ Ƿ Ѵ.
+	// 복사한 데이터는 더이상 필요 없으므로 삭제한다.
 	delete[] waveData;
 	waveData = 0;
 }
 
 void Sound::CreateSoundBuffer3D(IDirectSound8* d3dSound, FILE* waveFile, const WaveHeaderType& waveFileHeader)
 {
-	// ̺  Ѵ.
+	// 웨이브 포맷을 정의한다.
 	WAVEFORMATEX waveFormat;
 	waveFormat.wFormatTag = waveFileHeader.audioFormat;
 	waveFormat.nSamplesPerSec = waveFileHeader.sampleRate;
@@ -69,7 +69,7 @@ void Sound::CreateSoundBuffer3D(IDirectSound8* d3dSound, FILE* waveFile, const W
 	waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
 	waveFormat.cbSize = 0;
 
-	//  ڸ Ѵ.
+	// 버퍼 서술자를 정의한다.
 	DSBUFFERDESC bufferDesc;
 	bufferDesc.dwSize = sizeof(DSBUFFERDESC);
 	bufferDesc.dwFlags = DSBCAPS_CTRLFREQUENCY | DSBCAPS_CTRL3D | DSBCAPS_CTRLVOLUME | DSBCAPS_LOCSOFTWARE | DSBCAPS_STATIC;
@@ -78,30 +78,30 @@ void Sound::CreateSoundBuffer3D(IDirectSound8* d3dSound, FILE* waveFile, const W
 	bufferDesc.lpwfxFormat = &waveFormat;
 	bufferDesc.guid3DAlgorithm = GUID_NULL;
 
-	//  ۸ Ѵ.
+	// 사운드 버퍼를 생성한다.
 	IDirectSoundBuffer* tempBuffer = nullptr;
 	ThrowIfFailed(d3dSound->CreateSoundBuffer(&bufferDesc, &tempBuffer, NULL));
 	tempBuffer->QueryInterface(IID_IDirectSoundBuffer8, (void**)soundBuffer.GetAddressOf());
 	tempBuffer->Release();
 
-	// ε  ͸ Ѵ.
+	// 로드한 사운드 데이터를 복사한다.
 	unsigned char* waveData = new unsigned char[waveFileHeader.dataSize];
 	fseek(waveFile, sizeof(WaveHeaderType), SEEK_SET);
 	fread(waveData, 1, waveFileHeader.dataSize, waveFile);
 	fclose(waveFile);
 
-	// gpu  ͸ Ѵ.
+	// gpu로 사운드 데이터를 복사한다.
 	unsigned char* bufferPtr = nullptr;
 	unsigned long bufferSize = 0;
 	ThrowIfFailed(soundBuffer->Lock(0, waveFileHeader.dataSize, (void**)&bufferPtr, (DWORD*)&bufferSize, NULL, 0, 0));
 	memcpy(bufferPtr, waveData, waveFileHeader.dataSize);
 	ThrowIfFailed(soundBuffer->Unlock((void*)bufferPtr, bufferSize, NULL, 0));
 
-	// 3D Ư ۰ ʿϹǷ ٸ 3D ۸ Ѵ.
+	// 3D는 특수한 버퍼가 필요하므로 다른 3D 버퍼를 생성한다.
 	soundBuffer->SetFormat(&waveFormat);
 	ThrowIfFailed(soundBuffer->QueryInterface(IID_IDirectSound3DBuffer8, (void**)sound3dBuffer.GetAddressOf()));
 
-	//  ʹ ̻ ʿ Ƿ Ѵ.
+	// 복사한 데이터는 더이상 필요 없으므로 삭제한다.
 	delete[] waveData;
 	waveData = 0;
 }
@@ -143,7 +143,7 @@ void Sound::SetBound(const float min, const float max)
 void Sound::SetVolume(const UINT32 volume)
 {
 	this->volume = volume;
-	// [0, 100]  DirectSound   ֵ [-10000, 0] ȯѴ.
+	// [0, 100]인 볼륨을 DirectSound에서 사용할 수 있도록 [-10000, 0]으로 변환한다.
 	LONG dsbVolume = (LONG)(((float(volume) / 100.0f) - 1.0f) * DSBVOLUME_MIN);
 	soundBuffer->SetVolume(dsbVolume);
 }
@@ -151,7 +151,7 @@ void Sound::SetVolume(const UINT32 volume)
 void Sound::SetPan(const float pan)
 {
 	this->pan = pan;
-	// [-1, 1] Pan DirectSound   ֵ [-10000, 10000] ȯѴ.
+	// [-1, 1]인 Pan을 DirectSound에서 사용할 수 있도록 [-10000, 10000]으로 변환한다.
 	LONG dsbpPan = (LONG)(pan * 10000.0f);
 	soundBuffer->SetPan(dsbpPan);
 }
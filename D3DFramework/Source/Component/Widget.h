@@ -7,8 +7,8 @@ class Material;
 class Mesh;
 
 /*
-ȭ   ʿ ׷ 簢 ޽
-   ׷Ƿ ׻ δ.
+화면 상에 가장 앞쪽에 그려지는 사각형 메쉬
+렌더링에서 가장 마지막에 그려지므로 항상 보인다.
 */
 class Widget : public Component, public Renderable
 {
@@ -1,5 +1,6 @@
 #include "../PrecompiledHeader/pch.h"
 #include "Animation.h"
+#include "FrameAllocator.h"
 
 float BoneAnimation::GetStartTime()const
 {
@@ -13,8 +14,8 @@ float BoneAnimation::GetEndTime()const
 
 void BoneAnimation::Interpolate(const float t, XMFLOAT4X4& M)const
 {
-	//  ð ù ° Ű  ð ۴ٸ
-	//  ó Ű  Ѵ.
+	// 현재 시간이 첫 번째의 키 프레임 시간보다 작다면
+	// 가장 처음 키 프레임을 사용한다.
 	if (t <= keyframes.front().timePos)
 	{
 		XMVECTOR S = XMLoadFloat3(&keyframes.front().scale);
@@ -24,8 +25,8 @@ void BoneAnimation::Interpolate(const float t, XMFLOAT4X4& M)const
 		XMVECTOR zero = XMVectorSet(0.0f, 0.0f, 0.0f, 1.0f);
 		XMStoreFloat4x4(&M, XMMatrixAffineTransformation(S, zero, Q, P));
 	}
-	//  ð   ð ũٸ
-	//   Ű  Ѵ.
+	// 현재 시간이 마지막 프레임 시간보다 크다면
+	// 가장 마지막 키 프레임을 사용한다.
 	else if (t >= keyframes.back().timePos)
 	{
 		XMVECTOR S = XMLoadFloat3(&keyframes.back().scale);
@@ -37,8 +38,8 @@ void BoneAnimation::Interpolate(const float t, XMFLOAT4X4& M)const
 	}
 	else
 	{
-		//  ð ù ° Ű Ӱ  Ű  ̿ ġѴ.
-		//   ̿ ġϴ  ã Ѵ.
+		// 현재 시간은 첫 번째 키 프레임과 마지막 키 프레임 사이에 위치한다.
+		// 따라서 그 사이에 위치하는 프레임을 찾아 보간한다.
 		for (UINT i = 0; i < keyframes.size() - 1; ++i)
 		{
 			if (t >= keyframes[i].timePos && t <= keyframes[i + 1].timePos)
@@ -89,7 +90,7 @@ float AnimationClip::GetEndTime()const
 	return t;
 }
 
-void AnimationClip::Interpolate(float t, std::vector<XMFLOAT4X4>& boneTransforms)const
+void AnimationClip::Interpolate(float t, std::span<XMFLOAT4X4> boneTransforms)const
 {
 	for (UINT i = 0; i < boneAnimations.size(); ++i)
 	{
@@ -127,20 +128,21 @@ void SkinnedData::GetFinalTransforms(const std::string& clipName, float timePos,
 {
 	UINT numBones = (UINT)boneOffsets.size();
 
-	std::vector<XMFLOAT4X4> toParentTransforms(numBones);
+	// 중간 변환들은 이 함수 안에서만 사용하므로 프레임 할당자에서 얻는다.
+	XMFLOAT4X4* toParentTransforms = FrameAllocator::GetInstance()->Allocate<XMFLOAT4X4>(numBones);
 
-	//  Ŭ  븦 ־ ð() ° Ѵ.
+	// 이 클립의 모든 뼈대를 주어진 시간(순간)에 맞게 보간한다.
 	auto clip = animations.find(clipName);
-	clip->second.Interpolate(timePos, toParentTransforms);
+	clip->second.Interpolate(timePos, std::span<XMFLOAT4X4>(toParentTransforms, numBones));
 
-	//  뱸 鼭  븦 Ѹ  ȯѴ.
-	std::vector<XMFLOAT4X4> toRootTransforms(numBones);
+	// 골격 계통구조를 훑으면서 모든 뼈대를 뿌리 공간으로 변환한다.
+	XMFLOAT4X4* toRootTransforms = FrameAllocator::GetInstance()->Allocate<XMFLOAT4X4>(numBones);
 
-	// Ѹ ε 0̴. Ѹ 뿡 θ Ƿ
-	// Ѹ  Ѹ ȯ ׳ ڽ   ȯ̴.
+	// 뿌리의 인덱스는 0이다. 뿌리 뼈대에는 부모가 없으므로
+	// 뿌리 뼈대의 뿌리 변환은 그냥 자신의 국소 뼈대 변환이다.
 	toRootTransforms[0] = toParentTransforms[0];
 
-	//  ڽ  Ѹ ȯ Ѵ.
+	// 이제 자식 뺘대들의 뿌리 변환들을 구한다.
 	for (UINT i = 1; i < numBones; ++i)
 	{
 		int parentIndex = boneHierarchy[i];
@@ -152,7 +154,7 @@ void SkinnedData::GetFinalTransforms(const std::string& clipName, float timePos,
 		XMStoreFloat4x4(&toRootTransforms[i], toRoot);
 	}
 
-	//   ȯ  ؼ  ȯ Ѵ.
+	// 뼈대 오프셋 변환을 먼저 곱해서 최종 변환을 구한다.
 	for (UINT i = 0; i < numBones; ++i)
 	{
 		XMMATRIX offset = XMLoadFloat4x4(&boneOffsets[i]);
@@ -2,77 +2,78 @@
 
 #include "Vector.h"
 #include <vector>
+#include <span>
 #include <unordered_map>
 
 /*
-ִϸ̼ǿ  Ӹ ǵǴ ̴.
- ִϸ̼ Ű ӵ Ͽ ִϸ̼ Ѵ.
+애니메이션에서 각 프레임마다 정의되는 정보이다.
+뼈대 애니메이션이 키 프레임들을 보간하여 애니메이션을 수행한다.
 */
 struct Keyframe
 {
-	// ش  ġ Ű ð̴.
+	// 해당 프레임 위치를 가리키는 시간이다.
 	float timePos = 0.0f;
 
-	// ش ӿ ̴.
+	// 해당 프레임에서의 정보이다.
 	XMFLOAT3 translation = { 0.0f, 0.0f, 0.0f };
 	XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
 	XMFLOAT4 rotationQuat = { 0.0f, 0.0f, 0.0f, 1.0f };
 };
 
 /*
-ϳ  ִϸ̼ Ѵ.
-   Ű  
-Ű ӵ ̷ Ͽ 븦 ִϸ̼Ѵ.
+하나의 뼈대 애니메이션을 정의한다.
+뼈대는 여러 개의 키 프레임을 가지고
+키 프레임들 사이로 보간하여 뼈대를 애니메이션한다.
 */
 struct BoneAnimation
 {
 	float GetStartTime()const;
 	float GetEndTime()const;
 
-	//   ̸ Ѵ.
+	// 각 프레임 사이를 보간한다.
 	void Interpolate(const float t, DirectX::XMFLOAT4X4& M)const;
 
-	// Ű ӿ   迭 Ƶд.
+	// 키 프레임에 관한 정보를 동적배열로 담아둔다.
 	std::vector<Keyframe> keyframes;
 };
 
 /*
-   ִϸ̼ Ѵ.
-ϳ ĳͰ    ִϸ̼ 
-ִ  ó  븦  ü ϴ.
+여러 개의 뼈대 애니메이션을 정의한다.
+하나의 캐릭터가 여러 개의 뼈대 애니메이션을 가지고
+있는 것 처럼 여러 뼈대를 가진 객체에 유용하다.
 */
 struct AnimationClip
 {
 	float GetStartTime()const;
 	float GetEndTime()const;
 
-	//   ̸ Ѵ.
-	void Interpolate(float t, std::vector<DirectX::XMFLOAT4X4>& boneTransforms)const;
+	// 각 프레임 사이를 보간한다. boneTransforms는 뼈대의 개수만큼의 크기를 가져야 한다.
+	void Interpolate(float t, std::span<DirectX::XMFLOAT4X4> boneTransforms)const;
 
-	//  ִϸ̼ǿ   迭 Ƶд.
+	// 뼈대 애니메이션에 관한 정보를 동적배열로 담아둔다.
 	std::vector<BoneAnimation> boneAnimations;
 };
 
 /*
-ĳ͸ ִϸ̼ϱ Ͽ ʿ ִϸ̼   Ƶд.
-Ű׿ ʿ ĵ Ͽ  ۿ Ѱ־ Ѵ.
+캐릭터를 애니메이션하기 위하여 필요한 애니메이션 및 행렬을 담아둔다.
+스키닝에 필요한 행렬들을 계산하여 상수 버퍼에 넘겨주어야 한다.
 */
 class SkinnedData
 {
 public:
-	//      ȯѴ.
+	// 뼈대의 계층구조의 수가 몇 개인지 반환한다.
 	UINT32 GetBoneCount() const;
 
 	float GetStartTime(const std::string& clipName) const;
 	float GetEndTime(const std::string& clipName) const;
 
-	//   ,  , ִϸ̼ǵ Ѵ.
+	// 각 뼈대 계층구조, 뼈대 오프셋, 애니메이션들을 설정한다.
 	void Set(std::vector<int>& boneHierarchy,
 		std::vector<DirectX::XMFLOAT4X4>& boneOffsets,
 		std::unordered_map<std::string, AnimationClip>& animations);
 
-	//    ִϸ̼ Ͽ Ű׿ 
-	// ĵ Ѵ.
+	// 설정된 뼈대 정보와 애니메이션을 사용하여 스키닝에 사용할
+	// 행렬들을 계산한다.
 	void GetFinalTransforms(const std::string& clipName, float timePos,
 		std::vector<DirectX::XMFLOAT4X4>& finalTransforms) const;
 
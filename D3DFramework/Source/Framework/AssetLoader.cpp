@@ -10,7 +10,7 @@ bool AssetLoader::LoadH3d(ID3D12Device* device, ID3D12GraphicsCommandList* comma
 
 	fin.open(fileName);
 
-	//  ų ̸ ߸  Ѵ.
+	// 파일이 없거나 이름이 잘못된 경우 실패한다.
 	if (fin.fail())
 	{
 #if defined(DEBUG) || defined(_DEBUG)
@@ -25,7 +25,7 @@ bool AssetLoader::LoadH3d(ID3D12Device* device, ID3D12GraphicsCommandList* comma
 
 	for (UINT i = 0; i < vertexCount; ++i)
 	{
-		// h3dϿ Vertex   о´.
+		// h3d파일에서 Vertex에 관한 정보를 읽어온다.
 		Vertex v;
 		fin >> v.pos.x >> v.pos.y >> v.pos.z >> input;
 		fin >> v.normal.x >> v.normal.y >> v.normal.z >> input;
@@ -43,7 +43,7 @@ bool AssetLoader::LoadH3d(ID3D12Device* device, ID3D12GraphicsCommandList* comma
 
 	for (UINT i = 0; i < indexCount; ++i)
 	{
-		// ε  о´.
+		// 인덱스 정보를 읽어온다.
 		std::uint16_t index;
 		fin >> index;
 		indices.emplace_back(index);
@@ -64,7 +64,7 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 
 	fin.open(fileName);
 
-	//  ų ̸ ߸  Ѵ.
+	// 파일이 없거나 이름이 잘못된 경우 실패한다.
 	if (fin.fail())
 	{
 #if defined(DEBUG) || defined(_DEBUG)
@@ -87,7 +87,7 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 			{
 				XMFLOAT3 pos;
 				fin >> pos.x >> pos.y >> pos.z;
-				pos.z *= -1.0f; //  ǥ踦 ޼ ǥ ȯ
+				pos.z *= -1.0f; // 오른손 좌표계를 왼손 좌표계로 변환
 				positions.emplace_back(pos);
 			}
 			// Vertex Texcoord
@@ -95,7 +95,7 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 			{
 				XMFLOAT2 texcoord;
 				fin >> texcoord.x >> texcoord.y;
-				texcoord.y = 1.0f - texcoord.y; // ؽó ǥ ´.
+				texcoord.y = 1.0f - texcoord.y; // 텍스처 좌표를 뒤집는다.
 				texcoords.emplace_back(texcoord);
 			}
 			// Vertex Normal
@@ -103,7 +103,7 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 			{
 				XMFLOAT3 normal;
 				fin >> normal.x >> normal.y >> normal.z;
-				normal.z *= -1.0f;  //  ǥ踦 ޼ ǥ ȯ
+				normal.z *= -1.0f;  // 오른손 좌표계를 왼손 좌표계로 변환
 				normals.emplace_back(normal);
 			}
 		}
@@ -115,7 +115,7 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 			if (input == ' ')
 			{
 				FaceIndex f[3];
-				// ݽð  ǵ  ð  ٲٱ  Ųٷ д´.
+				// 반시계 방향으로 정의된 평면을 시계 방향으로 바꾸기 위해 거꾸로 읽는다.
 				fin >> f[2].posIndex >> input >> f[2].texIndex >> input >> f[2].normalIndex;
 				fin >> f[1].posIndex >> input >> f[1].texIndex >> input >> f[1].normalIndex;
 				fin >> f[0].posIndex >> input >> f[0].texIndex >> input >> f[0].normalIndex;
@@ -127,7 +127,7 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 		}
 
 
-		//   д´.
+		// 나머지 행을 읽는다.
 		while (input != '\n')
 			fin.get(input);
 
@@ -149,21 +149,21 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 		f[1] = faceIndices[i + 1];
 		f[2] = faceIndices[i + 2];
 
-		//  (Face) Ǵ   ε   ҷ´.
+		// 한 면(Face)에 사용되는 각 데이터의 인덱스에 따라 정보를 불러온다.
 		for (UINT j = 0; j < 3; ++j)
 		{
-			// obj ε 1 ϹǷ -1 ش.
+			// obj파일의 인덱스는 1부터 시작하므로 -1을 더해준다.
 			v[j].pos = positions.at(f[j].posIndex - 1);
 			v[j].normal = normals.at(f[j].normalIndex - 1);
 			v[j].texC = texcoords.at(f[j].texIndex - 1);
 		}
 
-		//    ÿ  TBN Ѵ.
+		// 노멀 매핑 및 라이팅에 사용항 TBN을 계산한다.
 		XMFLOAT3 normal, tangent, binormal;
 		CalculateTBN(v[0], v[1], v[2], normal, tangent, binormal);
 
-		// vector empty  find Լ ϸ incompatible  .
-		// ù °   ߺǴ    Ƿ Ѵ.
+		// vector가 empty일 때 find 함수를 사용하면 incompatible 오류가 생긴다.
+		// 첫 번째 삽입의 경우 중복되는 정점이 존재할 수 없으므로 삽입한다.
 		if (i == 0)
 		{
 			for (UINT32 j = 0; j < 3; ++j)
@@ -177,28 +177,28 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 			continue;
 		}
 
-		// objϿ ϵ Face ε ߺǴ  ε Ѵ.
-		//   ۸ 鶧 ߺǴ  ؾ Ѵ.
+		// obj파일에 기록된 Face 인덱스에는 중복되는 정점 인덱스가 존재한다.
+		// 따라서 정점 버퍼를 만들때에는 중복되는 정점을 제거해야 한다.
 		for (UINT32 j = 0; j < 3; ++j)
 		{
 			auto iter = std::find(overlapFaceIndices.begin(), overlapFaceIndices.end(), f[j]);
-			//  ġ FaceIndex Ѵٸ
+			// 만약 겹치는 FaceIndex가 존재한다면
 			if (iter != overlapFaceIndices.end())
 			{
-				// ߺǴ  ε Ѵ.
+				// 중복되는 정점의 인덱스를 삽입한다.
 				UINT index = (UINT)std::distance(overlapFaceIndices.begin(), iter);
 				++overlappedVertexNums[index];
 				indices.emplace_back(index);
 
-				// ߺǴ TBN Ѵ.
+				// 중복되는 TBN을 더한다.
 				vertices[index].normal = Vector3::Add(vertices[index].normal, v[j].normal);
 				vertices[index].tangentU = Vector3::Add(vertices[index].tangentU, tangent); 
 				vertices[index].binormalU = Vector3::Add(vertices[index].binormalU, binormal);
 			}
-			// ƴ϶
+			// 아니라면
 			else
 			{
-				// ο  ε Ѵ.
+				// 새로운 정점과 인덱스를 삽입한다.
 				vertices.emplace_back(v[j].pos, v[j].normal, tangent, binormal, v[j].texC);
 				indices.emplace_back(vertexIndex);
 				overlapFaceIndices.emplace_back(f[j]);
@@ -210,14 +210,14 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 
 	for (UINT32 i = 0; i < (UINT32)overlappedVertexNums.size(); ++i)
 	{
-		// ߺǴ TBN   Ѵ.
+		// 중복되는 TBN을 나누어 평균을 구한다.
 		auto n = overlappedVertexNums[i];
 		vertices[i].normal = Vector3::Divide(vertices[i].normal, n);
 		vertices[i].tangentU = Vector3::Divide(vertices[i].tangentU, n);
 		vertices[i].binormalU = Vector3::Divide(vertices[i].binormalU, n);
 	}
 	
-	// obj h3dϷ ȯѴ.
+	// obj파일은 h3d파일로 변환한다.
 	ObjToH3d(vertices, indices, fileName); 
 
 	return true;
@@ -226,15 +226,15 @@ bool AssetLoader::ConvertObj(const std::wstring fileName)
 void AssetLoader::ObjToH3d(const std::vector<Vertex>& vertices, const std::vector<UINT16>& indices, std::wstring fileName)
 {
 	static const std::wstring fileFormat = L".h3d";
-	fileName.erase(fileName.size() - 4, 4); // fileName obj  string .
-	fileName += fileFormat; // Ͽ h3d  δ.
+	fileName.erase(fileName.size() - 4, 4); // fileName에서 obj 포맷 string을 지운다.
+	fileName += fileFormat; // 파일에 h3d 파일형식을 붙인다.
 
 	std::ofstream fout(fileName);
 
 	fout << vertices.size() << std::endl; // VertexCount
 	for (const auto& vertex : vertices)
 	{
-		// Ͽ Vertex   .
+		// 파일에 Vertex에 관한 정보를 쓴다.
 		fout << vertex.pos.x << " " << vertex.pos.y << " " << vertex.pos.z << " / ";
 		fout << vertex.normal.x << " " << vertex.normal.y << " " << vertex.normal.z << " / ";
 		fout << vertex.tangentU.x << " " << vertex.tangentU.y << " " << vertex.tangentU.z << " / ";
@@ -246,7 +246,7 @@ void AssetLoader::ObjToH3d(const std::vector<Vertex>& vertices, const std::vecto
 	fout << indices.size() << std::endl; // Index Count
 	for (const auto& i : indices)
 	{
-		// ε .
+		// 인덱스를 쓴다.
 		fout << i << std::endl;
 	}
 
@@ -266,11 +266,11 @@ void AssetLoader::CalculateTBN(const VertexBasic& v1, const VertexBasic& v2, con
 	XMVECTOR t2 = XMLoadFloat2(&v2.texC);
 	XMVECTOR t3 = XMLoadFloat2(&v3.texC);
 
-	//  ǥ  ͸ Ѵ.
+	// 현재 표면의 두 벡터를 계산한다.
 	pv1 = p2 - p1;
 	pv2 = p3 - p1;
 
-	// tu  tv ؽó  ͸ Ѵ.
+	// tu 및 tv 텍스처 공간 벡터를 계산한다.
 	tu1 = t2 - t1;
 	tv1 = t3 - t1;
 
@@ -278,7 +278,7 @@ void AssetLoader::CalculateTBN(const VertexBasic& v1, const VertexBasic& v2, con
 	XMStoreFloat3(&tu, tu1);
 	XMStoreFloat3(&tv, tv1);
 
-	// źƮ /    и Ѵ.
+	// 탄젠트 / 바이 노멀 방정식의 분모를 계산한다.
 	float denominator = (tu.x * tv.y - tu.y * tv.x);
 	if (denominator < FLT_EPSILON)
 	{
@@ -293,7 +293,7 @@ void AssetLoader::CalculateTBN(const VertexBasic& v1, const VertexBasic& v2, con
 	float den = 1.0f / denominator;
 
 
-	//   ϰ  Ͽ    ´.
+	// 교차 곱을 계산하고 계수로 곱하여 접선과 비 구식을 얻는다.
 	XMVECTOR tangentVec = (tv.y * pv1 - tv.x * pv2) * den;
 	tangentVec = XMVector3Normalize(tangentVec);
 	XMVECTOR binormalVec = (tu.x * pv2 - tu.y * pv1) * den;
@@ -322,40 +322,40 @@ FILE* AssetLoader::LoadWave(const std::string fileName, WaveHeaderType& header)
 		return nullptr;
 
 
-	// RIFF  ȮѴ.
+	// RIFF 포맷인지 확인한다.
 	if ((header.chunkId[0] != 'R') || (header.chunkId[1] != 'I') ||
 		(header.chunkId[2] != 'F') || (header.chunkId[3] != 'F'))
 		return nullptr;
 
-	// Wave  ȮѴ.
+	// Wave 포맷인지 확인한다.
 	if ((header.format[0] != 'W') || (header.format[1] != 'A') ||
 		(header.format[2] != 'V') || (header.format[3] != 'E'))
 		return nullptr;
 
-	// fmt  ȮѴ.
+	// fmt 포맷인지 확인한다.
 	if ((header.subChunkId[0] != 'f') || (header.subChunkId[1] != 'm') ||
 		(header.subChunkId[2] != 't') || (header.subChunkId[3] != ' '))
 		return nullptr;
 
 	/*
-	//   WAVE_FORMAT_PCM ȮѴ.
+	// 오디오 포맷이 WAVE_FORMAT_PCM인지 확인한다.
 	if (header.audioFormat != WAVE_FORMAT_PCM)
 		return nullptr;
 
-	// ׷  ϵǾ ִ ȮѴ.
+	// 스테레오 포맷으로 기록되어 있는지 확인한다.
 	if (header.numChannels != 2)
 		return nullptr;
 
-	// 44.1kHz  ϵǾ ȮѴ.
+	// 44.1kHz 비율로 기록되었는지 확인한다.
 	if (header.sampleRate != 44100)
 		return nullptr;
 
-	// 16Ʈ ϵǾ ִ ȮѴ.
+	// 16비트로 기록되어 있는지 확인한다.
 	if (header.bitsPerSample != 16)
 		return nullptr;
 	*/
 
-	// data ȮѴ.
+	// data인지 확인한다.
 	if ((header.dataChunkId[0] != 'd') || (header.dataChunkId[1] != 'a') ||
 		(header.dataChunkId[2] != 't') || (header.dataChunkId[3] != 'a'))
 	{
@@ -17,6 +17,8 @@ struct MeshInfo
 	std::string name;
 	std::wstring fileName;
 	CollisionType collisionType;
+	// true라면 WorldPartition이 필요할 때 로드하고 더 이상 쓰이지 않으면 해제한다.
+	bool isStreamed = false;
 };
 
 struct TextureInfo
@@ -50,23 +52,23 @@ struct WaveHeaderType
 };
 
 /*
-ּ εϴ Ŭ
-޽,   ͸ ӿũ   ֵ ȯѴ.
+애셋을 로드하는 클래스
+메쉬, 사운드 등의 데이터를 프레임워크에서 사용할 수 있도록 변환한다.
 */
 class AssetLoader
 {
 public:
-	// Ȯ h3d εϿ   ε ȯѴ.
+	// 확장자 h3d파일을 로드하여 정점 및 인덱스를 반환한다.
 	static bool LoadH3d(ID3D12Device* device, ID3D12GraphicsCommandList* commandList, const std::wstring fileName,
 		std::vector<Vertex>& vertices, std::vector<UINT16>& indices);
-	// obj h3dϷ ȯѴ.
+	// obj를 h3d파일로 변환한다.
 	static bool ConvertObj(const std::wstring fileName);
-	// wav ƮϿ  Ϳ  ü ȯѴ.
+	// wav파일을 임포트하여 파일 포인터와 헤더 구조체를 반환한다.
 	static FILE* LoadWave(const std::string fileName, WaveHeaderType& header);
 
-	// obj h3d ȯѴ.
+	// obj를 h3d로 변환한다.
 	static void ObjToH3d(const std::vector<Vertex>& vertices, const std::vector<UINT16>& indices, std::wstring fileName);
-	// ޽   ̿Ͽ TBN ϰ  normal, tangent, binormal ȯѴ.
+	// 메쉬의 세 정점을 이용하여 TBN을 계산하고 각 normal, tangent, binormal을 반환한다.
 	static void CalculateTBN(const VertexBasic& v1, const VertexBasic& v2, const VertexBasic& v3,
 		XMFLOAT3& normal, XMFLOAT3& tangent, XMFLOAT3& binormal);
 };
\ No newline at end of file
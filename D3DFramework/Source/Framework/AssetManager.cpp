@@ -1,6 +1,8 @@
 #include "../PrecompiledHeader/pch.h"
 #include "AssetManager.h"
+#include "Defines.h"
 #include "DDSTextureLoader.h"
+#include "JobSystem.h"
 #include "../Component/Material.h"
 #include "../Component/Mesh.h"
 #include "../Component/Sound.h"
@@ -31,13 +33,18 @@ AssetManager::~AssetManager()
 
 void AssetManager::Initialize(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, IDirectSound8* d3dSound)
 {
-	// ּ Ŵ ̱ ̱ 
-	//  ѹ ʱȭ Ѵ.
+	// 애셋 매니저는 싱글턴 패턴이기 때문에
+	// 단 한번만 초기화가 가능한다.
 	if (isInitialized)
 		return;
 
 	LoadTextures(device, cmdList);
-	LoadMeshes(device, cmdList);
+#ifdef WORLD_PARTITION
+	// 스트리밍되는 메쉬는 WorldPartition이 필요할 때 로드한다.
+	LoadMeshes(device, cmdList, false);
+#else
+	LoadMeshes(device, cmdList, true);
+#endif
 	LoadSounds(device, cmdList, d3dSound);
 	BuildMaterial();
 
@@ -159,14 +166,14 @@ void AssetManager::LoadTextures(ID3D12Device* device, ID3D12GraphicsCommandList*
 		texMap->name = texName;
 		texMap->filename = fileName;
 		texMap->textureIndex = (std::uint32_t)i;
-		// ؽó εѴ.
+		// 텍스처를 로드한다.
 		ThrowIfFailed(DirectX::CreateDDSTextureFromFile12(device, commandList,
 			filePath.c_str(), texMap->resource, texMap->uploadHeap));
 
 		textures[texName] = std::move(texMap);
 	}
 
-	// ؽó  ̴ ǵ  ġϴ  ȮѴ.
+	// 텍스처의 수와 쉐이더에 정의된 수가 일치하는 지 확인한다.
 	if ((UINT)textures.size() != TEX_NUM)
 	{
 #if defined(DEBUG) || defined(_DEBUG)
@@ -177,21 +184,25 @@ void AssetManager::LoadTextures(ID3D12Device* device, ID3D12GraphicsCommandList*
 
 void AssetManager::LoadSounds(ID3D12Device* device, ID3D12GraphicsCommandList* commandList, IDirectSound8* d3dSound)
 {
+	// 사운드 장치가 없다면 사운드 없이 진행한다.
+	if (d3dSound == nullptr)
+		return;
+
 	for (const auto& soundInfo : mSoundInfos)
 	{
 		const std::string filePath = soundPath + soundInfo.fileName;
 		WaveHeaderType header;
 
-		// wav εѴ.
+		// wav파일을 로드한다.
 		FILE* filePtr = AssetLoader::LoadWave(filePath, header);
 		if (filePtr == nullptr)
 			continue;
 
-		//  ü Ѵ.
+		// 사운드 객체를 생성한다.
 		auto soundName = soundInfo.name;
 		std::unique_ptr<Sound> sound = std::make_unique<Sound>(std::move(soundName));
 
-		//  ŸԿ   ۸ Ѵ.
+		// 사운드 타입에 따라 사운드 버퍼를 생성한다.
 		switch (soundInfo.soundType)
 		{
 		case SoundType::Sound2D:
@@ -206,32 +217,80 @@ void AssetManager::LoadSounds(ID3D12Device* device, ID3D12GraphicsCommandList* c
 	}
 }
 
-void AssetManager::LoadMeshes(ID3D12Device* device, ID3D12GraphicsCommandList* commandList)
+void AssetManager::LoadMeshes(ID3D12Device* device, ID3D12GraphicsCommandList* commandList, const bool includeStreamed)
 {
-	for (const auto& h3dInfo : mH3dModels)
+	struct DecodedMesh
 	{
-		const std::wstring filePath = modelPath + h3dInfo.fileName;
+		const MeshInfo* info = nullptr;
 		std::vector<Vertex> vertices;
 		std::vector<std::uint16_t> indices;
+		bool result = false;
+	};
 
-		// h3d εѴ.
-		bool result = AssetLoader::LoadH3d(device, commandList, filePath, vertices, indices);
-		if (!result)
+	std::vector<DecodedMesh> decodedMeshes;
+	for (const auto& h3dInfo : mH3dModels)
+	{
+		if (meshes.find(h3dInfo.name) != meshes.end() || (h3dInfo.isStreamed && !includeStreamed))
 			continue;
 
-		// ޽ ü Ѵ.
-		auto meshName = h3dInfo.name;
-		std::unique_ptr<Mesh> mesh = std::make_unique<Mesh>(std::move(meshName));
+		decodedMeshes.emplace_back();
+		decodedMeshes.back().info = &h3dInfo;
+	}
 
-		//   ε gpu ű, 浹 ٿ带 Ѵ.
-		mesh->BuildVertices(device, commandList, (void*)vertices.data(), (UINT)vertices.size(), (UINT)sizeof(Vertex));
-		mesh->BuildIndices(device, commandList, indices.data(), (UINT)indices.size(), (UINT)sizeof(std::uint16_t));
-		mesh->BuildCollisionBound(&vertices[0].pos, (UINT32)vertices.size(), (UINT32)sizeof(Vertex), h3dInfo.collisionType);
+	// 파일을 읽고 해석하는 작업은 서로 독립적이므로 JobSystem에서 병렬로 수행한다.
+	JobSystem::GetInstance()->ParallelFor((UINT32)decodedMeshes.size(), 1, [this, device, commandList, &decodedMeshes](const UINT32 i)
+	{
+		DecodedMesh& decoded = decodedMeshes[i];
 
-		meshes[h3dInfo.name] = std::move(mesh);
+		// h3d파일을 로드한다.
+		decoded.result = AssetLoader::LoadH3d(device, commandList, GetModelFilePath(*decoded.info), decoded.vertices, decoded.indices);
+	});
+
+	// 명령 리스트는 하나의 스레드에서만 기록할 수 있으므로 GPU 버퍼는 순서대로 생성한다.
+	for (auto& decoded : decodedMeshes)
+	{
+		if (!decoded.result)
+			continue;
+
+		meshes[decoded.info->name] = BuildMesh(device, commandList, *decoded.info, decoded.vertices, decoded.indices);
 	}
 }
 
+std::unique_ptr<Mesh> AssetManager::BuildMesh(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
+	const MeshInfo& info, std::vector<Vertex>& vertices, std::vector<UINT16>& indices)
+{
+	// 메쉬 객체를 생성한다.
+	auto meshName = info.name;
+	std::unique_ptr<Mesh> mesh = std::make_unique<Mesh>(std::move(meshName));
+
+	// 정점 및 인덱스를 gpu에 옮기고, 충돌 바운드를 생성한다.
+	mesh->BuildVertices(device, commandList, (void*)vertices.data(), (UINT)vertices.size(), (UINT)sizeof(Vertex));
+	mesh->BuildIndices(device, commandList, indices.data(), (UINT)indices.size(), (UINT)sizeof(std::uint16_t));
+	mesh->BuildCollisionBound(&vertices[0].pos, (UINT32)vertices.size(), (UINT32)sizeof(Vertex), info.collisionType);
+
+	return mesh;
+}
+
+void AssetManager::LoadStreamedMeshes(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList)
+{
+	LoadMeshes(device, cmdList, true);
+}
+
+const MeshInfo* AssetManager::FindMeshInfo(const std::string& name) const
+{
+	for (const auto& h3dInfo : mH3dModels)
+	{
+		if (h3dInfo.name == name)
+			return &h3dInfo;
+	}
+	return nullptr;
+}
+
+std::wstring AssetManager::GetModelFilePath(const MeshInfo& info) const
+{
+	return modelPath + info.fileName;
+}
+
 Mesh* AssetManager::FindMesh(std::string&& name) const
 {
 	auto iter = meshes.find(name);
@@ -239,7 +298,7 @@ Mesh* AssetManager::FindMesh(std::string&& name) const
 	if (iter == meshes.end())
 	{
 #if defined(DEBUG) | defined(_DEBUG)
-		std::cout << "Geometry " << name << " ߰ߵ ." << std::endl;
+		std::cout << "Geometry " << name << "이 발견되지 않음." << std::endl;
 #endif
 		return nullptr;
 	}
@@ -254,7 +313,7 @@ Material* AssetManager::FindMaterial(std::string&& name) const
 	if (iter == materials.end())
 	{
 #if defined(DEBUG) | defined(_DEBUG)
-		std::cout << "Material " << name << " ߰ߵ ." << std::endl;
+		std::cout << "Material " << name << "이 발견되지 않음." << std::endl;
 #endif
 		return nullptr;
 	}
@@ -269,7 +328,7 @@ Sound* AssetManager::FindSound(std::string&& name) const
 	if (iter == sounds.end())
 	{
 #if defined(DEBUG) | defined(_DEBUG)
-		std::cout << "Sound " << name << " ߰ߵ ." << std::endl;
+		std::cout << "Sound " << name << "이 발견되지 않음." << std::endl;
 #endif
 		return nullptr;
 	}
@@ -284,7 +343,7 @@ Texture* AssetManager::FindTexture(std::string&& name) const
 	if (iter == textures.end())
 	{
 #if defined(DEBUG) | defined(_DEBUG)
-		std::cout << "Texture " << name << " ߰ߵ ." << std::endl;
+		std::cout << "Texture " << name << "이 발견되지 않음." << std::endl;
 #endif
 		return nullptr;
 	}
@@ -298,7 +357,7 @@ ID3D12Resource* AssetManager::GetTextureResource(const UINT32 index) const
 	if (mTexInfos.size() <= index)
 	{
 #if defined(DEBUG) | defined(_DEBUG)
-		std::cout << "TextureResource " << index << " ʰ" << std::endl;
+		std::cout << "TextureResource " << index << "가 초과됨" << std::endl;
 #endif
 	}
 
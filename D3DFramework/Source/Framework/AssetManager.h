@@ -23,7 +23,7 @@ struct Texture
 };
 
 /*
-ӿũ Ǵ ҽ Ѵ.
+프레임워크에 사용되는 리소스들을 관리한다.
 */
 class AssetManager
 {
@@ -36,21 +36,31 @@ public:
 	static AssetManager* GetInstance();
 
 public:
-	//  ؽó, ޽, , ͸  εѴ.
+	// 각종 텍스처, 메쉬, 사운드, 머터리얼 등을 로드한다.
 	void Initialize(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, IDirectSound8* d3dSound);
 
-	// ش value ã  Լ
+	// 해당 value를 찾기 위한 함수
 	Mesh* FindMesh(std::string&& name) const;
 	Material* FindMaterial(std::string&& name) const;
 	Sound* FindSound(std::string&& name) const;
 	Texture* FindTexture(std::string&& name) const;
 
-	// Shader Resource View   texNames ε  ؽó ҽ ִ Լ
+	// Shader Resource View를 만들기 위한 texNames의 인덱스에 따라 텍스처의 리소스를 돌려주는 함수
 	ID3D12Resource* GetTextureResource(const UINT32 index) const;
 
-	// ޽  ε ۵ Ѵ.
+	// 메쉬에서 사용된 업로드 버퍼들을 해제한다.
 	void DisposeUploaders();
 
+	// 스트리밍되는 메쉬들 중 아직 로드되지 않은 메쉬를 모두 로드한다.
+	void LoadStreamedMeshes(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
+	// 이름으로 메쉬의 파일 정보를 찾는다. 없다면 nullptr를 반환한다.
+	const MeshInfo* FindMeshInfo(const std::string& name) const;
+	std::wstring GetModelFilePath(const MeshInfo& info) const;
+
+	// 해석된 정점과 인덱스로 GPU 버퍼와 충돌 바운드를 가진 메쉬를 생성한다.
+	static std::unique_ptr<Mesh> BuildMesh(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
+		const MeshInfo& info, std::vector<Vertex>& vertices, std::vector<UINT16>& indices);
+
 public:
 	std::unordered_map<std::string, std::unique_ptr<Mesh>> meshes;
 	std::unordered_map<std::string, std::unique_ptr<Material>> materials;
@@ -59,14 +69,15 @@ public:
 
 private:
 	void LoadTextures(ID3D12Device* device, ID3D12GraphicsCommandList* commandList);
-	void LoadMeshes(ID3D12Device* device, ID3D12GraphicsCommandList* commandList);
+	// includeStreamed가 false라면 스트리밍되는 메쉬는 건너뛴다.
+	void LoadMeshes(ID3D12Device* device, ID3D12GraphicsCommandList* commandList, const bool includeStreamed);
 	void LoadSounds(ID3D12Device* device, ID3D12GraphicsCommandList* commandList, IDirectSound8* d3dSound);
 	void BuildMaterial();
 
 private:
 	static inline bool isInitialized = false;
 
-	// ؽó ̸,  ̸  ǵȴ.
+	// 텍스처 이름, 파일 이름 순으로 정의된다.
 	const std::vector<TextureInfo> mTexInfos =
 	{
 		{"Ice_D", L"Ice_D.dds"},
@@ -86,20 +97,20 @@ private:
 		{"Rock2_N", L"Rock2_N.dds"},
 	};
 
-	// ޽ ̸,  ̸, 浹 Ÿ  ǵȴ.
+	// 메쉬 이름, 파일 이름, 충돌 타입, 스트리밍 여부 순으로 정의된다.
 	const std::vector<MeshInfo> mH3dModels =
 	{
 		{ "Cube_AABB",  L"Cube.h3d", CollisionType::AABB },
 		{ "Cube_OBB",  L"Cube.h3d", CollisionType::OBB },
 		{ "Sphere",  L"Sphere.h3d", CollisionType::Sphere },
 		{ "SkySphere",  L"Sphere.h3d", CollisionType::None },
-		{ "Skull",  L"Skull.h3d", CollisionType::Sphere },
-		{ "Sword",  L"Sword.h3d", CollisionType::AABB },
-		{ "Rock1",  L"Rock1.h3d", CollisionType::AABB },
-		{ "Rock2",  L"Rock2.h3d", CollisionType::AABB },
+		{ "Skull",  L"Skull.h3d", CollisionType::Sphere, true },
+		{ "Sword",  L"Sword.h3d", CollisionType::AABB, true },
+		{ "Rock1",  L"Rock1.h3d", CollisionType::AABB, true },
+		{ "Rock2",  L"Rock2.h3d", CollisionType::AABB, true },
 	};
 
-	//  ̸,  ̸,  Ÿ  ǵȴ.
+	// 사운드 이름, 파일 이름, 사운드 타입 순으로 정의된다.
 	const std::vector<SoundInfo> mSoundInfos =
 	{
 		{"WinterWind", "wind-sand.wav", SoundType::Sound3D},
@@ -0,0 +1,192 @@
+#include "../PrecompiledHeader/pch.h"
+#include "Broadphase.h"
+#include "Octree.h"
+#include "D3DDebug.h"
+#include "../Object/GameObject.h"
+
+Broadphase::Broadphase(const ObjectTable* objects, const BoundingBox& worldBounds)
+{
+	this->objects = objects;
+	this->worldBounds = worldBounds;
+}
+
+Broadphase::~Broadphase()
+{
+	staticTree = nullptr;
+	staticObjects.clear();
+	dynamicProxies.clear();
+}
+
+void Broadphase::AddObject(GameObject* obj)
+{
+	if (!IsEnabledCollision(obj))
+		return;
+
+	if (obj->isStatic)
+	{
+		staticObjects.push_back(obj->GetHandle());
+		isStaticDirty = true;
+		++staticRevision;
+	}
+	else
+	{
+		DynamicProxy proxy;
+		proxy.handle = obj->GetHandle();
+		proxy.obj = obj;
+		dynamicProxies.push_back(std::move(proxy));
+	}
+}
+
+void Broadphase::AddObjects(const ObjectTable& objects)
+{
+	for (GameObject* obj : objects)
+		AddObject(obj);
+}
+
+void Broadphase::MarkStaticDirty()
+{
+	isStaticDirty = true;
+	++staticRevision;
+}
+
+const std::vector<ObjectHandle>& Broadphase::GetStaticObjects() const
+{
+	return staticObjects;
+}
+
+void Broadphase::SetStaticObjects(std::span<const ObjectHandle> handles)
+{
+	if (std::equal(handles.begin(), handles.end(), staticObjects.begin(), staticObjects.end()))
+		return;
+
+	staticObjects.assign(handles.begin(), handles.end());
+	isStaticDirty = true;
+	++staticRevision;
+}
+
+void Broadphase::Update()
+{
+	if (isStaticDirty)
+	{
+		RebuildStaticTree();
+		isStaticDirty = false;
+	}
+
+	UpdateDynamicProxies();
+	FindPairs();
+}
+
+void Broadphase::RebuildStaticTree()
+{
+	// 파괴된 객체의 핸들은 제거한다.
+	std::erase_if(staticObjects, [this](const ObjectHandle handle) { return !objects->IsValid(handle); });
+
+	staticTree = std::make_unique<Octree>(objects, worldBounds, staticObjects);
+	staticTree->BuildTree();
+}
+
+void Broadphase::UpdateDynamicProxies()
+{
+	// 사라진 객체는 리스트에서 제거한다.
+	dynamicProxies.erase(std::remove_if(dynamicProxies.begin(), dynamicProxies.end(),
+		[this](const DynamicProxy& proxy) -> bool { return !objects->IsValid(proxy.handle); }), dynamicProxies.end());
+
+	for (auto& proxy : dynamicProxies)
+	{
+		proxy.obj = objects->Get(proxy.handle);
+		proxy.aabb = proxy.obj->GetCollisionAabb();
+		proxy.minX = proxy.aabb.Center.x - proxy.aabb.Extents.x;
+		proxy.maxX = proxy.aabb.Center.x + proxy.aabb.Extents.x;
+	}
+
+	// 객체들은 프레임 사이에 조금씩만 움직이므로 거의 정렬된 상태이다.
+	// 따라서 삽입 정렬이 가장 빠르다.
+	for (size_t i = 1; i < dynamicProxies.size(); ++i)
+	{
+		DynamicProxy proxy = std::move(dynamicProxies[i]);
+		size_t j = i;
+		while (j > 0 && dynamicProxies[j - 1].minX > proxy.minX)
+		{
+			dynamicProxies[j] = std::move(dynamicProxies[j - 1]);
+			--j;
+		}
+		dynamicProxies[j] = std::move(proxy);
+	}
+}
+
+void Broadphase::FindPairs()
+{
+	pairs.clear();
+
+	for (size_t i = 0; i < dynamicProxies.size(); ++i)
+	{
+		const DynamicProxy& proxy = dynamicProxies[i];
+		GameObject* obj = proxy.obj;
+		if (!IsEnabledCollision(obj))
+			continue;
+
+		// x축으로 정렬되어 있으므로 x축 구간이 겹치는 객체들만 검사한다.
+		for (size_t j = i + 1; j < dynamicProxies.size() && dynamicProxies[j].minX <= proxy.maxX; ++j)
+		{
+			const DynamicProxy& otherProxy = dynamicProxies[j];
+			GameObject* other = otherProxy.obj;
+			if (!IsEnabledCollision(other))
+				continue;
+
+			if (proxy.aabb.Intersects(otherProxy.aabb))
+				pairs.emplace_back(obj, other);
+		}
+
+		// 동적 객체를 정적 트리에 질의한다.
+		if (staticTree)
+		{
+			queryResults.clear();
+			staticTree->Query(proxy.aabb, queryResults);
+
+			for (const auto& staticObj : queryResults)
+				pairs.emplace_back(obj, staticObj);
+		}
+	}
+}
+
+bool Broadphase::IsEnabledCollision(GameObject* obj) const
+{
+	CollisionType collisionType = obj->GetCollisionType();
+	if (collisionType == CollisionType::None || collisionType == CollisionType::Point)
+		return false;
+	return true;
+}
+
+void Broadphase::DrawDebug()
+{
+	if (staticTree)
+		staticTree->DrawDebug();
+
+	for (const auto& proxy : dynamicProxies)
+		D3DDebug::GetInstance()->Draw(proxy.aabb, FLT_MAX, (XMFLOAT4)Colors::Orange);
+}
+
+UINT64 Broadphase::GetStaticRevision() const
+{
+	return staticRevision;
+}
+
+UINT32 Broadphase::GetStaticObjectCount() const
+{
+	return (UINT32)staticObjects.size();
+}
+
+UINT32 Broadphase::GetDynamicObjectCount() const
+{
+	return (UINT32)dynamicProxies.size();
+}
+
+UINT32 Broadphase::GetPairCount() const
+{
+	return (UINT32)pairs.size();
+}
+
+const std::vector<std::pair<GameObject*, GameObject*>>& Broadphase::GetPairs() const
+{
+	return pairs;
+}
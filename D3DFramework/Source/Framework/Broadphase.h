@@ -0,0 +1,94 @@
+#pragma once
+
+#include <memory>
+#include <list>
+#include <vector>
+#include <span>
+#include <DirectXCollision.h>
+#include "ObjectTable.h"
+
+class GameObject;
+class Octree;
+
+/*
+충돌 검사의 광역 단계를 담당한다. 정적 객체는 한 번만 생성되는
+정적 팔진트리에, 움직이는 객체는 매 프레임 x축으로 정렬되는 가벼운
+동적 리스트에 따로 보관하며 두 구조는 서로 합쳐지지 않는다.
+동적 객체끼리, 동적 객체와 정적 트리 사이의 쌍만 검사하므로
+프레임 비용은 움직이는 객체의 수에 비례한다.
+객체는 ObjectHandle로 보관하며, 파괴된 객체는 Update에서 걸러진다.
+*/
+class Broadphase
+{
+public:
+	struct DynamicProxy
+	{
+		ObjectHandle handle;
+		// Update에서 핸들로부터 다시 얻는 포인터로, 그 프레임 동안만 유효하다.
+		GameObject* obj = nullptr;
+		DirectX::BoundingBox aabb;
+		float minX = 0.0f;
+		float maxX = 0.0f;
+	};
+
+public:
+	Broadphase(const ObjectTable* objects, const DirectX::BoundingBox& worldBounds);
+	~Broadphase();
+
+public:
+	// 객체의 isStatic에 따라 정적 트리 혹은 동적 리스트에 추가한다.
+	void AddObject(GameObject* obj);
+	void AddObjects(const ObjectTable& objects);
+
+	// 정적 객체가 바뀌었음을 알린다. 다음 Update에서 정적 트리를 다시 생성한다.
+	// 정적 객체를 움직였다면 반드시 이 함수를 불러야 한다.
+	void MarkStaticDirty();
+
+	// 정적 트리에 들어가는 객체들을 읽거나 통째로 바꾼다. 바뀌었다면 다음 Update에서 트리를 다시 생성한다.
+	const std::vector<ObjectHandle>& GetStaticObjects() const;
+	void SetStaticObjects(std::span<const ObjectHandle> handles);
+	// 정적 객체가 바뀔 때마다 증가하는 값으로, 정적 객체로 만든 다른 구조를 갱신할지 판단할 때 사용한다.
+	UINT64 GetStaticRevision() const;
+
+	// 필요하다면 정적 트리를 다시 만들고 AABB가 겹치는 충돌 쌍을 찾는다.
+	void Update();
+
+	// D3DDebug를 사용하여 정적 트리와 동적 객체의 바운딩 박스를 그린다.
+	void DrawDebug();
+
+	UINT32 GetStaticObjectCount() const;
+	UINT32 GetDynamicObjectCount() const;
+	UINT32 GetPairCount() const;
+
+	// 이번 Update에서 찾은 충돌 쌍을 반환한다. 실제 충돌 여부는 Physics에서 확인한다.
+	const std::vector<std::pair<GameObject*, GameObject*>>& GetPairs() const;
+
+private:
+	// 정적 객체 리스트로 정적 트리를 다시 생성한다.
+	void RebuildStaticTree();
+	// 동적 객체의 AABB를 갱신하고 x축 최솟값으로 정렬한다.
+	void UpdateDynamicProxies();
+	// 동적-동적, 동적-정적 쌍 중 AABB가 겹치는 쌍을 찾는다.
+	void FindPairs();
+
+	// 해당 객체가 충돌 가능한지 여부를 확인한다.
+	bool IsEnabledCollision(GameObject* obj) const;
+
+private:
+	const ObjectTable* objects = nullptr;
+	DirectX::BoundingBox worldBounds;
+
+	// 정적 객체들로만 이루어진 팔진트리
+	std::unique_ptr<Octree> staticTree;
+	std::vector<ObjectHandle> staticObjects;
+	bool isStaticDirty = true;
+	UINT64 staticRevision = 0;
+
+	// 움직이는 객체들의 AABB를 x축으로 정렬한 리스트
+	std::vector<DynamicProxy> dynamicProxies;
+
+	// 이번 프레임에 찾은 충돌 쌍
+	std::vector<std::pair<GameObject*, GameObject*>> pairs;
+	// 정적 트리 질의 결과를 담을 재사용 버퍼
+	std::vector<GameObject*> queryResults;
+};
@@ -4,9 +4,9 @@
 #include <memory>
 
 /*
-ε  ޸   ȯϱ  Ŭ.
-ε   0   ߻ŰǷ 
-  0  ۸ ϴ  ´.
+업로드 버퍼의 메모리 공간을 동적으로 변환하기 위한 클래스.
+업로드 버퍼의 공간이 0인 경우 오류를 발생시키므로 
+버퍼의 개수가 0일 경우 버퍼를 생성하는 것을 막는다.
 */
 template<typename T>
 class BufferMemoryPool
@@ -16,7 +16,7 @@ public:
 	~BufferMemoryPool();
 
 public:
-	// ش ۿ count ° ۸ ҴѴ.
+	// 해당 버퍼에 count수에 맞게 버퍼를 재할당한다.
 	void Resize(const UINT32 bufferCount);
 
 public:
@@ -26,10 +26,10 @@ public:
 	D3D12_GPU_VIRTUAL_ADDRESS GetVirtualAddress() { if (buffer) return buffer->GetResource()->GetGPUVirtualAddress(); return 0; }
 
 private:
-	//  ޸ 
+	// 생성된 메모리 버퍼
 	std::unique_ptr<UploadBuffer<T>> buffer = nullptr;
 
-	// ۸   
+	// 버퍼를 만들기 위한 변수
 	ID3D12Device* d3dDevice = nullptr;
 	UINT32 bufferCount = 0;
 	bool isConstantsBuffer = false;
@@ -42,7 +42,7 @@ BufferMemoryPool<T>::BufferMemoryPool(ID3D12Device* device, const INT32 bufferCo
 	this->isConstantsBuffer = IsConstantBuffer;
 	this->bufferCount = bufferCount;
 
-	//   0  ۸  ʴ´.
+	// 버퍼의 개수가 0일 경우 버퍼를 생성하지 않는다.
 	if(bufferCount != 0)
 		buffer = std::make_unique<UploadBuffer<T>>(d3dDevice, bufferCount, isConstantsBuffer);
 }
@@ -53,10 +53,10 @@ BufferMemoryPool<T>::~BufferMemoryPool() { }
 template<typename T>
 void BufferMemoryPool<T>::Resize(const UINT32 bufferCount)
 {
-	// ۸ Ҵϱ  ޸𸮸 Ѵ.
+	// 버퍼를 재할당하기 전 메모리를 해제한다.
 	buffer.reset();
 
 	this->bufferCount = bufferCount;
-	// ۸ Ѵ.
+	// 버퍼를 재생성한다.
 	buffer = std::make_unique<UploadBuffer<T>>(d3dDevice, bufferCount, isConstantsBuffer);
 }
\ No newline at end of file
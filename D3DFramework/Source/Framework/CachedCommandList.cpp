@@ -0,0 +1,601 @@
+#include "../PrecompiledHeader/pch.h"
+#include "CachedCommandList.h"
+#include "Defines.h"
+
+StateCacheStats& StateCacheStats::operator+=(const StateCacheStats& rhs)
+{
+	for (int i = 0; i < (int)StateCacheCall::Count; ++i)
+	{
+		issuedCalls[i] += rhs.issuedCalls[i];
+		redundantCalls[i] += rhs.redundantCalls[i];
+	}
+	return *this;
+}
+
+CachedCommandList::CachedCommandList(ID3D12GraphicsCommandList* commandList)
+	: commandList(commandList)
+{
+	Invalidate();
+}
+
+CachedCommandList::~CachedCommandList() { }
+
+ID3D12GraphicsCommandList* CachedCommandList::GetNative() const
+{
+	return commandList.Get();
+}
+
+void CachedCommandList::Invalidate()
+{
+	isPipelineStateKnown = false;
+	isGraphicsRootSignatureKnown = false;
+	isComputeRootSignatureKnown = false;
+	InvalidateRootArguments(graphicsRoot);
+	InvalidateRootArguments(computeRoot);
+
+	descriptorHeapCount = UINT_MAX;
+	topology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	isVertexBufferKnown.fill(false);
+	isIndexBufferKnown = false;
+	isRenderTargetKnown = false;
+}
+
+StateCacheStats CachedCommandList::GetStats()
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+	return totalStats;
+}
+
+void CachedCommandList::ResetStats()
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+	totalStats = StateCacheStats();
+}
+
+void CachedCommandList::PrintStats(const UINT32 frameCount)
+{
+	static const char* callNames[(int)StateCacheCall::Count] =
+	{
+		"Pipeline States ",
+		"Root Signatures ",
+		"Root Arguments  ",
+		"Root Constants  ",
+		"Descriptor Heaps",
+		"Topologies      ",
+		"Vertex Buffers  ",
+		"Index Buffers   ",
+		"Render Targets  ",
+	};
+
+	const StateCacheStats current = GetStats();
+	const double frameNum = (double)(std::max)(frameCount, 1u);
+
+	std::cout << "State Cache : issued / redundant" << std::endl;
+	for (int i = 0; i < (int)StateCacheCall::Count; ++i)
+	{
+		std::cout << "  " << callNames[i] << " : " << current.issuedCalls[i] << " / " << current.redundantCalls[i]
+			<< " (" << current.issuedCalls[i] / frameNum << " / " << current.redundantCalls[i] / frameNum << " per frame)" << std::endl;
+	}
+}
+
+bool CachedCommandList::Issue(const StateCacheCall call, const bool isSame)
+{
+	if (isSame)
+	{
+		++stats.redundantCalls[(int)call];
+#ifdef STATE_CACHE
+		return false;
+#endif
+	}
+
+	++stats.issuedCalls[(int)call];
+	return true;
+}
+
+bool CachedCommandList::SetRootArgument(RootState& root, const UINT rootParameterIndex, const UINT64 value)
+{
+	if (rootParameterIndex >= root.arguments.size())
+		return Issue(StateCacheCall::RootArgument, false);
+
+	if (!Issue(StateCacheCall::RootArgument, root.arguments[rootParameterIndex] == value))
+		return false;
+
+	root.arguments[rootParameterIndex] = value;
+	return true;
+}
+
+bool CachedCommandList::SetRootConstants(RootState& root, const UINT rootParameterIndex, const UINT count, const void* data, const UINT offset)
+{
+	if (rootParameterIndex >= root.arguments.size())
+		return Issue(StateCacheCall::RootConstant, false);
+
+	UINT32& known = root.knownConstants[rootParameterIndex];
+	auto& constants = root.constants[rootParameterIndex];
+	const UINT32* values = static_cast<const UINT32*>(data);
+
+	// 기억할 수 없는 위치를 쓰는 호출은 비교하지 않고 전달하며, 겹치는 값은 잊는다.
+	if (offset + count > maxCachedConstants)
+	{
+		for (UINT i = offset; i < maxCachedConstants; ++i)
+			known &= ~(1u << i);
+		return Issue(StateCacheCall::RootConstant, false);
+	}
+
+	bool isSame = true;
+	for (UINT i = 0; isSame && i < count; ++i)
+		isSame = (known & (1u << (offset + i))) && constants[offset + i] == values[i];
+
+	if (!Issue(StateCacheCall::RootConstant, isSame))
+		return false;
+
+	for (UINT i = 0; i < count; ++i)
+	{
+		constants[offset + i] = values[i];
+		known |= 1u << (offset + i);
+	}
+	return true;
+}
+
+void CachedCommandList::InvalidateRootArguments(RootState& root)
+{
+	root.arguments.fill(unknownArgument);
+	root.knownConstants.fill(0);
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::QueryInterface(REFIID riid, void** ppvObject)
+{
+	if (ppvObject == nullptr)
+		return E_POINTER;
+
+	if (riid == __uuidof(ID3D12GraphicsCommandList) || riid == __uuidof(ID3D12CommandList) || riid == __uuidof(ID3D12DeviceChild) ||
+		riid == __uuidof(ID3D12Object) || riid == __uuidof(IUnknown))
+	{
+		*ppvObject = static_cast<ID3D12GraphicsCommandList*>(this);
+		AddRef();
+		return S_OK;
+	}
+
+	*ppvObject = nullptr;
+	return E_NOINTERFACE;
+}
+
+ULONG STDMETHODCALLTYPE CachedCommandList::AddRef()
+{
+	return ++refCount;
+}
+
+ULONG STDMETHODCALLTYPE CachedCommandList::Release()
+{
+	const ULONG count = --refCount;
+	if (count == 0)
+		delete this;
+	return count;
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::GetPrivateData(REFGUID guid, UINT* pDataSize, void* pData)
+{
+	return commandList->GetPrivateData(guid, pDataSize, pData);
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::SetPrivateData(REFGUID guid, UINT DataSize, const void* pData)
+{
+	return commandList->SetPrivateData(guid, DataSize, pData);
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::SetPrivateDataInterface(REFGUID guid, const IUnknown* pData)
+{
+	return commandList->SetPrivateDataInterface(guid, pData);
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::SetName(LPCWSTR Name)
+{
+	return commandList->SetName(Name);
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::GetDevice(REFIID riid, void** ppvDevice)
+{
+	return commandList->GetDevice(riid, ppvDevice);
+}
+
+D3D12_COMMAND_LIST_TYPE STDMETHODCALLTYPE CachedCommandList::GetType()
+{
+	return commandList->GetType();
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::Close()
+{
+	{
+		std::lock_guard<std::mutex> lock(statsMutex);
+		totalStats += stats;
+	}
+	stats = StateCacheStats();
+
+	return commandList->Close();
+}
+
+HRESULT STDMETHODCALLTYPE CachedCommandList::Reset(ID3D12CommandAllocator* pAllocator, ID3D12PipelineState* pInitialState)
+{
+	// 리셋된 명령 리스트의 상태는 초기 파이프라인 상태를 제외하고 모두 기본값이다.
+	Invalidate();
+	isPipelineStateKnown = true;
+	pipelineState = pInitialState;
+
+	return commandList->Reset(pAllocator, pInitialState);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ClearState(ID3D12PipelineState* pPipelineState)
+{
+	Invalidate();
+	isPipelineStateKnown = true;
+	pipelineState = pPipelineState;
+
+	commandList->ClearState(pPipelineState);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::DrawInstanced(UINT VertexCountPerInstance, UINT InstanceCount,
+	UINT StartVertexLocation, UINT StartInstanceLocation)
+{
+	commandList->DrawInstanced(VertexCountPerInstance, InstanceCount, StartVertexLocation, StartInstanceLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::DrawIndexedInstanced(UINT IndexCountPerInstance, UINT InstanceCount, UINT StartIndexLocation,
+	INT BaseVertexLocation, UINT StartInstanceLocation)
+{
+	commandList->DrawIndexedInstanced(IndexCountPerInstance, InstanceCount, StartIndexLocation, BaseVertexLocation, StartInstanceLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::Dispatch(UINT ThreadGroupCountX, UINT ThreadGroupCountY, UINT ThreadGroupCountZ)
+{
+	commandList->Dispatch(ThreadGroupCountX, ThreadGroupCountY, ThreadGroupCountZ);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::CopyBufferRegion(ID3D12Resource* pDstBuffer, UINT64 DstOffset, ID3D12Resource* pSrcBuffer,
+	UINT64 SrcOffset, UINT64 NumBytes)
+{
+	commandList->CopyBufferRegion(pDstBuffer, DstOffset, pSrcBuffer, SrcOffset, NumBytes);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION* pDst, UINT DstX, UINT DstY, UINT DstZ,
+	const D3D12_TEXTURE_COPY_LOCATION* pSrc, const D3D12_BOX* pSrcBox)
+{
+	commandList->CopyTextureRegion(pDst, DstX, DstY, DstZ, pSrc, pSrcBox);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::CopyResource(ID3D12Resource* pDstResource, ID3D12Resource* pSrcResource)
+{
+	commandList->CopyResource(pDstResource, pSrcResource);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::CopyTiles(ID3D12Resource* pTiledResource, const D3D12_TILED_RESOURCE_COORDINATE* pTileRegionStartCoordinate,
+	const D3D12_TILE_REGION_SIZE* pTileRegionSize, ID3D12Resource* pBuffer, UINT64 BufferStartOffsetInBytes, D3D12_TILE_COPY_FLAGS Flags)
+{
+	commandList->CopyTiles(pTiledResource, pTileRegionStartCoordinate, pTileRegionSize, pBuffer, BufferStartOffsetInBytes, Flags);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ResolveSubresource(ID3D12Resource* pDstResource, UINT DstSubresource, ID3D12Resource* pSrcResource,
+	UINT SrcSubresource, DXGI_FORMAT Format)
+{
+	commandList->ResolveSubresource(pDstResource, DstSubresource, pSrcResource, SrcSubresource, Format);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::IASetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY PrimitiveTopology)
+{
+	if (!Issue(StateCacheCall::Topology, topology == PrimitiveTopology && topology != D3D_PRIMITIVE_TOPOLOGY_UNDEFINED))
+		return;
+
+	topology = PrimitiveTopology;
+	commandList->IASetPrimitiveTopology(PrimitiveTopology);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::RSSetViewports(UINT NumViewports, const D3D12_VIEWPORT* pViewports)
+{
+	commandList->RSSetViewports(NumViewports, pViewports);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::RSSetScissorRects(UINT NumRects, const D3D12_RECT* pRects)
+{
+	commandList->RSSetScissorRects(NumRects, pRects);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::OMSetBlendFactor(const FLOAT BlendFactor[4])
+{
+	commandList->OMSetBlendFactor(BlendFactor);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::OMSetStencilRef(UINT StencilRef)
+{
+	commandList->OMSetStencilRef(StencilRef);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetPipelineState(ID3D12PipelineState* pPipelineState)
+{
+	if (!Issue(StateCacheCall::PipelineState, isPipelineStateKnown && pipelineState == pPipelineState))
+		return;
+
+	isPipelineStateKnown = true;
+	pipelineState = pPipelineState;
+	commandList->SetPipelineState(pPipelineState);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ResourceBarrier(UINT NumBarriers, const D3D12_RESOURCE_BARRIER* pBarriers)
+{
+	commandList->ResourceBarrier(NumBarriers, pBarriers);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ExecuteBundle(ID3D12GraphicsCommandList* pCommandList)
+{
+	// 번들은 파이프라인 상태와 루트 인자, 입력 조립 상태를 바꿀 수 있다.
+	// 렌더 타겟과 서술자 힙은 번들이 바꿀 수 없으므로 유지한다.
+	isPipelineStateKnown = false;
+	isGraphicsRootSignatureKnown = false;
+	isComputeRootSignatureKnown = false;
+	InvalidateRootArguments(graphicsRoot);
+	InvalidateRootArguments(computeRoot);
+	topology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	isVertexBufferKnown.fill(false);
+	isIndexBufferKnown = false;
+
+	commandList->ExecuteBundle(pCommandList);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetDescriptorHeaps(UINT NumDescriptorHeaps, ID3D12DescriptorHeap* const* ppDescriptorHeaps)
+{
+	bool isSame = NumDescriptorHeaps == descriptorHeapCount && NumDescriptorHeaps <= descriptorHeaps.size();
+	for (UINT i = 0; isSame && i < NumDescriptorHeaps; ++i)
+		isSame = descriptorHeaps[i] == ppDescriptorHeaps[i];
+
+	if (!Issue(StateCacheCall::DescriptorHeap, isSame))
+		return;
+
+	descriptorHeapCount = NumDescriptorHeaps <= descriptorHeaps.size() ? NumDescriptorHeaps : UINT_MAX;
+	for (UINT i = 0; i < NumDescriptorHeaps && i < descriptorHeaps.size(); ++i)
+		descriptorHeaps[i] = ppDescriptorHeaps[i];
+
+	// 서술자 테이블은 새로운 힙을 기준으로 다시 설정되어야 한다.
+	InvalidateRootArguments(graphicsRoot);
+	InvalidateRootArguments(computeRoot);
+
+	commandList->SetDescriptorHeaps(NumDescriptorHeaps, ppDescriptorHeaps);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetComputeRootSignature(ID3D12RootSignature* pRootSignature)
+{
+	if (!Issue(StateCacheCall::RootSignature, isComputeRootSignatureKnown && computeRootSignature == pRootSignature))
+		return;
+
+	// 루트 서명이 바뀌면 이전의 루트 인자는 모두 무효가 된다.
+	isComputeRootSignatureKnown = true;
+	computeRootSignature = pRootSignature;
+	InvalidateRootArguments(computeRoot);
+	commandList->SetComputeRootSignature(pRootSignature);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetGraphicsRootSignature(ID3D12RootSignature* pRootSignature)
+{
+	if (!Issue(StateCacheCall::RootSignature, isGraphicsRootSignatureKnown && graphicsRootSignature == pRootSignature))
+		return;
+
+	isGraphicsRootSignatureKnown = true;
+	graphicsRootSignature = pRootSignature;
+	InvalidateRootArguments(graphicsRoot);
+	commandList->SetGraphicsRootSignature(pRootSignature);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetComputeRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
+{
+	if (SetRootArgument(computeRoot, RootParameterIndex, BaseDescriptor.ptr))
+		commandList->SetComputeRootDescriptorTable(RootParameterIndex, BaseDescriptor);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetGraphicsRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
+{
+	if (SetRootArgument(graphicsRoot, RootParameterIndex, BaseDescriptor.ptr))
+		commandList->SetGraphicsRootDescriptorTable(RootParameterIndex, BaseDescriptor);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetComputeRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues)
+{
+	if (SetRootConstants(computeRoot, RootParameterIndex, 1, &SrcData, DestOffsetIn32BitValues))
+		commandList->SetComputeRoot32BitConstant(RootParameterIndex, SrcData, DestOffsetIn32BitValues);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetGraphicsRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues)
+{
+	if (SetRootConstants(graphicsRoot, RootParameterIndex, 1, &SrcData, DestOffsetIn32BitValues))
+		commandList->SetGraphicsRoot32BitConstant(RootParameterIndex, SrcData, DestOffsetIn32BitValues);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetComputeRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+	const void* pSrcData, UINT DestOffsetIn32BitValues)
+{
+	if (SetRootConstants(computeRoot, RootParameterIndex, Num32BitValuesToSet, pSrcData, DestOffsetIn32BitValues))
+		commandList->SetComputeRoot32BitConstants(RootParameterIndex, Num32BitValuesToSet, pSrcData, DestOffsetIn32BitValues);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetGraphicsRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+	const void* pSrcData, UINT DestOffsetIn32BitValues)
+{
+	if (SetRootConstants(graphicsRoot, RootParameterIndex, Num32BitValuesToSet, pSrcData, DestOffsetIn32BitValues))
+		commandList->SetGraphicsRoot32BitConstants(RootParameterIndex, Num32BitValuesToSet, pSrcData, DestOffsetIn32BitValues);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetComputeRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	if (SetRootArgument(computeRoot, RootParameterIndex, BufferLocation))
+		commandList->SetComputeRootConstantBufferView(RootParameterIndex, BufferLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetGraphicsRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	if (SetRootArgument(graphicsRoot, RootParameterIndex, BufferLocation))
+		commandList->SetGraphicsRootConstantBufferView(RootParameterIndex, BufferLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetComputeRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	if (SetRootArgument(computeRoot, RootParameterIndex, BufferLocation))
+		commandList->SetComputeRootShaderResourceView(RootParameterIndex, BufferLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetGraphicsRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	if (SetRootArgument(graphicsRoot, RootParameterIndex, BufferLocation))
+		commandList->SetGraphicsRootShaderResourceView(RootParameterIndex, BufferLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetComputeRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	if (SetRootArgument(computeRoot, RootParameterIndex, BufferLocation))
+		commandList->SetComputeRootUnorderedAccessView(RootParameterIndex, BufferLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetGraphicsRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	if (SetRootArgument(graphicsRoot, RootParameterIndex, BufferLocation))
+		commandList->SetGraphicsRootUnorderedAccessView(RootParameterIndex, BufferLocation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* pView)
+{
+	const bool isSame = pView && isIndexBufferKnown && std::memcmp(&indexBuffer, pView, sizeof(D3D12_INDEX_BUFFER_VIEW)) == 0;
+	if (!Issue(StateCacheCall::IndexBuffer, isSame))
+		return;
+
+	isIndexBufferKnown = pView != nullptr;
+	if (pView)
+		indexBuffer = *pView;
+	commandList->IASetIndexBuffer(pView);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::IASetVertexBuffers(UINT StartSlot, UINT NumViews, const D3D12_VERTEX_BUFFER_VIEW* pViews)
+{
+	const UINT slotCount = (UINT)vertexBuffers.size();
+
+	bool isSame = pViews != nullptr && StartSlot < slotCount && NumViews <= slotCount - StartSlot;
+	for (UINT i = 0; isSame && i < NumViews; ++i)
+	{
+		isSame = isVertexBufferKnown[StartSlot + i] &&
+			std::memcmp(&vertexBuffers[StartSlot + i], &pViews[i], sizeof(D3D12_VERTEX_BUFFER_VIEW)) == 0;
+	}
+
+	if (!Issue(StateCacheCall::VertexBuffer, isSame))
+		return;
+
+	for (UINT i = 0; i < NumViews && StartSlot + i < slotCount; ++i)
+	{
+		isVertexBufferKnown[StartSlot + i] = pViews != nullptr;
+		if (pViews)
+			vertexBuffers[StartSlot + i] = pViews[i];
+	}
+	commandList->IASetVertexBuffers(StartSlot, NumViews, pViews);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SOSetTargets(UINT StartSlot, UINT NumViews, const D3D12_STREAM_OUTPUT_BUFFER_VIEW* pViews)
+{
+	commandList->SOSetTargets(StartSlot, NumViews, pViews);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::OMSetRenderTargets(UINT NumRenderTargetDescriptors, const D3D12_CPU_DESCRIPTOR_HANDLE* pRenderTargetDescriptors,
+	BOOL RTsSingleHandleToDescriptorRange, const D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor)
+{
+	// 하나의 핸들로 연속된 범위를 지정한다면 첫 핸들만 비교한다.
+	const UINT handleCount = RTsSingleHandleToDescriptorRange ? (std::min)(NumRenderTargetDescriptors, 1u) : NumRenderTargetDescriptors;
+
+	bool isSame = isRenderTargetKnown && renderTargetCount == NumRenderTargetDescriptors &&
+		isSingleHandleRange == RTsSingleHandleToDescriptorRange && hasDepthStencil == (pDepthStencilDescriptor != nullptr) &&
+		(pDepthStencilDescriptor == nullptr || depthStencil.ptr == pDepthStencilDescriptor->ptr) &&
+		handleCount <= renderTargets.size();
+	for (UINT i = 0; isSame && i < handleCount; ++i)
+		isSame = renderTargets[i].ptr == pRenderTargetDescriptors[i].ptr;
+
+	if (!Issue(StateCacheCall::RenderTarget, isSame))
+		return;
+
+	isRenderTargetKnown = handleCount <= renderTargets.size();
+	renderTargetCount = NumRenderTargetDescriptors;
+	isSingleHandleRange = RTsSingleHandleToDescriptorRange;
+	for (UINT i = 0; i < handleCount && i < renderTargets.size(); ++i)
+		renderTargets[i] = pRenderTargetDescriptors[i];
+	hasDepthStencil = pDepthStencilDescriptor != nullptr;
+	if (pDepthStencilDescriptor)
+		depthStencil = *pDepthStencilDescriptor;
+
+	commandList->OMSetRenderTargets(NumRenderTargetDescriptors, pRenderTargetDescriptors, RTsSingleHandleToDescriptorRange, pDepthStencilDescriptor);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ClearDepthStencilView(D3D12_CPU_DESCRIPTOR_HANDLE DepthStencilView, D3D12_CLEAR_FLAGS ClearFlags,
+	FLOAT Depth, UINT8 Stencil, UINT NumRects, const D3D12_RECT* pRects)
+{
+	commandList->ClearDepthStencilView(DepthStencilView, ClearFlags, Depth, Stencil, NumRects, pRects);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ClearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView, const FLOAT ColorRGBA[4],
+	UINT NumRects, const D3D12_RECT* pRects)
+{
+	commandList->ClearRenderTargetView(RenderTargetView, ColorRGBA, NumRects, pRects);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ClearUnorderedAccessViewUint(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+	D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const UINT Values[4], UINT NumRects, const D3D12_RECT* pRects)
+{
+	commandList->ClearUnorderedAccessViewUint(ViewGPUHandleInCurrentHeap, ViewCPUHandle, pResource, Values, NumRects, pRects);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ClearUnorderedAccessViewFloat(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+	D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const FLOAT Values[4], UINT NumRects, const D3D12_RECT* pRects)
+{
+	commandList->ClearUnorderedAccessViewFloat(ViewGPUHandleInCurrentHeap, ViewCPUHandle, pResource, Values, NumRects, pRects);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::DiscardResource(ID3D12Resource* pResource, const D3D12_DISCARD_REGION* pRegion)
+{
+	commandList->DiscardResource(pResource, pRegion);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::BeginQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index)
+{
+	commandList->BeginQuery(pQueryHeap, Type, Index);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::EndQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index)
+{
+	commandList->EndQuery(pQueryHeap, Type, Index);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ResolveQueryData(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT StartIndex, UINT NumQueries,
+	ID3D12Resource* pDestinationBuffer, UINT64 AlignedDestinationBufferOffset)
+{
+	commandList->ResolveQueryData(pQueryHeap, Type, StartIndex, NumQueries, pDestinationBuffer, AlignedDestinationBufferOffset);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetPredication(ID3D12Resource* pBuffer, UINT64 AlignedBufferOffset, D3D12_PREDICATION_OP Operation)
+{
+	commandList->SetPredication(pBuffer, AlignedBufferOffset, Operation);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::SetMarker(UINT Metadata, const void* pData, UINT Size)
+{
+	commandList->SetMarker(Metadata, pData, Size);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::BeginEvent(UINT Metadata, const void* pData, UINT Size)
+{
+	commandList->BeginEvent(Metadata, pData, Size);
+}
+
+void STDMETHODCALLTYPE CachedCommandList::EndEvent()
+{
+	commandList->EndEvent();
+}
+
+void STDMETHODCALLTYPE CachedCommandList::ExecuteIndirect(ID3D12CommandSignature* pCommandSignature, UINT MaxCommandCount,
+	ID3D12Resource* pArgumentBuffer, UINT64 ArgumentBufferOffset, ID3D12Resource* pCountBuffer, UINT64 CountBufferOffset)
+{
+	// 명령 시그니처의 인자가 루트 인자와 정점, 인덱스 버퍼를 바꿀 수 있다.
+	InvalidateRootArguments(graphicsRoot);
+	InvalidateRootArguments(computeRoot);
+	isVertexBufferKnown.fill(false);
+	isIndexBufferKnown = false;
+
+	commandList->ExecuteIndirect(pCommandSignature, MaxCommandCount, pArgumentBuffer, ArgumentBufferOffset, pCountBuffer, CountBufferOffset);
+}
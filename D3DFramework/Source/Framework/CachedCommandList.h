@@ -0,0 +1,202 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <array>
+#include <atomic>
+#include <mutex>
+
+// 상태 캐시가 추적하는 상태 설정 호출의 종류
+enum class StateCacheCall : int
+{
+	PipelineState = 0,
+	RootSignature,
+	RootArgument,
+	RootConstant,
+	DescriptorHeap,
+	Topology,
+	VertexBuffer,
+	IndexBuffer,
+	RenderTarget,
+	Count
+};
+
+// 실제 명령 리스트로 전달된 호출과 이미 설정된 상태와 같은 호출의 개수
+// STATE_CACHE가 정의되어 있다면 같은 호출은 전달되지 않는다.
+struct StateCacheStats
+{
+	std::array<UINT64, (int)StateCacheCall::Count> issuedCalls = {};
+	std::array<UINT64, (int)StateCacheCall::Count> redundantCalls = {};
+
+	StateCacheStats& operator+=(const StateCacheStats& rhs);
+};
+
+/*
+실제 명령 리스트를 감싸 이미 설정된 상태를 다시 설정하는 호출을 걸러내는 명령 리스트
+파이프라인 상태, 루트 서명, 루트 인자(CBV, SRV, UAV, 서술자 테이블), 루트 상수, 서술자 힙,
+기본 도형 위상 구조, 정점 버퍼, 인덱스 버퍼, 렌더 타겟을 기억하며 나머지 호출은 그대로 전달한다.
+루트 상수는 루트 인자마다 앞쪽 maxCachedConstants개의 값만 기억하며, 그 밖의 값을 쓰는 호출은 항상 전달한다.
+명령 리스트마다 하나씩 만들어지고 한 스레드만이 기록하므로 캐시는 잠그지 않는다.
+Reset과 ClearState, 번들의 실행은 알 수 없는 상태를 만들므로 캐시를 비우고,
+루트 서명이 바뀌면 루트 인자를, 서술자 힙이 바뀌면 서술자 테이블을 다시 설정해야 한다.
+명령 큐에는 GetNative가 반환하는 실제 명령 리스트를 제출해야 한다.
+STATE_CACHE가 정의되어 있지 않다면 걸러내지 않고 호출의 개수만 센다.
+중복된 상태 설정의 개수는 이 클래스만 세며, 널 백엔드는 실제로 도달한 호출만 센다.
+*/
+class CachedCommandList final : public ID3D12GraphicsCommandList
+{
+private:
+	// 루트 인자마다 기억하는 루트 상수의 개수
+	static constexpr UINT maxCachedConstants = 32;
+
+	// 하나의 루트 서명에 설정된 루트 인자와 루트 상수
+	struct RootState
+	{
+		std::array<UINT64, D3D12_MAX_ROOT_COST> arguments;
+		std::array<std::array<UINT32, maxCachedConstants>, D3D12_MAX_ROOT_COST> constants;
+		// constants 중 값을 알고 있는 상수의 비트
+		std::array<UINT32, D3D12_MAX_ROOT_COST> knownConstants;
+	};
+
+public:
+	CachedCommandList(ID3D12GraphicsCommandList* commandList);
+	CachedCommandList(const CachedCommandList& rhs) = delete;
+	CachedCommandList& operator=(const CachedCommandList& rhs) = delete;
+	virtual ~CachedCommandList();
+
+public:
+	ID3D12GraphicsCommandList* GetNative() const;
+	// 기억하고 있는 상태를 모두 잊는다.
+	void Invalidate();
+
+	// 닫힌 명령 리스트들의 통계를 합친 값
+	static StateCacheStats GetStats();
+	static void ResetStats();
+	// 종류마다 전달된 호출과 걸러진 호출의 개수, 프레임당 평균을 출력한다.
+	static void PrintStats(const UINT32 frameCount);
+
+public:
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override;
+	virtual ULONG STDMETHODCALLTYPE AddRef() override;
+	virtual ULONG STDMETHODCALLTYPE Release() override;
+	virtual HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid, UINT* pDataSize, void* pData) override;
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid, UINT DataSize, const void* pData) override;
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID guid, const IUnknown* pData) override;
+	virtual HRESULT STDMETHODCALLTYPE SetName(LPCWSTR Name) override;
+	virtual HRESULT STDMETHODCALLTYPE GetDevice(REFIID riid, void** ppvDevice) override;
+	virtual D3D12_COMMAND_LIST_TYPE STDMETHODCALLTYPE GetType() override;
+
+	virtual HRESULT STDMETHODCALLTYPE Close() override;
+	virtual HRESULT STDMETHODCALLTYPE Reset(ID3D12CommandAllocator* pAllocator, ID3D12PipelineState* pInitialState) override;
+	virtual void STDMETHODCALLTYPE ClearState(ID3D12PipelineState* pPipelineState) override;
+	virtual void STDMETHODCALLTYPE DrawInstanced(UINT VertexCountPerInstance, UINT InstanceCount,
+		UINT StartVertexLocation, UINT StartInstanceLocation) override;
+	virtual void STDMETHODCALLTYPE DrawIndexedInstanced(UINT IndexCountPerInstance, UINT InstanceCount, UINT StartIndexLocation,
+		INT BaseVertexLocation, UINT StartInstanceLocation) override;
+	virtual void STDMETHODCALLTYPE Dispatch(UINT ThreadGroupCountX, UINT ThreadGroupCountY, UINT ThreadGroupCountZ) override;
+	virtual void STDMETHODCALLTYPE CopyBufferRegion(ID3D12Resource* pDstBuffer, UINT64 DstOffset, ID3D12Resource* pSrcBuffer,
+		UINT64 SrcOffset, UINT64 NumBytes) override;
+	virtual void STDMETHODCALLTYPE CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION* pDst, UINT DstX, UINT DstY, UINT DstZ,
+		const D3D12_TEXTURE_COPY_LOCATION* pSrc, const D3D12_BOX* pSrcBox) override;
+	virtual void STDMETHODCALLTYPE CopyResource(ID3D12Resource* pDstResource, ID3D12Resource* pSrcResource) override;
+	virtual void STDMETHODCALLTYPE CopyTiles(ID3D12Resource* pTiledResource, const D3D12_TILED_RESOURCE_COORDINATE* pTileRegionStartCoordinate,
+		const D3D12_TILE_REGION_SIZE* pTileRegionSize, ID3D12Resource* pBuffer, UINT64 BufferStartOffsetInBytes, D3D12_TILE_COPY_FLAGS Flags) override;
+	virtual void STDMETHODCALLTYPE ResolveSubresource(ID3D12Resource* pDstResource, UINT DstSubresource, ID3D12Resource* pSrcResource,
+		UINT SrcSubresource, DXGI_FORMAT Format) override;
+	virtual void STDMETHODCALLTYPE IASetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY PrimitiveTopology) override;
+	virtual void STDMETHODCALLTYPE RSSetViewports(UINT NumViewports, const D3D12_VIEWPORT* pViewports) override;
+	virtual void STDMETHODCALLTYPE RSSetScissorRects(UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE OMSetBlendFactor(const FLOAT BlendFactor[4]) override;
+	virtual void STDMETHODCALLTYPE OMSetStencilRef(UINT StencilRef) override;
+	virtual void STDMETHODCALLTYPE SetPipelineState(ID3D12PipelineState* pPipelineState) override;
+	virtual void STDMETHODCALLTYPE ResourceBarrier(UINT NumBarriers, const D3D12_RESOURCE_BARRIER* pBarriers) override;
+	virtual void STDMETHODCALLTYPE ExecuteBundle(ID3D12GraphicsCommandList* pCommandList) override;
+	virtual void STDMETHODCALLTYPE SetDescriptorHeaps(UINT NumDescriptorHeaps, ID3D12DescriptorHeap* const* ppDescriptorHeaps) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootSignature(ID3D12RootSignature* pRootSignature) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootSignature(ID3D12RootSignature* pRootSignature) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor) override;
+	virtual void STDMETHODCALLTYPE SetComputeRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetComputeRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+		const void* pSrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+		const void* pSrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* pView) override;
+	virtual void STDMETHODCALLTYPE IASetVertexBuffers(UINT StartSlot, UINT NumViews, const D3D12_VERTEX_BUFFER_VIEW* pViews) override;
+	virtual void STDMETHODCALLTYPE SOSetTargets(UINT StartSlot, UINT NumViews, const D3D12_STREAM_OUTPUT_BUFFER_VIEW* pViews) override;
+	virtual void STDMETHODCALLTYPE OMSetRenderTargets(UINT NumRenderTargetDescriptors, const D3D12_CPU_DESCRIPTOR_HANDLE* pRenderTargetDescriptors,
+		BOOL RTsSingleHandleToDescriptorRange, const D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor) override;
+	virtual void STDMETHODCALLTYPE ClearDepthStencilView(D3D12_CPU_DESCRIPTOR_HANDLE DepthStencilView, D3D12_CLEAR_FLAGS ClearFlags,
+		FLOAT Depth, UINT8 Stencil, UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE ClearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView, const FLOAT ColorRGBA[4],
+		UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewUint(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+		D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const UINT Values[4], UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+		D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const FLOAT Values[4], UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE DiscardResource(ID3D12Resource* pResource, const D3D12_DISCARD_REGION* pRegion) override;
+	virtual void STDMETHODCALLTYPE BeginQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index) override;
+	virtual void STDMETHODCALLTYPE EndQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index) override;
+	virtual void STDMETHODCALLTYPE ResolveQueryData(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT StartIndex, UINT NumQueries,
+		ID3D12Resource* pDestinationBuffer, UINT64 AlignedDestinationBufferOffset) override;
+	virtual void STDMETHODCALLTYPE SetPredication(ID3D12Resource* pBuffer, UINT64 AlignedBufferOffset, D3D12_PREDICATION_OP Operation) override;
+	virtual void STDMETHODCALLTYPE SetMarker(UINT Metadata, const void* pData, UINT Size) override;
+	virtual void STDMETHODCALLTYPE BeginEvent(UINT Metadata, const void* pData, UINT Size) override;
+	virtual void STDMETHODCALLTYPE EndEvent() override;
+	virtual void STDMETHODCALLTYPE ExecuteIndirect(ID3D12CommandSignature* pCommandSignature, UINT MaxCommandCount,
+		ID3D12Resource* pArgumentBuffer, UINT64 ArgumentBufferOffset, ID3D12Resource* pCountBuffer, UINT64 CountBufferOffset) override;
+
+private:
+	// 같은 상태라면 걸러진 호출로, 아니라면 전달된 호출로 센다. 전달해야 한다면 true를 반환한다.
+	bool Issue(const StateCacheCall call, const bool isSame);
+	// 루트 인자를 비교하고 기억한다. 전달해야 한다면 true를 반환한다.
+	bool SetRootArgument(RootState& root, const UINT rootParameterIndex, const UINT64 value);
+	// 루트 상수를 비교하고 기억한다. 전달해야 한다면 true를 반환한다.
+	bool SetRootConstants(RootState& root, const UINT rootParameterIndex, const UINT count, const void* data, const UINT offset);
+	void InvalidateRootArguments(RootState& root);
+
+private:
+	// 아직 알 수 없는 루트 인자
+	static constexpr UINT64 unknownArgument = UINT64_MAX;
+
+	static inline std::mutex statsMutex;
+	static inline StateCacheStats totalStats;
+
+	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> commandList;
+	std::atomic<ULONG> refCount = 1;
+
+	// Close될 때 totalStats에 더해진다.
+	StateCacheStats stats;
+
+	bool isPipelineStateKnown = false;
+	ID3D12PipelineState* pipelineState = nullptr;
+	bool isGraphicsRootSignatureKnown = false;
+	ID3D12RootSignature* graphicsRootSignature = nullptr;
+	bool isComputeRootSignatureKnown = false;
+	ID3D12RootSignature* computeRootSignature = nullptr;
+	RootState graphicsRoot;
+	RootState computeRoot;
+
+	UINT descriptorHeapCount = UINT_MAX;
+	std::array<ID3D12DescriptorHeap*, 2> descriptorHeaps = {};
+
+	D3D12_PRIMITIVE_TOPOLOGY topology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	std::array<bool, D3D12_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT> isVertexBufferKnown = {};
+	std::array<D3D12_VERTEX_BUFFER_VIEW, D3D12_IA_VERTEX_INPUT_RESOURCE_SLOT_COUNT> vertexBuffers = {};
+	bool isIndexBufferKnown = false;
+	D3D12_INDEX_BUFFER_VIEW indexBuffer = {};
+
+	bool isRenderTargetKnown = false;
+	UINT renderTargetCount = 0;
+	BOOL isSingleHandleRange = FALSE;
+	std::array<D3D12_CPU_DESCRIPTOR_HANDLE, D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT> renderTargets = {};
+	bool hasDepthStencil = false;
+	D3D12_CPU_DESCRIPTOR_HANDLE depthStencil = {};
+};
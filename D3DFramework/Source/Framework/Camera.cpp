@@ -26,7 +26,8 @@ XMFLOAT3 Camera::GetPosition3f()const
 
 void Camera::SetPosition(const float x, const float y, const float z)
 {
-	listener->SetPosition(x, y, z, DS3D_IMMEDIATE);
+	if (listener)
+		listener->SetPosition(x, y, z, DS3D_IMMEDIATE);
 	position = { x,y,z };
 
 	viewDirty = true;
@@ -34,7 +35,8 @@ void Camera::SetPosition(const float x, const float y, const float z)
 
 void Camera::SetPosition(const XMFLOAT3& v)
 {
-	listener->SetPosition(v.x, v.y, v.z, DS3D_IMMEDIATE);
+	if (listener)
+		listener->SetPosition(v.x, v.y, v.z, DS3D_IMMEDIATE);
 	position = v;
 
 	viewDirty = true;
@@ -16,7 +16,7 @@ public:
 	~Camera();
 
 public:
-	// fovY Degree 
+	// fovY는 Degree 기준
 	void SetLens(const float fovY, const float aspect, const float zn, const float zf);
 
 	void LookAt(const FXMVECTOR& pos, const FXMVECTOR& target, const FXMVECTOR& worldUp);
@@ -28,7 +28,7 @@ public:
 	void Pitch(const float angle);
 	void RotateY(const float angle);
 
-	// ī޶ ̵  ȸ Ͽٸ   ƮѴ.
+	// 카메라가 이동 및 회전을 하였다면 뷰 행렬을 업데이트한다.
 	void UpdateViewMatrix();
 
 public:
@@ -0,0 +1,502 @@
+#include "../PrecompiledHeader/pch.h"
+#include "ClothSolver.h"
+#include "Physics.h"
+#include "StopWatch.h"
+#include "../Object/Cloth.h"
+#include "ParallelFor.hpp"
+#include "FrameAllocator.h"
+
+void ClothData::Constraints::Clear()
+{
+	indexA.clear();
+	indexB.clear();
+	restLength.clear();
+	stiffness.clear();
+	colorOffsets.clear();
+}
+
+void ClothSolver::BuildCloth(ClothData& data, const UINT32 width, const UINT32 height, const float spacing,
+	const std::vector<bool>& isPinned, const XMMATRIX& world,
+	const float stretchStiffness, const float bendStiffness, const UINT32 iterations)
+{
+	data.width = width;
+	data.height = height;
+	data.particleCount = width * height;
+	// 더미 입자를 포함하여 4의 배수로 맞춘다.
+	data.paddedCount = (data.particleCount + 1 + 3) & ~3u;
+
+	data.posX.assign(data.paddedCount, 0.0f);
+	data.posY.assign(data.paddedCount, 0.0f);
+	data.posZ.assign(data.paddedCount, 0.0f);
+	data.invMass.assign(data.paddedCount, 0.0f);
+	data.localPos.resize(data.particleCount);
+
+	// 격자는 지역 공간의 xy평면에서 윗변을 기준으로 아래로 늘어진다.
+	for (UINT32 y = 0; y < height; ++y)
+	{
+		for (UINT32 x = 0; x < width; ++x)
+		{
+			const UINT32 i = y * width + x;
+			data.localPos[i] = XMFLOAT3(x * spacing, -(y * spacing), 0.0f);
+
+			XMFLOAT3 pos = Vector3::TransformCoord(data.localPos[i], world);
+			data.posX[i] = pos.x;
+			data.posY[i] = pos.y;
+			data.posZ[i] = pos.z;
+			data.invMass[i] = isPinned[i] ? 0.0f : 1.0f;
+		}
+	}
+
+	data.prevX = data.posX;
+	data.prevY = data.posY;
+	data.prevZ = data.posZ;
+
+	// PBD에서 강성은 반복 횟수에 따라 누적되므로 반복 횟수에 무관하도록 보정한다.
+	auto correctStiffness = [iterations](float k) {
+		return 1.0f - std::pow(1.0f - std::clamp(k, 0.0f, 1.0f), 1.0f / (float)(std::max)(iterations, 1u)); };
+	const float stretch = correctStiffness(stretchStiffness);
+	const float bend = correctStiffness(bendStiffness);
+
+	auto addConstraint = [&data](ClothData::Constraints& constraints, UINT32 a, UINT32 b, float k)
+	{
+		XMVECTOR posA = XMLoadFloat3(&data.localPos[a]);
+		XMVECTOR posB = XMLoadFloat3(&data.localPos[b]);
+
+		constraints.indexA.push_back(a);
+		constraints.indexB.push_back(b);
+		constraints.restLength.push_back(XMVectorGetX(XMVector3Length(posB - posA)));
+		constraints.stiffness.push_back(k);
+	};
+
+	data.distanceConstraints.Clear();
+	data.bendingConstraints.Clear();
+	data.attachmentConstraints.Clear();
+
+	for (UINT32 y = 0; y < height; ++y)
+	{
+		for (UINT32 x = 0; x < width; ++x)
+		{
+			const UINT32 i = y * width + x;
+
+			// 가로, 세로 및 대각선으로 이웃한 입자를 잇는 거리 제약 조건
+			if (x + 1 < width)
+				addConstraint(data.distanceConstraints, i, i + 1, stretch);
+			if (y + 1 < height)
+				addConstraint(data.distanceConstraints, i, i + width, stretch);
+			if (x + 1 < width && y + 1 < height)
+			{
+				addConstraint(data.distanceConstraints, i, i + width + 1, stretch);
+				addConstraint(data.distanceConstraints, i + 1, i + width, stretch);
+			}
+
+			// 한 칸을 건너뛴 입자를 잇는 굽힘 제약 조건
+			if (x + 2 < width)
+				addConstraint(data.bendingConstraints, i, i + 2, bend);
+			if (y + 2 < height)
+				addConstraint(data.bendingConstraints, i, i + width * 2, bend);
+		}
+	}
+
+	// 장거리 부착 제약 조건은 각 입자를 가장 가까운 고정 입자로부터
+	// 초기 거리 이상 멀어지지 않게 하여 반복 횟수가 적어도 천이 늘어나지 않게 한다.
+	data.attachmentConstraints.isUnilateral = true;
+	for (UINT32 i = 0; i < data.particleCount; ++i)
+	{
+		if (isPinned[i])
+			continue;
+
+		UINT32 nearest = UINT32_MAX;
+		float nearestDist = FLT_MAX;
+		for (UINT32 j = 0; j < data.particleCount; ++j)
+		{
+			if (!isPinned[j])
+				continue;
+
+			float dist = Vector3::Length(Vector3::Subtract(data.localPos[j], data.localPos[i]));
+			if (dist < nearestDist)
+			{
+				nearestDist = dist;
+				nearest = j;
+			}
+		}
+
+		if (nearest != UINT32_MAX)
+			addConstraint(data.attachmentConstraints, i, nearest, 1.0f);
+	}
+
+	ColorConstraints(data, data.distanceConstraints);
+	ColorConstraints(data, data.bendingConstraints);
+	ColorConstraints(data, data.attachmentConstraints);
+
+	CalculateBounds(data);
+}
+
+void ClothSolver::ColorConstraints(ClothData& data, ClothData::Constraints& constraints)
+{
+	const UINT32 constraintCount = (UINT32)constraints.indexA.size();
+	const UINT32 dummy = data.paddedCount - 1;
+
+	// 각 입자가 이미 사용한 색을 비트로 기록하고, 두 입자 모두 사용하지 않은
+	// 가장 작은 색을 고른다. 고정된 입자는 풀이에서 읽기만 하므로 공유해도 된다.
+	std::vector<UINT64> usedColors(data.paddedCount, 0);
+	std::vector<UINT32> colors(constraintCount);
+	UINT32 colorCount = 0;
+
+	for (UINT32 c = 0; c < constraintCount; ++c)
+	{
+		const UINT32 a = constraints.indexA[c];
+		const UINT32 b = constraints.indexB[c];
+
+		UINT64 used = 0;
+		if (data.invMass[a] > 0.0f) used |= usedColors[a];
+		if (data.invMass[b] > 0.0f) used |= usedColors[b];
+
+		UINT32 color = 0;
+		while (color < 63 && (used & (1ull << color)))
+			++color;
+		assert(color < 63 && "Too many constraint colors");
+
+		usedColors[a] |= (1ull << color);
+		usedColors[b] |= (1ull << color);
+		colors[c] = color;
+		colorCount = (std::max)(colorCount, color + 1);
+	}
+
+	// 색 별로 정렬하고 각 색을 4의 배수가 되도록 더미 제약 조건으로 채운다.
+	ClothData::Constraints sorted;
+	sorted.isUnilateral = constraints.isUnilateral;
+	sorted.colorOffsets.push_back(0);
+
+	for (UINT32 color = 0; color < colorCount; ++color)
+	{
+		for (UINT32 c = 0; c < constraintCount; ++c)
+		{
+			if (colors[c] != color)
+				continue;
+
+			sorted.indexA.push_back(constraints.indexA[c]);
+			sorted.indexB.push_back(constraints.indexB[c]);
+			sorted.restLength.push_back(constraints.restLength[c]);
+			sorted.stiffness.push_back(constraints.stiffness[c]);
+		}
+
+		while (sorted.indexA.size() % 4 != 0)
+		{
+			sorted.indexA.push_back(dummy);
+			sorted.indexB.push_back(dummy);
+			sorted.restLength.push_back(0.0f);
+			sorted.stiffness.push_back(0.0f);
+		}
+
+		sorted.colorOffsets.push_back((UINT32)sorted.indexA.size());
+	}
+
+	constraints = std::move(sorted);
+}
+
+void ClothSolver::Simulate(const std::vector<ObjectHandle>& cloths, const ObjectTable& objects, const float deltaTime)
+{
+	StopWatch stopWatch;
+	stopWatch.Start();
+
+	// 천과 충돌할 물체들의 월드 공간 바운드를 모은다.
+	colliders.clear();
+	for (GameObject* obj : objects)
+	{
+		const std::any bounding = obj->GetCollisionBounding();
+
+		ClothCollider collider;
+		collider.type = obj->GetCollisionType();
+
+		switch (collider.type)
+		{
+			case CollisionType::Sphere:
+				collider.sphere = std::any_cast<BoundingSphere>(bounding);
+				break;
+			case CollisionType::AABB:
+			{
+				const BoundingBox& aabb = std::any_cast<BoundingBox>(bounding);
+				collider.obb = BoundingOrientedBox(aabb.Center, aabb.Extents, XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f));
+				break;
+			}
+			case CollisionType::OBB:
+				collider.obb = std::any_cast<BoundingOrientedBox>(bounding);
+				break;
+			default:
+				continue;
+		}
+
+		colliders.push_back(collider);
+	}
+
+	workCloths.clear();
+	for (const auto handle : cloths)
+	{
+		Cloth* cloth = objects.Get<Cloth>(handle);
+		if (cloth)
+			workCloths.push_back(cloth);
+	}
+
+	// 천끼리는 데이터를 공유하지 않으므로 각 천을 병렬로 시뮬레이션한다.
+	ParallelFor((UINT32)workCloths.size(), 1, [this, deltaTime](const UINT32 i)
+	{
+		Step(workCloths[i]->GetClothData(), *workCloths[i], colliders, deltaTime);
+	});
+
+	for (auto cloth : workCloths)
+		cloth->UpdateBounds();
+
+	stopWatch.End();
+	lastSimulateTime = stopWatch.Nanosecond() / 1000000.0;
+}
+
+double ClothSolver::GetLastSimulateTime() const
+{
+	return lastSimulateTime;
+}
+
+void ClothSolver::Step(ClothData& data, const Cloth& cloth, std::span<const ClothCollider> colliders, const float deltaTime)
+{
+	if (data.particleCount == 0)
+		return;
+
+	const XMFLOAT3 acceleration = Vector3::Add(Physics::gravity, cloth.wind);
+	Predict(data, cloth.GetWorld(), acceleration, cloth.damping, deltaTime);
+
+	// 이번 스텝에서 천이 닿을 수 있는 충돌체만 추린다.
+	FrameVector<ClothCollider> nearColliders;
+	BoundingBox reach = data.bounds;
+	reach.Extents = Vector3::Add(reach.Extents, XMFLOAT3(cloth.thickness, cloth.thickness, cloth.thickness));
+	for (const auto& collider : colliders)
+	{
+		bool isNear = collider.type == CollisionType::Sphere ?
+			collider.sphere.Intersects(reach) : collider.obb.Intersects(reach);
+		if (isNear)
+			nearColliders.push_back(collider);
+	}
+
+	for (UINT32 i = 0; i < cloth.iterations; ++i)
+	{
+		SolveConstraints(data, data.distanceConstraints);
+		SolveConstraints(data, data.bendingConstraints);
+		SolveConstraints(data, data.attachmentConstraints);
+		SolveCollisions(data, nearColliders, cloth.thickness);
+	}
+
+	CalculateBounds(data);
+}
+
+void ClothSolver::Predict(ClothData& data, const XMMATRIX& world, const XMFLOAT3& acceleration,
+	const float damping, const float deltaTime)
+{
+	// 고정된 입자는 객체를 따라 움직인다.
+	for (UINT32 i = 0; i < data.particleCount; ++i)
+	{
+		if (data.invMass[i] > 0.0f)
+			continue;
+
+		XMFLOAT3 pos = Vector3::TransformCoord(data.localPos[i], world);
+		data.posX[i] = pos.x;
+		data.posY[i] = pos.y;
+		data.posZ[i] = pos.z;
+	}
+
+	// x' = x + (x - x_prev) * damping + a * dt^2를 4개씩 계산한다.
+	// 질량이 무한대인 입자는 속도와 가속도를 0으로 두어 제자리에 머문다.
+	const XMVECTOR zero = XMVectorZero();
+	const XMVECTOR damp = XMVectorReplicate(damping);
+	const float dt2 = deltaTime * deltaTime;
+	const XMVECTOR accX = XMVectorReplicate(acceleration.x * dt2);
+	const XMVECTOR accY = XMVectorReplicate(acceleration.y * dt2);
+	const XMVECTOR accZ = XMVectorReplicate(acceleration.z * dt2);
+
+	for (UINT32 i = 0; i < data.paddedCount; i += 4)
+	{
+		XMVECTOR mask = XMVectorGreater(XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&data.invMass[i])), zero);
+
+		XMVECTOR x = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&data.posX[i]));
+		XMVECTOR y = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&data.posY[i]));
+		XMVECTOR z = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&data.posZ[i]));
+
+		XMVECTOR vx = (x - XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&data.prevX[i]))) * damp + accX;
+		XMVECTOR vy = (y - XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&data.prevY[i]))) * damp + accY;
+		XMVECTOR vz = (z - XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&data.prevZ[i]))) * damp + accZ;
+
+		XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&data.prevX[i]), x);
+		XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&data.prevY[i]), y);
+		XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&data.prevZ[i]), z);
+
+		XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&data.posX[i]), x + XMVectorSelect(zero, vx, mask));
+		XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&data.posY[i]), y + XMVectorSelect(zero, vy, mask));
+		XMStoreFloat4(reinterpret_cast<XMFLOAT4*>(&data.posZ[i]), z + XMVectorSelect(zero, vz, mask));
+	}
+}
+
+void ClothSolver::SolveConstraints(ClothData& data, const ClothData::Constraints& constraints)
+{
+	// 같은 색 안에서는 입자가 겹치지 않으므로 여러 작업이 동시에 풀 수 있다.
+	// 색과 색 사이는 순서대로 진행하여 앞의 색이 갱신한 위치를 사용한다.
+	for (UINT32 color = 0; color < constraints.GetColorCount(); ++color)
+	{
+		const UINT32 colorBegin = constraints.colorOffsets[color];
+		const UINT32 colorEnd = constraints.colorOffsets[color + 1];
+		const UINT32 jobCount = (colorEnd - colorBegin + constraintsPerJob - 1) / constraintsPerJob;
+
+		ParallelFor(jobCount, 1, [&data, &constraints, colorBegin, colorEnd](const UINT32 job)
+		{
+			const UINT32 begin = colorBegin + job * constraintsPerJob;
+			SolveConstraintRange(data, constraints, begin, (std::min)(begin + constraintsPerJob, colorEnd));
+		});
+	}
+}
+
+void ClothSolver::SolveConstraintRange(ClothData& data, const ClothData::Constraints& constraints,
+	const UINT32 begin, const UINT32 end)
+{
+	const XMVECTOR zero = XMVectorZero();
+	const XMVECTOR epsilon = XMVectorReplicate(FLT_EPSILON);
+
+	float* px = data.posX.data();
+	float* py = data.posY.data();
+	float* pz = data.posZ.data();
+	const float* w = data.invMass.data();
+
+	const UINT32* indexA = constraints.indexA.data();
+	const UINT32* indexB = constraints.indexB.data();
+
+	// 같은 색 안에서는 입자가 겹치지 않으므로 4개의 제약 조건을 동시에 풀 수 있다.
+	for (UINT32 c = begin; c < end; c += 4)
+	{
+		const UINT32* a = &indexA[c];
+		const UINT32* b = &indexB[c];
+
+		XMVECTOR ax = XMVectorSet(px[a[0]], px[a[1]], px[a[2]], px[a[3]]);
+		XMVECTOR ay = XMVectorSet(py[a[0]], py[a[1]], py[a[2]], py[a[3]]);
+		XMVECTOR az = XMVectorSet(pz[a[0]], pz[a[1]], pz[a[2]], pz[a[3]]);
+		XMVECTOR bx = XMVectorSet(px[b[0]], px[b[1]], px[b[2]], px[b[3]]);
+		XMVECTOR by = XMVectorSet(py[b[0]], py[b[1]], py[b[2]], py[b[3]]);
+		XMVECTOR bz = XMVectorSet(pz[b[0]], pz[b[1]], pz[b[2]], pz[b[3]]);
+		XMVECTOR wa = XMVectorSet(w[a[0]], w[a[1]], w[a[2]], w[a[3]]);
+		XMVECTOR wb = XMVectorSet(w[b[0]], w[b[1]], w[b[2]], w[b[3]]);
+
+		XMVECTOR rest = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&constraints.restLength[c]));
+		XMVECTOR k = XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(&constraints.stiffness[c]));
+
+		XMVECTOR dx = bx - ax;
+		XMVECTOR dy = by - ay;
+		XMVECTOR dz = bz - az;
+		XMVECTOR length = XMVectorSqrt(dx * dx + dy * dy + dz * dz);
+
+		// C = |b - a| - rest, 단방향 제약 조건은 늘어난 경우만 보정한다.
+		XMVECTOR C = length - rest;
+		if (constraints.isUnilateral)
+			C = XMVectorMax(C, zero);
+
+		XMVECTOR denom = (wa + wb) * length;
+		XMVECTOR s = XMVectorSelect(zero, k * C / denom, XMVectorGreater(denom, epsilon));
+
+		XMVECTOR sa = s * wa;
+		XMVECTOR sb = s * wb;
+		ax += dx * sa; ay += dy * sa; az += dz * sa;
+		bx -= dx * sb; by -= dy * sb; bz -= dz * sb;
+
+		XMFLOAT4A outAX, outAY, outAZ, outBX, outBY, outBZ;
+		XMStoreFloat4A(&outAX, ax); XMStoreFloat4A(&outAY, ay); XMStoreFloat4A(&outAZ, az);
+		XMStoreFloat4A(&outBX, bx); XMStoreFloat4A(&outBY, by); XMStoreFloat4A(&outBZ, bz);
+
+		// 고정된 입자와 더미 입자는 같은 색의 여러 제약 조건이 공유하므로 쓰지 않는다.
+		// 값이 바뀌지 않더라도 여러 작업이 동시에 쓰면 데이터 경쟁이 된다.
+		const float* outA[3] = { &outAX.x, &outAY.x, &outAZ.x };
+		const float* outB[3] = { &outBX.x, &outBY.x, &outBZ.x };
+		for (UINT32 lane = 0; lane < 4; ++lane)
+		{
+			if (w[a[lane]] > 0.0f)
+			{
+				px[a[lane]] = outA[0][lane]; py[a[lane]] = outA[1][lane]; pz[a[lane]] = outA[2][lane];
+			}
+			if (w[b[lane]] > 0.0f)
+			{
+				px[b[lane]] = outB[0][lane]; py[b[lane]] = outB[1][lane]; pz[b[lane]] = outB[2][lane];
+			}
+		}
+	}
+}
+
+void ClothSolver::SolveCollisions(ClothData& data, std::span<const ClothCollider> colliders, const float thickness)
+{
+	for (const auto& collider : colliders)
+	{
+		if (collider.type == CollisionType::Sphere)
+		{
+			const XMVECTOR center = XMLoadFloat3(&collider.sphere.Center);
+			const float radius = collider.sphere.Radius + thickness;
+
+			for (UINT32 i = 0; i < data.particleCount; ++i)
+			{
+				if (data.invMass[i] <= 0.0f)
+					continue;
+
+				XMVECTOR pos = XMVectorSet(data.posX[i], data.posY[i], data.posZ[i], 0.0f);
+				XMVECTOR diff = pos - center;
+				float dist = XMVectorGetX(XMVector3Length(diff));
+				if (dist >= radius || dist <= FLT_EPSILON)
+					continue;
+
+				// 구의 표면으로 밀어낸다.
+				pos = center + diff * (radius / dist);
+				data.posX[i] = XMVectorGetX(pos);
+				data.posY[i] = XMVectorGetY(pos);
+				data.posZ[i] = XMVectorGetZ(pos);
+			}
+		}
+		else
+		{
+			// 입자를 박스의 지역 공간으로 옮겨 가장 얕게 파고든 축으로 밀어낸다.
+			const XMVECTOR center = XMLoadFloat3(&collider.obb.Center);
+			const XMVECTOR orientation = XMLoadFloat4(&collider.obb.Orientation);
+			const XMFLOAT3 extents = Vector3::Add(collider.obb.Extents, XMFLOAT3(thickness, thickness, thickness));
+
+			for (UINT32 i = 0; i < data.particleCount; ++i)
+			{
+				if (data.invMass[i] <= 0.0f)
+					continue;
+
+				XMVECTOR pos = XMVectorSet(data.posX[i], data.posY[i], data.posZ[i], 0.0f);
+				XMFLOAT3 local;
+				XMStoreFloat3(&local, XMVector3InverseRotate(pos - center, orientation));
+
+				const float depth[3] = {
+					extents.x - fabsf(local.x), extents.y - fabsf(local.y), extents.z - fabsf(local.z) };
+				if (depth[0] <= 0.0f || depth[1] <= 0.0f || depth[2] <= 0.0f)
+					continue;
+
+				float* axis[3] = { &local.x, &local.y, &local.z };
+				const float* axisExtents[3] = { &extents.x, &extents.y, &extents.z };
+				UINT32 minAxis = 0;
+				if (depth[1] < depth[minAxis]) minAxis = 1;
+				if (depth[2] < depth[minAxis]) minAxis = 2;
+				*axis[minAxis] = *axis[minAxis] >= 0.0f ? *axisExtents[minAxis] : -*axisExtents[minAxis];
+
+				pos = XMVector3Rotate(XMLoadFloat3(&local), orientation) + center;
+				data.posX[i] = XMVectorGetX(pos);
+				data.posY[i] = XMVectorGetY(pos);
+				data.posZ[i] = XMVectorGetZ(pos);
+			}
+		}
+	}
+}
+
+void ClothSolver::CalculateBounds(ClothData& data)
+{
+	XMVECTOR minPos = XMVectorReplicate(FLT_MAX);
+	XMVECTOR maxPos = XMVectorReplicate(-FLT_MAX);
+
+	for (UINT32 i = 0; i < data.particleCount; ++i)
+	{
+		XMVECTOR pos = XMVectorSet(data.posX[i], data.posY[i], data.posZ[i], 0.0f);
+		minPos = XMVectorMin(minPos, pos);
+		maxPos = XMVectorMax(maxPos, pos);
+	}
+
+	BoundingBox::CreateFromPoints(data.bounds, minPos, maxPos);
+}
@@ -0,0 +1,123 @@
+#pragma once
+
+#include "Enumeration.h"
+#include "Vector.h"
+#include "ObjectTable.h"
+#include <DirectXCollision.h>
+#include <span>
+
+class Cloth;
+class GameObject;
+
+/*
+천의 입자와 제약 조건을 SoA 형태로 저장하는 구조체
+입자와 제약 조건은 SIMD로 4개씩 처리할 수 있도록 4의 배수로 채워진다.
+마지막 입자는 질량이 무한대인 더미 입자로, 채워진 제약 조건들이 가리킨다.
+*/
+struct ClothData
+{
+	// 하나의 제약 조건 집합. 같은 색의 제약 조건은 서로 입자를 공유하지 않으므로
+	// 4개씩 묶어 동시에 풀 수 있다. colorOffsets[i]부터 colorOffsets[i + 1]까지가 i번째 색이다.
+	struct Constraints
+	{
+		std::vector<UINT32> indexA;
+		std::vector<UINT32> indexB;
+		std::vector<float> restLength;
+		std::vector<float> stiffness;
+		std::vector<UINT32> colorOffsets;
+
+		// 최대 길이만을 제한하는 제약 조건이라면 true이다.
+		bool isUnilateral = false;
+
+		void Clear();
+		UINT32 GetColorCount() const { return colorOffsets.empty() ? 0 : (UINT32)colorOffsets.size() - 1; }
+	};
+
+	UINT32 width = 0;
+	UINT32 height = 0;
+	// 실제 입자의 개수(width * height)와 더미를 포함해 채워진 입자의 개수
+	UINT32 particleCount = 0;
+	UINT32 paddedCount = 0;
+
+	std::vector<float> posX, posY, posZ;
+	std::vector<float> prevX, prevY, prevZ;
+	std::vector<float> invMass;
+
+	// 객체의 지역 공간에서의 초기 위치. 고정된 입자는 매 스텝 이 위치로 옮겨진다.
+	std::vector<XMFLOAT3> localPos;
+
+	Constraints distanceConstraints;
+	Constraints bendingConstraints;
+	Constraints attachmentConstraints;
+
+	// 시뮬레이션이 끝난 후 입자들을 감싸는 월드 공간의 AABB
+	BoundingBox bounds;
+};
+
+/*
+천이 충돌하는 물체의 월드 공간 바운드. AABB는 회전이 없는 OBB로 다룬다.
+*/
+struct ClothCollider
+{
+	CollisionType type = CollisionType::None;
+	BoundingSphere sphere;
+	BoundingOrientedBox obb;
+};
+
+/*
+Position Based Dynamics로 천을 시뮬레이션하는 클래스
+입자를 예측한 위치로 옮긴 후, 거리, 굽힘, 장거리 부착 제약 조건을 반복하여 투영한다.
+제약 조건은 그래프 색칠로 나누어 같은 색끼리 SIMD로 4개씩 풀고,
+한 색의 제약 조건들은 constraintsPerJob개씩 나누어 워커 스레드에서 병렬로 푼다.
+천과 천은 서로 독립적이므로 여러 천도 병렬로 시뮬레이션한다.
+*/
+class ClothSolver
+{
+public:
+	// 한 작업이 푸는 같은 색의 제약 조건 개수. 4의 배수여야 한다.
+	static constexpr UINT32 constraintsPerJob = 256;
+
+public:
+	ClothSolver() = default;
+	ClothSolver(const ClothSolver& rhs) = delete;
+	ClothSolver& operator=(const ClothSolver& rhs) = delete;
+	~ClothSolver() = default;
+
+public:
+	// 격자 형태의 입자들과 제약 조건을 생성한다. isPinned가 true인 입자는 고정된다.
+	// 반복 횟수에 상관없이 같은 강성이 되도록 강성을 반복 횟수에 맞게 보정한다.
+	static void BuildCloth(ClothData& data, const UINT32 width, const UINT32 height, const float spacing,
+		const std::vector<bool>& isPinned, const XMMATRIX& world,
+		const float stretchStiffness, const float bendStiffness, const UINT32 iterations);
+
+	// 모든 천을 병렬로 한 스텝 시뮬레이션한다.
+	// 충돌 가능한 물체들의 바운드를 모은 후 각 천마다 입자와 충돌시킨다.
+	// cloths는 objects에 들어있는 천 객체들의 핸들이다.
+	void Simulate(const std::vector<ObjectHandle>& cloths, const ObjectTable& objects, const float deltaTime);
+
+	// 마지막 Simulate에 걸린 시간(ms)
+	double GetLastSimulateTime() const;
+
+private:
+	// 예측, 제약 조건 투영, 충돌 순으로 한 천을 시뮬레이션한다.
+	static void Step(ClothData& data, const Cloth& cloth, std::span<const ClothCollider> colliders, const float deltaTime);
+	// 고정된 입자를 객체의 월드 행렬에 맞게 옮긴 후 나머지 입자의 위치를 예측한다.
+	static void Predict(ClothData& data, const XMMATRIX& world, const XMFLOAT3& acceleration,
+		const float damping, const float deltaTime);
+	// 한 제약 조건 집합을 색 순서대로 투영한다. 같은 색의 제약 조건들은 병렬로 푼다.
+	static void SolveConstraints(ClothData& data, const ClothData::Constraints& constraints);
+	// 같은 색의 [begin, end) 구간의 제약 조건을 4개씩 투영한다.
+	static void SolveConstraintRange(ClothData& data, const ClothData::Constraints& constraints,
+		const UINT32 begin, const UINT32 end);
+	// 입자를 충돌체 바깥으로 밀어낸다.
+	static void SolveCollisions(ClothData& data, std::span<const ClothCollider> colliders, const float thickness);
+	static void CalculateBounds(ClothData& data);
+
+	// 입자를 공유하지 않도록 제약 조건을 색칠하고, 색 별로 정렬하여 4의 배수로 채운다.
+	static void ColorConstraints(ClothData& data, ClothData::Constraints& constraints);
+
+private:
+	std::vector<ClothCollider> colliders;
+	std::vector<Cloth*> workCloths;
+	double lastSimulateTime = 0.0;
+};
@@ -3,6 +3,10 @@
 #include "Ssao.h"
 #include "Ssr.h"
 #include "AssetManager.h"
+#include "NullDevice.h"
+#include "CachedCommandList.h"
+#include "IndirectDraw.h"
+#include "StopWatch.h"
 
 using Microsoft::WRL::ComPtr;
 
@@ -20,6 +24,7 @@ D3DApp::~D3DApp()
 	dxgiFactory = nullptr;
 	swapChain = nullptr;
 	d3dDevice = nullptr;
+	nullDevice = nullptr;
 
 	fence = nullptr;
 	commandQueue = nullptr;
@@ -64,6 +69,52 @@ void D3DApp::Tick(float deltaTime)
 	__super::Tick(deltaTime);
 }
 
+int D3DApp::RunHeadless(const UINT32 frameCount, const float deltaTime)
+{
+	StopWatch stopWatch;
+	double totalTime = 0.0;
+	double minTime = (std::numeric_limits<double>::max)();
+	double maxTime = 0.0;
+
+	ResetFrameStats();
+
+	for (UINT32 i = 0; i < frameCount; ++i)
+	{
+		stopWatch.Start();
+		Tick(deltaTime);
+		Render();
+		stopWatch.End();
+
+		const double frameTime = stopWatch.Nanosecond() / 1000000.0;
+		totalTime += frameTime;
+		minTime = (std::min)(minTime, frameTime);
+		maxTime = (std::max)(maxTime, frameTime);
+	}
+
+	// 마지막 프레임의 기록까지 끝낸 뒤에 통계를 출력한다.
+	OnDestroy();
+
+	std::cout << "Headless : " << frameCount << " frames, avg " << totalTime / (std::max)(frameCount, 1u)
+		<< "ms, min " << (frameCount > 0 ? minTime : 0.0) << "ms, max " << maxTime << "ms" << std::endl;
+	PrintFrameStats(frameCount);
+
+	return 0;
+}
+
+void D3DApp::ResetFrameStats()
+{
+	if (nullDevice)
+		nullDevice->ResetStats();
+	CachedCommandList::ResetStats();
+}
+
+void D3DApp::PrintFrameStats(const UINT32 frameCount) const
+{
+	if (nullDevice)
+		nullDevice->PrintStats(frameCount);
+	CachedCommandList::PrintStats(frameCount);
+}
+
 void D3DApp::OnDestroy()
 {
 	__super::OnDestroy();
@@ -71,12 +122,13 @@ void D3DApp::OnDestroy()
 	if (d3dDevice != nullptr)
 		FlushCommandQueue();
 
-	swapChain->SetFullscreenState(false, nullptr);
+	if (swapChain)
+		swapChain->SetFullscreenState(false, nullptr);
 }
 
 void D3DApp::CreateRtvAndDsvDescriptorHeaps(const UINT32 shadowMapNum)
 {
-	// Ÿ 並 Ѵ.
+	// 렌더타겟 뷰를 생성한다.
 	D3D12_DESCRIPTOR_HEAP_DESC rtvHeapDesc;
 #if defined(SSAO) || defined(SSR)
 	rtvHeapDesc.NumDescriptors = SWAP_CHAIN_BUFFER_COUNT + DEFERRED_BUFFER_COUNT + 3; // Ssao Map, Ssr Map
@@ -89,7 +141,7 @@ void D3DApp::CreateRtvAndDsvDescriptorHeaps(const UINT32 shadowMapNum)
 	ThrowIfFailed(d3dDevice->CreateDescriptorHeap(
 		&rtvHeapDesc, IID_PPV_ARGS(rtvHeap.GetAddressOf())));
 
-	//  ٽ 並 Ѵ.
+	// 깊이 스텐실 뷰를 생성한다.
 	D3D12_DESCRIPTOR_HEAP_DESC dsvHeapDesc;
 	dsvHeapDesc.NumDescriptors = 1 + shadowMapNum;
 	dsvHeapDesc.Type = D3D12_DESCRIPTOR_HEAP_TYPE_DSV;
@@ -103,49 +155,68 @@ void D3DApp::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 {
 	__super::OnResize(screenWidth, screenHeight);
 
-	if (!d3dDevice || !swapChain || !mainCommandAlloc)
+	if (!d3dDevice || !mainCommandAlloc)
+		return;
+	if (!swapChain && renderBackend == RenderBackend::D3D12)
 		return;
 
-	// ҽ ϱ  ɵ .
+	// 리소스를 변경하기 전에 명령들을 비운다.
 	FlushCommandQueue();
 
 	ThrowIfFailed(mainCommandList->Reset(mainCommandAlloc.Get(), nullptr));
 
-	// ҽ     ҽ Ѵ.
+	// 리소스를 새로 만들기 위해 기존의 리소스를 해제한다.
 	for (int i = 0; i < SWAP_CHAIN_BUFFER_COUNT; ++i)
 		swapChainBuffer[i].Reset();
 	for (int i = 0; i < DEFERRED_BUFFER_COUNT; ++i)
 		deferredBuffer[i].Reset();
 	depthStencilBuffer.Reset();
 
-	// SwapChain ResizeѴ.
-	ThrowIfFailed(swapChain->ResizeBuffers(
-		SWAP_CHAIN_BUFFER_COUNT,
-		screenWidth, screenHeight,
-		backBufferFormat,
-		DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH));
+	// SwapChain을 Resize한다.
+	if (swapChain)
+	{
+		ThrowIfFailed(swapChain->ResizeBuffers(
+			SWAP_CHAIN_BUFFER_COUNT,
+			screenWidth, screenHeight,
+			backBufferFormat,
+			DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH));
+	}
 
 	currentBackBuffer = 0;
 
 	CD3DX12_CPU_DESCRIPTOR_HANDLE rtvHeapHandle(rtvHeap->GetCPUDescriptorHandleForHeapStart());
 	for (UINT i = 0; i < SWAP_CHAIN_BUFFER_COUNT; i++)
 	{
-		//  Ÿ ۸ Ѵ.
-		ThrowIfFailed(swapChain->GetBuffer(i, IID_PPV_ARGS(&swapChainBuffer[i])));
+		// 렌더 타겟 버퍼를 생성한다.
+		if (swapChain)
+		{
+			ThrowIfFailed(swapChain->GetBuffer(i, IID_PPV_ARGS(&swapChainBuffer[i])));
+		}
+		// 교환 사슬이 없다면 같은 형식의 텍스처를 후면 버퍼로 사용한다.
+		else
+		{
+			ThrowIfFailed(d3dDevice->CreateCommittedResource(
+				&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
+				D3D12_HEAP_FLAG_NONE,
+				&CD3DX12_RESOURCE_DESC::Tex2D(backBufferFormat, screenWidth, screenHeight, 1, 1, 1, 0, D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET),
+				D3D12_RESOURCE_STATE_PRESENT,
+				nullptr,
+				IID_PPV_ARGS(&swapChainBuffer[i])));
+		}
 
-		//  並 Ѵ.
+		// 서술자 뷰를 정의한다.
 		D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
 		rtvDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
 		rtvDesc.Format = backBufferFormat;
 		rtvDesc.Texture2D.MipSlice = 0;
 		rtvDesc.Texture2D.PlaneSlice = 0;
 
-		//  Ÿ 並 Ѵ.
+		// 렌더 타겟 뷰를 생성한다.
 		d3dDevice->CreateRenderTargetView(swapChainBuffer[i].Get(), &rtvDesc, rtvHeapHandle);
 		rtvHeapHandle.Offset(1, DescriptorSize::rtvDescriptorSize);
 	}
 
-	// Gۿ   ҽ ڸ Ѵ.
+	// G버퍼에 사용될 공통적인 리소스 서술자를 정의한다.
 	D3D12_RESOURCE_DESC defferedBufferDesc;
 	ZeroMemory(&defferedBufferDesc, sizeof(defferedBufferDesc));
 	defferedBufferDesc.Dimension = D3D12_RESOURCE_DIMENSION_TEXTURE2D;
@@ -159,7 +230,7 @@ void D3DApp::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 	defferedBufferDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
 	defferedBufferDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
 
-	// Gۿ    Ÿ ڸ Ѵ.
+	// G버퍼에 사용될 공통적인 렌더 타겟 서술자를 정의한다.
 	D3D12_RENDER_TARGET_VIEW_DESC defferedBufferRtvDesc;
 	ZeroMemory(&defferedBufferRtvDesc, sizeof(defferedBufferRtvDesc));
 	defferedBufferRtvDesc.Texture2D.MipSlice = 0;
@@ -171,7 +242,7 @@ void D3DApp::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 		CD3DX12_CLEAR_VALUE optClear = CD3DX12_CLEAR_VALUE(deferredBufferFormats[i], (float*)&deferredBufferClearColors[i]);
 		defferedBufferDesc.Format = deferredBufferFormats[i];
 		
-		// G ҽ Ѵ.
+		// G버퍼 리소스를 생성한다.
 		ThrowIfFailed(d3dDevice->CreateCommittedResource(
 			&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 			D3D12_HEAP_FLAG_NONE,
@@ -180,31 +251,31 @@ void D3DApp::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 			&optClear,
 			IID_PPV_ARGS(deferredBuffer[i].GetAddressOf())));
 
-		// G Ÿ 並 Ѵ.
+		// G버퍼의 렌더타겟 뷰를 생성한다.
 		d3dDevice->CreateRenderTargetView(deferredBuffer[i].Get(), &defferedBufferRtvDesc, rtvHeapHandle);
 		rtvHeapHandle.Offset(1, DescriptorSize::rtvDescriptorSize);
 	}
 
-	//  ٽ ۸ ϱ  ҽ ڸ Ѵ.
+	// 깊이 스텐실 버퍼를 생성하기 위한 리소스 서술자를 정의한다.
 	D3D12_RESOURCE_DESC depthStencilDesc = defferedBufferDesc;
 	depthStencilDesc.Format = depthStencilFormat;
 	depthStencilDesc.SampleDesc.Count = GetOptionEnabled(Option::Msaa) ? 4 : 1;
 	depthStencilDesc.SampleDesc.Quality = GetOptionEnabled(Option::Msaa) ? (msaaQuality - 1) : 0;
 	depthStencilDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_DEPTH_STENCIL;
 
-	//  ٽ ۸ ϱ   並 Ѵ.
+	// 깊이 스텐실 버퍼를 생성하기 위한 서술자 뷰를 정의한다.
 	D3D12_DEPTH_STENCIL_VIEW_DESC dsvDesc = {};
 	dsvDesc.Format = depthStencilFormat;
 	dsvDesc.ViewDimension = GetOptionEnabled(Option::Fullscreen) ? D3D12_DSV_DIMENSION_TEXTURE2DMS : D3D12_DSV_DIMENSION_TEXTURE2D;
 
-	// ⿡ ȭ  Ѵ. ȭ  
-	// ϴ  ȣ  ʴ ȣ⺸   ִ.
+	// 지우기에 최적화된 값을 설정한다. 최적화된 지우기 값과
+	// 부합하는 지우기 호출은 부합하지 않는 호출보다 빠를 수 있다.
 	D3D12_CLEAR_VALUE optClear;
 	optClear.Format = depthStencilFormat;
 	optClear.DepthStencil.Depth = 1.0f;
 	optClear.DepthStencil.Stencil = 0;
 
-	//  ٽ ۸ Ѵ.
+	// 깊이 스텐실 버퍼를 생성한다.
 	ThrowIfFailed(d3dDevice->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -213,22 +284,22 @@ void D3DApp::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 		&optClear,
 		IID_PPV_ARGS(depthStencilBuffer.GetAddressOf())));
 
-	//  ٽ  並 Ѵ.
+	// 깊이 스텐실 서술자 뷰를 생성한다.
 	d3dDevice->CreateDepthStencilView(depthStencilBuffer.Get(), &dsvDesc, GetDepthStencilView());
 
-	//  ۷μ ϱ    Ѵ.
+	// 깊이 버퍼로서 사용하기 위해 상태 이전을 한다.
 	mainCommandList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(depthStencilBuffer.Get(),
 		D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_DEPTH_WRITE));
 
-	// Resize  Ѵ.
+	// Resize 명령을 실행한다.
 	ThrowIfFailed(mainCommandList->Close());
 	ID3D12CommandList* cmdsLists[] = { mainCommandList.Get() };
 	commandQueue->ExecuteCommandLists(_countof(cmdsLists), cmdsLists);
 
-	// Resize Ϸ  ٸ.
+	// Resize가 완료될 때까지 기다린다.
 	FlushCommandQueue();
 
-	// Viewport ScissorRect ƮѴ.
+	// Viewport와 ScissorRect를 업데이트한다.
 	screenViewport.TopLeftX = 0;
 	screenViewport.TopLeftY = 0;
 	screenViewport.Width = static_cast<float>(screenWidth);
@@ -241,7 +312,8 @@ void D3DApp::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 bool D3DApp::InitDirect3D()
 {
 #if defined(DEBUG) || defined(_DEBUG) 
-	// D3D12   ȰȭѴ.
+	// D3D12 디버그 층을 활성화한다.
+	if (renderBackend == RenderBackend::D3D12)
 	{
 		ComPtr<ID3D12Debug> debugController;
 		ThrowIfFailed(D3D12GetDebugInterface(IID_PPV_ARGS(&debugController)));
@@ -251,51 +323,69 @@ bool D3DApp::InitDirect3D()
 
 	CreateDevice();
 	CreateCommandObjects();
-	CreateSwapChain();
-	CreateSoundBuffer();
+
+	// 널 백엔드는 창이 없으므로 교환 사슬과 사운드를 만들지 않는다.
+	if (renderBackend == RenderBackend::D3D12)
+	{
+		CreateSwapChain();
+		CreateSoundBuffer();
+	}
+
 	CreateRtvAndDsvDescriptorHeaps(LIGHT_NUM);
 	CreateShadersAndInputLayout();
 
-	// Alt-Enter ȰȭѴ.
-	dxgiFactory->MakeWindowAssociation(hMainWnd, DXGI_MWA_NO_ALT_ENTER);
+	if (dxgiFactory)
+	{
+		// Alt-Enter를 비활성화한다.
+		dxgiFactory->MakeWindowAssociation(hMainWnd, DXGI_MWA_NO_ALT_ENTER);
 
 #ifdef _DEBUG
-	LogAdapters();
+		LogAdapters();
 #endif
+	}
 
 	return true;
 }
 
 void D3DApp::CreateDevice()
 {
-	ThrowIfFailed(CreateDXGIFactory1(IID_PPV_ARGS(&dxgiFactory)));
-
-	HRESULT hardwareResult = D3D12CreateDevice(
-		nullptr,             // default adapter
-		D3D_FEATURE_LEVEL_11_0,
-		IID_PPV_ARGS(&d3dDevice));
-
-	// D3D12Device  Ϳ Ͽٸ ϵ ׷ ɼ
-	// 䳻 WARP(Ʈ ÷ ) Ѵ.
-	if (FAILED(hardwareResult))
+	if (renderBackend == RenderBackend::Null)
+	{
+		// 생성할 때의 참조를 d3dDevice가 가진다.
+		nullDevice = new NullDevice();
+		d3dDevice.Attach(nullDevice);
+	}
+	else
 	{
-		ComPtr<IDXGIAdapter> pWarpAdapter;
-		ThrowIfFailed(dxgiFactory->EnumWarpAdapter(IID_PPV_ARGS(&pWarpAdapter)));
+		ThrowIfFailed(CreateDXGIFactory1(IID_PPV_ARGS(&dxgiFactory)));
 
-		ThrowIfFailed(D3D12CreateDevice(
-			pWarpAdapter.Get(),
+		HRESULT hardwareResult = D3D12CreateDevice(
+			nullptr,             // default adapter
 			D3D_FEATURE_LEVEL_11_0,
-			IID_PPV_ARGS(&d3dDevice)));
+			IID_PPV_ARGS(&d3dDevice));
+
+		// D3D12Device를 만드는 것에 실패하였다면 하드웨어 그래픽 기능성을
+		// 흉내내는 WARP(소프트웨어 디스플레이 어댑터)를 생성한다.
+		if (FAILED(hardwareResult))
+		{
+			ComPtr<IDXGIAdapter> pWarpAdapter;
+			ThrowIfFailed(dxgiFactory->EnumWarpAdapter(IID_PPV_ARGS(&pWarpAdapter)));
+
+			ThrowIfFailed(D3D12CreateDevice(
+				pWarpAdapter.Get(),
+				D3D_FEATURE_LEVEL_11_0,
+				IID_PPV_ARGS(&d3dDevice)));
+		}
 	}
 
 	ThrowIfFailed(d3dDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence)));
 
-	//  ũ CPU  ٸ  Ƿ ̸ ˾Ƴд.
+	// 서술자의 크기는 CPU 마다 다를 수 있으므로 미리 알아내둔다.
 	DescriptorSize::rtvDescriptorSize = d3dDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_RTV);
 	DescriptorSize::dsvDescriptorSize = d3dDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_DSV);
 	DescriptorSize::cbvSrvUavDescriptorSize = d3dDevice->GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV);
 
-	// ĸ ۸  4X MSAA  θ Ѵ.
+	// 후면 버퍼를 위한 4X MSAA 지원 여부를 점검한다.
 	D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS msQualityLevels;
 	msQualityLevels.Format = backBufferFormat;
 	msQualityLevels.SampleCount = 4;
@@ -312,18 +402,18 @@ void D3DApp::CreateDevice()
 
 void D3DApp::CreateCommandObjects()
 {
-	// ɾ ť Ѵ.
+	// 명령어 큐를 생성한다.
 	D3D12_COMMAND_QUEUE_DESC queueDesc = {};
 	queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
 	queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
 	ThrowIfFailed(d3dDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&commandQueue)));
 
-	// ɾ Ҵڸ Ѵ.
+	// 명령어 할당자를 생성한다.
 	ThrowIfFailed(d3dDevice->CreateCommandAllocator(
 		D3D12_COMMAND_LIST_TYPE_DIRECT,
 		IID_PPV_ARGS(mainCommandAlloc.GetAddressOf())));
 
-	// ɾ Ʈ Ѵ.
+	// 명령어 리스트를 생성한다.
 	ThrowIfFailed(d3dDevice->CreateCommandList(
 		0,
 		D3D12_COMMAND_LIST_TYPE_DIRECT,
@@ -331,30 +421,30 @@ void D3DApp::CreateCommandObjects()
 		nullptr,   
 		IID_PPV_ARGS(mainCommandList.GetAddressOf())));
 
-	//  · Ѵ.    ó   Reset ȣϴµ,
-	// Reset ȣϷ CommandList  ־ ϱ ̴.
+	// 닫힌 상태로 시작한다. 이후 명령 목록을 처음 참조할 때 Reset을 호출하는데,
+	// Reset을 호출하려면 CommandList가 닫혀 있어야 하기 때문이다.
 	mainCommandList->Close();
 }
 
 void D3DApp::CreateSwapChain()
 {
-	// SwapChain ϱ  Fullscreen带 ؾ߸ Ѵ.
+	// SwapChain을 해제하기 전에 Fullscreen모드를 해제해야만 한다.
 	if (swapChain)
 		swapChain->SetFullscreenState(false, nullptr);
 
-	// SwapChain    SwapChain Ѵ.
+	// SwapChain을 만들기 전에 기존 SwapChain을 해제한다.
 	swapChain.Reset();
 
 	DXGI_SWAP_CHAIN_DESC sd;
 	sd.BufferDesc.Width = screenWidth;
 	sd.BufferDesc.Height = screenHeight;
-	sd.BufferDesc.RefreshRate.Numerator = 0; //  
-	sd.BufferDesc.RefreshRate.Denominator = 0; //  
+	sd.BufferDesc.RefreshRate.Numerator = 0; // 사용하지 않음
+	sd.BufferDesc.RefreshRate.Denominator = 0; // 사용하지 않음
 	sd.BufferDesc.Format = backBufferFormat;
 	sd.BufferDesc.ScanlineOrdering = DXGI_MODE_SCANLINE_ORDER_UNSPECIFIED;
 	sd.BufferDesc.Scaling = DXGI_MODE_SCALING_UNSPECIFIED;
-	sd.SampleDesc.Count = 1; // SwapChain ǥȭ Ȱȭ 
-	sd.SampleDesc.Quality = 0; // SwapChain ǥȭ Ȱȭ 
+	sd.SampleDesc.Count = 1; // SwapChain으로 다중표본화 활성화하지 않음
+	sd.SampleDesc.Quality = 0; // SwapChain으로 다중표본화 활성화하지 않음
 	sd.BufferUsage = DXGI_USAGE_RENDER_TARGET_OUTPUT;
 	sd.BufferCount = SWAP_CHAIN_BUFFER_COUNT;
 	sd.OutputWindow = GetMainWnd();
@@ -362,7 +452,7 @@ void D3DApp::CreateSwapChain()
 	sd.SwapEffect = DXGI_SWAP_EFFECT_FLIP_DISCARD;
 	sd.Flags = DXGI_SWAP_CHAIN_FLAG_ALLOW_MODE_SWITCH;
 
-	//  : ȯ 罽 Command Queue ̿ؼ Flush Ѵ.
+	// 참고 : 교환 사슬은 Command Queue를 이용해서 Flush를 수행한다.
 	ThrowIfFailed(dxgiFactory->CreateSwapChain(
 		commandQueue.Get(),
 		&sd,
@@ -371,7 +461,7 @@ void D3DApp::CreateSwapChain()
 
 void D3DApp::CreateSoundBuffer()
 {
-	// Direct Sound 
+	// Direct Sound 생성
 	ThrowIfFailed(DirectSoundCreate8(NULL, d3dSound.GetAddressOf(), NULL));
 	ThrowIfFailed(d3dSound->SetCooperativeLevel(hMainWnd, DSSCL_PRIORITY));
 
@@ -382,7 +472,7 @@ void D3DApp::CreateSoundBuffer()
 	soundBufferDesc.dwReserved = 0;
 	soundBufferDesc.lpwfxFormat = NULL;
 	soundBufferDesc.guid3DAlgorithm = GUID_NULL;
-	//    
+	// 주 사운드 버퍼 생성
 	ThrowIfFailed(d3dSound->CreateSoundBuffer(&soundBufferDesc, primarySoundBuffer.GetAddressOf(), NULL));
 
 	WAVEFORMATEX waveFormat;
@@ -394,29 +484,29 @@ void D3DApp::CreateSoundBuffer()
 	waveFormat.nAvgBytesPerSec = waveFormat.nSamplesPerSec * waveFormat.nBlockAlign;
 	waveFormat.cbSize = 0;
 	ThrowIfFailed(primarySoundBuffer->SetFormat(&waveFormat));
-	//  
+	// 리스너 생성
 	ThrowIfFailed(primarySoundBuffer->QueryInterface(IID_IDirectSound3DListener8, (void**)listener.GetAddressOf()));
 }
 
 void D3DApp::FlushCommandQueue()
 {
-	//  Ÿ  ɵ ǥϵ Ÿ  Ų.
+	// 현재 울타리 지점까지의 명령들을 표시하도록 울타리 값을 전진시킨다.
 	currentFence++;
 
-	//  Ÿ  ϴ (Signal)  ⿭ ߰Ѵ.
-	//  Ÿ  GPU Signal() ɱ   óϱ
-	//   ʴ´.
+	// 이 울타리 지점을 설정하는 명령(Signal)을 명령 대기열에 추가한다.
+	// 새 울타리 지점은 GPU가 Signal() 명령까지의 모든 명령을 처리하기
+	// 전까지는 설정되지 않는다.
 	ThrowIfFailed(commandQueue->Signal(fence.Get(), currentFence));
 
-	// GPU  Ÿ  ɵ Ϸ  ٸ.
+	// GPU가 이 울타리 지점까지의 명령들을 완료할 때까지 기다린다.
 	if (fence->GetCompletedValue() < currentFence)
 	{
 		HANDLE eventHandle = CreateEventEx(nullptr, false, false, EVENT_ALL_ACCESS);
 
-		// GPU  Ÿ   ̺Ʈ ߵѴ.
+		// GPU가 현재 울타리 지점에 도달했으면 이벤트를 발동한다.
 		ThrowIfFailed(fence->SetEventOnCompletion(currentFence, eventHandle));
 
-		// GPU  Ÿ   ϴ ̺Ʈ ٸ.
+		// GPU가 현재 울타리 지점에 도달했음을 뜻하는 이벤트를 기다린다.
 		WaitForSingleObject(eventHandle, INFINITE);
 		CloseHandle(eventHandle);
 	}
@@ -532,7 +622,7 @@ void D3DApp::LogOutputDisplayModes(IDXGIOutput* output, DXGI_FORMAT format)
 	UINT count = 0;
 	UINT flags = 0;
 
-	// nullptr ϸ Ʈ  Ѵ.
+	// nullptr를 대입하면 리스트의 개수를 리턴한다.
 	output->GetDisplayModeList(format, flags, &count, nullptr);
 
 	std::vector<DXGI_MODE_DESC> modeList(count);
@@ -554,8 +644,8 @@ void D3DApp::LogOutputDisplayModes(IDXGIOutput* output, DXGI_FORMAT format)
 
 void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMapNum)
 {
-	// Ϲ ̴ α׷ Ư ڿ( , ؽó, ǥ )
-	// Էµȴٰ Ѵ. Ʈ  ̴ α׷ ϴ ڿ Ѵ.
+	// 일반적으로 셰이더 프로그램은 특정 자원들(상수 버퍼, 텍스처, 표본추출기 등)이
+	// 입력된다고 기대한다. 루트 서명은 셰이더 프로그램이 기대하는 자원들을 정의한다.
 
 	///////////////////////////////////////// Common /////////////////////////////////////
 	{
@@ -568,21 +658,24 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpCommon::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpCommon::Object].InitAsConstantBufferView(0);
+		slotRootParameter[(int)RpCommon::InstanceBase].InitAsConstants(1, 2);
+		slotRootParameter[(int)RpCommon::Instance].InitAsShaderResourceView(3, 3);
 		slotRootParameter[(int)RpCommon::Pass].InitAsConstantBufferView(1);
 		slotRootParameter[(int)RpCommon::Light].InitAsShaderResourceView(0, 3);
 		slotRootParameter[(int)RpCommon::Material].InitAsShaderResourceView(1, 3);
+		slotRootParameter[(int)RpCommon::ObjectBuffer].InitAsShaderResourceView(2, 3);
 		slotRootParameter[(int)RpCommon::Texture].InitAsDescriptorTable(1, &texTable[0], D3D12_SHADER_VISIBILITY_PIXEL);
 		slotRootParameter[(int)RpCommon::ShadowMap].InitAsDescriptorTable(1, &texTable[1], D3D12_SHADER_VISIBILITY_PIXEL);
 		slotRootParameter[(int)RpCommon::GBuffer].InitAsDescriptorTable(1, &texTable[2], D3D12_SHADER_VISIBILITY_PIXEL);
 		slotRootParameter[(int)RpCommon::Ssao].InitAsDescriptorTable(1, &texTable[3], D3D12_SHADER_VISIBILITY_PIXEL);
 		slotRootParameter[(int)RpCommon::Ssr].InitAsDescriptorTable(1, &texTable[4], D3D12_SHADER_VISIBILITY_PIXEL);
 
-		// ׷  α׷ ϴ ǥ  ׸  Ƿ
-		// ̸  Root Signature Խ д.
+		// 그래픽 응용 프로그램이 사용하는 표본추출기의 수는 그리 많지 않으므로
+		// 미리 만들어서 Root Signature에 포함시켜 둔다.
 
-		//  ͸, ȯ ǥ  
+		// 점 필터링, 순환 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC pointWrap(
 			0, // shaderRegister
 			D3D12_FILTER_MIN_MAG_MIP_POINT, // filter
@@ -590,7 +683,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP,  // addressV
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP); // addressW
 
-		//  ͸,  ǥ  
+		// 점 필터링, 한정 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC pointClamp(
 			1, // shaderRegister
 			D3D12_FILTER_MIN_MAG_MIP_POINT, // filter
@@ -598,7 +691,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP,  // addressV
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP); // addressW
 
-		//  ͸, ȯ ǥ  
+		// 선형 필터링, 순환 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC linearWrap(
 			2, // shaderRegister
 			D3D12_FILTER_MIN_MAG_MIP_LINEAR, // filter
@@ -606,7 +699,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP,  // addressV
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP); // addressW
 
-		//  ͸,  ǥ  
+		// 선형 필터링, 한정 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC linearClamp(
 			3, // shaderRegister
 			D3D12_FILTER_MIN_MAG_MIP_LINEAR, // filter
@@ -614,7 +707,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP,  // addressV
 			D3D12_TEXTURE_ADDRESS_MODE_CLAMP); // addressW
 
-		//  ͸, ȯ ǥ  
+		// 비등방 필터링, 순환 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC anisotropicWrap(
 			4, // shaderRegister
 			D3D12_FILTER_ANISOTROPIC, // filter
@@ -624,7 +717,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			0.0f,                             // mipLODBias
 			8);                               // maxAnisotropy
 
-		//  ͸,  ǥ  
+		// 비등방 필터링, 한정 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC anisotropicClamp(
 			5, // shaderRegister
 			D3D12_FILTER_ANISOTROPIC, // filter
@@ -634,9 +727,9 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			0.0f,                              // mipLODBias
 			8);                                // maxAnisotropy
 
-		// ׸ڸ   ǥ
-		// ϵ ׸      ְ ϱ  
-		// PCF(Percenatge Colser Filtering) :   ͸
+		// 그림자를 위한 비교 표폰추출기
+		// 하드웨어가 그림자 맵 비교 판정들을 수행할 수 있게 하기 위한 것
+		// PCF(Percenatge Colser Filtering) : 비율 근접 필터링
 		const CD3DX12_STATIC_SAMPLER_DESC shadow(
 			6, // shaderRegister
 			D3D12_FILTER_COMPARISON_MIN_MAG_LINEAR_MIP_POINT, // filter
@@ -657,7 +750,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			(UINT)staticSamplers.size(), staticSamplers.data(),
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -685,7 +778,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 	std::array<CD3DX12_ROOT_PARAMETER, (int)RpSsao::Count> slotRootParameter;
 
-	// ս TIP:   ϴ  տ ´.
+	// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 	slotRootParameter[(int)RpSsao::SsaoCB].InitAsConstantBufferView(0);
 	slotRootParameter[(int)RpSsao::Pass].InitAsConstantBufferView(1);
 	slotRootParameter[(int)RpSsao::Constants].InitAsConstants(1, 2);
@@ -731,7 +824,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 		(UINT)staticSamplers.size(), staticSamplers.data(),
 		D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-	// Root Signature ȭ  ü Ѵ.
+	// Root Signature를 직렬화한 후 객체를 생성한다.
 	ComPtr<ID3DBlob> serializedRootSig = nullptr;
 	ComPtr<ID3DBlob> errorBlob = nullptr;
 	HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -758,7 +851,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpParticleGraphics::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpParticleGraphics::ParticleCB].InitAsConstantBufferView(0);
 		slotRootParameter[(int)RpParticleGraphics::Pass].InitAsConstantBufferView(1);
 		slotRootParameter[(int)RpParticleGraphics::Buffer].InitAsShaderResourceView(0);
@@ -777,7 +870,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			(UINT)staticSamplers.size(), staticSamplers.data(),
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -800,7 +893,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 	{
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpParticleCompute::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpParticleCompute::ParticleCB].InitAsConstantBufferView(0);
 		slotRootParameter[(int)RpParticleCompute::Counter].InitAsUnorderedAccessView(0);
 		slotRootParameter[(int)RpParticleCompute::Uav].InitAsUnorderedAccessView(1);
@@ -810,7 +903,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			0, nullptr,
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -837,14 +930,14 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpTerrainGraphics::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpTerrainGraphics::TerrainCB].InitAsConstantBufferView(0);
 		slotRootParameter[(int)RpTerrainGraphics::Pass].InitAsConstantBufferView(1);
 		slotRootParameter[(int)RpTerrainGraphics::Texture].InitAsDescriptorTable(1, &texTables[0], D3D12_SHADER_VISIBILITY_ALL);
 		slotRootParameter[(int)RpTerrainGraphics::Srv].InitAsDescriptorTable(1, &texTables[1], D3D12_SHADER_VISIBILITY_ALL);
 		slotRootParameter[(int)RpTerrainGraphics::Material].InitAsShaderResourceView(2, 1);
 
-		//  ͸, ȯ ǥ  
+		// 선형 필터링, 순환 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC linearWrap(
 			0, // shaderRegister
 			D3D12_FILTER_MIN_MAG_MIP_LINEAR, // filter
@@ -852,7 +945,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP,  // addressV
 			D3D12_TEXTURE_ADDRESS_MODE_WRAP); // addressW
 
-		//  ͸, ȯ ǥ  
+		// 비등방 필터링, 순환 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC anisotropicWrap(
 			1, // shaderRegister
 			D3D12_FILTER_ANISOTROPIC, // filter
@@ -868,7 +961,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			(UINT)staticSamplers.size(), staticSamplers.data(),
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -895,7 +988,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpTerrainCompute::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpTerrainCompute::HeightMap].InitAsDescriptorTable(1, &texTables[0]);
 		slotRootParameter[(int)RpTerrainCompute::Uav].InitAsDescriptorTable(1, &texTables[1]);
 
@@ -903,7 +996,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			0, nullptr,
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -931,14 +1024,14 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpSsr::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpSsr::PositionMap].InitAsDescriptorTable(1, &texTables[0]);
 		slotRootParameter[(int)RpSsr::NormalMap].InitAsDescriptorTable(1, &texTables[1]);
 		slotRootParameter[(int)RpSsr::ColorMap].InitAsDescriptorTable(1, &texTables[2]);
 		slotRootParameter[(int)RpSsr::SsrCB].InitAsConstantBufferView(0);
 		slotRootParameter[(int)RpSsr::Pass].InitAsConstantBufferView(1);
 
-		//  ͸, ȯ ǥ  
+		// 선형 필터링, 순환 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC linearWrap(
 			0, // shaderRegister
 			D3D12_FILTER_MIN_MAG_MIP_LINEAR, // filter
@@ -952,7 +1045,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			(UINT)staticSamplers.size(), staticSamplers.data(),
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -980,12 +1073,12 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpReflection::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpReflection::ColorMap].InitAsDescriptorTable(1, &texTables[0]);
 		slotRootParameter[(int)RpReflection::BufferMap].InitAsDescriptorTable(1, &texTables[1]);
 		slotRootParameter[(int)RpReflection::SsrMap].InitAsDescriptorTable(1, &texTables[2]);
 
-		//  ͸, ȯ ǥ  
+		// 선형 필터링, 순환 좌표 지정 모드
 		const CD3DX12_STATIC_SAMPLER_DESC linearWrap(
 			0, // shaderRegister
 			D3D12_FILTER_MIN_MAG_MIP_LINEAR, // filter
@@ -999,7 +1092,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			(UINT)staticSamplers.size(), staticSamplers.data(),
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -1026,7 +1119,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpBlur::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpBlur::BlurConstants].InitAsConstants(20, 0);
 		slotRootParameter[(int)RpBlur::InputSrv].InitAsDescriptorTable(1, &texTables[0]);
 		slotRootParameter[(int)RpBlur::OutputUav].InitAsDescriptorTable(1, &texTables[1]);
@@ -1035,7 +1128,7 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 			0, nullptr,
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -1058,14 +1151,14 @@ void D3DApp::CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMa
 	{
 		std::array<CD3DX12_ROOT_PARAMETER, (int)RpDebug::Count> slotRootParameter;
 
-		// ս TIP:   ϴ  տ ´.
+		// 퍼포먼스 TIP: 가장 자주 사용하는 것을 앞에 놓는다.
 		slotRootParameter[(int)RpDebug::Pass].InitAsConstantBufferView(1);
 
 		CD3DX12_ROOT_SIGNATURE_DESC rootSigDesc((UINT)slotRootParameter.size(), slotRootParameter.data(),
 			0, nullptr,
 			D3D12_ROOT_SIGNATURE_FLAG_ALLOW_INPUT_ASSEMBLER_INPUT_LAYOUT);
 
-		// Root Signature ȭ  ü Ѵ.
+		// Root Signature를 직렬화한 후 객체를 생성한다.
 		ComPtr<ID3DBlob> serializedRootSig = nullptr;
 		ComPtr<ID3DBlob> errorBlob = nullptr;
 		HRESULT hr = D3D12SerializeRootSignature(&rootSigDesc, D3D_ROOT_SIGNATURE_VERSION_1,
@@ -1096,7 +1189,7 @@ void D3DApp::CreateDescriptorHeaps(const UINT32 textureNum, const UINT32 shadowM
 
 	CD3DX12_CPU_DESCRIPTOR_HANDLE hDescriptor(cbvSrvUavDescriptorHeap->GetCPUDescriptorHandleForHeapStart());
 
-	// ؽó Shader Resource View ϴ ü
+	// 텍스처의 Shader Resource View를 설명하는 구조체
 	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
@@ -1115,10 +1208,10 @@ void D3DApp::CreateDescriptorHeaps(const UINT32 textureNum, const UINT32 shadowM
 	}
 
 	DescriptorIndex::textureHeapIndex = DescriptorIndex::renderTargetHeapIndex + SWAP_CHAIN_BUFFER_COUNT;
-	//  ؽó  Shader Resource View Ѵ.
+	// 각 텍스처마다 힙에 Shader Resource View를 생성한다.
 	for (UINT i = 0; i < textureNum; ++i)
 	{
-		// texNames ε Material  ؽó ε ֱ   View Ѵ.
+		// texNames의 인데스와 Material에 사용될 텍스처 인덱스를 맞춰주기 위해 순서대로 View를 생성한다.
 		ID3D12Resource* resource = AssetManager::GetInstance()->GetTextureResource(i);
 
 		srvDesc.Format = resource->GetDesc().Format;
@@ -1136,7 +1229,7 @@ void D3DApp::CreateDescriptorHeaps(const UINT32 textureNum, const UINT32 shadowM
 		srvDesc.Texture2D.MipLevels = 1;
 		srvDesc.Format = deferredBufferFormats[i];
 
-		// G-Buffer Ǵ  Ÿٵ鿡  SRV Ѵ.
+		// G-Buffer에 사용되는 렌더 타겟들에 대한 SRV를 생성한다.
 		d3dDevice->CreateShaderResourceView(deferredBuffer[i].Get(), &srvDesc, hDescriptor);
 
 		// next descriptor
@@ -1145,15 +1238,39 @@ void D3DApp::CreateDescriptorHeaps(const UINT32 textureNum, const UINT32 shadowM
 
 	DescriptorIndex::depthBufferHeapIndex = DescriptorIndex::deferredBufferHeapIndex + DEFERRED_BUFFER_COUNT;
 	srvDesc.Format = DXGI_FORMAT_R24_UNORM_X8_TYPELESS;
-	// G-Buffer Ǵ  ۿ  SRV Ѵ.
+	// G-Buffer에 사용되는 깊이 버퍼에 대한 SRV를 생성한다.
 	d3dDevice->CreateShaderResourceView(depthStencilBuffer.Get(), &srvDesc, hDescriptor);
 	hDescriptor.Offset(1, DescriptorSize::cbvSrvUavDescriptorSize);
 }
 
+void D3DApp::CreateCommandSignatures()
+{
+	// ExecuteIndirect의 명령 하나는 정점 버퍼, 인덱스 버퍼, 인스턴스 시작 위치의 루트 상수를
+	// 바꾼 후 인덱스 그리기를 수행한다. 인자의 배치는 IndirectDrawCommand와 같다.
+	std::array<D3D12_INDIRECT_ARGUMENT_DESC, 4> argumentDescs = {};
+	argumentDescs[0].Type = D3D12_INDIRECT_ARGUMENT_TYPE_VERTEX_BUFFER_VIEW;
+	argumentDescs[0].VertexBuffer.Slot = 0;
+	argumentDescs[1].Type = D3D12_INDIRECT_ARGUMENT_TYPE_INDEX_BUFFER_VIEW;
+	argumentDescs[2].Type = D3D12_INDIRECT_ARGUMENT_TYPE_CONSTANT;
+	argumentDescs[2].Constant.RootParameterIndex = (UINT)RpCommon::InstanceBase;
+	argumentDescs[2].Constant.DestOffsetIn32BitValues = 0;
+	argumentDescs[2].Constant.Num32BitValuesToSet = 1;
+	argumentDescs[3].Type = D3D12_INDIRECT_ARGUMENT_TYPE_DRAW_INDEXED;
+
+	D3D12_COMMAND_SIGNATURE_DESC commandSignatureDesc = {};
+	commandSignatureDesc.ByteStride = sizeof(IndirectDrawCommand);
+	commandSignatureDesc.NumArgumentDescs = (UINT)argumentDescs.size();
+	commandSignatureDesc.pArgumentDescs = argumentDescs.data();
+
+	// 루트 인자를 바꾸는 명령 서명은 그 루트 서명과 함께 만들어야 한다.
+	ThrowIfFailed(d3dDevice->CreateCommandSignature(&commandSignatureDesc, rootSignatures["Common"].Get(),
+		IID_PPV_ARGS(&commandSignatures["DrawIndexed"])));
+}
+
 void D3DApp::CreateShadersAndInputLayout()
 {
-	// Direct3D    ˷ִ InputLayout
-	// ̴ Ѵ.
+	// Direct3D에게 각 정점의 성분을 알려주는 InputLayout과
+	// 셰이더를 컴파일한다.
 
 #ifdef SSAO
 	D3D_SHADER_MACRO defines[] = {
@@ -1272,10 +1389,10 @@ void D3DApp::CreateShadersAndInputLayout()
 
 void D3DApp::CreatePSOs()
 {
-	// Direct3D   ´ PSOü  ̸ ȴ.
-	//    ϳ ü ϴ  Direct3D  °
-	// ȣȯǴ ̸    ̹ ϵ  α׷
-	//   ڵ带 ̸   ֱ ̴.
+	// Direct3D에서 사용할 파이프라인의 상태는 PSO객체에 의해 미리 지정된다.
+	// 이 모든 것을 하나의 집합체로 지정하는 이유는 Direct3D가 모든 상태가
+	// 호환되는지 미리 검증할 수 있으며 드라이버는 하드웨어 상태의 프로그래밍을
+	// 위한 모든 코드를 미리 생성할 수 있기 때문이다.
 
 	// PSO for Forward
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC forwardPsoDesc;
@@ -1347,7 +1464,7 @@ void D3DApp::CreatePSOs()
 	};
 	billboardPsoDesc.PrimitiveTopologyType = D3D12_PRIMITIVE_TOPOLOGY_TYPE_POINT;
 	billboardPsoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;
-	// MSAA ȰȭǾ ִٸ ϵ   ̿ؼ MSAA   Ͽ øѴ.
+	// MSAA가 활성화되어 있다면 하드웨어는 알파 값을 이용해서 MSAA에 알파 값을 포괄하여 샘플링한다.
 	billboardPsoDesc.BlendState.AlphaToCoverageEnable = GetOptionEnabled(Option::Msaa);
 	ThrowIfFailed(d3dDevice->CreateGraphicsPipelineState(&billboardPsoDesc, IID_PPV_ARGS(&pipelineStateObjects["Billborad"])));
 
@@ -1391,8 +1508,8 @@ void D3DApp::CreatePSOs()
 	transparencyBlendDesc.LogicOp = D3D12_LOGIC_OP_NOOP;
 	transparencyBlendDesc.RenderTargetWriteMask = D3D12_COLOR_WRITE_ENABLE_ALL;
 	transparentPsoDesc.BlendState.RenderTarget[0] = transparencyBlendDesc;
-	//  ü  Ǿ ̰ Ϸ  ⸦ Ȱȭϰų  ü Ͽ ׷ Ѵ.
-	// D3D12_DEPTH_WRITE_MASK_ZERO  ϸ Ȱȭ   б    ȰȭѴ.
+	// 불투명한 물체끼리 색상이 누적되어 보이게 하려면 깊이 쓰기를 비활성화하거나 불투명한 물체를 정렬하여 그려야 한다.
+	// D3D12_DEPTH_WRITE_MASK_ZERO는 깊이 기록만 비활성화할 뿐 깊이 읽기와 깊이 판정은 여전히 활성화한다.
 	transparentPsoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ZERO;
 	ThrowIfFailed(d3dDevice->CreateGraphicsPipelineState(&transparentPsoDesc, IID_PPV_ARGS(&pipelineStateObjects["Transparent"])));
 
@@ -1445,11 +1562,11 @@ void D3DApp::CreatePSOs()
 
 	// PSO for Sky
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC skyPsoDesc = forwardPsoDesc;
-	// ɸ޶ ϴ  ο Ƿ ĸ  .
+	// 케메라는 하늘 구 내부에 있으므로 후면 선별을 끈다.
 	skyPsoDesc.RasterizerState.CullMode = D3D12_CULL_MODE_NONE;
-	//  Լ LESS ƴ϶ LESS_EQUAL Ѵ.
-	// ̷  ,  ۸ 1   z = 1(NDC)
-	// ȭ     Ѵ.
+	// 깊이 함수가 LESS가 아니라 LESS_EQUAL로 설정한다.
+	// 이렇게 하지 않으면, 깊이 버퍼를 1로 지우는 경우 z = 1(NDC)에서
+	// 정규화된 깊이 값이 깊이 판정에 실패한다.
 	skyPsoDesc.DepthStencilState.DepthFunc = D3D12_COMPARISON_FUNC_LESS_EQUAL;
 	skyPsoDesc.DepthStencilState.DepthWriteMask = D3D12_DEPTH_WRITE_MASK_ZERO;
 	skyPsoDesc.VS =
@@ -1468,9 +1585,9 @@ void D3DApp::CreatePSOs()
 	// PSO for Shadow
 	D3D12_GRAPHICS_PIPELINE_STATE_DESC smapPsoDesc = forwardPsoDesc;
 	// Bias = (float)DepthBias * r + SlopeScaledDepthBias * MaxDepthSlope;
-	// ⼭ r    float32 ȯ , ǥ  0 ū ּڰ̴.
-	// 24Ʈ    r = 1 /2^24̴.
-	// ex. DepthBias = 100000 ->   ġ = 100000 / 2^24 = 0.006
+	// 여기서 r은 깊이 버퍼 형식을 float32로 변환했을 때, 표현 가능한 0보다 큰 최솟값이다.
+	// 24비트 깊이 버퍼의 경우 r = 1 /2^24이다.
+	// ex. DepthBias = 100000 -> 실제 깊이 편향치 = 100000 / 2^24 = 0.006
 	smapPsoDesc.RasterizerState.DepthBias = 100000;
 	smapPsoDesc.RasterizerState.DepthBiasClamp = 0.0f;
 	smapPsoDesc.RasterizerState.SlopeScaledDepthBias = 1.0f;
@@ -1484,9 +1601,9 @@ void D3DApp::CreatePSOs()
 		reinterpret_cast<BYTE*>(shaders["ShadowMapPS"]->GetBufferPointer()),
 		shaders["ShadowMapPS"]->GetBufferSize()
 	};
-	// ׸  н   .
-	// ׸   ۸ ϹǷ    ν
-	//  ȭ   ִ.
+	// 그림자 맵 패스에는 렌더 대상이 없다.
+	// 그림자 맵은 깊이 버퍼만을 사용하므로 렌더 대상을 사용하지 않음으로써
+	// 일종의 최적화를 적용할 수 있다.
 	smapPsoDesc.RTVFormats[0] = DXGI_FORMAT_UNKNOWN;
 	smapPsoDesc.NumRenderTargets = 0;
 	ThrowIfFailed(d3dDevice->CreateGraphicsPipelineState(&smapPsoDesc, IID_PPV_ARGS(&pipelineStateObjects["ShadowMap"])));
@@ -1824,12 +1941,12 @@ void D3DApp::SetBackgroundColor(const float r, const float g, const float b, con
 
 void D3DApp::Reset(ID3D12GraphicsCommandList* cmdList, ID3D12CommandAllocator* cmdAlloc)
 {
-	//  Ͽ õ ޸ Ȱ   Ҵڸ 缳Ѵ.
-	// 缳 GPU  ɸϵ  ó Ŀ Ͼ.
+	// 명령 기록에 관련된 메모리의 재활용을 위해 명령 할당자를 재설정한다.
+	// 재설정은 GPU가 관련 명령목록들을 모두 처리한 후에 일어난다.
 	ThrowIfFailed(cmdAlloc->Reset());
 
-	//   ExcuteCommandList ؼ  ⿭ ߰ߴٸ
-	//   缳  ִ.   缳ϸ ޸𸮰 Ȱȴ.
+	// 명령 목록을 ExcuteCommandList을 통해서 명령 대기열에 추가했다면
+	// 명령 목록을 재설정할 수 있다. 명령 목록을 재설정하면 메모리가 재활용된다.
 	ThrowIfFailed(cmdList->Reset(cmdAlloc, nullptr));
 }
 
@@ -1855,4 +1972,18 @@ void D3DApp::SwitchOptionEnabled(const Option option)
 bool D3DApp::GetOptionEnabled(const Option option)
 {
 	return options.test((int)option);
+}
+
+void D3DApp::SetRenderBackend(const RenderBackend backend)
+{
+	renderBackend = backend;
+
+	// 널 백엔드는 창을 만들지 않는다.
+	if (backend == RenderBackend::Null)
+		useWinApi = false;
+}
+
+RenderBackend D3DApp::GetRenderBackend() const
+{
+	return renderBackend;
 }
\ No newline at end of file
@@ -21,6 +21,8 @@
 #include <vector>
 #include <unordered_map>
 
+class NullDevice;
+
 class D3DApp : public WinApp
 {
 public:
@@ -39,19 +41,33 @@ public:
 	virtual void OnResize(const INT32 screenWidth, const INT32 screenHeight) override;
 	virtual void CreateDescriptorHeaps(const UINT32 textureNum, const UINT32 shadowMapNum, const UINT32 particleNum);
 
-	//    α׷ ݿѴ.
+	// 설정에 적용된 값을 프로그램에 반영한다.
 	virtual void ApplyOption(const Option option);
 
 public:
 	void SetBackgroundColor(const float r, const float g, const float b, const float a);
 
-	//   ٲ۴. true->false, false->true ȴ.
+	// 설정 값을 바꾼다. true->false, false->true가 된다.
 	void SwitchOptionEnabled(const Option option);
-	//  ش value  ٲ۴.
+	// 설정은 해당 value 값으로 바꾼다.
 	void SetOptionEnabled(const Option option, const  bool value);
-	//   ִ θ ȯѴ.
+	// 설정이 켜져 있는지 여부를 반환한다.
 	bool GetOptionEnabled(const Option option);
 
+	// 렌더링 백엔드를 설정한다. Initialize 이전에 불려져야 한다.
+	// 널 백엔드는 창과 교환 사슬, 사운드를 만들지 않는다.
+	void SetRenderBackend(const RenderBackend backend);
+	RenderBackend GetRenderBackend() const;
+
+	// 메시지 루프 없이 고정된 시간 간격으로 frameCount 프레임을 실행하고
+	// 프레임 시간과 널 백엔드의 통계를 출력한다.
+	int RunHeadless(const UINT32 frameCount, const float deltaTime);
+
+protected:
+	// RunHeadless가 측정을 시작할 때 통계를 지우고, 끝난 후에 프레임당 평균을 출력한다.
+	virtual void ResetFrameStats();
+	virtual void PrintFrameStats(const UINT32 frameCount) const;
+
 protected:
 	void CreateDevice();
 	void CreateCommandObjects();
@@ -59,12 +75,14 @@ protected:
 	void CreateSoundBuffer();
 	void CreateRtvAndDsvDescriptorHeaps(const UINT32 shadowMapNum);
 	void CreateRootSignatures(const UINT32 textureNum, const UINT32 shadowMapNum);
+	// 루트 서명을 만든 후에 불려야 한다.
+	void CreateCommandSignatures();
 	void CreateShadersAndInputLayout();
 	void CreatePSOs();
 
-	// ɾ Ʈ Ҵڸ Ѵ.
+	// 명령어 리스트와 할당자를 리셋한다.
 	void Reset(ID3D12GraphicsCommandList* cmdList, ID3D12CommandAllocator* cmdAlloc);
-	// gpu ŸӶ 󿡼 ش  Ͽ  ȮѴ.
+	// gpu 타임라인 상에서 해당 지점까지 도달하였는 지 확인한다.
 	void FlushCommandQueue();
 
 protected:
@@ -73,14 +91,14 @@ protected:
 	D3D12_CPU_DESCRIPTOR_HANDLE GetDefferedBufferView(const UINT32 index) const;
 	D3D12_CPU_DESCRIPTOR_HANDLE GetDepthStencilView() const;
 
-	//  ҽ  ε    ڵ ش.
+	// 각 리소스 뷰의 인덱스 값을 통해 서술자 핸들을 돌려준다.
 	CD3DX12_CPU_DESCRIPTOR_HANDLE GetCpuSrv(const UINT32 index) const;
 	CD3DX12_GPU_DESCRIPTOR_HANDLE GetGpuSrv(const UINT32 index) const;
 	CD3DX12_CPU_DESCRIPTOR_HANDLE GetDsv(const UINT32 index) const;
 	CD3DX12_CPU_DESCRIPTOR_HANDLE GetRtv(const UINT32 index) const;
 
 private:
-	// ش ǻ Ӽ ˱   Լ
+	// 해당 컴퓨터의 속성을 알기 위한 디버그 함수
 	void LogAdapters();
 	void LogAdapterOutputs(IDXGIAdapter* adapter);
 	void LogOutputDisplayModes(IDXGIOutput* output, const DXGI_FORMAT format);
@@ -90,6 +108,10 @@ protected:
 	Microsoft::WRL::ComPtr<IDXGISwapChain> swapChain;
 	Microsoft::WRL::ComPtr<ID3D12Device> d3dDevice;
 
+	RenderBackend renderBackend = RenderBackend::D3D12;
+	// 널 백엔드를 사용한다면 d3dDevice가 가리키는 디바이스
+	NullDevice* nullDevice = nullptr;
+
 	Microsoft::WRL::ComPtr<ID3D12Fence> fence;
 	UINT64 currentFence = 0;
 
@@ -112,6 +134,7 @@ protected:
 
 	std::unordered_map<std::string, Microsoft::WRL::ComPtr<ID3D12RootSignature>> rootSignatures;
 	std::unordered_map<std::string, Microsoft::WRL::ComPtr<ID3D12PipelineState>> pipelineStateObjects;
+	std::unordered_map<std::string, Microsoft::WRL::ComPtr<ID3D12CommandSignature>> commandSignatures;
 	std::unordered_map<std::string, Microsoft::WRL::ComPtr<ID3DBlob>> shaders;
 	std::vector<D3D12_INPUT_ELEMENT_DESC> defaultLayout;
 	std::vector<D3D12_INPUT_ELEMENT_DESC> billboardLayout;
@@ -125,21 +148,21 @@ protected:
 
 	XMFLOAT4 backBufferClearColor = { 0.0f, 0.0f, 0.0f, 0.0f };
 
-	//  G۸   ÷
+	// 각 G버퍼를 지우기 위한 컬러
 	const std::array<DirectX::XMFLOAT4, DEFERRED_BUFFER_COUNT> deferredBufferClearColors =
 	{
-		XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f), // Diffuse,    üũθ ٷ
+		XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f), // Diffuse, 알파 값은 라이팅의 체크여부를 다룬다
 		XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f), // Specular Roughness
-		XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f), // Position,   SSAO  SSR üũ θ ٷ.
+		XMFLOAT4(0.0f, 0.0f, 0.0f, 0.0f), // Position, 알파 값은 SSAO 및 SSR 체크 여부를 다룬다.
 		XMFLOAT4(0.0f, 0.0f, 1.0f, 1.0f), // Normal
 		XMFLOAT4(0.0f, 0.0f, 1.0f, 1.0f), // Normal(Normal Map x)
 	};
 
-	// option bool ϴ ̳
+	// option들의 bool값을 관리하는 컨테이너
 	std::bitset<(int)Option::Count> options;
 
 private:
-	//  G 
+	// 각 G버퍼의 포맷
 	const std::array<DXGI_FORMAT, DEFERRED_BUFFER_COUNT> deferredBufferFormats =
 	{
 		DXGI_FORMAT_R8G8B8A8_UNORM, // Diffuse
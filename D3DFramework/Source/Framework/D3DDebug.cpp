@@ -1,6 +1,8 @@
 #include "../PrecompiledHeader/pch.h"
 #include "D3DDebug.h"
 #include "D3DStructure.h"
+#include "ObjectPool.hpp"
+#include "FrameAllocator.h"
 #include "../Component/Mesh.h"
 
 using namespace std::literals;
@@ -14,6 +16,7 @@ D3DDebug::~D3DDebug()
 	cmdQueue = nullptr;
 	fence = nullptr;
 
+	pendingDatas.clear();
 	debugDatas.clear();
 }
 
@@ -30,18 +33,18 @@ void D3DDebug::CreateCommandObjects(ID3D12Device* device)
 {
 	d3dDevice = device;
 
-	// ɾ ť Ѵ.
+	// 명령어 큐를 생성한다.
 	D3D12_COMMAND_QUEUE_DESC queueDesc = {};
 	queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
 	queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
 	ThrowIfFailed(d3dDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&cmdQueue)));
 
-	// ɾ Ҵڸ Ѵ.
+	// 명령어 할당자를 생성한다.
 	ThrowIfFailed(d3dDevice->CreateCommandAllocator(
 		D3D12_COMMAND_LIST_TYPE_DIRECT,
 		IID_PPV_ARGS(meshBuildCmdAlloc.GetAddressOf())));
 
-	// ɾ Ʈ Ѵ.
+	// 명령어 리스트를 생성한다.
 	ThrowIfFailed(d3dDevice->CreateCommandList(
 		0,
 		D3D12_COMMAND_LIST_TYPE_DIRECT,
@@ -49,16 +52,16 @@ void D3DDebug::CreateCommandObjects(ID3D12Device* device)
 		nullptr,
 		IID_PPV_ARGS(meshBuildCmdList.GetAddressOf())));
 
-	// 潺 Ѵ.
+	// 펜스를 생성한다.
 	ThrowIfFailed(d3dDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence)));
 }
 
 void D3DDebug::DrawLine(const XMFLOAT3& p1, const XMFLOAT3& p2, const float time, const XMFLOAT4& color)
 {
 	DebugData data;
-	std::vector<LineVertex> vertices(2);
+	FrameVector<LineVertex> vertices(2);
 
-	data.debugMesh = new Mesh("DebugLine"s);
+	data.debugMesh = ObjectPool<Mesh>::GetInstance()->Create("DebugLine"s);
 
 	vertices.emplace_back(p1, color);
 	vertices.emplace_back(p2, color);
@@ -74,9 +77,9 @@ void D3DDebug::DrawRay(const XMVECTOR& p1, const XMVECTOR& p2, const float time,
 void D3DDebug::DrawBox(const XMFLOAT3& center, const XMFLOAT3& extents, const float time, const XMFLOAT4& color)
 {
 	DebugData data;
-	std::vector<LineVertex> vertices(24);
+	FrameVector<LineVertex> vertices(24);
 
-	data.debugMesh = new Mesh("DebugBox"s);
+	data.debugMesh = ObjectPool<Mesh>::GetInstance()->Create("DebugBox"s);
 
 	XMFLOAT3 p[] = 
 	{ 
@@ -126,11 +129,11 @@ void D3DDebug::DrawRing(const XMVECTOR& center, const XMVECTOR& majorAxis, const
 	static constexpr float angleDelta = XM_2PI / float(ringSegments);
 
 	DebugData data;
-	std::vector<LineVertex> vertices(ringSegments + 1);
+	FrameVector<LineVertex> vertices(ringSegments + 1);
 
-	data.debugMesh = new Mesh("DebugRing"s);
+	data.debugMesh = ObjectPool<Mesh>::GetInstance()->Create("DebugRing"s);
 
-	//  Ѵ.
+	// 증가량을 계산한다.
 	XMVECTOR cosDelta = XMVectorReplicate(cosf(angleDelta));
 	XMVECTOR sinDelta = XMVectorReplicate(sinf(angleDelta));
 	XMVECTOR incrementalSin = XMVectorReplicate(0.0f);
@@ -138,15 +141,15 @@ void D3DDebug::DrawRing(const XMVECTOR& center, const XMVECTOR& majorAxis, const
 
 	for (int i = 0; i < ringSegments + 1; ++i)
 	{
-		// ο ġ Ѵ.
+		// 새로운 위치를 계산한다.
 		XMVECTOR pos = XMVectorMultiplyAdd(majorAxis, incrementalCos, center);
 		pos = XMVectorMultiplyAdd(minorAxis, incrementalSin, pos);
 
-		// ġ  Ѵ.
+		// 위치와 색을 저장한다.
 		XMStoreFloat3(&vertices[i].pos, pos);
 		vertices[i].color = color;
 
-		// ο  Ѵ.
+		// 새로운 증가량을 계산한다.
 		XMVECTOR newCos = incrementalCos * cosDelta - incrementalSin * sinDelta;
 		XMVECTOR newSin = incrementalCos * sinDelta + incrementalSin * cosDelta;
 		incrementalCos = newCos;
@@ -159,9 +162,9 @@ void D3DDebug::DrawRing(const XMVECTOR& center, const XMVECTOR& majorAxis, const
 void D3DDebug::Draw(const BoundingFrustum& frustum, const float time, const XMFLOAT4& color)
 {
 	DebugData data;
-	std::vector<LineVertex> vertices(24);
+	FrameVector<LineVertex> vertices(24);
 
-	data.debugMesh = new Mesh("DebugFrstum"s);
+	data.debugMesh = ObjectPool<Mesh>::GetInstance()->Create("DebugFrstum"s);
 
 	XMFLOAT3 corners[BoundingFrustum::CORNER_COUNT];
 	frustum.GetCorners(corners);
@@ -204,9 +207,9 @@ void D3DDebug::Draw(const BoundingFrustum& frustum, const float time, const XMFL
 void D3DDebug::Draw(const DirectX::BoundingOrientedBox& obb, const float time, const XMFLOAT4& color)
 {
 	DebugData data;
-	std::vector<LineVertex> vertices(24);
+	FrameVector<LineVertex> vertices(24);
 
-	data.debugMesh = new Mesh("DebugBox"s);
+	data.debugMesh = ObjectPool<Mesh>::GetInstance()->Create("DebugBox"s);
 
 	XMFLOAT3 corners[BoundingOrientedBox::CORNER_COUNT];
 	obb.GetCorners(corners);
@@ -239,31 +242,39 @@ void D3DDebug::Draw(const DirectX::BoundingSphere& sphere, const float time, con
 
 void D3DDebug::Update(float deltaTime)
 {
-	if (isMeshBuild)
 	{
-		// ش ɾ   ٸ.
-		FlushCommandQueue();
-		isMeshBuild = false;
+		std::lock_guard<std::mutex> pendingLock(pendingMutex);
+		if (!pendingDatas.empty())
+		{
+			// 해당 명령어가 수행될 때까지 기다린다.
+			FlushCommandQueue();
+
+			// 다음 명령어를 위해서 리셋한다.
+			Reset(meshBuildCmdList.Get(), meshBuildCmdAlloc.Get());
 
-		//  ɾ ؼ Ѵ.
-		Reset(meshBuildCmdList.Get(), meshBuildCmdAlloc.Get());
+			// 정점 버퍼가 준비된 디버그 메쉬만 그려지도록 이제서야 옮긴다.
+			std::lock_guard<std::mutex> lock(mutex);
+			debugDatas.insert(debugDatas.end(), pendingDatas.begin(), pendingDatas.end());
+			pendingDatas.clear();
+		}
 	}
 
+	std::lock_guard<std::mutex> lock(mutex);
 	if (!debugDatas.empty())
 	{
 		for (auto iter = debugDatas.begin(); iter != debugDatas.end();)
 		{
 			if (iter->time < 0.0f)
 			{
-				//  ð 0ϱ Ǹ  δ.
-				//  ӿ ش ü ׸µ ϰ Ƿ
-				// ش ü ׸ ʴ GPU ŸӶο ؾ Ѵ.
+				// 수명 시간이 0이하기 되면 프레임을 줄인다.
+				// 이전 프레임에서 해당 객체를 그리는데에 사용하고 있으므로
+				// 해당 객체를 그리지 않는 GPU 타임라인에 도달해야 한다.
 				--iter->frame;
 
-				//   Ǹ ش ü Ʈ Ѵ.
+				// 수명이 다 되면 해당 객체를 리스트에서 삭제한다.
 				if (iter->frame == 0)
 				{
-					delete iter->debugMesh;
+					ObjectPool<Mesh>::GetInstance()->Destroy(iter->debugMesh);
 					iter->debugMesh = nullptr;
 					iter = debugDatas.erase(iter);
 					continue;
@@ -278,10 +289,11 @@ void D3DDebug::Update(float deltaTime)
 
 void D3DDebug::Render(ID3D12GraphicsCommandList* cmdList)
 {
+	std::lock_guard<std::mutex> lock(mutex);
 	for (const auto& data : debugDatas)
 	{
-		//  ޽  0̻  ׸  ִ.
-		// frame 3 ƴϸ  0Ϸ frame  ҵǾ  ̴.
+		// 디버그 메쉬는 수명이 0이상일 때 그릴 수 있다.
+		// frame이 3이 아니면 수명이 0이하로 frame 값이 감소되었을 때 이다.
 		if (data.frame == NUM_FRAME_RESOURCES)
 		{
 			data.debugMesh->Render(cmdList, 1, false);
@@ -291,17 +303,21 @@ void D3DDebug::Render(ID3D12GraphicsCommandList* cmdList)
 
 void D3DDebug::Clear()
 {
+	std::scoped_lock lock(pendingMutex, mutex);
+	for (auto& data : pendingDatas)
+		data.time = 0.0f;
+
 	for (auto& data : debugDatas)
 	{
-		//  ָ  Ʈ
-		//  ͸ ϰ ȴ.
+		// 수명을 없애면 다음 업데이트에서
+		// 모든 데이터를 삭제하게 된다.
 		data.time = 0.0f;
 	}
 }
 
 void D3DDebug::ExcuteBuild()
 {
-	//  ޽ ϴ ɾ Ѵ.
+	// 디버그 메쉬를 생성하는 명령어를 수행한다.
 	ThrowIfFailed(meshBuildCmdList->Close());
 	ID3D12CommandList* cmdLists[] = { meshBuildCmdList.Get() };
 	cmdQueue->ExecuteCommandLists(_countof(cmdLists), cmdLists);
@@ -310,12 +326,12 @@ void D3DDebug::ExcuteBuild()
 
 void D3DDebug::Reset(ID3D12GraphicsCommandList* cmdList, ID3D12CommandAllocator* cmdAlloc)
 {
-	//  Ͽ õ ޸ Ȱ   Ҵڸ 缳Ѵ.
-	// 缳 GPU  ɸϵ  ó Ŀ Ͼ.
+	// 명령 기록에 관련된 메모리의 재활용을 위해 명령 할당자를 재설정한다.
+	// 재설정은 GPU가 관련 명령목록들을 모두 처리한 후에 일어난다.
 	ThrowIfFailed(cmdAlloc->Reset());
 
-	//   ExcuteCommandList ؼ  ⿭ ߰ߴٸ
-	//   缳  ִ.   缳ϸ ޸𸮰 Ȱȴ.
+	// 명령 목록을 ExcuteCommandList을 통해서 명령 대기열에 추가했다면
+	// 명령 목록을 재설정할 수 있다. 명령 목록을 재설정하면 메모리가 재활용된다.
 	ThrowIfFailed(cmdList->Reset(cmdAlloc, nullptr));
 }
 
@@ -323,46 +339,46 @@ void D3DDebug::FlushCommandQueue()
 {
 	ExcuteBuild();
 
-	//  Ÿ  ɵ ǥϵ Ÿ  Ų.
+	// 현재 울타리 지점까지의 명령들을 표시하도록 울타리 값을 전진시킨다.
 	currentFence++;
 
-	//  Ÿ  ϴ (Signal)  ⿭ ߰Ѵ.
-	//  Ÿ  GPU Signal() ɱ   óϱ
-	//   ʴ´.
+	// 이 울타리 지점을 설정하는 명령(Signal)을 명령 대기열에 추가한다.
+	// 새 울타리 지점은 GPU가 Signal() 명령까지의 모든 명령을 처리하기
+	// 전까지는 설정되지 않는다.
 	ThrowIfFailed(cmdQueue->Signal(fence.Get(), currentFence));
 
-	// GPU  Ÿ  ɵ Ϸ  ٸ.
+	// GPU가 이 울타리 지점까지의 명령들을 완료할 때까지 기다린다.
 	if (fence->GetCompletedValue() < currentFence)
 	{
 		HANDLE eventHandle = CreateEventEx(nullptr, false, false, EVENT_ALL_ACCESS);
 
-		// GPU  Ÿ   ̺Ʈ ߵѴ.
+		// GPU가 현재 울타리 지점에 도달했으면 이벤트를 발동한다.
 		ThrowIfFailed(fence->SetEventOnCompletion(currentFence, eventHandle));
 
-		// GPU  Ÿ   ϴ ̺Ʈ ٸ.
+		// GPU가 현재 울타리 지점에 도달했음을 뜻하는 이벤트를 기다린다.
 		WaitForSingleObject(eventHandle, INFINITE);
 		CloseHandle(eventHandle);
 	}
 }
 
-void D3DDebug::BuildDebugMeshWithTopology(DebugData& data, const std::vector<LineVertex>& vertices, const float time,
+void D3DDebug::BuildDebugMeshWithTopology(DebugData& data, std::span<const LineVertex> vertices, const float time,
 	D3D_PRIMITIVE_TOPOLOGY topology)
 {
-	//  ۸ Ѵ.
+	std::lock_guard<std::mutex> lock(pendingMutex);
+
+	// 정점 버퍼를 생성한다.
 	data.debugMesh->BuildVertices(d3dDevice, meshBuildCmdList.Get(),
 	(void*)vertices.data(), (UINT32)vertices.size(), (UINT32)sizeof(LineVertex));
 
-	// Ƽ ð Ѵ.
+	// 프리미티브와 시간을 설정한다.
 	data.debugMesh->SetPrimitiveType(topology);
 	data.time = time;
 
-	//  ޽ Ѵ.
-	debugDatas.push_back(data);
-
-	isMeshBuild = true;
+	// 생성 명령어가 수행될 때까지 대기 목록에 둔다.
+	pendingDatas.push_back(data);
 }
 
-void D3DDebug::BuildDebugMesh(DebugData& data, const std::vector<LineVertex>& vertices, const float time)
+void D3DDebug::BuildDebugMesh(DebugData& data, std::span<const LineVertex> vertices, const float time)
 {
 	BuildDebugMeshWithTopology(data, vertices, time, D3D11_PRIMITIVE_TOPOLOGY_LINELIST);
 }
\ No newline at end of file
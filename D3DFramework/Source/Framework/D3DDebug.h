@@ -5,12 +5,14 @@
 #include "d3dx12.h"
 #include <DirectXCollision.h>
 #include <vector>
+#include <span>
+#include <mutex>
 
 struct LineVertex;
 
 /*
-ӿũ ϱ  Ŭ
-  , ޽  ׸.
+프레임워크에서 디버깅하기 위한 클래스
+디버그 용 라인, 메쉬 등을 그린다.
 */
 class D3DDebug
 {
@@ -19,9 +21,9 @@ public:
 	{
 		class Mesh* debugMesh;
 		float time;
-		//    ÿ  ޽ ޸𸮸 ؾ ϴµ
-		//  ӿ  ҽ ϰ Ƿ
-		// NUM_FRAME_RESOURCESŭ    ޸𸮸 Ѵ.
+		// 수명이 다 될 시에 디버그 메쉬의 메모리를 해제해야 하는데
+		// 이전 프레임에서 이 리소스를 사용하고 있으므로
+		// NUM_FRAME_RESOURCES만큼 프레임이 지났을 때 메모리를 해제한다.
 		INT32 frame = NUM_FRAME_RESOURCES;
 	};
 
@@ -64,27 +66,32 @@ private:
 	void Reset(ID3D12GraphicsCommandList* cmdList, ID3D12CommandAllocator* cmdAlloc);
 	void FlushCommandQueue();
 
-	// primitive topology   ޽ .
-	void BuildDebugMeshWithTopology(DebugData& data, const std::vector<LineVertex>& vertices, const float time, D3D_PRIMITIVE_TOPOLOGY topology);
-	// primitive topology lint list  ޽ .
-	void BuildDebugMesh(DebugData& data, const std::vector<LineVertex>& vertices, const float time);
+	// primitive topology에 따라 디버그 메쉬를 만든다.
+	void BuildDebugMeshWithTopology(DebugData& data, std::span<const LineVertex> vertices, const float time, D3D_PRIMITIVE_TOPOLOGY topology);
+	// primitive topology가 lint list인 디버그 메쉬를 만든다.
+	void BuildDebugMesh(DebugData& data, std::span<const LineVertex> vertices, const float time);
 
-	//  ޽ ϴ ɾ Ѵ.
+	// 디버그 메쉬를 생성하는 명령어를 수행한다.
 	void ExcuteBuild();
 
 private:
 	ID3D12Device* d3dDevice = nullptr;
 
-	//  ޽  Ŀǵ Ʈ  д.
-	// ӿũ ӵ ʱ ̴.
+	// 디버그 메쉬를 생성한 커맨드 오브젝트를 따로 둔다.
+	// 프레임워크에 종속되지 않기 위함이다.
 	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> meshBuildCmdList;
 	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> meshBuildCmdAlloc;
 	Microsoft::WRL::ComPtr<ID3D12CommandQueue> cmdQueue;
 	Microsoft::WRL::ComPtr<ID3D12Fence> fence;
 	UINT64 currentFence = 0;
 
-	// true ,  ޽   ɾ Ѵ.
-	bool isMeshBuild = false;
+	// 생성 명령어가 기록되었지만 아직 GPU에서 수행되지 않은 디버그 메쉬들
+	// Update에서 명령어를 수행한 후에 debugDatas로 옮겨 그려지게 한다.
+	std::vector<DebugData> pendingDatas;
+	// 디버그 메쉬는 여러 스레드에서 요청될 수 있으므로 생성 명령 리스트와 pendingDatas를 보호한다.
+	std::mutex pendingMutex;
 
 	std::list<DebugData> debugDatas;
+	// 렌더 단계는 다른 스레드에서 실행될 수 있으므로 디버그 데이터를 보호한다.
+	std::mutex mutex;
 };
\ No newline at end of file
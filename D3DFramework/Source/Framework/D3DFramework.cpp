@@ -7,7 +7,22 @@
 #include "GameTimer.h"
 #include "Camera.h"
 #include "InputManager.h"
-#include "Octree.h"
+#include "Broadphase.h"
+#include "SceneQuery.h"
+#include "PhysicsRecorder.h"
+#include "ClothSolver.h"
+#include "StaticBatcher.h"
+#include "SceneFile.h"
+#include "WorldPartition.h"
+#include "WorldSnapshot.h"
+#include "TransformStore.h"
+#include "DeferredCommands.h"
+#include "IndirectDraw.h"
+#include "VisibleSet.h"
+#include "OcclusionBuffer.h"
+#include "ParallelFor.hpp"
+#include "JobSystem.h"
+#include "FrameAllocator.h"
 #include "Ssao.h"
 #include "Ssr.h"
 #include "StopWatch.h"
@@ -27,6 +42,7 @@
 #include "../Object/PointLight.h"
 #include "../Object/SpotLight.h"
 #include "../Object/Particle.h"
+#include "../Object/Cloth.h"
 #include "../Object/Billboard.h"
 #include "../Object/SkySphere.h"
 #include "../Object/Terrain.h"
@@ -40,11 +56,13 @@
 using namespace std::literals;
 using Microsoft::WRL::ComPtr;
 
+static const std::wstring sceneFileName = L"Assets/Scenes/Default.scene";
+
 D3DFramework::D3DFramework(HINSTANCE hInstance, const INT32 screenWidth, const INT32 screenHeight, 
 	const std::wstring applicationName, const bool useWinApi)
 	: D3DApp(hInstance, screenWidth, screenHeight, applicationName, useWinApi)
 {
-	//  ϳ Framework Ѵ.
+	// 오직 하나의 Framework만이 존재한다.
 	assert(instance == nullptr);
 	instance = this;
 
@@ -53,6 +71,7 @@ D3DFramework::D3DFramework(HINSTANCE hInstance, const INT32 screenWidth, const I
 		shadowPassCB[i] = std::make_unique<PassConstants>();
 
 	camera = std::make_unique<Camera>();
+	clothSolver = std::make_unique<ClothSolver>();
 }
 
 D3DFramework::~D3DFramework() 
@@ -63,7 +82,10 @@ D3DFramework::~D3DFramework()
 
 	for (int i = 0; i < (int)RenderLayer::Count; ++i)
 		renderableObjects[i].clear();
-	gameObjects.clear();
+	cloths.clear();
+	gameObjects.Clear();
+	// 스트리밍된 메쉬는 객체들이 모두 제거된 뒤에 해제한다.
+	worldPartition = nullptr;
 	lights.clear();
 	widgets.clear();
 	particles.clear();
@@ -72,10 +94,15 @@ D3DFramework::~D3DFramework()
 		shadowPassCB[i] = nullptr;
 	mainPassCB = nullptr;
 	camera = nullptr;
-	octreeRoot = nullptr;
+	broadphase = nullptr;
+	sceneQuery = nullptr;
+	physicsRecorder = nullptr;
+	clothSolver = nullptr;
+	staticBatcher = nullptr;
 	ssao = nullptr;
 	ssr = nullptr;
 	blurFilter = nullptr;
+	occlusionBuffer = nullptr;
 }
 
 D3DFramework* D3DFramework::GetInstance()
@@ -88,6 +115,87 @@ Camera* D3DFramework::GetCamera() const
 	return camera.get();
 }
 
+SceneQuery* D3DFramework::GetSceneQuery() const
+{
+	return sceneQuery.get();
+}
+
+const PhysicsStats& D3DFramework::GetPhysicsStats() const
+{
+	return physicsStats;
+}
+
+const CullingStats& D3DFramework::GetCullingStats() const
+{
+	return cameraVisibleSet.GetStats();
+}
+
+void D3DFramework::ResetFrameStats()
+{
+	__super::ResetFrameStats();
+
+	cameraVisibleSet.ResetTotalStats();
+	for (auto& visibleSet : shadowVisibleSets)
+		visibleSet.ResetTotalStats();
+}
+
+void D3DFramework::PrintFrameStats(const UINT32 frameCount) const
+{
+	__super::PrintFrameStats(frameCount);
+
+	const double frameNum = (double)(std::max)(frameCount, 1u);
+	auto printCullingStats = [frameNum](const std::string& viewName, const CullingStats& stats)
+	{
+		std::cout << "  " << viewName << " : tested " << stats.testedCount / frameNum << ", culled " << stats.culledCount / frameNum
+			<< " (occluded " << stats.occludedCount / frameNum << "), visible " << stats.visibleCount / frameNum << " per frame" << std::endl;
+	};
+
+	std::cout << "Culling" << std::endl;
+	printCullingStats("Camera  ", cameraVisibleSet.GetTotalStats());
+	for (size_t i = 0; i < shadowVisibleSets.size(); ++i)
+		printCullingStats("Shadow " + std::to_string(i), shadowVisibleSets[i].GetTotalStats());
+}
+
+void D3DFramework::SetPhysicsRecordMode(const PhysicsRecordMode mode, const std::string& fileName)
+{
+	if (mode == PhysicsRecordMode::None)
+	{
+		physicsRecorder = nullptr;
+		return;
+	}
+
+	physicsRecorder = std::make_unique<PhysicsRecorder>(mode, fileName);
+}
+
+void D3DFramework::ReserveSnapshot(WorldSnapshot& snapshot) const
+{
+	snapshot.Reserve(gameObjects.GetCount(), (UINT32)particles.size(), broadphase ? broadphase->GetStaticObjectCount() : 0);
+}
+
+void D3DFramework::CaptureSnapshot(WorldSnapshot& snapshot) const
+{
+	snapshot.Capture(gameObjects, particles, broadphase.get());
+}
+
+void D3DFramework::CaptureDeltaSnapshot(const WorldSnapshot& base, WorldSnapshot& snapshot) const
+{
+	snapshot.CaptureDelta(base, gameObjects, particles, broadphase.get());
+}
+
+bool D3DFramework::RestoreSnapshot(const WorldSnapshot& snapshot)
+{
+	// 렌더 단계가 읽고 있는 트랜스폼을 바꾸므로 이전 프레임의 기록이 끝나기를 기다린다.
+	WaitForRender();
+
+	const bool result = snapshot.Restore(gameObjects, particles, broadphase.get());
+
+	// 되돌린 위치로 충돌 바운드를 다시 계산하여 질의와 다음 물리 스텝이 바로 사용할 수 있게 한다.
+	TransformStore::GetInstance()->UpdateWorlds();
+	sceneQuery->UpdateSnapshot(gameObjects, *broadphase);
+
+	return result;
+}
+
 bool D3DFramework::Initialize()
 {
 	if (!__super::Initialize())
@@ -100,24 +208,32 @@ bool D3DFramework::Initialize()
 
 void D3DFramework::OnDestroy()
 {
+	WaitForRender();
+
 	__super::OnDestroy();
 
-	for (UINT32 i = 0; i < FrameResource::processorCoreNum; ++i)
-	{
-		CloseHandle(workerBeginFrameEvents[i]);
-		CloseHandle(workerFinishedFrameEvents[i]);
-		workerThread[i].join();
-	}
+	if (physicsRecorder)
+		physicsRecorder->Close();
+
+	JobSystem::GetInstance()->Shutdown();
+
+#if defined(DEBUG) || defined(_DEBUG)
+	// 풀마다 최대 사용량을 확인하여 청크 크기를 조정하는 데에 사용한다.
+	PoolBase::PrintStats();
+#endif
 }
 
 void D3DFramework::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 {
+	// 기록 중인 프레임이 사용하는 리소스를 다시 만들기 전에 기다린다.
+	WaitForRender();
+
 	__super::OnResize(screenWidth, screenHeight);
 
-	// ī޶   ٽ Ѵ.
+	// 카메라 뷰 행렬을 다시 계산한다.
 	camera->SetLens(60.0f, GetAspectRatio(), 0.1f, 1000.0f);
 
-	// ȭ ػ󵵰 ٲ  ũ⵵ ٲ Ѵ.
+	// 화면 해상도가 바뀌면 위젯의 크기도 바뀌어야 한다.
 	for (auto& widget : widgets)
 		widget->UpdateNumFrames();
 
@@ -136,17 +252,21 @@ void D3DFramework::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 
 void D3DFramework::InitFramework()
 {
-	// ɾ Ҵڿ Ʈ Ѵ.
+	// 명령어 할당자와 리스트를 리셋한다.
 	Reset(mainCommandList.Get(), mainCommandAlloc.Get());
 
-	// ÷̾ ī޶ 3D   ǵ 
-	// ʸ ϰ  ġ Ѵ.
+	// 난수를 사용하는 객체들이 생성되기 전에 기록된 시드를 적용한다.
+	if (physicsRecorder && !physicsRecorder->Load())
+		physicsRecorder = nullptr;
+
+	// 플레이어 카메라가 3D 사운드의 기준이 되도록 
+	// 리스너를 설정하고 시작 위치를 지정한다.
 	camera->SetListener(listener.Get());
 	camera->SetPosition(25.8f, -30.5f, 0.74f);
 	camera->RotateY(-15.0f);
 	camera->Pitch(-3.0f);
 
-	// ʿ ּµ εѴ.
+	// 필요한 애셋들을 로드한다.
 	AssetManager::GetInstance()->Initialize(d3dDevice.Get(), mainCommandList.Get(), d3dSound.Get());
 
 #ifdef SSAO
@@ -158,25 +278,54 @@ void D3DFramework::InitFramework()
 	blurFilter = std::make_unique<BlurFilter>(d3dDevice.Get(), screenWidth / 2, screenHeight / 2, Ssr::ssrMapFormat);
 #endif
 
-	// ӿũ Ǵ  ü ̸ .
-	CreateObjects();
+#ifdef WORLD_PARTITION
+	// 씬 파일의 객체들은 카메라 주변의 셀만 로드하고 나머지는 카메라가 다가갈 때 로드한다.
+	// 씬 파일이 없다면 코드로 생성한 씬을 저장하고, 이번 실행에서는 모든 객체를 상주시킨다.
+	worldPartition = std::make_unique<WorldPartition>(d3dDevice.Get());
+	if (worldPartition->Open(sceneFileName))
+	{
+		worldPartition->Preload(camera->GetPosition3f(), gameObjects, renderableObjects);
+	}
+	else
+	{
+		worldPartition = nullptr;
+		AssetManager::GetInstance()->LoadStreamedMeshes(d3dDevice.Get(), mainCommandList.Get());
+		CreateObjects();
+		SaveScene(sceneFileName);
+	}
+#else
+	// 프레임워크에 사용되는 모든 객체를 미리 만든다.
+	// 저장된 씬 파일이 있다면 파일로부터 객체들을 생성하고, 없다면 코드로 생성한 씬을 저장해둔다.
+	if (!LoadScene(sceneFileName))
+	{
+		CreateObjects();
+		SaveScene(sceneFileName);
+	}
+#endif
+	CreateBillboards();
 	CreateLights();
 	CreateWidgets(d3dDevice.Get(), mainCommandList.Get());
 	CreateParticles();
+	CreateCloths(d3dDevice.Get(), mainCommandList.Get());
 	CreateTerrain();
+#ifdef STATIC_BATCHING
+	// 씬 파일의 객체들은 WorldPartition이 셀이 로드될 때 셀 단위로 합친다.
+	if (worldPartition == nullptr)
+		CreateStaticBatches(d3dDevice.Get(), mainCommandList.Get());
+#endif
 	CreateFrameResources(d3dDevice.Get());
-	CreateThreads();
 
 	const UINT32 textureNum = (UINT32)AssetManager::GetInstance()->textures.size();
 	const UINT32 shadowMapNum = (UINT32)LIGHT_NUM;
 	const UINT32 particleNum = (UINT32)particles.size();
 
 	CreateRootSignatures(textureNum, shadowMapNum);
+	CreateCommandSignatures();
 	CreateDescriptorHeaps(textureNum, shadowMapNum, particleNum);
 	CreatePSOs();
 	CreateTerrainStdDevAndNormalMap();
 
-	// ʱȭ ɵ Ѵ.
+	// 초기화 명령들을 실행한다.
 	ThrowIfFailed(mainCommandList->Close());
 	ID3D12CommandList* cmdLists[] = { mainCommandList.Get() };
 	commandQueue->ExecuteCommandLists(1, cmdLists);
@@ -185,24 +334,44 @@ void D3DFramework::InitFramework()
 	D3DDebug::GetInstance()->CreateCommandObjects(d3dDevice.Get());
 #endif
 
-	// ʱȭ   ٸ.
+	// 초기화가 끝날 때까지 기다린다.
 	FlushCommandQueue();
 
-	// ޽  ε ۸ Ѵ.
+	// 메쉬에서 사용된 업로드 버퍼를 해제한다.
 	AssetManager::GetInstance()->DisposeUploaders();
+	if (staticBatcher)
+		staticBatcher->DisposeUploaders();
 
-	for (const auto& obj : gameObjects)
+	for (GameObject* obj : gameObjects)
 	{
 		obj->BeginPlay();
 	}
 
-	// 浹 ȭϱ  Ʈ Ѵ.
-	BoundingBox octreeAABB = BoundingBox(XMFLOAT3(0.0f, 0.0f, 0.0f), XMFLOAT3(500.0f, 500.0f, 500.0f));
-	octreeRoot = std::make_unique<Octree>(octreeAABB, gameObjects);
-	octreeRoot->BuildTree();
+	// 충돌을 최적화하기 위해 정적 객체와 동적 객체를 나누어 관리한다.
+	BoundingBox worldAABB = BoundingBox(XMFLOAT3(0.0f, 0.0f, 0.0f), XMFLOAT3(500.0f, 500.0f, 500.0f));
+	broadphase = std::make_unique<Broadphase>(&gameObjects, worldAABB);
+	broadphase->AddObjects(gameObjects);
 
-	AssetManager::GetInstance()->sounds["WinterWind"]->SetPosition(10.0f, -35.0f, 30.0f);
-	AssetManager::GetInstance()->sounds["WinterWind"]->Play(true);
+	// 물리 시뮬레이션을 기록한다면 초기 상태를 저장하고, 재생한다면 기록된 상태로 되돌린다.
+	if (physicsRecorder)
+	{
+		physicsRecorder->CaptureInitialState(gameObjects);
+		if (!physicsRecorder->RestoreInitialState(gameObjects))
+			physicsRecorder = nullptr;
+	}
+
+	// 광선 충돌, 스윕 등의 질의를 수행할 스레드를 생성한다.
+	// 정적 트리는 정적 객체가 바뀔 때까지 다시 만들지 않으므로 월드 바운드를 먼저 계산해둔다.
+	TransformStore::GetInstance()->UpdateWorlds();
+	sceneQuery = std::make_unique<SceneQuery>();
+	sceneQuery->UpdateSnapshot(gameObjects, *broadphase);
+
+	// 널 백엔드에서는 사운드가 로드되지 않는다.
+	if (Sound* windSound = AssetManager::GetInstance()->FindSound("WinterWind"s))
+	{
+		windSound->SetPosition(10.0f, -35.0f, 30.0f);
+		windSound->Play(true);
+	}
 }
 
 void D3DFramework::CreateDescriptorHeaps(const UINT32 textureNum, const UINT32 shadowMapNum, const UINT32 particleNum)
@@ -226,7 +395,7 @@ void D3DFramework::CreateDescriptorHeaps(const UINT32 textureNum, const UINT32 s
 		GetGpuSrv(DescriptorIndex::deferredBufferHeapIndex + 4), // Normal Map x
 		GetCpuSrv(DescriptorIndex::ssrMapHeapIndex),
 		GetGpuSrv(DescriptorIndex::ssrMapHeapIndex),
-		GetRtv(SWAP_CHAIN_BUFFER_COUNT + DEFERRED_BUFFER_COUNT + 2)); // Ssao   Ÿ
+		GetRtv(SWAP_CHAIN_BUFFER_COUNT + DEFERRED_BUFFER_COUNT + 2)); // Ssao의 두 개의 렌더타겟
 	blurFilter->BuildDescriptors(d3dDevice.Get(),
 		GetCpuSrv(DescriptorIndex::ssrMapHeapIndex + 1), 
 		GetGpuSrv(DescriptorIndex::ssrMapHeapIndex + 1));
@@ -268,30 +437,34 @@ void D3DFramework::SetDefaultState(ID3D12GraphicsCommandList* cmdList)
 
 	cmdList->SetGraphicsRootSignature(rootSignatures["Common"].Get());
 
-	//  鿡 Ǵ Pass  ۸ ´.
+	// 이 장면에 사용되는 Pass 상수 버퍼를 묶는다.
 	cmdList->SetGraphicsRootConstantBufferView((int)RpCommon::Pass, currentFrameResource->GetPassVirtualAddress());
 
-	//  ۴  ϰ ׳ ϳ Ʈ ڷ   ִ.
+	// 구조적 버퍼는 힙을 생략하고 그냥 하나의 루트 서술자로 묶을 수 있다.
 	cmdList->SetGraphicsRootShaderResourceView((int)RpCommon::Light, currentFrameResource->GetLightVirtualAddress());
 	cmdList->SetGraphicsRootShaderResourceView((int)RpCommon::Material, currentFrameResource->GetMaterialVirtualAddress());
+	// 객체의 상수 버퍼도 구조적 버퍼로 묶어 인스턴스마다 인덱스로 읽는다.
+	cmdList->SetGraphicsRootShaderResourceView((int)RpCommon::ObjectBuffer, currentFrameResource->GetObjectVirtualAddress());
+	// 그리기마다 InstanceBase 루트 상수로 이 버퍼에서 읽기 시작할 위치만 바꾼다.
+	cmdList->SetGraphicsRootShaderResourceView((int)RpCommon::Instance, currentFrameResource->GetInstanceVirtualAddress());
 
-	//  鿡 Ǵ  ؽó ´. ̺ ù ڸ 
-	// ̺   ڰ ִ Root Signature Ǿ ִ.
+	// 이 장면에 사용되는 모든 텍스처를 묶는다. 테이블의 첫 서술자만 묶으면
+	// 테이블에 몇 개의 서술자가 있는지는 Root Signature에 설정되어 있다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpCommon::Texture, GetGpuSrv(DescriptorIndex::textureHeapIndex));
 
-	// G-Buffer   Ÿٵ ο εѴ.
+	// G-Buffer에 사용될 렌더 타겟들을 파이프라인에 바인딩한다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpCommon::GBuffer, GetGpuSrv(DescriptorIndex::deferredBufferHeapIndex));
 
-	// ׸  ο εѴ.
+	// 그림자 맵을 파이프라인에 바인딩한다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpCommon::ShadowMap, GetGpuSrv(DescriptorIndex::shadowMapHeapIndex));
 
 #ifdef SSAO
-	// Ssao Map εѴ. , Ssao  쿡 εѴ.
+	// Ssao Map을 바인딩한다. 단, Ssao를 사용할 경우에만 바인딩한다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpCommon::Ssao, GetGpuSrv(DescriptorIndex::ssaoMapHeapIndex));
 #endif
 
 #ifdef SSR
-	// Ssr Map εѴ. , Ssao  쿡 εѴ.
+	// Ssr Map을 바인딩한다. 단, Ssao를 사용할 경우에만 바인딩한다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpCommon::Ssr, GetGpuSrv(DescriptorIndex::ssrMapHeapIndex));
 #endif
 }
@@ -300,8 +473,24 @@ void D3DFramework::Render()
 {
 	__super::Render();
 
-	//    Ѵ.
-	if (GetOptionEnabled(Option::Wireframe))
+#ifdef PIPELINED_FRAME
+	// 명령 기록을 작업으로 넘기고 바로 반환하여 다음 프레임의 시뮬레이션을 진행한다.
+	// 다음 Tick은 스냅샷을 다시 쓰기 전에 WaitForRender로 이 작업을 기다린다.
+	JobSystem::GetInstance()->Run([this]() { RenderFrame(); }, &renderCounter);
+#else
+	RenderFrame();
+#endif
+}
+
+void D3DFramework::WaitForRender()
+{
+	JobSystem::GetInstance()->Wait(renderCounter);
+}
+
+void D3DFramework::RenderFrame()
+{
+	// 와이퍼 프레임 형식으로 렌더링한다.
+	if (renderOptions.test((int)Option::Wireframe))
 	{
 		auto cmdList = currentFrameResource->frameCmdLists[0].Get();
 		auto cmdAlloc = currentFrameResource->frameCmdAllocs[0].Get();
@@ -310,10 +499,10 @@ void D3DFramework::Render()
 		WireframePass(cmdList);
 
 		ThrowIfFailed(cmdList->Close());
-		ID3D12CommandList* cmdLists[] = { cmdList };
+		ID3D12CommandList* cmdLists[] = { cmdList->GetNative() };
 		commandQueue->ExecuteCommandLists(_countof(cmdLists), cmdLists);
 	}
-	// fill  Ѵ.
+	// fill 형식으로 렌더링한다.
 	else
 	{
 #ifdef MULTITHREAD_RENDERING
@@ -324,15 +513,15 @@ void D3DFramework::Render()
 		ParticleUpdate(cmdListPre);
 		ShadowMapPass(cmdListPre);
 
-		//  ù° ɾ  Ѵ.
+		// 각 첫번째 명령어들을 먼저 수행한다.
 		ThrowIfFailed(cmdListPre->Close());
-		ID3D12CommandList* commandListsPre[] = { cmdListPre };
+		ID3D12CommandList* commandListsPre[] = { cmdListPre->GetNative() };
 		commandQueue->ExecuteCommandLists(_countof(commandListsPre), commandListsPre);
 
-		// Ƽ   , ٸ   Ѵ.
+		// 멀티 스레드 렌더링에 경우, 다른 스레드들이 렌더링을 수행한다.
 		GBufferPass(nullptr);
 
-		// G۸ ä  Ѵ.
+		// G버퍼를 채우는 렌더링을 수행한다.
 		commandQueue->ExecuteCommandLists((UINT)currentFrameResource->executableCmdLists.size(), 
 			currentFrameResource->executableCmdLists.data());
 
@@ -345,9 +534,9 @@ void D3DFramework::Render()
 
 		Finish(cmdListPost);
 
-		//  ɾ Ѵ.
+		// 나머지 명령어를 수행한다.
 		ThrowIfFailed(cmdListPost->Close());
-		ID3D12CommandList* commandListsPost[] = { cmdListPost };
+		ID3D12CommandList* commandListsPost[] = { cmdListPost->GetNative() };
 		commandQueue->ExecuteCommandLists(_countof(commandListsPost), commandListsPost);
 #else
 		auto cmdList = currentFrameResource->frameCmdLists[0].Get();
@@ -367,41 +556,44 @@ void D3DFramework::Render()
 		Finish(cmdList);
 
 		ThrowIfFailed(cmdList->Close());
-		ID3D12CommandList* commandLists[] = { cmdList };
+		ID3D12CommandList* commandLists[] = { cmdList->GetNative() };
 		commandQueue->ExecuteCommandLists(_countof(commandLists), commandLists);
 #endif
 	}
 
-	//  ۿ ĸ ۸ ٲ۴.
-	ThrowIfFailed(swapChain->Present(0, 0));
+	// 전면 버퍼와 후면 버퍼를 바꾼다. 널 백엔드는 교환 사슬이 없다.
+	if (swapChain)
+		ThrowIfFailed(swapChain->Present(0, 0));
 	currentBackBuffer = (currentBackBuffer + 1) % SWAP_CHAIN_BUFFER_COUNT;
 
-	//  Ÿ  ɵ ǥϵ Ÿ  Ų.
+	// 현재 울타리 지점까지의 명령들을 표시하도록 울타리 값을 전진시킨다.
 	currentFrameResource->fence = ++currentFence;
 
-	//  Ÿ  ϴ (Signal)  ⿭ ߰Ѵ.
-	//  Ÿ  GPU  Signal() ɱ   óϱ
-	//   ʴ´.
+	// 새 울타리 지점을 설정하는 명령(Signal)을 명령 대기열에 추가한다.
+	// 새 울타리 지점은 GPU가 이 Signal() 명령까지의 모든 명령을 처리하기
+	// 전까지는 설정되지 않는다.
 	commandQueue->Signal(fence.Get(), currentFence);
 }
 
 void D3DFramework::Tick(float deltaTime)
 {
-	__super::Tick(deltaTime);
-
-	currentFrameResourceIndex = (currentFrameResourceIndex + 1) % NUM_FRAME_RESOURCES;
-	currentFrameResource = frameResources[currentFrameResourceIndex].get();
+	// 이번 프레임에 사용할 임시 메모리를 되돌린다.
+	FrameAllocator::GetInstance()->BeginFrame();
 
-	// GPU  FrameResource  ƴ ȮѴ.
-	// ƴ϶ Fence Point   ٸ.
-	if (currentFrameResource->fence != 0 && fence->GetCompletedValue() < currentFrameResource->fence)
+	// 기록하거나 재생할 때는 한 프레임에 한 스텝씩 고정된 시간 간격으로 진행한다.
+	// 객체의 Tick과 상수 버퍼 갱신도 같은 시간 간격을 받아야 재생이 기록과 같아진다.
+	const bool isReplay = physicsRecorder && physicsRecorder->GetMode() == PhysicsRecordMode::Replay;
+	if (physicsRecorder)
 	{
-		HANDLE eventHandle = CreateEventEx(nullptr, false, false, EVENT_ALL_ACCESS);
-		ThrowIfFailed(fence->SetEventOnCompletion(currentFrameResource->fence, eventHandle));
-		WaitForSingleObject(eventHandle, INFINITE);
-		CloseHandle(eventHandle);
+		deltaTime = physicsRecorder->GetFixedDeltaTime();
+		if (isReplay)
+			physicsRecorder->ReplayInput(InputManager::keys);
+		else
+			physicsRecorder->RecordInput(InputManager::keys);
 	}
 
+	__super::Tick(deltaTime);
+
 	if (InputManager::keys['w'] || InputManager::keys['W'])
 		camera->Walk(deltaTime);
 
@@ -416,16 +608,72 @@ void D3DFramework::Tick(float deltaTime)
 
 	camera->UpdateViewMatrix();
 
-	// ī޶    ǥ ȯѴ.
+	StepPhysics(deltaTime);
+
+	if (physicsRecorder)
+	{
+		physicsRecorder->EndStep(physicsStats);
+
+		if (isReplay && physicsRecorder->IsFinished())
+		{
+			physicsRecorder->Close();
+			PostQuitMessage(0);
+		}
+	}
+
+	// 움직인 객체들의 월드 행렬과 충돌 바운드를 한 번에 계산한다.
+	// 물리 스텝은 프레임마다 한 번이므로 여기서만 계산하며, 객체의 충돌 바운드는 각 객체의 Tick에서 가져간다.
+	TransformStore::GetInstance()->UpdateWorlds();
+
+	// 여기까지의 시뮬레이션은 이전 프레임의 명령 기록과 겹쳐서 진행된다.
+	// 이후로는 렌더 단계가 읽는 스냅샷을 새로 쓰므로 이전 프레임의 기록이 끝나기를 기다린다.
+	WaitForRender();
+
+	currentFrameResourceIndex = (currentFrameResourceIndex + 1) % NUM_FRAME_RESOURCES;
+	currentFrameResource = frameResources[currentFrameResourceIndex].get();
+
+	// GPU가 현재 FrameResource까지 명령을 끝맞쳤는지 확인한다.
+	// 아니라면 Fence Point에 도달할 떄까지 기다린다.
+	if (currentFrameResource->fence != 0 && fence->GetCompletedValue() < currentFrameResource->fence)
+	{
+		HANDLE eventHandle = CreateEventEx(nullptr, false, false, EVENT_ALL_ACCESS);
+		ThrowIfFailed(fence->SetEventOnCompletion(currentFrameResource->fence, eventHandle));
+		WaitForSingleObject(eventHandle, INFINITE);
+		CloseHandle(eventHandle);
+	}
+
+#ifdef WORLD_PARTITION
+	// 카메라 주변의 셀을 로드하고 멀어진 셀을 해제한다.
+	if (worldPartition)
+		worldPartition->Update(camera->GetPosition3f(), gameObjects, renderableObjects, broadphase.get());
+#endif
+	// 객체의 수가 바뀌었을 수 있으므로 GPU가 다 사용한 현재 프레임의 상수 버퍼 크기를 맞춘다.
+	UpdateObjectBufferPool();
+
+	// 카메라 로컬 프러스텀을 월드 좌표계로 변환한다.
 	worldCamFrustum = camera->GetWorldCameraBounding();
+	// 렌더 단계는 기록 도중 바뀔 수 있는 옵션 대신 이 값을 읽는다.
+	renderOptions = options;
 
-	//   ۸ ƮѴ.
-	octreeRoot->Update(deltaTime);
+	// 각 상수 버퍼를 업데이트한다.
 	UpdateObjectBuffer(deltaTime);
+	UpdateDrawLists();
+#ifdef OCCLUSION_CULLING
+	// 오클루더를 고른 후, Tick의 나머지 갱신과 겹쳐서 워커 스레드에서 래스터화한다.
+	BeginOcclusionCulling();
+#endif
+	UpdateInstanceBufferPool();
+	UpdateIndirectBufferPool();
+
+	// 물리 업데이트가 끝난 객체들로 질의에 사용될 스냅샷을 갱신한다.
+	sceneQuery->UpdateSnapshot(gameObjects, *broadphase);
+	CheckPickingResult();
+
 	UpdateLightBuffer(deltaTime);
 	UpdateMaterialBuffer(deltaTime);
 	UpdateMainPassBuffer(deltaTime);
 	UpdateWidgetBuffer(deltaTime);
+	UpdateClothBuffer(deltaTime);
 	UpdateParticleBuffer(deltaTime);
 	UpdateTerrainBuffer(deltaTime);
 	UpdateSsrBuffer(deltaTime);
@@ -434,19 +682,66 @@ void D3DFramework::Tick(float deltaTime)
 	UpdateSsaoBuffer(deltaTime);
 #endif
 
+	// 조명의 프러스텀이 갱신되고 오클루더의 래스터화가 끝난 후에 모든 뷰를 컬링한다.
+	CullViews();
+
 #if defined(DEBUG) || defined(_DEBUG)
 	D3DDebug::GetInstance()->Update(deltaTime);
 #endif
 }
 
 
+void D3DFramework::StepPhysics(float deltaTime)
+{
+	StopWatch stopWatch;
+
+	stopWatch.Start();
+	broadphase->Update();
+	stopWatch.End();
+	physicsStats.broadphaseTime = stopWatch.Nanosecond() / 1000000.0;
+
+	stopWatch.Start();
+	Physics::Narrowphase(broadphase->GetPairs(), contacts);
+	stopWatch.End();
+	physicsStats.narrowphaseTime = stopWatch.Nanosecond() / 1000000.0;
+
+	stopWatch.Start();
+	Physics::Solve(contacts, deltaTime);
+	stopWatch.End();
+	physicsStats.solveTime = stopWatch.Nanosecond() / 1000000.0;
+
+	stopWatch.Start();
+	tickObjects.clear();
+	for (GameObject* obj : gameObjects)
+		tickObjects.push_back(obj);
+
+	// 적분은 각 객체의 상태만을 바꾸므로 병렬로 수행한다.
+	ParallelFor((UINT32)tickObjects.size(), updateGrainSize, [this, deltaTime](const UINT32 i)
+	{
+		tickObjects[i]->Integrate(deltaTime);
+	});
+	stopWatch.End();
+	physicsStats.integrateTime = stopWatch.Nanosecond() / 1000000.0;
+
+	clothSolver->Simulate(cloths, gameObjects, deltaTime);
+	physicsStats.clothTime = clothSolver->GetLastSimulateTime();
+
+	physicsStats.pairCount = broadphase->GetPairCount();
+	physicsStats.contactCount = (UINT32)contacts.size();
+}
+
 void D3DFramework::UpdateObjectBuffer(float deltaTime)
 {
 	auto currObjectCB = currentFrameResource->objectPool->GetBuffer();
-	UINT32 objectIndex = 0;
 
-	for (auto& obj : gameObjects)
+	tickObjects.clear();
+	for (GameObject* obj : gameObjects)
+		tickObjects.push_back(obj);
+
+	// 오브젝트마다 상수 버퍼의 슬롯이 다르므로 구간을 나누어 병렬로 갱신한다.
+	ParallelFor((UINT32)tickObjects.size(), updateGrainSize, [this, currObjectCB, deltaTime](const UINT32 objectIndex)
 	{
+		GameObject* obj = tickObjects[objectIndex];
 		obj->Tick(deltaTime);
 
 		if (objectIndex != obj->cbIndex)
@@ -457,20 +752,202 @@ void D3DFramework::UpdateObjectBuffer(float deltaTime)
 
 		if (obj->IsUpdate())
 		{
-			// Ʈ  ۸ ƮѴ.
+			// 오브젝트의 상수 버퍼를 업데이트한다.
 			ObjectConstants objConstants;
 			XMStoreFloat4x4(&objConstants.world, XMMatrixTranspose(obj->GetWorld()));
 			objConstants.materialIndex = obj->GetMaterial()->GetMaterialIndex();
 
 			currObjectCB->CopyData(objectIndex, objConstants);
 		}
-		++objectIndex;
+	});
+
+	// Tick 도중 미뤄둔 다른 객체에 대한 작업을 실행한다.
+	DeferredCommands::GetInstance()->Execute();
+}
+
+void D3DFramework::UpdateDrawLists()
+{
+	const XMVECTOR camPos = camera->GetPosition();
+	const XMVECTOR camLook = camera->GetLook();
+	const float farZ = camera->GetFarZ();
+
+	for (int layer = 0; layer < (int)RenderLayer::Count; ++layer)
+	{
+		DrawList& drawList = drawLists[layer];
+		drawList.Clear();
+
+		// 반투명 객체는 올바르게 섞이도록 뒤에서 앞으로, 나머지는 Early-Z를 위해 앞에서 뒤로 그린다.
+		const bool isBackToFront = layer == (int)RenderLayer::Transparent;
+
+		for (const auto handle : renderableObjects[layer])
+		{
+			GameObject* obj = gameObjects.Get(handle);
+			if (obj == nullptr)
+				continue;
+
+			DrawRecord record;
+			if (!obj->BuildDrawRecord(record))
+				continue;
+
+			const float depth = XMVectorGetX(XMVector3Dot(XMLoadFloat3(&record.bounds.Center) - camPos, camLook));
+			const UINT32 materialIndex = record.material ? record.material->GetMaterialIndex() : 0;
+			const UINT64 meshID = record.mesh ? record.mesh->GetUID() : 0;
+			record.sortKey = DrawList::MakeSortKey(layer, materialIndex, meshID, depth, farZ, isBackToFront);
+			// 하늘은 항상 카메라를 감싸므로 컬링하지 않는다.
+			if (layer == (int)RenderLayer::Sky)
+				record.isCullable = false;
+
+			drawList.Add(record);
+		}
+
+		// 상태가 비슷한 레코드가 연속되도록 정렬한다. 스레드마다 그릴 구간은 컬링 후에 VisibleSet이 나눈다.
+		drawList.Sort();
 	}
 }
 
+void D3DFramework::BeginOcclusionCulling()
+{
+	if (occlusionBuffer == nullptr)
+		occlusionBuffer = std::make_unique<OcclusionBuffer>(occlusionSettings.width, occlusionSettings.height);
+
+	// 시스템 메모리에 정점과 인덱스가 남아 있는 불투명 메쉬 중 화면상 크기가 큰 것들을 오클루더로 고른다.
+	const XMVECTOR camPos = camera->GetPosition();
+	const float nearZ = camera->GetNearZ();
+	const auto& records = drawLists[(int)RenderLayer::Opaque].GetRecords();
+
+	occluderCandidates.clear();
+	for (UINT32 i = 0; i < (UINT32)records.size(); ++i)
+	{
+		const DrawRecord& record = records[i];
+		if (!record.isCullable || !record.isIndexed || record.transformIndex == UINT32_MAX)
+			continue;
+
+		const Mesh* mesh = record.mesh;
+		if (mesh->GetVertexData() == nullptr || mesh->GetIndexData() == nullptr ||
+			mesh->GetIndexCount() / 3 > occlusionSettings.maxOccluderTriangles)
+			continue;
+
+		const float radius = XMVectorGetX(XMVector3Length(XMLoadFloat3(&record.bounds.Extents)));
+		const float distance = XMVectorGetX(XMVector3Length(XMLoadFloat3(&record.bounds.Center) - camPos));
+		const float size = radius / (std::max)(distance, nearZ);
+		if (size >= occlusionSettings.minOccluderSize)
+			occluderCandidates.emplace_back(size, i);
+	}
+
+	const size_t occluderCount = (std::min)(occluderCandidates.size(), (size_t)occlusionSettings.maxOccluderCount);
+	std::partial_sort(occluderCandidates.begin(), occluderCandidates.begin() + occluderCount, occluderCandidates.end(),
+		[](const auto& lhs, const auto& rhs) { return lhs.first > rhs.first; });
+
+	// 래스터화하는 동안 Tick이 트랜스폼을 바꿀 수 있으므로 월드 행렬을 복사해둔다.
+	occluders.resize(occluderCount);
+	for (size_t i = 0; i < occluderCount; ++i)
+	{
+		const DrawRecord& record = records[occluderCandidates[i].second];
+		OccluderMesh& occluder = occluders[i];
+		occluder.vertices = record.mesh->GetVertexData();
+		occluder.vertexCount = record.mesh->GetVertexCount();
+		occluder.vertexStride = record.mesh->GetVertexStride();
+		occluder.indices = record.mesh->GetIndexData();
+		occluder.indexCount = record.mesh->GetIndexCount();
+		occluder.world = TransformStore::GetInstance()->GetWorld(record.transformIndex);
+	}
+
+	// 지형은 가장 큰 오클루더이다. 지형 아래에서는 평면이 지형보다 앞에 있게 되므로 위에 있을 때만 사용한다.
+	if (terrain != nullptr)
+	{
+		const XMFLOAT3 terrainPos = terrain->GetPosition();
+		const XMFLOAT3 terrainUp = terrain->GetUp();
+		const XMVECTOR terrainPlane = XMPlaneFromPointNormal(XMLoadFloat3(&terrainPos), XMLoadFloat3(&terrainUp));
+		if (XMVectorGetX(XMPlaneDotCoord(terrainPlane, camPos)) > 0.0f)
+			occluders.push_back(terrain->GetOccluder());
+	}
+
+	XMFLOAT4X4 viewProj;
+	XMStoreFloat4x4(&viewProj, camera->GetView() * camera->GetProj());
+
+	JobSystem::GetInstance()->Run([this, viewProj]()
+	{
+		occlusionBuffer->Render(occluders, viewProj);
+	}, &occlusionCounter);
+}
+
+void D3DFramework::SetOcclusionSettings(const OcclusionSettings& settings)
+{
+	// CullViews가 래스터화를 기다린 후이므로 Tick 밖에서는 버퍼를 바로 바꿀 수 있다.
+	const bool isResized = settings.width != occlusionSettings.width || settings.height != occlusionSettings.height;
+	occlusionSettings = settings;
+
+	if (occlusionBuffer && isResized)
+		occlusionBuffer->Resize(occlusionSettings.width, occlusionSettings.height);
+}
+
+const OcclusionSettings& D3DFramework::GetOcclusionSettings() const
+{
+	return occlusionSettings;
+}
+
+void D3DFramework::CullViews()
+{
+	// 카메라는 워커 스레드들이 나누어 기록하고, 그림자 맵은 하나의 명령어 리스트에 기록된다.
+	const OcclusionBuffer* cameraOcclusion = nullptr;
+#ifdef OCCLUSION_CULLING
+	// 오클루전 버퍼는 카메라에서 래스터화되었으므로 카메라 뷰에만 사용한다.
+	JobSystem::GetInstance()->Wait(occlusionCounter);
+	cameraOcclusion = occlusionBuffer.get();
+#endif
+	cameraVisibleSet.Cull(drawLists, &worldCamFrustum, cameraOcclusion, FrameResource::processorCoreNum);
+
+	if (shadowVisibleSets.size() != lights.size())
+		shadowVisibleSets.resize(lights.size());
+	for (size_t i = 0; i < lights.size(); ++i)
+		shadowVisibleSets[i].Cull(drawLists, &lights[i]->GetFrustum(), nullptr, 1);
+}
+
+void D3DFramework::UpdateInstanceBufferPool()
+{
+	// 이전 프레임의 기록은 이미 끝났으므로 그 프레임의 예약량을 반영하고 다시 센다.
+	instanceDemand = (std::max)(instanceDemand, instanceCursor.exchange(0));
+
+	// 최소한 모든 레코드를 한 번씩 인스턴싱으로 그릴 수 있어야 한다.
+	UINT32 recordCount = 0;
+	for (const auto& drawList : drawLists)
+		recordCount += drawList.GetCount();
+	instanceDemand = (std::max)(instanceDemand, recordCount);
+
+	auto currInstancePool = currentFrameResource->instancePool.get();
+	const UINT32 identityCount = currentFrameResource->objectPool->GetBufferCount();
+	const UINT32 bufferCount = currInstancePool->GetBufferCount();
+
+	if (currentFrameResource->instanceIdentityCount != identityCount || bufferCount < identityCount + instanceDemand)
+	{
+		// 그림자 패스처럼 같은 DrawList를 여러 번 그리는 경우를 위해 여유를 둔다.
+		currInstancePool->Resize(identityCount + instanceDemand * 2);
+
+		auto instanceBuffer = currInstancePool->GetBuffer();
+		for (UINT32 i = 0; i < identityCount; ++i)
+			instanceBuffer->CopyData(i, i);
+		currentFrameResource->instanceIdentityCount = identityCount;
+	}
+}
+
+void D3DFramework::UpdateIndirectBufferPool()
+{
+	indirectDemand = (std::max)(indirectDemand, indirectCursor.exchange(0));
+
+	// 레코드마다 많아야 하나의 명령이 만들어진다.
+	UINT32 recordCount = 0;
+	for (const auto& drawList : drawLists)
+		recordCount += drawList.GetCount();
+	indirectDemand = (std::max)(indirectDemand, recordCount);
+
+	auto currIndirectPool = currentFrameResource->indirectPool.get();
+	if (currIndirectPool->GetBufferCount() < indirectDemand)
+		currIndirectPool->Resize(indirectDemand * 2);
+}
+
 void D3DFramework::UpdateLightBuffer(float deltaTime)
 {
-	// NDC  [-1, 1]^2 ؽó  [0, 1]^2 ȯϴ 
+	// NDC 공간 [-1, 1]^2을 텍스처 공간 [0, 1]^2으로 변환하는 행렬
 	static XMMATRIX toTextureTransform(
 		0.5f, 0.0f, 0.0f, 0.0f,
 		0.0f, -0.5f, 0.0f, 0.0f,
@@ -479,9 +956,11 @@ void D3DFramework::UpdateLightBuffer(float deltaTime)
 
 	auto currLightBuffer = currentFrameResource->lightBufferPool->GetBuffer();
 	auto passCB = currentFrameResource->passPool->GetBuffer();
-	UINT32 i = 0;
-	for (const auto& light : lights)
+
+	// 조명마다 조명 버퍼와 그림자 패스 상수 버퍼의 슬롯이 다르므로 병렬로 갱신한다.
+	ParallelFor((UINT32)lights.size(), updateGrainSize, [this, currLightBuffer, passCB, deltaTime](const UINT32 i)
 	{
+		Light* light = lights[i].get();
 		light->Tick(deltaTime);
 		if (light->IsUpdate())
 		{
@@ -502,7 +981,7 @@ void D3DFramework::UpdateLightBuffer(float deltaTime)
 			XMStoreFloat4x4(&shadowPassCB[i]->invProj, XMMatrixTranspose(invProj));
 			XMStoreFloat4x4(&shadowPassCB[i]->viewProj, XMMatrixTranspose(viewProj));
 			XMStoreFloat4x4(&shadowPassCB[i]->invViewProj, XMMatrixTranspose(invViewProj));
-			shadowPassCB[i]->eyePosW = light->GetPosition();
+			shadowPassCB[i]->eyePosW = light->GetWorldPosition();
 			shadowPassCB[i]->renderTargetSize = XMFLOAT2((float)SHADOW_MAP_SIZE, (float)SHADOW_MAP_SIZE);
 			shadowPassCB[i]->invRenderTargetSize = XMFLOAT2(1.0f / SHADOW_MAP_SIZE, 1.0f / SHADOW_MAP_SIZE);
 			shadowPassCB[i]->nearZ = light->falloffStart;
@@ -513,8 +992,9 @@ void D3DFramework::UpdateLightBuffer(float deltaTime)
 
 			light->DecreaseNumFrames();
 		}
-		++i;
-	}
+	});
+
+	DeferredCommands::GetInstance()->Execute();
 }
 
 void D3DFramework::UpdateMaterialBuffer(float deltaTime)
@@ -588,15 +1068,16 @@ void D3DFramework::UpdateMainPassBuffer(float deltaTime)
 
 void D3DFramework::UpdateWidgetBuffer(float deltaTime)
 {
-	// [0, 1]    ġ  ǥ [-1, 1] ȯѴ.
+	// [0, 1]범위로 설정된 위젯의 정점 위치를 동차 좌표계의 [-1, 1]범위로 변환한다.
 	static std::function<float(float)> transformHomogenous = [](float x) { return x * 2.0f - 1.0f; };
 
 	auto currWidgetCB = currentFrameResource->widgetPool->GetBuffer();
 	auto& currWidgetVBs = currentFrameResource->widgetVBs;
-	UINT32 widgetIndex = 0;
 
-	for (const auto& widget : widgets)
+	// 위젯마다 상수 버퍼와 동적 정점 버퍼가 따로 있으므로 병렬로 갱신한다.
+	ParallelFor((UINT32)widgets.size(), updateGrainSize, [this, currWidgetCB, &currWidgetVBs, deltaTime](const UINT32 widgetIndex)
 	{
+		Widget* widget = widgets[widgetIndex].get();
 		widget->Tick(deltaTime);
 		if (widgetIndex != widget->cbIndex)
 		{
@@ -640,17 +1121,33 @@ void D3DFramework::UpdateWidgetBuffer(float deltaTime)
 
 			widget->DecreaseNumFrames();
 		}
-		++widgetIndex;
+	});
+
+	DeferredCommands::GetInstance()->Execute();
+}
+
+void D3DFramework::UpdateClothBuffer(float deltaTime)
+{
+	auto& currClothVBs = currentFrameResource->clothVBs;
+	UINT32 clothIndex = 0;
+
+	// 시뮬레이션된 천의 정점을 현재 프레임 자원의 동적 정점 버퍼에 쓴다.
+	for (const auto handle : cloths)
+	{
+		Cloth* cloth = gameObjects.Get<Cloth>(handle);
+		if (cloth)
+			cloth->UpdateVertices(currClothVBs[clothIndex].get());
+		++clothIndex;
 	}
 }
 
 void D3DFramework::UpdateParticleBuffer(float deltaTime)
 {
 	auto currParticleCB = currentFrameResource->particlePool->GetBuffer();
-	UINT32 particleIndex = 0;
 
-	for (const auto& particle : particles)
+	ParallelFor((UINT32)particles.size(), updateGrainSize, [this, currParticleCB, deltaTime](const UINT32 particleIndex)
 	{
+		Particle* particle = particles[particleIndex].get();
 		particle->Tick(deltaTime);
 
 		if (particleIndex != particle->cbIndex)
@@ -667,9 +1164,9 @@ void D3DFramework::UpdateParticleBuffer(float deltaTime)
 
 			particle->DecreaseNumFrames();
 		}
+	});
 
-		++particleIndex;
-	}
+	DeferredCommands::GetInstance()->Execute();
 }
 
 void D3DFramework::UpdateSsaoBuffer(float deltaTime)
@@ -752,190 +1249,200 @@ void D3DFramework::UpdateSsrBuffer(float deltaTime)
 
 void D3DFramework::UpdateObjectBufferPool()
 {
-	const UINT32 allObjectCount = (UINT32)gameObjects.size() + (UINT32)widgets.size();
+	const UINT32 allObjectCount = (UINT32)gameObjects.GetCount() + (UINT32)widgets.size();
 
 	if (currentFrameResource)
 	{
 		auto currObjectPool = currentFrameResource->objectPool.get();
-		if (currObjectPool->GetBufferCount() < allObjectCount)
-			currObjectPool->Resize(allObjectCount * 2);
+		const UINT32 bufferCount = currObjectPool->GetBufferCount();
+
+		// 객체가 많이 줄었을 때만 버퍼를 줄여 크기가 경계에서 반복해서 바뀌지 않게 한다.
+		if (bufferCount < allObjectCount || bufferCount > allObjectCount * 4)
+		{
+			currObjectPool->Resize((std::max)(allObjectCount * 2, 1u));
+
+			// 새로운 버퍼는 비어있으므로 모든 객체의 상수를 다시 쓴다.
+			for (GameObject* obj : gameObjects)
+				obj->UpdateNumFrames();
+		}
 	}
 }
 
 void D3DFramework::CreateObjects()
 {
-	std::shared_ptr<GameObject> object;
-	std::shared_ptr<Billboard> tree;
+	GameObject* object;
 
-	object = std::make_shared<SkySphere>("Sky"s);
+	object = gameObjects.Create<SkySphere>("Sky"s);
 	object->SetScale(5000.0f, 5000.0f, 5000.0f);
 	object->SetRotation(0.0f, 90.0f, 0.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Sky"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("SkySphere"s));
 	object->SetCollisionEnabled(false);
-	renderableObjects[(int)RenderLayer::Sky].push_back(object);
-	gameObjects.push_back(object);
+	renderableObjects[(int)RenderLayer::Sky].push_back(object->GetHandle());
 
-	object = std::make_shared<GameObject>("Floor"s);
+	object = gameObjects.Create<GameObject>("Floor"s);
 	object->SetPosition(50.0f, -40.0f, 60.0f);
 	object->SetScale(200.0f, 2.5f, 200.0f);
 	object->SetRotation(0.0f, 60.0f, 0.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Ice"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Cube_AABB"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
 
-	object = std::make_shared<GameObject>("Sword"s);
+	object = gameObjects.Create<GameObject>("Sword"s);
 	object->SetPosition(10.0f, -35.0f, 30.0f);
 	object->SetScale(0.1f, 0.1f, 0.1f);
 	object->SetRotation(30.0f, 5.0f, 0.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Sword"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Sword"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
-
-	tree = std::make_shared<Billboard>("Tree1"s);
-	tree->SetPosition(0.0f, 0.0f, 200.0f);
-	tree->mSize = XMFLOAT2(40.0f, 40.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree1"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
-
-	tree = std::make_shared<Billboard>("Tree1"s);
-	tree->SetPosition(90.0f, -10.0f, 170.0f);
-	tree->mSize = XMFLOAT2(40.0f, 40.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree1"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
 
-	tree = std::make_shared<Billboard>("Tree1"s);
-	tree->SetPosition(-180.0f, 30.0f, 230.0f);
-	tree->mSize = XMFLOAT2(60.0f, 60.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree1"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
-
-	tree = std::make_shared<Billboard>("Tree2"s);
-	tree->SetPosition(-50.0f, 5.0f, 200.0f);
-	tree->mSize = XMFLOAT2(40.0f, 40.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree2"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
-
-	tree = std::make_shared<Billboard>("Tree2"s);
-	tree->SetPosition(30.0f, -10.0f, 150.0f);
-	tree->mSize = XMFLOAT2(60.0f, 60.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree2"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
-
-	tree = std::make_shared<Billboard>("Tree2"s);
-	tree->SetPosition(-60.0f, -10.0f, 100.0f);
-	tree->mSize = XMFLOAT2(30.0f, 30.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree2"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
-
-	tree = std::make_shared<Billboard>("Tree3"s);
-	tree->SetPosition(80.0f, 10.0f, 210.0f);
-	tree->mSize = XMFLOAT2(30.0f, 30.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree3"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
-
-	tree = std::make_shared<Billboard>("Tree3"s);
-	tree->SetPosition(-100.0f, 20.0f, 100.0f);
-	tree->mSize = XMFLOAT2(50.0f, 50.0f);
-	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree3"s));
-	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
-	renderableObjects[(int)RenderLayer::Billborad].push_back(tree);
-	gameObjects.push_back(tree);
-
-	object = std::make_shared<GameObject>("Rock1"s);
+	object = gameObjects.Create<GameObject>("Rock1"s);
 	object->SetPosition(30.0f, -39.0f, 30.0f);
 	object->SetScale(3.0f, 3.0f, 3.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Rock1"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Rock1"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
 
-	object = std::make_shared<GameObject>("Rock1"s);
+	object = gameObjects.Create<GameObject>("Rock1"s);
 	object->SetPosition(26.0f, -39.5f, 42.0f);
 	object->SetScale(2.5f, 2.5f, 2.5f);
 	object->SetRotation(2.0f, 10.0f, 0.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Rock1"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Rock1"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
 
-	object = std::make_shared<GameObject>("Rock1"s);
+	object = gameObjects.Create<GameObject>("Rock1"s);
 	object->SetPosition(27.5f, -40.0f, 56.0f);
 	object->SetScale(2.8f, 2.8f, 2.8f);
 	object->SetRotation(8.0f, 30.0f, 6.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Rock1"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Rock1"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
 
-	object = std::make_shared<GameObject>("Rock1"s);
+	object = gameObjects.Create<GameObject>("Rock1"s);
 	object->SetPosition(32.0f, -40.0f, 75.0f);
 	object->SetScale(3.8f, 3.8f, 3.8f);
 	object->SetRotation(43.0f, 60.0f, 15.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Rock1"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Rock1"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
 
-	object = std::make_shared<GameObject>("Rock1"s);
+	object = gameObjects.Create<GameObject>("Rock1"s);
 	object->SetPosition(20.0f, -39.0f, 86.0f);
 	object->SetScale(2.6f, 2.6f, 2.6f);
 	object->SetRotation(0.0f, 78.0f, 0.0f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Rock1"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Rock1"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
 
-	object = std::make_shared<GameObject>("Rock1"s);
+	object = gameObjects.Create<GameObject>("Rock1"s);
 	object->SetPosition(9.0f, -40.0f, 100.0f);
 	object->SetScale(2.9f, 2.9f, 2.9f);
 	object->SetRotation(2.0f, 60.0f, 0.2f);
 	object->SetMaterial(AssetManager::GetInstance()->FindMaterial("Rock1"s));
 	object->SetMesh(AssetManager::GetInstance()->FindMesh("Rock1"s));
 	object->SetCollisionEnabled(true);
-	renderableObjects[(int)RenderLayer::Opaque].push_back(object);
-	gameObjects.push_back(object);
+	object->isStatic = true;
+	renderableObjects[(int)RenderLayer::Opaque].push_back(object->GetHandle());
+}
+
+void D3DFramework::CreateStaticBatches(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList)
+{
+	// 불투명 레이어의 정적 객체들만 합친다. 합쳐진 객체들은 충돌에만 사용된다.
+	staticBatcher = std::make_unique<StaticBatcher>();
+	staticBatcher->Build(device, cmdList, gameObjects, renderableObjects[(int)RenderLayer::Opaque]);
+}
+
+void D3DFramework::CreateBillboards()
+{
+	Billboard* tree;
+
+	tree = gameObjects.Create<Billboard>("Tree1"s);
+	tree->SetPosition(0.0f, 0.0f, 200.0f);
+	tree->mSize = XMFLOAT2(40.0f, 40.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree1"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
+
+	tree = gameObjects.Create<Billboard>("Tree1"s);
+	tree->SetPosition(90.0f, -10.0f, 170.0f);
+	tree->mSize = XMFLOAT2(40.0f, 40.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree1"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
+
+	tree = gameObjects.Create<Billboard>("Tree1"s);
+	tree->SetPosition(-180.0f, 30.0f, 230.0f);
+	tree->mSize = XMFLOAT2(60.0f, 60.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree1"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
+
+	tree = gameObjects.Create<Billboard>("Tree2"s);
+	tree->SetPosition(-50.0f, 5.0f, 200.0f);
+	tree->mSize = XMFLOAT2(40.0f, 40.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree2"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
+
+	tree = gameObjects.Create<Billboard>("Tree2"s);
+	tree->SetPosition(30.0f, -10.0f, 150.0f);
+	tree->mSize = XMFLOAT2(60.0f, 60.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree2"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
+
+	tree = gameObjects.Create<Billboard>("Tree2"s);
+	tree->SetPosition(-60.0f, -10.0f, 100.0f);
+	tree->mSize = XMFLOAT2(30.0f, 30.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree2"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
+
+	tree = gameObjects.Create<Billboard>("Tree3"s);
+	tree->SetPosition(80.0f, 10.0f, 210.0f);
+	tree->mSize = XMFLOAT2(30.0f, 30.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree3"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
+
+	tree = gameObjects.Create<Billboard>("Tree3"s);
+	tree->SetPosition(-100.0f, 20.0f, 100.0f);
+	tree->mSize = XMFLOAT2(50.0f, 50.0f);
+	tree->SetMaterial(AssetManager::GetInstance()->FindMaterial("Tree3"s));
+	tree->BuildBillboardMesh(d3dDevice.Get(), mainCommandList.Get());
+	renderableObjects[(int)RenderLayer::Billborad].push_back(tree->GetHandle());
 }
 
 void D3DFramework::CreateTerrain()
 {
-	terrain = std::make_shared<Terrain>("Terrian"s);
+	terrain = ObjectPool<Terrain>::GetInstance()->MakeShared("Terrian"s);
 	terrain->SetPosition(0.0f, -50.0f, 0.0f);
 	terrain->SetScale(10.0f, 10.0f, 10.0f);
 	terrain->BuildMesh(d3dDevice.Get(), mainCommandList.Get(), 100.0f, 100.0f, 8, 8);
 	terrain->SetMaterial(AssetManager::GetInstance()->FindMaterial("Terrain"s));
 	terrain->CalculateWorld();
-	renderableObjects[(int)RenderLayer::Terrain].push_back(terrain);
 }
 
 void D3DFramework::CreateLights()
 {
 	std::shared_ptr<Light> light;
 
-	light = std::make_shared<DirectionalLight>("DirectionalLight"s, d3dDevice.Get());
+	light = ObjectPool<DirectionalLight>::GetInstance()->MakeShared("DirectionalLight"s, d3dDevice.Get());
 	light->SetPosition(50.0f, 10.0f, 30.0f);
 	light->Rotate(45.0f, -90.0f, 0.0f);
 	light->strength = { 0.8f, 0.8f, 0.8f };
@@ -957,49 +1464,49 @@ void D3DFramework::CreateWidgets(ID3D12Device* device, ID3D12GraphicsCommandList
 {
 	std::shared_ptr<Widget> widget;
 
-	widget = std::make_shared<Widget>("DiffuseMapDebug"s, device, cmdList);
+	widget = ObjectPool<Widget>::GetInstance()->MakeShared("DiffuseMapDebug"s, device, cmdList);
 	widget->SetPosition(0, -120);
 	widget->SetSize(160, 120);
 	widget->SetAnchor(0.0f, 1.0f);
 	widget->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
 	widgets.push_back(std::move(widget));
 
-	widget = std::make_shared<Widget>("SpecularMapDebug"s, device, cmdList);
+	widget = ObjectPool<Widget>::GetInstance()->MakeShared("SpecularMapDebug"s, device, cmdList);
 	widget->SetPosition(160, -120);
 	widget->SetSize(160, 120);
 	widget->SetAnchor(0.0f, 1.0f);
 	widget->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
 	widgets.push_back(std::move(widget));
 
-	widget = std::make_shared<Widget>("RoughnessMapDebug"s, device, cmdList);
+	widget = ObjectPool<Widget>::GetInstance()->MakeShared("RoughnessMapDebug"s, device, cmdList);
 	widget->SetPosition(320, -120);
 	widget->SetSize(160, 120);
 	widget->SetAnchor(0.0f, 1.0f);
 	widget->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
 	widgets.push_back(std::move(widget));
 
-	widget = std::make_shared<Widget>("NormalMapDebug"s, device, cmdList);
+	widget = ObjectPool<Widget>::GetInstance()->MakeShared("NormalMapDebug"s, device, cmdList);
 	widget->SetPosition(480, -120);
 	widget->SetSize(160, 120);
 	widget->SetAnchor(0.0f, 1.0f);
 	widget->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
 	widgets.push_back(std::move(widget));
 
-	widget = std::make_shared<Widget>("DetphMapDebug"s, device, cmdList);
+	widget = ObjectPool<Widget>::GetInstance()->MakeShared("DetphMapDebug"s, device, cmdList);
 	widget->SetPosition(640, -120);
 	widget->SetSize(160, 120);
 	widget->SetAnchor(0.0f, 1.0f);
 	widget->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
 	widgets.push_back(std::move(widget));
 	
-	widget = std::make_shared<Widget>("SsaoMapDebug"s, device, cmdList);
+	widget = ObjectPool<Widget>::GetInstance()->MakeShared("SsaoMapDebug"s, device, cmdList);
 	widget->SetPosition(800, -120);
 	widget->SetSize(160, 120);
 	widget->SetAnchor(0.0f, 1.0f);
 	widget->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
 	widgets.push_back(std::move(widget));
 
-	widget = std::make_shared<Widget>("SsrMapDebug"s, device, cmdList);
+	widget = ObjectPool<Widget>::GetInstance()->MakeShared("SsrMapDebug"s, device, cmdList);
 	widget->SetPosition(960, -120);
 	widget->SetSize(160, 120);
 	widget->SetAnchor(0.0f, 1.0f);
@@ -1022,7 +1529,7 @@ void D3DFramework::CreateParticles()
 	end.size = XMFLOAT2(0.25f, 0.25f);
 	end.speed = 10.0f;
 
-	particle = std::make_unique<Particle>("Snow"s, 50000);
+	particle = ObjectPool<Particle>::GetInstance()->MakeShared("Snow"s, 50000);
 	particle->start = start;
 	particle->end = end;
 	particle->spawnTimeRange = std::make_pair<float, float>(0.2f, 0.2f);
@@ -1034,6 +1541,31 @@ void D3DFramework::CreateParticles()
 	particles.push_back(std::move(particle));
 }
 
+void D3DFramework::CreateCloths(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList)
+{
+	Cloth* cloth;
+
+	cloth = gameObjects.Create<Cloth>("Banner"s, 32, 32, 0.25f);
+	cloth->SetPosition(14.0f, -28.0f, 36.0f);
+	cloth->SetRotation(0.0f, 60.0f, 0.0f);
+	cloth->PinTopEdge();
+	cloth->wind = XMFLOAT3(0.0f, 0.0f, 4.0f);
+	cloth->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
+	cloth->BuildClothMesh(device, cmdList);
+	renderableObjects[(int)RenderLayer::AlphaTested].push_back(cloth->GetHandle());
+	cloths.push_back(cloth->GetHandle());
+
+	cloth = gameObjects.Create<Cloth>("Flag"s, 32, 24, 0.2f);
+	cloth->SetPosition(22.0f, -30.0f, 28.0f);
+	cloth->SetPinned(0, 0);
+	cloth->SetPinned(0, 23);
+	cloth->wind = XMFLOAT3(3.0f, 0.0f, 1.0f);
+	cloth->SetMaterial(AssetManager::GetInstance()->FindMaterial("Default"s));
+	cloth->BuildClothMesh(device, cmdList);
+	renderableObjects[(int)RenderLayer::AlphaTested].push_back(cloth->GetHandle());
+	cloths.push_back(cloth->GetHandle());
+}
+
 void D3DFramework::CreateFrameResources(ID3D12Device* device)
 {
 	for (int i = 0; i < NUM_FRAME_RESOURCES; ++i)
@@ -1044,40 +1576,48 @@ void D3DFramework::CreateFrameResources(ID3D12Device* device)
 #else
 		isMultithreadRendering = false;
 #endif
-		//  ڿ Ѵ.
+		// 프레임 자원을 생성한다.
 		frameResources[i] = std::make_unique<FrameResource>(device, isMultithreadRendering,
-			1 + LIGHT_NUM, (UINT)gameObjects.size() * 2, LIGHT_NUM,
+			1 + LIGHT_NUM, (UINT)gameObjects.GetCount() * 2, LIGHT_NUM,
 			(UINT)AssetManager::GetInstance()->materials.size(), (UINT)widgets.size(), (UINT)particles.size());
 
-		//   ۴  Ѵ.
+		// 동적 정점 버퍼는 따로 생성한다.
 		frameResources[i]->widgetVBs.reserve((UINT)widgets.size());
 		for (const auto& widget : widgets)
 		{
 			std::unique_ptr<UploadBuffer<WidgetVertex>> vb = std::make_unique<UploadBuffer<WidgetVertex>>(device, 4, false);
 			frameResources[i]->widgetVBs.push_back(std::move(vb));
 		}
+
+		frameResources[i]->clothVBs.reserve((UINT)cloths.size());
+		for (const auto handle : cloths)
+		{
+			Cloth* cloth = gameObjects.Get<Cloth>(handle);
+			std::unique_ptr<UploadBuffer<Vertex>> vb = std::make_unique<UploadBuffer<Vertex>>(device, cloth->GetVertexCount(), false);
+			frameResources[i]->clothVBs.push_back(std::move(vb));
+		}
 	}
 }
 
 void D3DFramework::CreateTerrainStdDevAndNormalMap()
 {
-	// Terrain  ǥ  LODMap   ̸ Ѵ.
-	// ̵    ʿ .
+	// Terrain에서 사용할 표준 편차 LODMap과 노멀 맵을 미리 계산한다.
+	// 이들은 두 번 계산할 필요는 없다.
 
 	ID3D12DescriptorHeap* descriptorHeaps[] = { cbvSrvUavDescriptorHeap.Get() };
 	mainCommandList->SetDescriptorHeaps(_countof(descriptorHeaps), descriptorHeaps);
 
-	// Ʈʿ  ǥ Ѵ.
+	// 하이트맵에 대한 표준편차를 계산한다.
 	mainCommandList->SetComputeRootSignature(rootSignatures["TerrainCompute"].Get());
 	mainCommandList->SetComputeRootDescriptorTable((int)RpTerrainCompute::HeightMap,
 		GetGpuSrv(DescriptorIndex::textureHeapIndex + terrain->GetMaterial()->heightMapIndex));
 	terrain->SetUavDescriptors(mainCommandList.Get());
 
-	// ǥ Ͽ LOD Ѵ.
+	// 표준편차를 계산하여 LOD를 지정한다.
 	mainCommandList->SetPipelineState(pipelineStateObjects["TerrainStdDev"].Get());
 	terrain->LODCompute(mainCommandList.Get());
 
-	//  Ͽ   .
+	// 노멀을 계산하여 노멀 맵을 만든다.
 	mainCommandList->SetPipelineState(pipelineStateObjects["TerrainNormal"].Get());
 	terrain->NormalCompute(mainCommandList.Get());
 }
@@ -1089,44 +1629,118 @@ void D3DFramework::RenderObject(ID3D12GraphicsCommandList* cmdList, Renderable*
 	obj->Render(cmdList, frustum);
 }
 
-void D3DFramework::RenderObjects(ID3D12GraphicsCommandList* cmdList, const std::list<std::shared_ptr<Renderable>>& list,
-	D3D12_GPU_VIRTUAL_ADDRESS startAddress, BoundingFrustum* frustum, const UINT32 threadIndex, const UINT32 threadNum) const
+// 같은 인스턴싱 그리기로 묶을 수 있는 레코드인지 확인한다.
+// 레이어마다 파이프라인 상태가 하나이므로 메쉬와 재질만 비교한다.
+static bool IsSameInstanceGroup(const DrawRecord& lhs, const DrawRecord& rhs)
 {
-	UINT32 currentNum = threadIndex;
-	UINT32 maxNum = (UINT32)list.size();
-	if (list.empty() || currentNum >= maxNum)
-		return;
+	return lhs.mesh == rhs.mesh && lhs.material == rhs.material && lhs.isIndexed == rhs.isIndexed;
+}
 
-	auto iter = list.begin();
-	std::advance(iter, currentNum);
-	while(true)
+void D3DFramework::RenderObjects(ID3D12GraphicsCommandList* cmdList, const RenderLayer layer,
+	const VisibleSet& visibleSet, const UINT32 threadIndex, const UINT32 threadNum) const
+{
+	const DrawList& list = drawLists[(int)layer];
+	const auto [begin, end] = visibleSet.GetRange(layer, threadIndex, threadNum);
+	const auto& records = list.GetRecords();
+	const UINT32* visibleIndices = visibleSet.GetIndices(layer).data();
+
+	auto instanceBuffer = currentFrameResource->instancePool->GetBuffer();
+	const UINT32 identityCount = currentFrameResource->instanceIdentityCount;
+	const UINT32 instanceCapacity = currentFrameResource->instancePool->GetBufferCount() - identityCount;
+
+#ifdef INDIRECT_DRAW
+	if (begin < end && list.IsAllIndexed())
 	{
-		RenderObject(cmdList, (*iter).get(), startAddress, frustum);
+		// 구간의 모든 레코드가 각각 명령과 인스턴스 인덱스가 되어도 담을 수 있도록 예약한다.
+		const UINT32 recordCount = end - begin;
+		const UINT32 commandOffset = indirectCursor.fetch_add(recordCount);
+		const UINT32 instanceOffset = instanceCursor.fetch_add(recordCount);
+
+		auto indirectBuffer = currentFrameResource->indirectPool->GetBuffer();
+		const UINT32 commandCapacity = currentFrameResource->indirectPool->GetBufferCount();
+
+		if (commandOffset + recordCount <= commandCapacity && instanceOffset + recordCount <= instanceCapacity)
+		{
+			IndirectDrawCommand* commands = indirectBuffer->GetMappedData() + commandOffset;
+			UINT32* instanceIndices = instanceBuffer->GetMappedData() + identityCount + instanceOffset;
+			ID3D12CommandSignature* commandSignature = commandSignatures.at("DrawIndexed").Get();
+
+			UINT32 commandCount = 0;
+			UINT32 instanceCount = 0;
+			UINT32 recordBegin = begin;
+			while (recordBegin < end)
+			{
+				// 위상 구조가 같은 연속된 명령들을 한 번의 ExecuteIndirect로 제출한다.
+				const IndirectDrawBatch batch = BuildIndirectDrawCommands(records.data(), visibleIndices, recordBegin, end,
+					commands + commandCount, instanceIndices + instanceCount, identityCount + instanceOffset + instanceCount);
+
+				if (batch.commandCount > 0)
+				{
+					cmdList->IASetPrimitiveTopology(batch.primitiveType);
+					cmdList->ExecuteIndirect(commandSignature, batch.commandCount, indirectBuffer->GetResource(),
+						(UINT64)(commandOffset + commandCount) * sizeof(IndirectDrawCommand), nullptr, 0);
+				}
+
+				commandCount += batch.commandCount;
+				instanceCount += batch.instanceCount;
+				recordBegin = batch.recordEnd;
+			}
 
-		currentNum += threadNum;
-		if (currentNum >= maxNum)
 			return;
-		std::advance(iter, threadNum);
+		}
+	}
+#endif
+
+	UINT32 groupBegin = begin;
+	while (groupBegin < end)
+	{
+		// 정렬 키가 같은 재질과 메쉬를 모아두므로 묶음은 대부분 길게 이어진다.
+		const DrawRecord& first = records[visibleIndices[groupBegin]];
+		UINT32 groupEnd = groupBegin + 1;
+		while (groupEnd < end && IsSameInstanceGroup(first, records[visibleIndices[groupEnd]]))
+			++groupEnd;
+
+		// 묶음 전체를 담을 자리를 예약하여 객체의 인덱스를 채운다.
+		const UINT32 groupSize = groupEnd - groupBegin;
+		const UINT32 instanceOffset = groupSize > 1 ? instanceCursor.fetch_add(groupSize) : instanceCapacity;
+
+		if (instanceOffset + groupSize <= instanceCapacity)
+		{
+			for (UINT32 i = groupBegin; i < groupEnd; ++i)
+				instanceBuffer->CopyData(identityCount + instanceOffset + i - groupBegin, records[visibleIndices[i]].cbIndex);
+
+			cmdList->SetGraphicsRoot32BitConstant((UINT)RpCommon::InstanceBase, identityCount + instanceOffset, 0);
+			first.mesh->Render(cmdList, groupSize, first.isIndexed);
+		}
+		else
+		{
+			// 하나뿐이거나 예약할 수 없었다면 객체마다 미리 써둔 자신의 인덱스를 가리켜 하나씩 그린다.
+			for (UINT32 i = groupBegin; i < groupEnd; ++i)
+			{
+				const DrawRecord& record = records[visibleIndices[i]];
+				cmdList->SetGraphicsRoot32BitConstant((UINT)RpCommon::InstanceBase, record.cbIndex, 0);
+				record.mesh->Render(cmdList, 1, record.isIndexed);
+			}
+		}
+
+		groupBegin = groupEnd;
 	}
 }
 
-void D3DFramework::RenderActualObjects(ID3D12GraphicsCommandList* cmdList, BoundingFrustum* frustum)
+void D3DFramework::RenderActualObjects(ID3D12GraphicsCommandList* cmdList, const VisibleSet& visibleSet)
 {
-	auto currObjectCB = currentFrameResource->objectPool->GetBuffer();
-	D3D12_GPU_VIRTUAL_ADDRESS startAddress = currObjectCB->GetResource()->GetGPUVirtualAddress();
-
-	RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Opaque], startAddress, frustum);
-	RenderObjects(cmdList, renderableObjects[(int)RenderLayer::AlphaTested], startAddress, frustum);
-	RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Billborad], startAddress, frustum);
-	RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Transparent], startAddress, frustum);
+	RenderObjects(cmdList, RenderLayer::Opaque, visibleSet);
+	RenderObjects(cmdList, RenderLayer::AlphaTested, visibleSet);
+	RenderObjects(cmdList, RenderLayer::Billborad, visibleSet);
+	RenderObjects(cmdList, RenderLayer::Transparent, visibleSet);
 }
 
-bool D3DFramework::Picking(HitInfo& hitInfo, const INT32 screenX, const INT32 screenY,
-	const float distance, const bool isMeshCollision) const
+std::shared_future<SceneQueryResult> D3DFramework::Picking(const INT32 screenX, const INT32 screenY,
+	const float distance, const bool isMeshCollision)
 {
 	XMFLOAT4X4 proj = camera->GetProj4x4f();
 
-	// Picking Ray   Ѵ.
+	// Picking Ray를 뷰 공간으로 계산한다.
 	float vx = (2.0f * screenX / screenWidth - 1.0f) / proj(0, 0);
 	float vy = (-2.0f * screenY / screenHeight + 1.0f) / proj(1, 1);
 
@@ -1136,80 +1750,73 @@ bool D3DFramework::Picking(HitInfo& hitInfo, const INT32 screenX, const INT32 sc
 	XMMATRIX view = camera->GetView();
 	XMMATRIX invView = XMMatrixInverse(&XMMatrixDeterminant(view), view);
 
-	// Picking Ray   ȯѴ.
+	// Picking Ray를 월드 공간으로 변환한다.
 	rayOrigin = XMVector3TransformCoord(rayOrigin, invView);
 	rayDir = XMVector3TransformNormal(rayDir, invView);
 	rayDir = XMVector3Normalize(rayDir);
 
-	bool nearestHit = false;
-	float nearestDist = FLT_MAX;
-	GameObject* hitObj = nullptr;
-
 #if defined(DEBUG) || defined(_DEBUG)
 	D3DDebug::GetInstance()->DrawRay(rayOrigin, rayOrigin + (rayDir * distance));
 #endif
 
-	// Picking Ray 浹 ˻Ѵ.
-	for (const auto& obj : gameObjects)
-	{
-		float hitDist = FLT_MAX;
-		bool isHit = Physics::IsCollision(obj.get(), rayOrigin, rayDir, hitDist, isMeshCollision);
+	// Picking Ray로 충돌을 검사하는 질의를 요청한다.
+	pickingResult = sceneQuery->Raycast(Vector3::XMVectorToFloat3(rayOrigin), 
+		Vector3::XMVectorToFloat3(rayDir), distance, isMeshCollision).share();
 
-		if (isHit)
-		{
-			// 浹 Game Object    ü õ ü̴.
-			if (nearestDist > hitDist)
-			{
-				nearestDist = hitDist;
-				hitObj = obj.get();
-				nearestHit = true;
-			}
-		}
-	}
+	return pickingResult;
+}
 
-	if (!nearestHit)
-		return false;
+void D3DFramework::CheckPickingResult()
+{
+	if (!pickingResult.valid())
+		return;
 
-	if (nearestHit)
-	{
-		std::cout << "Picking : " << hitObj->ToString() << std::endl;
-	}
+	if (pickingResult.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+		return;
 
-	if (nearestDist < distance)
+	const SceneQueryResult& result = pickingResult.get();
+	if (result.isHit)
 	{
-		hitInfo.dist = nearestDist;
-		hitInfo.obj = (void*)hitObj;
-		XMStoreFloat3(&hitInfo.rayOrigin, rayOrigin);
-		XMStoreFloat3(&hitInfo.rayDirection, rayDir);
-
-		return true;
+		// 질의 이후에 객체가 사라졌을 수 있으므로 uid로 다시 찾는다.
+		GameObject* hitObj = gameObjects.Get(result.handle);
+		if (hitObj)
+			std::cout << "Picking : " << hitObj->ToString() << std::endl;
 	}
 
-	return false;
+	pickingResult = std::shared_future<SceneQueryResult>();
 }
 
-GameObject* D3DFramework::FindGameObject(const std::string name)
+bool D3DFramework::LoadScene(const std::wstring& fileName)
 {
-	auto iter = std::find_if(gameObjects.begin(), gameObjects.end(),
-		[&name](const std::shared_ptr<GameObject> obj) -> bool
-	{ if (name.compare(obj->GetName()) == 0) return true; return false; });
+	SceneFile sceneFile;
+	if (!sceneFile.Open(fileName))
+		return false;
 
-	if (iter != gameObjects.end())
-		return iter->get();
+	StopWatch stopWatch;
+	stopWatch.Start();
+	const UINT32 objectCount = sceneFile.Instantiate(gameObjects, renderableObjects);
+	stopWatch.End();
+
+#if defined(DEBUG) || defined(_DEBUG)
+	std::cout << "LoadScene : " << objectCount << " objects, " << stopWatch.Nanosecond() / 1000000.0 << "ms" << std::endl;
+#endif
 
-	return nullptr;
+	return objectCount > 0;
 }
 
-GameObject* D3DFramework::FindGameObject(const UINT64 uid)
+bool D3DFramework::SaveScene(const std::wstring& fileName) const
 {
-	auto iter = std::find_if(gameObjects.begin(), gameObjects.end(),
-		[&uid](const std::shared_ptr<GameObject> obj) -> bool
-	{ if (uid == obj->GetUID()) return true; return false; });
+	return SceneFile::Save(fileName, gameObjects, renderableObjects);
+}
 
-	if (iter != gameObjects.end())
-		return iter->get();
+GameObject* D3DFramework::FindGameObject(std::string_view name)
+{
+	return gameObjects.Get(gameObjects.FindByName(name));
+}
 
-	return nullptr;
+GameObject* D3DFramework::FindGameObject(const UINT64 uid)
+{
+	return gameObjects.Get(gameObjects.FindByUID(uid));
 }
 
 void D3DFramework::WireframePass(ID3D12GraphicsCommandList* cmdList)
@@ -1217,7 +1824,7 @@ void D3DFramework::WireframePass(ID3D12GraphicsCommandList* cmdList)
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(GetCurrentBackBuffer(),
 		D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET));
 
-	//  Ÿ   ۸    ܰ迡 εѴ.
+	// 렌더 타겟 및 깊이 버퍼를 지우고 출력 병합 단계에 바인딩한다.
 	cmdList->ClearRenderTargetView(GetCurrentBackBufferView(), (float*)&backBufferClearColor, 0, nullptr);
 	cmdList->ClearDepthStencilView(GetDepthStencilView(), D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, nullptr);
 	cmdList->OMSetRenderTargets(1, &GetCurrentBackBufferView(), true, &GetDepthStencilView());
@@ -1228,21 +1835,21 @@ void D3DFramework::WireframePass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, "Wirefrmae Rendering");
 #endif
 
-	// ȭ鿡 ̴ ǰü鸸 ׸.
+	// 화면에 보이는 실객체들만 그린다.
 	cmdList->SetPipelineState(pipelineStateObjects["Wireframe"].Get());
-	RenderActualObjects(cmdList, &worldCamFrustum);
+	RenderActualObjects(cmdList, cameraVisibleSet);
 
 #ifdef PIX
 	PIXEndEvent(cmdList);
 #endif
 
-	//  ׸.
+	// 지형을 그린다.
 	DrawTerrain(cmdList, true);
 
 	SetDefaultState(cmdList);
 
 #if defined(DEBUG) || defined(_DEBUG)
-	//  ޽ ׸.
+	// 디버깅할 메쉬들을 그린다.
 	cmdList->SetPipelineState(pipelineStateObjects["Debug"].Get());
 	D3DDebug::GetInstance()->Render(cmdList);
 #endif
@@ -1263,13 +1870,13 @@ void D3DFramework::ShadowMapPass(ID3D12GraphicsCommandList* cmdList)
 	UINT i = 0;
 	for (const auto& light : lights)
 	{
-		//  ʿ  н ۸ ο εѴ.
+		// 쉐도우 맵에 사용될 패스 버퍼를 파이프라인에 바인딩한다.
 		D3D12_GPU_VIRTUAL_ADDRESS shadowPassCBAddress = currentFrameResource->GetPassVirtualAddress() +
 			(1 + i++) * ConstantsSize::passCBByteSize;
 		cmdList->SetGraphicsRootConstantBufferView((int)RpCommon::Pass, shadowPassCBAddress);
 
-		//   ׸.
-		light->RenderSceneToShadowMap(cmdList);
+		// 쉐도우 맵을 그린다.
+		light->RenderSceneToShadowMap(cmdList, shadowVisibleSets[i - 1]);
 	}
 
 #ifdef PIX
@@ -1279,15 +1886,14 @@ void D3DFramework::ShadowMapPass(ID3D12GraphicsCommandList* cmdList)
 
 void D3DFramework::GBufferPass(ID3D12GraphicsCommandList* cmdList)
 {
-	for (UINT i = 0; i < FrameResource::processorCoreNum; ++i)
-	{
-		// ̺Ʈ ȣ° Ǹ  Worker 忡 Ʈ ϴ
-		//  ߰ϱ Ѵ.
-		SetEvent(workerBeginFrameEvents[i]);
-	}
-	//  Worker 尡    ƴٸ 
-	//  ¿ Ǯ ȴ.
-	WaitForMultipleObjects(FrameResource::processorCoreNum, workerFinishedFrameEvents.data(), TRUE, INFINITE);
+	// 명령 리스트마다 하나의 작업을 만들어 JobSystem에 넘긴다. 각 작업은
+	// DrawList에서 미리 나누어진 구간을 컬링하며 G버퍼를 채우는 명령을 기록한다.
+	JobCounter counter;
+	for (UINT32 i = 0; i < FrameResource::processorCoreNum; ++i)
+		JobSystem::GetInstance()->Run([this, i]() { RecordGBuffer(i); }, &counter);
+
+	// 기다리는 동안 메인 스레드도 남은 작업을 수행한다.
+	JobSystem::GetInstance()->Wait(counter);
 }
 
 void D3DFramework::LightingPass(ID3D12GraphicsCommandList* cmdList)
@@ -1300,7 +1906,7 @@ void D3DFramework::LightingPass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, L"SSAO Rendering");
 #endif
 
-	// ssao ׸ Ų.
+	// ssao맵을 그리고 블러시킨다.
 	cmdList->SetGraphicsRootSignature(rootSignatures["Ssao"].Get());
 	ssao->ComputeSsao(cmdList, pipelineStateObjects["SsaoCompute"].Get(),
 		currentFrameResource->GetSsaoVirtualAddress(), currentFrameResource->GetPassVirtualAddress());
@@ -1321,7 +1927,7 @@ void D3DFramework::LightingPass(ID3D12GraphicsCommandList* cmdList)
 	cmdList->OMSetRenderTargets(1, &GetCurrentBackBufferView(), true, nullptr);
 	cmdList->SetPipelineState(pipelineStateObjects["LightingPass"].Get());
 
-	// G۸ Ͽ ȭ鿡 Ǵ ȼ  Ѵ.
+	// G버퍼를 사용하여 화면에 사용되는 픽셀의 라이팅을 계산한다.
 	cmdList->IASetVertexBuffers(0, 0, nullptr);
 	cmdList->IASetIndexBuffer(nullptr);
 	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -1342,9 +1948,9 @@ void D3DFramework::ForwardPass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, L"Sky Rendering");
 #endif
 
-	// ϴ ׸.
+	// 하늘을 그린다.
 	cmdList->SetPipelineState(pipelineStateObjects["Sky"].Get());
-	RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Sky], currentFrameResource->GetObjectVirtualAddress());
+	RenderObjects(cmdList, RenderLayer::Sky, cameraVisibleSet);
 
 #ifdef PIX
 	PIXEndEvent(cmdList);
@@ -1352,7 +1958,7 @@ void D3DFramework::ForwardPass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, L"Particle Rendering");
 #endif
 
-	// ƼŬ  Ǵ ҽ εѴ.
+	// 파티클 렌더링에 사용되는 리소스들을 바인딩한다.
 	cmdList->SetGraphicsRootSignature(rootSignatures["ParticleRender"].Get());
 	cmdList->SetPipelineState(pipelineStateObjects["ParticleRender"].Get());
 	cmdList->SetGraphicsRootConstantBufferView((int)RpParticleGraphics::Pass, currentFrameResource->GetPassVirtualAddress());
@@ -1361,7 +1967,7 @@ void D3DFramework::ForwardPass(ID3D12GraphicsCommandList* cmdList)
 	{
 		particle->SetBufferSrv(cmdList);
 
-		// ƼŬ ׸.
+		// 파티클을 그린다.
 		RenderObject(cmdList, particle.get(), currentFrameResource->GetParticleVirtualAddress());
 	}
 
@@ -1375,10 +1981,10 @@ void D3DFramework::ForwardPass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, L"Transparent Rendering");
 #endif
 
-	//  ü Gۿ   Ƿ 
-	//    ׸.
+	// 투명 객체들은 G버퍼에 담을 수 없으므로 
+	// 포워드 렌더링으로 따로 그린다.
 	cmdList->SetPipelineState(pipelineStateObjects["Transparent"].Get());
-	RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Transparent], currentFrameResource->GetObjectVirtualAddress(),&worldCamFrustum);
+	RenderObjects(cmdList, RenderLayer::Transparent, cameraVisibleSet);
 
 #ifdef PIX
 	PIXEndEvent(cmdList);
@@ -1386,13 +1992,13 @@ void D3DFramework::ForwardPass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, L"Widget Rendering");
 #endif
 
-	//  0~6° DebugMap ׸ ̴.
+	// 위젯의 0~6번째까지는 DebugMap을 그리는 위젯이다.
 	auto iter = widgets.begin();
 	std::advance(iter, 7);
 	cmdList->SetPipelineState(pipelineStateObjects["Widget"].Get());
 	for (; iter != widgets.end(); ++iter)
 	{
-		//  ȭ鿡 ׸.
+		// 위젯을 화면에 그린다.
 		RenderObject(cmdList, (*iter).get(), currentFrameResource->GetWidgetVirtualAddress());
 	}
 
@@ -1401,8 +2007,8 @@ void D3DFramework::ForwardPass(ID3D12GraphicsCommandList* cmdList)
 #endif
 
 #if defined(DEBUG) || defined(_DEBUG)
-	// G۸   ִ ؽó  ׸.
-	if (GetOptionEnabled(Option::Debug_GBuffer))
+	// G버퍼를 볼 수 있는 텍스처 위젯을 그린다.
+	if (renderOptions.test((int)Option::Debug_GBuffer))
 	{
 		auto iter = widgets.begin();
 
@@ -1449,7 +2055,7 @@ void D3DFramework::PostProcessPass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, L"Ssr Rendering");
 #endif
 
-	// ssr  ׸.
+	// ssr 맵을 그린다.
 	cmdList->SetGraphicsRootSignature(rootSignatures["Ssr"].Get());
 	cmdList->SetPipelineState(pipelineStateObjects["Ssr"].Get());
 	ssr->ComputeSsr(cmdList, GetGpuSrv(DescriptorIndex::renderTargetHeapIndex + currentBackBuffer),
@@ -1461,7 +2067,7 @@ void D3DFramework::PostProcessPass(ID3D12GraphicsCommandList* cmdList)
 	PIXBeginEvent(cmdList, 0, L"Blur");
 #endif
 
-	// ssr  Ų.
+	// ssr 맵을 블러시킨다.
 	cmdList->SetComputeRootSignature(rootSignatures["Blur"].Get());
 	blurFilter->Execute(cmdList, pipelineStateObjects["BlurHorz"].Get(), pipelineStateObjects["BlurVert"].Get(),
 		ssr->Output(), D3D12_RESOURCE_STATE_GENERIC_READ, 1);
@@ -1480,12 +2086,12 @@ void D3DFramework::PostProcessPass(ID3D12GraphicsCommandList* cmdList)
 	cmdList->SetGraphicsRootSignature(rootSignatures["Reflection"].Get());
 	cmdList->SetPipelineState(pipelineStateObjects["Reflection"].Get());
 
-	// ssr Ǵ ҽ εѴ.
+	// ssr에 사용되는 리소스들을 바인딩한다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpReflection::ColorMap, GetGpuSrv(DescriptorIndex::renderTargetHeapIndex + currentBackBuffer));
 	cmdList->SetGraphicsRootDescriptorTable((int)RpReflection::BufferMap, GetGpuSrv(DescriptorIndex::deferredBufferHeapIndex + 1));
 	cmdList->SetGraphicsRootDescriptorTable((int)RpReflection::SsrMap, GetGpuSrv(DescriptorIndex::ssrMapHeapIndex));
 
-	// ssr Ͽ ݻǴ ȿ Ѵ.
+	// ssr맵을 사용하여 반사되는 효과를 수행한다.
 	cmdList->IASetVertexBuffers(0, 0, nullptr);
 	cmdList->IASetIndexBuffer(nullptr);
 	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -1520,7 +2126,7 @@ void D3DFramework::ParticleUpdate(ID3D12GraphicsCommandList* cmdList)
 
 			particle->SetBufferUav(cmdList);
 
-			// ƼŬ Ѵ.
+			// 파티클을 생성한다.
 			particle->Emit(cmdList);
 		}
 	}
@@ -1534,13 +2140,13 @@ void D3DFramework::ParticleUpdate(ID3D12GraphicsCommandList* cmdList)
 
 		particle->SetBufferUav(cmdList);
 
-		// ƼŬ ͸ ƮѴ.
+		// 파티클 데이터를 업데이트한다.
 		particle->Update(cmdList);
 	}
 
 	for (const auto& particle : particles)
 	{
-		// gpu  ƼŬ ͸ Ѵ.
+		// gpu에 존재한 파티클 데이터를 복사한다.
 		particle->CopyData(cmdList);
 	}
 
@@ -1575,14 +2181,14 @@ void D3DFramework::DrawTerrain(ID3D12GraphicsCommandList* cmdList, bool isWirefr
 		cmdList->OMSetRenderTargets(DEFERRED_BUFFER_COUNT, &GetDefferedBufferView(0), true, &GetDepthStencilView());
 		cmdList->SetPipelineState(pipelineStateObjects["TerrainRender"].Get());
 	}
-	//  Ǵ ҽ εѴ.
+	// 지형에 사용되는 리소스들을 바인딩한다.
 	cmdList->SetGraphicsRootConstantBufferView((int)RpTerrainGraphics::Pass, currentFrameResource->GetPassVirtualAddress());
 	cmdList->SetGraphicsRootDescriptorTable((int)RpTerrainGraphics::Texture, GetGpuSrv(DescriptorIndex::textureHeapIndex));
 	cmdList->SetGraphicsRootShaderResourceView((int)RpTerrainGraphics::Material, currentFrameResource->GetMaterialVirtualAddress());
 	terrain->SetSrvDescriptors(cmdList);
 
-	//  ׸.
-	RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Terrain], currentFrameResource->GetTerrainVirtualAddress());
+	// 지형을 그린다.
+	RenderObject(cmdList, terrain.get(), currentFrameResource->GetTerrainVirtualAddress());
 
 #ifdef PIX
 	PIXEndEvent(cmdList);
@@ -1594,7 +2200,7 @@ void D3DFramework::Init(ID3D12GraphicsCommandList* cmdList)
 #ifdef MULTITHREAD_RENDERING
 	for (UINT i = 0; i < FrameResource::processorCoreNum; ++i)
 	{
-		// Ƽ   Ǵ ɾ Ʈ Ѵ.
+		// 멀티 스레드 렌더링에 사용되는 명령어 오브젝트들을 리셋한다.
 		auto cmdList = currentFrameResource->worekrCmdLists[i].Get();
 		auto cmdAlloc = currentFrameResource->workerCmdAllocs[i].Get();
 		Reset(cmdList, cmdAlloc);
@@ -1603,13 +2209,13 @@ void D3DFramework::Init(ID3D12GraphicsCommandList* cmdList)
 
 	for (UINT i = 0; i < FrameResource::framePhase; ++i)
 	{
-		//  ӿ  ɾ Ʈ Ѵ.
+		// 현재 프레임에 사용될 명령어 오브젝트들을 리셋한다.
 		auto cmdList = currentFrameResource->frameCmdLists[i].Get();
 		auto cmdAlloc = currentFrameResource->frameCmdAllocs[i].Get();
 		Reset(cmdList, cmdAlloc);
 	}
 
-	//  G-Buffer ۵  Ÿ,  ۸ ϱ  ڿ ¸ ȯѴ.
+	// 각 G-Buffer의 버퍼들과 렌더 타겟, 깊이 버퍼를 사용하기 위해 자원 상태를를 전환한다.
 	CD3DX12_RESOURCE_BARRIER transitions[DEFERRED_BUFFER_COUNT];
 	for (int i = 0; i < DEFERRED_BUFFER_COUNT; i++)
 		transitions[i] = CD3DX12_RESOURCE_BARRIER::Transition(deferredBuffer[i].Get(),
@@ -1618,7 +2224,7 @@ void D3DFramework::Init(ID3D12GraphicsCommandList* cmdList)
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(GetCurrentBackBuffer(),
 		D3D12_RESOURCE_STATE_PRESENT, D3D12_RESOURCE_STATE_RENDER_TARGET));
 
-	//  ӿ   Ÿ   ۸ .
+	// 현재 프레임에 사용될 렌더 타겟 및 깊이 버퍼를 지운다.
 	for (int i = 0; i < DEFERRED_BUFFER_COUNT; i++)
 		cmdList->ClearRenderTargetView(GetDefferedBufferView(i), (float*)&deferredBufferClearColors[i], 0, nullptr);
 	cmdList->ClearRenderTargetView(GetCurrentBackBufferView(), (float*)&backBufferClearColor, 0, nullptr);
@@ -1627,7 +2233,7 @@ void D3DFramework::Init(ID3D12GraphicsCommandList* cmdList)
 
 void D3DFramework::MidFrame(ID3D12GraphicsCommandList* cmdList)
 {
-	//  G-Buffer ۵  ۸ б  ڿ ¸ ȯѴ.
+	// 각 G-Buffer의 버퍼들과 깊이 버퍼를 읽기 위해 자원 상태를를 전환한다.
 	CD3DX12_RESOURCE_BARRIER transitions[DEFERRED_BUFFER_COUNT];
 	for (int i = 0; i < DEFERRED_BUFFER_COUNT; i++)
 		transitions[i] = CD3DX12_RESOURCE_BARRIER::Transition(deferredBuffer[i].Get(),
@@ -1637,88 +2243,59 @@ void D3DFramework::MidFrame(ID3D12GraphicsCommandList* cmdList)
 
 void D3DFramework::Finish(ID3D12GraphicsCommandList* cmdList)
 {
-	// ĸ ۸   ֵ ҽ ¸ ٲ۴.
+	// 후면 버퍼를 제시할 수 있도록 리소스 상태를 바꾼다.
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(GetCurrentBackBuffer(),
 		D3D12_RESOURCE_STATE_RENDER_TARGET, D3D12_RESOURCE_STATE_PRESENT));
 }
 
-void D3DFramework::WorkerThread(const UINT32 threadIndex)
+void D3DFramework::RecordGBuffer(const UINT32 threadIndex)
 {
 	const UINT32 threadNum = FrameResource::processorCoreNum;
 
-	while (true)
-	{
-		// G۸ ä    ٸ.
-		WaitForSingleObject(workerBeginFrameEvents[threadIndex], INFINITE);
-
-		ID3D12GraphicsCommandList* cmdList = nullptr;
+	ID3D12GraphicsCommandList* cmdList = nullptr;
 #ifdef MULTITHREAD_RENDERING
-		// Ƽ    ɾ Ʈ
-		//  ε   ´.
-		cmdList = currentFrameResource->worekrCmdLists[threadIndex].Get();
+	// 멀티 스레드 렌더링에서 사용할 명령어 리스트를
+	// 스레드 인덱스에  따라 가져온다.
+	cmdList = currentFrameResource->worekrCmdLists[threadIndex].Get();
 #else
-		// ̱   ϳ ɾ Ʈ ȴ.
-		cmdList = currentFrameResource->frameCmdLists[0].Get();
+	// 싱글 스레드 렌더링은 하나의 명령어 리스트만 사용된다.
+	cmdList = currentFrameResource->frameCmdLists[0].Get();
 #endif
 
-		SetDefaultState(cmdList);
-		//  G۸   ܰ迡 εѴ.
-		cmdList->OMSetRenderTargets(DEFERRED_BUFFER_COUNT, &GetDefferedBufferView(0), true, &GetDepthStencilView());
+	SetDefaultState(cmdList);
+	// 사용될 G버퍼를 출력 병합 단계에 바인딩한다.
+	cmdList->OMSetRenderTargets(DEFERRED_BUFFER_COUNT, &GetDefferedBufferView(0), true, &GetDepthStencilView());
 
 #ifdef PIX
-		PIXBeginEvent(cmdList, 0, L"MultiThread Rendering");
+	PIXBeginEvent(cmdList, 0, L"MultiThread Rendering");
 #endif
 
-		cmdList->SetPipelineState(pipelineStateObjects["Opaque"].Get());
-		RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Opaque], currentFrameResource->GetObjectVirtualAddress(),
-			&worldCamFrustum, threadIndex, threadNum);
+	cmdList->SetPipelineState(pipelineStateObjects["Opaque"].Get());
+	RenderObjects(cmdList, RenderLayer::Opaque, cameraVisibleSet, threadIndex, threadNum);
 
-		cmdList->SetPipelineState(pipelineStateObjects["AlphaTested"].Get());
-		RenderObjects(cmdList, renderableObjects[(int)RenderLayer::AlphaTested], currentFrameResource->GetObjectVirtualAddress(),
-			&worldCamFrustum, threadIndex, threadNum);
+	cmdList->SetPipelineState(pipelineStateObjects["AlphaTested"].Get());
+	RenderObjects(cmdList, RenderLayer::AlphaTested, cameraVisibleSet, threadIndex, threadNum);
 
-		cmdList->SetPipelineState(pipelineStateObjects["Billborad"].Get());
-		RenderObjects(cmdList, renderableObjects[(int)RenderLayer::Billborad], currentFrameResource->GetObjectVirtualAddress(),
-			&worldCamFrustum, threadIndex, threadNum);
+	cmdList->SetPipelineState(pipelineStateObjects["Billborad"].Get());
+	RenderObjects(cmdList, RenderLayer::Billborad, cameraVisibleSet, threadIndex, threadNum);
 
 #ifdef PIX
-		PIXEndEvent(cmdList);
+	PIXEndEvent(cmdList);
 #endif
 
 #ifdef MULTITHREAD_RENDERING
-		ThrowIfFailed(cmdList->Close());
+	ThrowIfFailed(cmdList->Close());
 #endif
-
-		// ̺Ʈ ȣ· ٲپ  ° ǵ Ѵ.
-		SetEvent(workerFinishedFrameEvents[threadIndex]);
-	}
-}
-
-void D3DFramework::CreateThreads()
-{
-	UINT threadNum = FrameResource::processorCoreNum;
-
-	workerThread.reserve(threadNum);
-	workerBeginFrameEvents.reserve(threadNum);
-	workerFinishedFrameEvents.reserve(threadNum);
-
-	for (UINT i = 0; i < threadNum; ++i)
-	{
-		workerBeginFrameEvents.push_back(CreateEvent(NULL, FALSE, FALSE, NULL));
-		workerFinishedFrameEvents.push_back(CreateEvent(NULL, FALSE, FALSE, NULL));
-
-		workerThread.emplace_back([this, i]() { this->WorkerThread(i); });
-	}
 }
 
 void D3DFramework::DrawDebugOctree()
 {
-	octreeRoot->DrawDebug();
+	broadphase->DrawDebug();
 }
 
 void D3DFramework::DrawDebugCollision()
 {
-	for (const auto& obj : gameObjects)
+	for (GameObject* obj : gameObjects)
 	{
 		auto meshBounding = obj->GetCollisionBounding();
 		switch (obj->GetCollisionType())
@@ -1751,8 +2328,8 @@ void D3DFramework::DrawDebugLight()
 
 	for (const auto& light : lights)
 	{
-		D3DDebug::GetInstance()->DrawSphere(light->GetPosition(), lightRadius, FLT_MAX, (XMFLOAT4)Colors::Yellow);
-		D3DDebug::GetInstance()->DrawLine(light->GetPosition(), 
-			Vector3::Add(light->GetPosition(), Vector3::Multiply(light->GetLook(), 5.0f)), FLT_MAX, (XMFLOAT4)Colors::Yellow);
+		D3DDebug::GetInstance()->DrawSphere(light->GetWorldPosition(), lightRadius, FLT_MAX, (XMFLOAT4)Colors::Yellow);
+		D3DDebug::GetInstance()->DrawLine(light->GetWorldPosition(), 
+			Vector3::Add(light->GetWorldPosition(), Vector3::Multiply(light->GetLook(), 5.0f)), FLT_MAX, (XMFLOAT4)Colors::Yellow);
 	}
 }
\ No newline at end of file
@@ -1,20 +1,35 @@
 #pragma once
 
 #include "D3DApp.h"
+#include "Physics.h"
+#include "ObjectTable.h"
+#include "DrawList.h"
+#include "VisibleSet.h"
+#include "OcclusionBuffer.h"
+#include "JobSystem.h"
 #include <DirectXCollision.h>
 #include <array>
 #include <thread>
+#include <future>
+#include <atomic>
 
 struct FrameResource;
 struct PassConstants;
-struct HitInfo;
+struct SceneQueryResult;
 class Camera;
 class Renderable;
 class GameObject;
 class Light;
 class Widget;
 class Particle;
-class Octree;
+class Cloth;
+class Broadphase;
+class SceneQuery;
+class PhysicsRecorder;
+class ClothSolver;
+class StaticBatcher;
+class WorldPartition;
+class WorldSnapshot;
 class Ssao;
 class Ssr;
 class BlurFilter;
@@ -41,61 +56,123 @@ public:
 public:
 	static D3DFramework* GetInstance();
 
+	// 물리 시뮬레이션의 기록 또는 재생을 설정한다. Initialize 이전에 불려져야 한다.
+	// 재생 모드에서는 기록된 스텝을 모두 재생한 후 통계를 출력하고 종료한다.
+	void SetPhysicsRecordMode(const PhysicsRecordMode mode, const std::string& fileName);
+
+	// 시뮬레이션 상태를 스냅샷에 저장하거나 되돌린다. Tick과 Tick 사이에 메인 스레드에서 불려야 한다.
+	// 미리 ReserveSnapshot으로 공간을 확보해두면 메모리를 할당하지 않는다.
+	void ReserveSnapshot(WorldSnapshot& snapshot) const;
+	void CaptureSnapshot(WorldSnapshot& snapshot) const;
+	void CaptureDeltaSnapshot(const WorldSnapshot& base, WorldSnapshot& snapshot) const;
+	bool RestoreSnapshot(const WorldSnapshot& snapshot);
+
+	// 오클루전 컬링의 해상도와 오클루더를 고르는 기준을 설정한다. Tick과 Tick 사이에 불려야 한다.
+	void SetOcclusionSettings(const OcclusionSettings& settings);
+	const OcclusionSettings& GetOcclusionSettings() const;
+
 public:
-	// Renderable Ʈ Ѵ.
+	// Renderable 오브젝트를 렌더링한다.
 	void RenderObject(ID3D12GraphicsCommandList* cmdList, Renderable* obj,
 		D3D12_GPU_VIRTUAL_ADDRESS startAddress, DirectX::BoundingFrustum* frustum = nullptr) const;
-	// Renderabel Ʈ  Ʈ ̿Ͽ Ѵ.
-	// ش Լ Ƽ   Ͽ  ε ü   ڷ ޴´.
-	void RenderObjects(ID3D12GraphicsCommandList* cmdList, const std::list<std::shared_ptr<Renderable>>& list,
-		D3D12_GPU_VIRTUAL_ADDRESS startAddress, DirectX::BoundingFrustum* frustum = nullptr, 
-		const UINT32 threadIndex = 0, const UINT32  threadNum = 1) const;
-	// ȭ󿡼   ü鸸 ׸.
-	void RenderActualObjects(ID3D12GraphicsCommandList* cmdList, DirectX::BoundingFrustum* frustum = nullptr);
-	//  帶   Ѵ.
-	void WorkerThread(const UINT32 threadIndex);
-
-	// ȭ    ε ü ȯѴ.  ü 浹 üũ
-	//     浹 Ѵٸ isMeshCollision true Ѵ.
-	bool Picking(HitInfo& hitInfo, const INT32 screenX, const INT32 screenY,
-		const float distance = 1000.0f, const bool isMeshCollision = false) const;
-
-	// ϴ Ʈ ã ּҰ ȯѴ.
-	GameObject* FindGameObject(const std::string name);
+	// 렌더 레이어의 DrawList에서 visibleSet에 남은 레코드들을 렌더링한다.
+	// 해당 함수를 멀티 스레드 렌더링을 고려하여 스레드 인덱스와 전체 스레드 개수를 인자로 받으며,
+	// 각 스레드는 컬링 단계에서 비용에 따라 나누어진 연속된 구간만을 그린다.
+	// 구간 안에서 메쉬와 재질이 같은 연속된 레코드들은 한 번의 인스턴싱으로 그린다.
+	// INDIRECT_DRAW가 정의되어 있다면 인자 버퍼를 채워 ExecuteIndirect로 제출하고,
+	// 인덱스를 사용하지 않는 레코드가 있거나 버퍼의 자리가 모자라면 직접 그린다.
+	void RenderObjects(ID3D12GraphicsCommandList* cmdList, const RenderLayer layer,
+		const VisibleSet& visibleSet, const UINT32 threadIndex = 0, const UINT32  threadNum = 1) const;
+	// 화면상에서 실제로 보일 객체들만 그린다.
+	void RenderActualObjects(ID3D12GraphicsCommandList* cmdList, const VisibleSet& visibleSet);
+	// 나누어진 구간마다 G버퍼를 채우는 명령을 기록한다. JobSystem의 작업으로 실행된다.
+	void RecordGBuffer(const UINT32 threadIndex);
+
+	// 화면 상에 광선을 쏘아 부딪힌 객체를 찾는 질의를 요청한다. 게임 객체는 충돌 체크를
+	// 끌 수 있지만 무조건적인 충돌을 원한다면 isMeshCollision를 true로 한다.
+	// 질의는 워커 스레드에서 수행되며 결과는 다음 Tick 이후에 future로 확인한다.
+	std::shared_future<SceneQueryResult> Picking(const INT32 screenX, const INT32 screenY,
+		const float distance = 1000.0f, const bool isMeshCollision = false);
+
+	// 이진 씬 파일의 객체들을 한 번에 생성한다. 파일이 없거나 잘못되었다면 false를 반환한다.
+	bool LoadScene(const std::wstring& fileName);
+	// 현재 렌더 레이어의 객체들 중 씬 파일로 표현할 수 있는 객체들을 저장한다.
+	bool SaveScene(const std::wstring& fileName) const;
+
+	// 원하는 오브젝트를 찾아 주소값을 반환한다. ObjectTable의 해시 인덱스를 사용한다.
+	GameObject* FindGameObject(std::string_view name);
 	GameObject* FindGameObject(const UINT64 uid);
 
-	//  ϱ  Լ
+	// 디버그 하기 위한 함수
 	void DrawDebugOctree();
 	void DrawDebugCollision();
 	void DrawDebugLight();
 
 	Camera* GetCamera() const;
+	SceneQuery* GetSceneQuery() const;
+	const PhysicsStats& GetPhysicsStats() const;
+	// 마지막 프레임에서 카메라 뷰를 컬링한 통계
+	const CullingStats& GetCullingStats() const;
+
+protected:
+	// 널 백엔드와 상태 캐시의 통계에 더해 뷰마다 컬링 통계를 출력한다.
+	virtual void ResetFrameStats() override;
+	virtual void PrintFrameStats(const UINT32 frameCount) const override;
 
 private:
-	// ӿũ ʱȭϰ ʿ ü Ѵ.
+	// 프레임워크를 초기화하고 필요한 객체들을 생성한다.
 	void InitFramework();
 	void CreateObjects();
+	void CreateBillboards();
 	void CreateLights();
 	void CreateWidgets(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
 	void CreateParticles();
+	void CreateCloths(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
 	void CreateTerrain();
+	// 정적 객체들을 재질과 공간 클러스터별로 합쳐 그리기 호출을 줄인다.
+	void CreateStaticBatches(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList);
 	void CreateFrameResources(ID3D12Device* device);
-	void CreateThreads();
 	void CreateTerrainStdDevAndNormalMap();
 
-	// ʿ  ۵ ƮѴ.
+	// 필요한 상수 버퍼들을 업데이트한다.
 	void UpdateObjectBuffer(float deltaTime);
 	void UpdateLightBuffer(float deltaTime);
 	void UpdateMaterialBuffer(float deltaTime);
 	void UpdateMainPassBuffer(float deltaTime);
 	void UpdateWidgetBuffer(float deltaTime);
+	void UpdateClothBuffer(float deltaTime);
 	void UpdateParticleBuffer(float deltaTime);
 	void UpdateSsaoBuffer(float deltaTime);
 	void UpdateTerrainBuffer(float deltaTime);
 	void UpdateSsrBuffer(float deltaTime);
 	void UpdateObjectBufferPool();
+	// 렌더 레이어마다 DrawList를 다시 채우고 워커 스레드의 구간을 나눈다.
+	// 객체들의 상수 버퍼 인덱스가 정해진 이후에 불려야 한다.
+	void UpdateDrawLists();
+	// 인스턴스 인덱스 버퍼가 객체 수와 이전 프레임들의 사용량을 담을 수 있도록 크기를 맞춘다.
+	// DrawList가 채워진 이후, 렌더 단계가 시작되기 전에 불려야 한다.
+	void UpdateInstanceBufferPool();
+	// 카메라에서 가까운 큰 불투명 객체들을 오클루더로 골라 래스터화하는 작업을 시작한다.
+	// DrawList가 채워진 후에 불려야 하며, CullViews가 작업이 끝나기를 기다린다.
+	void BeginOcclusionCulling();
+	// 카메라와 각 조명의 그림자 뷰를 한 번씩 컬링하여 기록 단계가 읽을 VisibleSet을 만든다.
+	void CullViews();
+	// ExecuteIndirect의 인자 버퍼도 같은 방식으로 크기를 맞춘다.
+	void UpdateIndirectBufferPool();
 
-	//  ʿ  н̴.
+	// 완료된 Picking 질의의 결과를 확인한다.
+	void CheckPickingResult();
+
+	// 광역 단계, 좁은 단계, 충돌 해결, 적분 순서로 물리 시뮬레이션을 한 스텝 진행한다.
+	void StepPhysics(float deltaTime);
+
+	// 마지막 Tick이 만든 스냅샷으로 한 프레임의 명령을 기록하고 제출한다.
+	// PIPELINED_FRAME이 정의되어 있다면 다음 Tick의 시뮬레이션과 겹쳐서 작업으로 실행된다.
+	void RenderFrame();
+	// 기록 중인 프레임이 있다면 끝날 때까지 기다린다.
+	void WaitForRender();
+
+	// 렌더링에 필요한 각 패스들이다.
 	void WireframePass(ID3D12GraphicsCommandList* cmdList);
 	void ShadowMapPass(ID3D12GraphicsCommandList* cmdList);
 	void GBufferPass(ID3D12GraphicsCommandList* cmdList);
@@ -116,31 +193,69 @@ private:
 	FrameResource* currentFrameResource = nullptr;
 	UINT32 currentFrameResourceIndex = 0;
 
-	// Ƽ   ʿ   ̺Ʈ̴.
-	std::vector<std::thread> workerThread;
-	std::vector<HANDLE> workerBeginFrameEvents;
-	std::vector<HANDLE> workerFinishedFrameEvents;
-
-	std::array<std::list<std::shared_ptr<Renderable>>, (int)RenderLayer::Count> renderableObjects;
-	std::list<std::shared_ptr<GameObject>> gameObjects;
-	std::list<std::shared_ptr<Light>> lights;
-	std::list<std::shared_ptr<Widget>> widgets;
-	std::list<std::shared_ptr<Particle>> particles;
+	// 모든 게임 오브젝트는 gameObjects가 소유하며, 나머지는 핸들만을 가진다.
+	ObjectTable gameObjects;
+	std::array<std::vector<ObjectHandle>, (int)RenderLayer::Count> renderableObjects;
+	// renderableObjects로부터 매 프레임 만들어지는 그리기 레코드
+	std::array<DrawList, (int)RenderLayer::Count> drawLists;
+	// 컬링 단계가 뷰마다 만든 보이는 레코드들. shadowVisibleSets[i]는 lights[i]의 그림자 뷰이다.
+	VisibleSet cameraVisibleSet;
+	std::vector<VisibleSet> shadowVisibleSets;
+	// 카메라 뷰의 오클루전 컬링에 사용되는 깊이 버퍼와 이번 프레임의 오클루더들
+	std::unique_ptr<OcclusionBuffer> occlusionBuffer;
+	OcclusionSettings occlusionSettings;
+	std::vector<OccluderMesh> occluders;
+	// 오클루더를 고를 때 재사용되는 (화면상 크기, 레코드 인덱스) 목록
+	std::vector<std::pair<float, UINT32>> occluderCandidates;
+	// 오클루더를 래스터화하는 작업의 카운터
+	JobCounter occlusionCounter;
+	std::vector<std::shared_ptr<Light>> lights;
+	std::vector<std::shared_ptr<Widget>> widgets;
+	std::vector<std::shared_ptr<Particle>> particles;
+	// 병렬 갱신을 위해 매 프레임 인덱스로 접근할 수 있도록 모아두는 오브젝트 목록
+	std::vector<GameObject*> tickObjects;
+	std::vector<ObjectHandle> cloths;
 	std::shared_ptr<Terrain> terrain;
 
+	// 렌더 단계가 진행 중인 프레임을 세는 카운터
+	JobCounter renderCounter;
+	// 이번 프레임에 예약된 인스턴스 인덱스의 개수. 워커 스레드들이 동시에 구간을 예약한다.
+	// 버퍼의 크기를 넘은 예약도 세어 다음 프레임의 버퍼 크기를 정하는 데 사용한다.
+	mutable std::atomic<UINT32> instanceCursor = 0;
+	// 지금까지의 프레임들이 예약한 인스턴스 인덱스의 최대 개수
+	UINT32 instanceDemand = 0;
+	// 이번 프레임에 예약된 ExecuteIndirect 명령의 개수와 지금까지의 최대 개수
+	mutable std::atomic<UINT32> indirectCursor = 0;
+	UINT32 indirectDemand = 0;
+	// Tick에서 복사되어 렌더 단계가 읽는 옵션
+	std::bitset<(int)Option::Count> renderOptions;
+
 	std::unique_ptr<PassConstants> mainPassCB;
 	std::array<std::unique_ptr<PassConstants>, LIGHT_NUM> shadowPassCB;
 	std::unique_ptr<Camera> camera;
-	std::unique_ptr<Octree> octreeRoot;
+	std::unique_ptr<Broadphase> broadphase;
+	std::unique_ptr<SceneQuery> sceneQuery;
+	std::shared_future<SceneQueryResult> pickingResult;
+
+	// 물리 시뮬레이션의 기록 및 재생에 사용된다.
+	std::unique_ptr<PhysicsRecorder> physicsRecorder;
+	std::unique_ptr<ClothSolver> clothSolver;
+	std::unique_ptr<StaticBatcher> staticBatcher;
+	std::unique_ptr<WorldPartition> worldPartition;
+	// 매 스텝마다 재사용되는 접촉 목록과 마지막 스텝의 통계
+	std::vector<CollisionContact> contacts;
+	PhysicsStats physicsStats;
 	std::unique_ptr<Ssao> ssao;
 	std::unique_ptr<Ssr> ssr;
 	std::unique_ptr<BlurFilter> blurFilter;
 	std::unique_ptr<D3DDebug> d3dDebug;
 	
-	//  Ӹ ī޶    ǥ
-	// ȯϿ Ѵ.    ø , ȴ.
+	// 매 프레임마다 카메라 로컬 프러스텀을 월드 좌표계로
+	// 변환하여 저장한다. 그 후 프러스텀 컬링할 때, 사용된다.
 	DirectX::BoundingFrustum worldCamFrustum;
 
 private:
 	static inline D3DFramework* instance = nullptr;
+	// 병렬 갱신에서 하나의 작업이 맡는 객체의 개수
+	static constexpr UINT32 updateGrainSize = 64;
 };
@@ -63,7 +63,7 @@ ComPtr<ID3D12Resource> D3DUtil::CreateDefaultBuffer(
 {
 	ComPtr<ID3D12Resource> defaultBuffer;
 
-	//  ⺻  ڿ Ѵ.
+	// 실제 기본 버퍼 자원을 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -72,8 +72,8 @@ ComPtr<ID3D12Resource> D3DUtil::CreateDefaultBuffer(
 		nullptr,
 		IID_PPV_ARGS(defaultBuffer.GetAddressOf())));
 
-	// CPU ޸ ڷḦ ⺻ ۿ Ϸ
-	// ӽ ε   Ѵ.
+	// CPU 메모리의 자료를 기본 버퍼에 복사하려면
+	// 임시 업로드 힙을 만들어야 한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
 		D3D12_HEAP_FLAG_NONE,
@@ -83,32 +83,32 @@ ComPtr<ID3D12Resource> D3DUtil::CreateDefaultBuffer(
 		IID_PPV_ARGS(uploadBuffer.GetAddressOf())));
 
 
-	// ⺻ ۿ  ڷḦ Ѵ.
+	// 기본 버퍼에 복사할 자료를 서술한다.
 	D3D12_SUBRESOURCE_DATA subResourceData = {};
 	subResourceData.pData = initData;
 	subResourceData.RowPitch = byteSize;
 	subResourceData.SlicePitch = subResourceData.RowPitch;
 
-	// ⺻  ڿ ڷ 縦 ûѴ.
-	// UpdateSubresources CPU ޸𸮸 ӽ ε  ϰ,
-	// ID3D12CommandList::CopySubresourceRegion ̿ؼ
-	// ӽ ε  ڷḦ mBuffer Ѵ.
+	// 기본 버퍼 자원으로의 자료 복사를 요청한다.
+	// UpdateSubresources는 CPU 메모리를 임시 업로드 힙에 복사하고,
+	// ID3D12CommandList::CopySubresourceRegion을 이용해서
+	// 임시 업로드 힙의 자료를 mBuffer에 복사한다.
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(defaultBuffer.Get(),
 		D3D12_RESOURCE_STATE_COMMON, D3D12_RESOURCE_STATE_COPY_DEST));
 	UpdateSubresources<1>(cmdList, defaultBuffer.Get(), uploadBuffer.Get(), 0, 0, 1, &subResourceData);
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(defaultBuffer.Get(),
 		D3D12_RESOURCE_STATE_COPY_DEST, D3D12_RESOURCE_STATE_GENERIC_READ));
 
-	//  :  Լ ȣ Ŀ uploadBuffer  ؾ Ѵ.
-	//  縦 ϴ     ʾұ ̴.
-	// 簡 ϷǾ Ȯ Ŀ ȣڰ uploadBuffer ϸ ȴ.
+	// 주의 : 위의 함수 호출 이후에도 uploadBuffer를 계속 유지해야 한다.
+	// 실제로 복사를 수행하는 명령 목록이 아직 실행되지 않았기 때문이다.
+	// 복사가 완료되었음이 확실해진 후에 호출자가 uploadBuffer를 해제하면 된다.
 
 	return defaultBuffer;
 }
 
 std::wstring DxException::ToString()const
 {
-	// ErrorCode  ´.
+	// ErrorCode의 설명을 얻는다.
 	_com_error err(ErrorCode);
 	std::wstring msg = err.ErrorMessage();
 
@@ -16,8 +16,8 @@ class D3DUtil
 public:
 	static UINT32 CalcConstantBufferByteSize(UINT32 byteSize)
 	{
-		//   ũ ݵ ּ ϵ Ҵ ũ( 256Ʈ) ̾ Ѵ.
-		//  ޼ ־ ũ⿡   256  ؼ ش.
+		// 상수 버퍼의 크기는 반드시 최소 하드웨어 할당 크기(흔히 256바이트)의 배수이어야 한다.
+		// 이 메서드는 주어진 크기에 가장 가까운 256의 배수를 구해서 돌려준다.
 		return (byteSize + 255) & ~255;
 	}
 
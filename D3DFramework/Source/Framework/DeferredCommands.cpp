@@ -0,0 +1,38 @@
+#include "../PrecompiledHeader/pch.h"
+#include "DeferredCommands.h"
+
+
+DeferredCommands* DeferredCommands::GetInstance()
+{
+	static DeferredCommands* instance = nullptr;
+	if (instance == nullptr)
+		instance = new DeferredCommands();
+	return instance;
+}
+
+void DeferredCommands::Push(const UINT64 order, std::function<void()>&& function)
+{
+	std::lock_guard<std::mutex> lock(mutex);
+	commands.push_back({ order, std::move(function) });
+}
+
+void DeferredCommands::Execute()
+{
+	while (true)
+	{
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if (commands.empty())
+				break;
+			executeCommands.swap(commands);
+		}
+
+		// 같은 객체의 명령은 넣은 순서를 유지해야 하므로 안정 정렬을 사용한다.
+		std::stable_sort(executeCommands.begin(), executeCommands.end(),
+			[](const Command& lhs, const Command& rhs) { return lhs.order < rhs.order; });
+
+		for (auto& command : executeCommands)
+			command.function();
+		executeCommands.clear();
+	}
+}
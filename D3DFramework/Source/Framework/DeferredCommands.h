@@ -0,0 +1,43 @@
+#pragma once
+
+#include <basetsd.h>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+/*
+병렬로 실행되는 Tick 도중 다른 객체나 공유 자원을 수정해야 할 때 사용하는 명령 큐
+명령은 바로 실행되지 않고 병렬 구간이 끝난 뒤 메인 스레드에서 한 번에 실행된다.
+명령은 넣은 객체의 UID 순서로, 같은 객체의 명령은 넣은 순서대로 실행되므로
+스레드의 실행 순서와 상관없이 직렬로 실행했을 때와 같은 결과가 나온다.
+*/
+class DeferredCommands
+{
+private:
+	struct Command
+	{
+		UINT64 order;
+		std::function<void()> function;
+	};
+
+public:
+	DeferredCommands() = default;
+	DeferredCommands(const DeferredCommands& rhs) = delete;
+	DeferredCommands& operator=(const DeferredCommands& rhs) = delete;
+	~DeferredCommands() = default;
+
+public:
+	static DeferredCommands* GetInstance();
+
+public:
+	// order가 작은 명령부터 실행된다. 여러 스레드에서 동시에 호출할 수 있다.
+	void Push(const UINT64 order, std::function<void()>&& function);
+	// 쌓인 명령을 모두 실행한다. 실행 중 추가된 명령도 이어서 실행한다.
+	void Execute();
+
+private:
+	std::mutex mutex;
+	std::vector<Command> commands;
+	// 실행 중에 명령이 추가될 수 있으므로 실행할 명령은 따로 옮겨둔다.
+	std::vector<Command> executeCommands;
+};
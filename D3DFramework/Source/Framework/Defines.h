@@ -14,4 +14,11 @@
 //#define SSAO
 #define SSR
 #define MULTITHREAD_RENDERING
+#define PARALLEL_UPDATE
+#define PIPELINED_FRAME
+#define STATIC_BATCHING
+#define WORLD_PARTITION
+#define STATE_CACHE
+#define INDIRECT_DRAW
+#define OCCLUSION_CULLING
 //#define PIX
\ No newline at end of file
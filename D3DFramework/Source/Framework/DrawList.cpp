@@ -0,0 +1,100 @@
+#include "../PrecompiledHeader/pch.h"
+#include "DrawList.h"
+#include "RadixSort.hpp"
+
+// 키를 채우고 레코드를 옮기는 작업 하나가 처리할 레코드의 개수
+static constexpr UINT32 sortGrainSize = 4096;
+
+UINT64 DrawList::MakeSortKey(const UINT32 layer, const UINT32 materialIndex, const UINT64 meshID,
+	const float depth, const float maxDepth, const bool isBackToFront)
+{
+	constexpr UINT64 layerMask = (1ull << layerBits) - 1;
+	constexpr UINT64 materialMask = (1ull << materialBits) - 1;
+	constexpr UINT64 meshMask = (1ull << meshBits) - 1;
+	constexpr UINT64 depthMask = (1ull << depthBits) - 1;
+	constexpr UINT32 unusedBits = 64 - layerBits - materialBits - meshBits - depthBits;
+
+	const float normalizedDepth = maxDepth > 0.0f ? std::clamp(depth / maxDepth, 0.0f, 1.0f) : 0.0f;
+	UINT64 quantizedDepth = (UINT64)(normalizedDepth * (float)depthMask);
+	// 메쉬는 UID의 하위 비트만 사용하므로 드물게 다른 메쉬가 섞일 수 있지만 순서에만 영향을 준다.
+	const UINT64 state = ((materialIndex & materialMask) << meshBits) | (meshID & meshMask);
+
+	UINT64 key = (layer & layerMask) << (64 - layerBits);
+	if (isBackToFront)
+	{
+		quantizedDepth = depthMask - quantizedDepth;
+		key |= quantizedDepth << (materialBits + meshBits + unusedBits);
+		key |= state << unusedBits;
+	}
+	else
+	{
+		key |= state << (depthBits + unusedBits);
+		key |= quantizedDepth << unusedBits;
+	}
+
+	return key;
+}
+
+DrawList::DrawList() { }
+
+DrawList::~DrawList() { }
+
+void DrawList::Clear()
+{
+	// 메모리는 다음 프레임에서 재사용한다.
+	records.clear();
+	totalCost = 0;
+	nonIndexedCount = 0;
+}
+
+void DrawList::Add(const DrawRecord& record)
+{
+	records.push_back(record);
+	totalCost += record.cost;
+	if (!record.isIndexed)
+		++nonIndexedCount;
+}
+
+void DrawList::Sort()
+{
+	const UINT32 recordCount = (UINT32)records.size();
+	if (recordCount <= 1)
+		return;
+
+	sortEntries.resize(recordCount);
+	ParallelFor(recordCount, sortGrainSize, [this](const UINT32 i)
+	{
+		sortEntries[i] = { records[i].sortKey, i };
+	});
+
+	RadixSort(sortEntries, sortScratch, sortHistograms, [](const SortEntry& entry) { return entry.key; });
+
+	// 레코드는 키보다 크므로 키와 인덱스만 정렬한 후 한 번에 옮긴다.
+	sortedRecords.resize(recordCount);
+	ParallelFor(recordCount, sortGrainSize, [this](const UINT32 i)
+	{
+		sortedRecords[i] = records[sortEntries[i].index];
+	});
+
+	records.swap(sortedRecords);
+}
+
+const std::vector<DrawRecord>& DrawList::GetRecords() const
+{
+	return records;
+}
+
+UINT32 DrawList::GetCount() const
+{
+	return (UINT32)records.size();
+}
+
+UINT64 DrawList::GetTotalCost() const
+{
+	return totalCost;
+}
+
+bool DrawList::IsAllIndexed() const
+{
+	return nonIndexedCount == 0;
+}
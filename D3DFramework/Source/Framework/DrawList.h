@@ -0,0 +1,95 @@
+#pragma once
+
+#include <array>
+#include <vector>
+#include <DirectXCollision.h>
+
+class Mesh;
+class Material;
+
+/*
+한 번의 그리기에 필요한 정보만을 모은 구조체
+객체를 따라가지 않고 이 레코드만으로 상수 버퍼를 바인딩하고 메쉬를 그린다.
+*/
+struct DrawRecord
+{
+	Mesh* mesh = nullptr;
+	Material* material = nullptr;
+	UINT32 cbIndex = 0;
+	// 오클루더로 사용될 때 월드 행렬을 찾기 위한 TransformStore의 인덱스
+	UINT32 transformIndex = UINT32_MAX;
+	// 그리기 비용의 추정치. 스레드마다 그릴 구간을 나눌 때 사용된다.
+	UINT32 cost = 0;
+	// Sort가 오름차순으로 정렬하는 키. MakeSortKey로 만든다.
+	UINT64 sortKey = 0;
+	// 프러스텀 컬링에 사용되는 월드 공간의 AABB
+	DirectX::BoundingBox bounds;
+	// false라면 프러스텀과 상관없이 항상 그린다.
+	bool isCullable = true;
+	bool isIndexed = true;
+};
+
+/*
+하나의 렌더 레이어에 속한 DrawRecord를 연속된 배열에 저장하는 클래스
+매 프레임 메인 스레드에서 다시 채워지며, 컬링 후 VisibleSet이 보이는 레코드들을
+추정 비용이 비슷하도록 스레드 수만큼의 구간으로 나누어 각 워커 스레드가 그린다.
+Sort로 정렬 키 순서로 레코드를 정렬해두면 각 구간은 정렬된 스트림의
+연속된 일부가 되어, 재질과 메쉬의 전환이 줄고 깊이 순서도 유지된다.
+*/
+class DrawList
+{
+public:
+	// 메쉬의 정점 혹은 인덱스 개수에 더해지는 그리기 호출당 고정 비용
+	static constexpr UINT32 drawCallCost = 256;
+
+	// 정렬 키의 각 필드의 비트 수
+	static constexpr UINT32 layerBits = 4;
+	static constexpr UINT32 materialBits = 14;
+	static constexpr UINT32 meshBits = 16;
+	static constexpr UINT32 depthBits = 24;
+
+public:
+	/*
+	상위 비트부터 레이어, 상태, 깊이 순서로 정렬 키를 만든다.
+	렌더 레이어마다 파이프라인 상태가 하나이므로 레이어가 PSO의 필드를 대신한다.
+	앞에서 뒤로: [레이어 4][재질 14][메쉬 16][깊이 24][6]   상태가 같다면 가까운 것부터 그린다.
+	뒤에서 앞으로: [레이어 4][반전된 깊이 24][재질 14][메쉬 16][6]   먼 것부터 그리는 것이 우선이다.
+	depth는 카메라 공간의 깊이이며, [0, maxDepth]로 제한된 후 양자화된다.
+	*/
+	static UINT64 MakeSortKey(const UINT32 layer, const UINT32 materialIndex, const UINT64 meshID,
+		const float depth, const float maxDepth, const bool isBackToFront);
+
+public:
+	DrawList();
+	~DrawList();
+
+public:
+	void Clear();
+	void Add(const DrawRecord& record);
+
+	// 레코드를 sortKey의 오름차순으로 안정 정렬한다. 레코드가 많다면 병렬로 정렬한다.
+	void Sort();
+
+	const std::vector<DrawRecord>& GetRecords() const;
+	UINT32 GetCount() const;
+	UINT64 GetTotalCost() const;
+	// 모든 레코드가 인덱스를 사용하여 ExecuteIndirect로 그릴 수 있는지 확인한다.
+	bool IsAllIndexed() const;
+
+private:
+	std::vector<DrawRecord> records;
+	UINT64 totalCost = 0;
+	UINT32 nonIndexedCount = 0;
+
+	struct SortEntry
+	{
+		UINT64 key;
+		UINT32 index;
+	};
+
+	// 정렬에 사용되는 작업 공간으로, 매 프레임 재사용된다.
+	std::vector<SortEntry> sortEntries;
+	std::vector<SortEntry> sortScratch;
+	std::vector<std::array<UINT32, 256>> sortHistograms;
+	std::vector<DrawRecord> sortedRecords;
+};
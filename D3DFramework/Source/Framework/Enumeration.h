@@ -27,6 +27,28 @@ enum class CollisionType : int
 	Point
 };
 
+enum class SceneQueryType : int
+{
+	Raycast = 0,
+	Sweep,
+	Overlap,
+};
+
+// 렌더링 명령을 처리하는 백엔드
+enum class RenderBackend : int
+{
+	D3D12 = 0,
+	// 창과 GPU 작업 없이 호출을 세고 검증만 하는 헤드리스 백엔드
+	Null,
+};
+
+enum class PhysicsRecordMode : int
+{
+	None = 0,
+	Record,
+	Replay,
+};
+
 enum class LightType : int
 {
 	DirectioanlLight = 0,
@@ -40,7 +62,7 @@ enum class SoundType : int
 	Sound3D,
 };
 
-// RenderLayer    Ѵ.
+// RenderLayer는 렌더할 때의 순으로 정렬한다.
 enum class RenderLayer : int
 {
 	Opaque = 0,
@@ -79,9 +101,12 @@ enum class CubeMapFace : int
 enum class RpCommon : int
 {
 	Object = 0,
+	InstanceBase,
+	Instance,
 	Pass,
 	Light,
 	Material,
+	ObjectBuffer,
 	Texture,
 	ShadowMap,
 	GBuffer,
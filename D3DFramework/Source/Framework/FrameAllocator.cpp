@@ -0,0 +1,109 @@
+#include "../PrecompiledHeader/pch.h"
+#include "FrameAllocator.h"
+#include "JobSystem.h"
+
+
+FrameAllocator::FrameAllocator(const UINT32 threadNum)
+{
+	frameSets = std::make_unique<FrameSet[]>(NUM_FRAME_RESOURCES);
+	for (UINT32 i = 0; i < NUM_FRAME_RESOURCES; ++i)
+		frameSets[i].arenas.resize(threadNum);
+}
+
+FrameAllocator* FrameAllocator::GetInstance()
+{
+	static FrameAllocator* instance = nullptr;
+	if (instance == nullptr)
+		instance = new FrameAllocator(JobSystem::GetInstance()->GetThreadNum());
+	return instance;
+}
+
+void FrameAllocator::BeginFrame()
+{
+	// 다음 세트는 NUM_FRAME_RESOURCES - 1 프레임 전에 사용된 것으로 그 렌더링은 이미 끝났다.
+	// 다른 스레드가 되돌리는 중인 세트에 할당하지 않도록 먼저 되돌린 뒤 세트를 바꾼다.
+	const UINT32 nextSet = (currentSet.load(std::memory_order_relaxed) + 1) % NUM_FRAME_RESOURCES;
+
+	FrameSet& frameSet = frameSets[nextSet];
+	for (auto& arena : frameSet.arenas)
+		ResetArena(arena);
+
+	{
+		std::lock_guard<std::mutex> lock(frameSet.sharedMutex);
+		ResetArena(frameSet.sharedArena);
+	}
+
+	currentSet.store(nextSet, std::memory_order_release);
+}
+
+void* FrameAllocator::Allocate(const size_t size, const size_t alignment)
+{
+	FrameSet& frameSet = frameSets[currentSet.load(std::memory_order_acquire)];
+
+	const UINT32 threadIndex = JobSystem::GetThreadIndex();
+	if (threadIndex < frameSet.arenas.size())
+		return AllocateFromArena(frameSet.arenas[threadIndex], size, alignment);
+
+	std::lock_guard<std::mutex> lock(frameSet.sharedMutex);
+	return AllocateFromArena(frameSet.sharedArena, size, alignment);
+}
+
+size_t FrameAllocator::GetUsedSize() const
+{
+	const FrameSet& frameSet = frameSets[currentSet.load(std::memory_order_acquire)];
+
+	size_t usedSize = frameSet.sharedArena.usedSize;
+	for (const auto& arena : frameSet.arenas)
+		usedSize += arena.usedSize;
+	return usedSize;
+}
+
+void* FrameAllocator::AllocateFromArena(Arena& arena, const size_t size, const size_t alignment)
+{
+	if (!arena.blocks.empty())
+	{
+		Block& block = arena.blocks.back();
+		const UINT_PTR base = (UINT_PTR)block.memory.get();
+		const UINT_PTR aligned = (base + arena.offset + alignment - 1) & ~(UINT_PTR)(alignment - 1);
+
+		if (aligned + size <= base + block.size)
+		{
+			arena.offset = (size_t)(aligned - base) + size;
+			arena.usedSize += size;
+			return (void*)aligned;
+		}
+	}
+
+	// 현재 블록에 공간이 없다면 새로운 블록을 추가한다.
+	Block block;
+	block.size = (std::max)(defaultBlockSize, size + alignment);
+	block.memory.reset(new BYTE[block.size]);
+
+	const UINT_PTR base = (UINT_PTR)block.memory.get();
+	const UINT_PTR aligned = (base + alignment - 1) & ~(UINT_PTR)(alignment - 1);
+
+	arena.blocks.push_back(std::move(block));
+	arena.offset = (size_t)(aligned - base) + size;
+	arena.usedSize += size;
+	return (void*)aligned;
+}
+
+void FrameAllocator::ResetArena(Arena& arena)
+{
+	if (arena.blocks.size() > 1)
+	{
+		size_t totalSize = 0;
+		for (const auto& block : arena.blocks)
+			totalSize += block.size;
+
+		arena.blocks.clear();
+
+		Block block;
+		block.size = totalSize;
+		block.memory.reset(new BYTE[block.size]);
+		arena.blocks.push_back(std::move(block));
+	}
+
+	arena.offset = 0;
+	arena.usedSize = 0;
+}
@@ -0,0 +1,113 @@
+#pragma once
+
+#include "Defines.h"
+#include <basetsd.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+/*
+한 프레임 동안만 사용하는 임시 메모리를 할당하는 선형 할당자이다.
+포인터를 앞으로 밀기만 하며 개별 해제는 없고, 프레임이 시작될 때 한 번에 되돌린다.
+NUM_FRAME_RESOURCES개의 세트를 번갈아 사용하므로 렌더링 작업이 다음 프레임까지
+이어지더라도 그 프레임에 할당한 메모리는 유효하다.
+JobSystem의 스레드마다 하나의 아레나를 가져 락 없이 할당하며,
+등록되지 않은 스레드는 락으로 보호되는 공용 아레나를 사용한다.
+*/
+class FrameAllocator
+{
+private:
+	struct Block
+	{
+		std::unique_ptr<BYTE[]> memory;
+		size_t size = 0;
+	};
+
+	// 서로 다른 스레드의 아레나가 같은 캐시 라인을 공유하지 않도록 정렬한다.
+	struct alignas(64) Arena
+	{
+		std::vector<Block> blocks;
+		// 현재 블록에서 다음에 할당할 위치
+		size_t offset = 0;
+		// 이번 프레임에 할당한 전체 크기
+		size_t usedSize = 0;
+	};
+
+	struct FrameSet
+	{
+		std::vector<Arena> arenas;
+		Arena sharedArena;
+		std::mutex sharedMutex;
+	};
+
+public:
+	FrameAllocator(const UINT32 threadNum);
+	FrameAllocator(const FrameAllocator& rhs) = delete;
+	FrameAllocator& operator=(const FrameAllocator& rhs) = delete;
+	~FrameAllocator() = default;
+
+public:
+	static FrameAllocator* GetInstance();
+
+public:
+	// 다음 세트로 넘어가고 그 세트의 메모리를 모두 되돌린다.
+	// 메인 스레드에서 프레임이 시작될 때 불려져야 한다.
+	void BeginFrame();
+
+	// 현재 스레드의 아레나에서 size바이트를 할당한다.
+	void* Allocate(const size_t size, const size_t alignment = alignof(std::max_align_t));
+
+	template<typename T>
+	T* Allocate(const size_t count)
+	{
+		return static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+	}
+
+	// 현재 세트에서 모든 스레드가 할당한 크기
+	size_t GetUsedSize() const;
+
+private:
+	void* AllocateFromArena(Arena& arena, const size_t size, const size_t alignment);
+	// 사용한 블록들을 하나로 합쳐 다음 프레임에는 블록을 추가하지 않게 한다.
+	void ResetArena(Arena& arena);
+
+private:
+	static constexpr size_t defaultBlockSize = 64 * 1024;
+
+private:
+	std::unique_ptr<FrameSet[]> frameSets;
+	std::atomic<UINT32> currentSet = 0;
+};
+
+/*
+FrameAllocator에서 메모리를 얻는 STL 할당자이다.
+해제는 아무 일도 하지 않으며, 컨테이너는 할당한 프레임 안에서만 사용해야 한다.
+*/
+template<typename T>
+class FrameAllocatorAdapter
+{
+public:
+	using value_type = T;
+
+public:
+	FrameAllocatorAdapter() noexcept = default;
+	template<typename U>
+	FrameAllocatorAdapter(const FrameAllocatorAdapter<U>&) noexcept { }
+
+public:
+	T* allocate(const size_t n)
+	{
+		return FrameAllocator::GetInstance()->Allocate<T>(n);
+	}
+
+	void deallocate(T*, const size_t) noexcept { }
+
+	template<typename U>
+	bool operator==(const FrameAllocatorAdapter<U>&) const noexcept { return true; }
+	template<typename U>
+	bool operator!=(const FrameAllocatorAdapter<U>&) const noexcept { return false; }
+};
+
+template<typename T>
+using FrameVector = std::vector<T, FrameAllocatorAdapter<T>>;
@@ -11,9 +11,9 @@ FrameResource::FrameResource(ID3D12Device* device, bool isMultiThread,
 		SYSTEM_INFO info;
 		GetSystemInfo(&info);
 
-		// Ƽ   μ  Ѵ.
+		// 멀티 스레드의 경우 프로세서 수를 저장한다.
 		processorCoreNum = isMultiThread ? info.dwNumberOfProcessors : 1;
-		// Ƽ      Ѵ.
+		// 멀티 스레드의 경우 나눌 프레임 수를 저장한다.
 		framePhase = isMultiThread ? FRAME_COUNT : 1;
 
 		isInitailize = true;
@@ -26,26 +26,28 @@ FrameResource::FrameResource(ID3D12Device* device, bool isMultiThread,
 
 		for (UINT i = 0; i < processorCoreNum; ++i)
 		{
-			// ɾ Ҵڸ Ѵ.
+			// 명령어 할당자를 생성한다.
 			ThrowIfFailed(device->CreateCommandAllocator(
 				D3D12_COMMAND_LIST_TYPE_DIRECT,
 				IID_PPV_ARGS(workerCmdAllocs[i].GetAddressOf())));
 
-			// ɾ Ʈ Ѵ.
+			// 명령어 리스트를 생성한다.
+			Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> cmdList;
 			ThrowIfFailed(device->CreateCommandList(
 				0,
 				D3D12_COMMAND_LIST_TYPE_DIRECT,
 				workerCmdAllocs[i].Get(),
 				nullptr,
-				IID_PPV_ARGS(worekrCmdLists[i].GetAddressOf())));
+				IID_PPV_ARGS(cmdList.GetAddressOf())));
+			worekrCmdLists[i].Attach(new CachedCommandList(cmdList.Get()));
 
-			// Ʈ ϱ  Ʈ ݴ´.
+			// 리스트를 리셋하기 전에 리스트를 닫는다.
 			worekrCmdLists[i]->Close();
 		}
 
-		// Ƽ    ɾ Ʈ ̸ Ƶд.
+		// 멀티 스레드 렌더링을 위한 명령어 리스트를 미리 담아둔다.
 		for (UINT i = 0; i < processorCoreNum; ++i)
-			executableCmdLists.push_back(worekrCmdLists[i].Get());
+			executableCmdLists.push_back(worekrCmdLists[i]->GetNative());
 		executableCmdLists.shrink_to_fit();
 	}
 
@@ -54,20 +56,22 @@ FrameResource::FrameResource(ID3D12Device* device, bool isMultiThread,
 
 	for (UINT i = 0; i < framePhase; ++i)
 	{
-		// ɾ Ҵڸ Ѵ.
+		// 명령어 할당자를 생성한다.
 		ThrowIfFailed(device->CreateCommandAllocator(
 			D3D12_COMMAND_LIST_TYPE_DIRECT,
 			IID_PPV_ARGS(frameCmdAllocs[i].GetAddressOf())));
 
-		// ɾ Ʈ Ѵ.
+		// 명령어 리스트를 생성한다.
+		Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> cmdList;
 		ThrowIfFailed(device->CreateCommandList(
 			0,
 			D3D12_COMMAND_LIST_TYPE_DIRECT,
 			frameCmdAllocs[i].Get(),
 			nullptr,
-			IID_PPV_ARGS(frameCmdLists[i].GetAddressOf())));
+			IID_PPV_ARGS(cmdList.GetAddressOf())));
+		frameCmdLists[i].Attach(new CachedCommandList(cmdList.Get()));
 
-		// Ʈ ϱ  Ʈ ݴ´.
+		// 리스트를 리셋하기 전에 리스트를 닫는다.
 		frameCmdLists[i]->Close();
 	}
 
@@ -80,6 +84,9 @@ FrameResource::FrameResource(ID3D12Device* device, bool isMultiThread,
 	particlePool = std::make_unique<BufferMemoryPool<ParticleConstants>>(device, particleCount, true);
 	terrainPool = std::make_unique<BufferMemoryPool<TerrainConstants>>(device, 1, true);
 	ssrPool = std::make_unique<BufferMemoryPool<SsrConstants>>(device, 1, true);
+	// 객체의 수가 정해진 후 UpdateInstanceBufferPool에서 채워진다.
+	instancePool = std::make_unique<BufferMemoryPool<UINT32>>(device, 0, false);
+	indirectPool = std::make_unique<BufferMemoryPool<IndirectDrawCommand>>(device, 0, false);
 }
 
 FrameResource::~FrameResource() 
@@ -99,6 +106,9 @@ FrameResource::~FrameResource()
 	particlePool = nullptr;
 	terrainPool = nullptr;
 	ssrPool = nullptr;
+	instancePool = nullptr;
+	indirectPool = nullptr;
 
 	widgetVBs.clear();
+	clothVBs.clear();
 }
\ No newline at end of file
@@ -2,11 +2,13 @@
 
 #include "BufferMemoryPool.hpp"
 #include "D3DStructure.h"
+#include "CachedCommandList.h"
+#include "IndirectDraw.h"
 #include <wrl.h>
 #include <vector>
 
 /*
-CPU    ϵ ϴ  ʿ ڿ ǥϴ ü
+CPU가 한 프레임의 명령 목록들을 구축하는 데 필요한 자원들을 대표하는 구조체
 */
 struct FrameResource
 {
@@ -37,30 +39,36 @@ public:
 		if (terrainPool->GetBuffer()) return terrainPool->GetBuffer()->GetResource()->GetGPUVirtualAddress(); return NULL; }
 	D3D12_GPU_VIRTUAL_ADDRESS GetSsrVirtualAddress() const {
 		if (ssrPool->GetBuffer()) return ssrPool->GetBuffer()->GetResource()->GetGPUVirtualAddress(); return NULL; }
+	D3D12_GPU_VIRTUAL_ADDRESS GetInstanceVirtualAddress() const {
+		if (instancePool->GetBuffer()) return instancePool->GetBuffer()->GetResource()->GetGPUVirtualAddress(); return NULL; }
+	ID3D12Resource* GetIndirectArgumentBuffer() const {
+		if (indirectPool->GetBuffer()) return indirectPool->GetBuffer()->GetResource(); return nullptr; }
  
 public:
 	static inline UINT32 processorCoreNum = 0;
 	static inline UINT32 framePhase = 0;
 	static inline bool isInitailize = false;
 
-	// Ƽ   ϱ  ɾ ü
-	std::vector<Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>> worekrCmdLists;
+	// 멀티 스레드 렌더링을 하기 위한 명령어 객체들
+	// 명령어 리스트는 중복된 상태 설정을 걸러내는 CachedCommandList로 감싸져 있으며,
+	// 명령 큐에는 GetNative로 얻은 실제 명령어 리스트를 제출한다.
+	std::vector<Microsoft::WRL::ComPtr<CachedCommandList>> worekrCmdLists;
 	std::vector<Microsoft::WRL::ComPtr<ID3D12CommandAllocator>> workerCmdAllocs;
-	//  ӿ  ɾ ü
-	// Ƽ   FRAME_COUNTŭ  ɾ ϱ
-	// ̱  ϳ ɾ ü鸸 ȴ.
-	std::vector<Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList>> frameCmdLists;
+	// 한 프레임에서 사용할 명령어 객체들
+	// 멀티 스레드의 경우 FRAME_COUNT만큼 나누어 명령어를 수행하기
+	// 싱글 스레드라면 하나의 명령어 객체들만이 사용된다.
+	std::vector<Microsoft::WRL::ComPtr<CachedCommandList>> frameCmdLists;
 	std::vector<Microsoft::WRL::ComPtr<ID3D12CommandAllocator>> frameCmdAllocs;
-	// Ƽ    ɾ Ʈ cmdList->ExcuteCommandLists
-	// ѹ ϱ Ͽ ̸ ɾ Ʈ ּҵ Ƶд.
+	// 멀티 스레드 렌더링에서 사용될 명령어 리스트들을 cmdList->ExcuteCommandLists에서
+	// 한번에 제출하기 위하여 미리 명령어 리스트 주소들을 담아둔다.
 	std::vector<ID3D12CommandList*> executableCmdLists;
 
-	// Fence  Ÿ  ɵ ǥϴ ̴.
-	//   GPU    ڿ ϰ ִ ϴ 뵵 δ.
+	// Fence는 현재 울타리 지점까지의 명령들을 표시하는 값이다.
+	// 이 값은 GPU가 아직 이 프레임 자원들을 사용하고 있는지 판정하는 용도로 쓰인다.
 	UINT64 fence = 0;
 
-	//  ۴ װ ϴ ɵ GPU  ó Ŀ ؾ Ѵ.
-	//  Ӹ  ۸   Ѵ.
+	// 상수 버퍼는 그것을 참조하는 명령들을 GPU가 다 처리한 후에 갱신해야 한다.
+	// 따라서 프레임마다 상수 버퍼를 새로 만들어야 한다.
 	std::unique_ptr<BufferMemoryPool<PassConstants>> passPool = nullptr;
 	std::unique_ptr<BufferMemoryPool<ObjectConstants>> objectPool = nullptr;
 	std::unique_ptr<BufferMemoryPool<LightData>> lightBufferPool = nullptr;
@@ -71,8 +79,20 @@ public:
 	std::unique_ptr<BufferMemoryPool<TerrainConstants>> terrainPool = nullptr;
 	std::unique_ptr<BufferMemoryPool<SsrConstants>> ssrPool = nullptr;
 
-	//    ۸ Ѵ.
-	//   ۸  Ӹ  ۰   Ƿ
-	//  ڿ ϰ,   ۸ ϱ  ͷ Ѵ.
+	// 셰이더가 인스턴스마다 읽을 객체 상수의 인덱스
+	// 앞의 instanceIdentityCount개는 i번째 원소가 i로, 묶이지 않은 그리기가 객체의 인덱스를 바로 가리킨다.
+	// 나머지는 매 프레임 인스턴싱 그리기마다 예약되어 보이는 객체들의 인덱스가 채워진다.
+	std::unique_ptr<BufferMemoryPool<UINT32>> instancePool = nullptr;
+	UINT32 instanceIdentityCount = 0;
+
+	// CPU가 컬링 후에 채우는 ExecuteIndirect의 인자 버퍼
+	// 프레임 자원마다 하나씩 있으므로 NUM_FRAME_RESOURCES개의 버퍼가 링처럼 돌아가며 쓰인다.
+	std::unique_ptr<BufferMemoryPool<IndirectDrawCommand>> indirectPool = nullptr;
+
+	// 위젯은 동적 정점 버퍼를 사용한다.
+	// 동적 정점 버퍼를 각 프레임마다 정점 버퍼가 변할 수 있으므로
+	// 프레임 자원에 선언하고, 여러 정점 버퍼를 수용하기 위해 벡터로 관리한다.
 	std::vector<std::unique_ptr<UploadBuffer<WidgetVertex>>> widgetVBs;
+	// 천 역시 매 프레임 CPU에서 정점을 만들어 동적 정점 버퍼에 쓴다.
+	std::vector<std::unique_ptr<UploadBuffer<Vertex>>> clothVBs;
 };
\ No newline at end of file
@@ -14,13 +14,13 @@ GameTimer::GameTimer()
 	mSecondsPerCount = 1.0 / (double)countsPerSec;
 }
 
-// Reset ȣ  帥ð Ͻ  ð  ð ش.
+// Reset이 호출된 이후 흐른시간에서 일시 정지된 시간을 제외한 시간을 돌려준다.
 float GameTimer::GetTotalTime()const
 {
-	// Ÿ̸Ӱ  ̸,   帥 ð  ƾ Ѵ.
-	// ,  ̹ Ͻ   ִٸ ð mStopTime - mBasetime
-	// Ͻ   ð ԵǾ մµ,   ð ü ð 
-	// ƾ Ѵ. ̸ ٷ , mStopTime Ͻ   ð .
+	// 타이머가 정지 상태이면, 정지된 시점부터 흐른 시간은 계산하지 말아야 한다.
+	// 또한, 이전에 이미 일시 정지된 적이 있다면 시간차 mStopTime - mBasetime에는
+	// 일시 정지 누적 시간이 포함되어 잇는데, 그 누적 시간은 전체 시간에 포함하지
+	// 말아야 한다. 이를 바로잡기 위해, mStopTime에서 일시 정지 누적 시간을 뺀다.
 	//
 	//                     |<--paused time-->|
 	// ----*---------------*-----------------*------------*------------*------> time
@@ -31,8 +31,8 @@ float GameTimer::GetTotalTime()const
 		return (float)(((mStopTime - mPausedTime)-mBaseTime)*mSecondsPerCount);
 	}
 
-	// ð mCurrentTime - mBaseTime Ͻ   ð ԵǾ ִ.
-	// ̸ ü ð ϸ  ǹǷ,  ð mCurrTime .
+	// 시간차 mCurrentTime - mBaseTime에는 일시 정지 누적 시간이 포함되어 있다.
+	// 이를 전체 시간에 포함하면 안 되므로, 그 시간을 mCurrTime에서 뺀다.
 	//  (mCurrTime - mPausedTime) - mBaseTime 
 	//
 	//                     |<--paused time-->|
@@ -67,24 +67,24 @@ void GameTimer::Start()
 	QueryPerformanceCounter((LARGE_INTEGER*)&startTime);
 
 
-	// (Ͻ ) (簳) ̿ 帥 ð Ѵ.
+	// 정지(일시 정지)와 시작(재개) 사이에 흐른 시간을 누적한다.
 	//
 	//                     |<-------d------->|
 	// ----*---------------*-----------------*------------> time
 	//  mBaseTime       mStopTime        startTime     
 
-	//  ¿ Ÿ̸Ӹ 簳ϴ 
+	// 정지 상태에서 타이머를 재개하는 경우
 	if( mStopped )
 	{
-		// Ͻ  ð Ѵ.
+		// 일시 정지된 시간을 누적한다.
 		mPausedTime += (startTime - mStopTime);	
 
-		// Ÿ̸Ӹ ٽ ϴ ̹Ƿ,  mPrevtime( ð)
-		// ȿ ʴ(Ͻ  ߿ ŵǾ ̹Ƿ).
-		//   ð ٽ Ѵ.
+		// 타이머를 다시 시작하는 것이므로, 현재의 mPrevtime(이전 시간)은
+		// 유효하지 않다(일시 정지 도중에 갱신되었을 것이므로).
+		// 따라서 현재 시간으로 다시 설정한다.
 		mPrevTime = startTime;
 
-		//   ° ƴϹǷ   Ѵ.
+		// 이제는 정지 상태가 아니므로 관련 멤버들을 갱신한다.
 		mStopTime = 0;
 		mStopped  = false;
 	}
@@ -92,14 +92,14 @@ void GameTimer::Start()
 
 void GameTimer::Stop()
 {
-	//  ̸ ƹ ϵ  ʴ´.
+	// 정지 상태이면 아무 일도 하지 않는다.
 	if( !mStopped )
 	{
 		__int64 currTime;
 		QueryPerformanceCounter((LARGE_INTEGER*)&currTime);
 
-		// ׷ ʴٸ  ð Ÿ̸   ð ϰ,
-		// Ÿ̸Ӱ Ǿ ϴ ο ÷׸ Ѵ.
+		// 그렇지 않다면 현재 시간을 타이머 정지 시점 시간으로 저장하고,
+		// 타이머가 정지되었음을 뜻하는 부울 플래그를 설정한다.
 		mStopTime = currTime;
 		mStopped  = true;
 	}
@@ -113,20 +113,20 @@ void GameTimer::Tick()
 		return;
 	}
 
-	// ̹  ð ´.
+	// 이번 프레임의 시간을 얻는다.
 	INT64 currTime;
 	QueryPerformanceCounter((LARGE_INTEGER*)&currTime);
 	mCurrentTime = currTime;
 
-	// ̹  ð   ð ̸ Ѵ.
+	// 이번 프레임의 시간과 이전 프레임의 시간의 차이를 구한다.
 	mDeltaTime = (mCurrentTime - mPrevTime)*mSecondsPerCount;
 
-	//   غѴ.
+	// 다음 프레임을 준비한다.
 	mPrevTime = mCurrentTime;
 
-	//   ʰ Ѵ. SDK ȭ CDXUTTimer ׸ ,
-	// μ  忡 ų  Ǵ ٸ μ
-	// Ű  mDeltaTime    ִ.
+	// 음수가 되지 않게 한다. SDK 문서화이 CDXUTTimer 항목에 따르면,
+	// 프로세서가 절전 모드에 들어가거나 실행이 되는 다른 프로세서와
+	// 엉키는 경우 mDeltaTime이 음수가 될 수 있다.
 	if(mDeltaTime < 0.0)
 	{
 		mDeltaTime = 0.0;
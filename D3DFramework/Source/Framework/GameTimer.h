@@ -7,22 +7,22 @@
 #include <basetsd.h>
 
 /*
- ð Ѵ.
- ۵  ð  ϸ   ð ,
-   ð,     Ѵ.
+게임의 시간을 측정한다.
+게임이 시작될 때부터 시간 측정을 시작하며 프레임 간 시간 차,
+게임이 시작한 후의 시간, 게임 정지 등의 역할을 한다.
 */
 class GameTimer
 {
 public:
 	GameTimer();
 
-	float GetTotalTime() const; //  
-	float GetDeltaTime() const; //  
+	float GetTotalTime() const; // 초 단위
+	float GetDeltaTime() const; // 초 단위
 
-	void Reset(); // Loop  θ.
-	void Start(); //  , θ.
-	void Stop();  //  , θ.
-	void Tick();  //  Ӹ θ.
+	void Reset(); // Loop 이전에 부른다.
+	void Start(); // 시작할 때, 부른다.
+	void Stop();  // 정지할 때, 부른다.
+	void Tick();  // 매 프레임마다 부른다.
 
 private:
 	double mSecondsPerCount;
@@ -0,0 +1,61 @@
+#include "../PrecompiledHeader/pch.h"
+#include "IndirectDraw.h"
+#include "DrawList.h"
+#include "../Component/Mesh.h"
+
+IndirectDrawBatch BuildIndirectDrawCommands(const DrawRecord* records, const UINT32* visibleIndices, const UINT32 begin, const UINT32 end,
+	IndirectDrawCommand* commands, UINT32* instanceIndices, const UINT32 instanceOffset)
+{
+	IndirectDrawBatch batch;
+	if (begin >= end)
+	{
+		batch.recordEnd = end;
+		return batch;
+	}
+
+	batch.primitiveType = records[visibleIndices[begin]].mesh->GetPrimitiveType();
+
+	UINT32 groupBegin = begin;
+	while (groupBegin < end)
+	{
+		const DrawRecord& first = records[visibleIndices[groupBegin]];
+		const Mesh* mesh = first.mesh;
+		if (mesh->GetPrimitiveType() != batch.primitiveType)
+			break;
+
+		// 인스턴싱 그리기와 같은 기준으로 묶는다.
+		UINT32 groupEnd = groupBegin + 1;
+		while (groupEnd < end && records[visibleIndices[groupEnd]].mesh == mesh && records[visibleIndices[groupEnd]].material == first.material)
+			++groupEnd;
+
+		const UINT32 groupSize = groupEnd - groupBegin;
+		if (mesh->GetIndexCount() > 0)
+		{
+			IndirectDrawCommand& command = commands[batch.commandCount++];
+			command.vertexBufferView = mesh->GetVertexBufferView();
+			command.indexBufferView = mesh->GetIndexBufferView();
+			command.drawArguments.IndexCountPerInstance = mesh->GetIndexCount();
+			command.drawArguments.InstanceCount = groupSize;
+			command.drawArguments.StartIndexLocation = 0;
+			command.drawArguments.BaseVertexLocation = 0;
+			command.drawArguments.StartInstanceLocation = 0;
+
+			if (groupSize == 1)
+			{
+				// 하나뿐이라면 identity 구간의 자신을 가리킨다.
+				command.instanceBase = first.cbIndex;
+			}
+			else
+			{
+				command.instanceBase = instanceOffset + batch.instanceCount;
+				for (UINT32 i = groupBegin; i < groupEnd; ++i)
+					instanceIndices[batch.instanceCount++] = records[visibleIndices[i]].cbIndex;
+			}
+		}
+
+		groupBegin = groupEnd;
+	}
+
+	batch.recordEnd = groupBegin;
+	return batch;
+}
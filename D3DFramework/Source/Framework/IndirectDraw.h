@@ -0,0 +1,47 @@
+#pragma once
+
+struct DrawRecord;
+
+/*
+ExecuteIndirect로 제출되는 한 번의 그리기 인자
+명령 서명의 인자 순서와 같게 배치되며, 그대로 인자 버퍼에 쓰인다.
+메쉬마다 정점 버퍼와 인덱스 버퍼가 다르므로 버퍼 뷰도 명령마다 바꾼다.
+*/
+struct IndirectDrawCommand
+{
+	D3D12_VERTEX_BUFFER_VIEW vertexBufferView;
+	D3D12_INDEX_BUFFER_VIEW indexBufferView;
+	// 셰이더가 gInstanceIndices에서 읽기 시작할 위치로, 루트 상수로 설정된다.
+	UINT32 instanceBase;
+	D3D12_DRAW_INDEXED_ARGUMENTS drawArguments;
+};
+
+// 명령 서명의 ByteStride와 같아야 하므로 구조체에 빈틈이 없어야 한다.
+static_assert(sizeof(IndirectDrawCommand) == sizeof(D3D12_VERTEX_BUFFER_VIEW) + sizeof(D3D12_INDEX_BUFFER_VIEW) +
+	sizeof(UINT32) + sizeof(D3D12_DRAW_INDEXED_ARGUMENTS));
+
+// BuildIndirectDrawCommands가 한 번에 만든 명령들의 정보
+struct IndirectDrawBatch
+{
+	// 명령들이 사용하는 위상 구조. 명령으로 바꿀 수 없으므로 ExecuteIndirect 전에 설정한다.
+	D3D12_PRIMITIVE_TOPOLOGY primitiveType = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	// 처리한 visibleIndices의 끝. 다음 호출은 여기서부터 시작한다.
+	UINT32 recordEnd = 0;
+	UINT32 commandCount = 0;
+	// instanceIndices에 쓴 인덱스의 개수
+	UINT32 instanceCount = 0;
+};
+
+/*
+컬링 단계가 남긴 visibleIndices의 [begin, end) 구간이 가리키는 레코드들로 그리기 인자를 만든다.
+메쉬와 재질이 같은 연속된 레코드들은 하나의 인스턴싱 명령으로 묶고, 객체의 인덱스를
+instanceIndices에 차례로 쓴다. 레코드가 하나뿐인 묶음은 인덱스를 쓰지 않고
+identity 구간의 자신의 인덱스(cbIndex)를 instanceBase로 가리킨다.
+instanceIndices[0]은 인스턴스 버퍼의 instanceOffset번째 원소이며, commands와 instanceIndices는
+각각 end - begin개 이상의 공간이 있어야 한다.
+위상 구조가 다른 메쉬를 만나면 그 앞에서 멈추므로 recordEnd가 end가 될 때까지 다시 부른다.
+모든 레코드는 인덱스를 사용하여야 한다.
+D3D12 장치나 명령어 리스트 없이 CPU 메모리에만 쓰므로 따로 떼어 검증할 수 있다.
+*/
+IndirectDrawBatch BuildIndirectDrawCommands(const DrawRecord* records, const UINT32* visibleIndices, const UINT32 begin, const UINT32 end,
+	IndirectDrawCommand* commands, UINT32* instanceIndices, const UINT32 instanceOffset);
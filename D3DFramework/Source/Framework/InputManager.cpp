@@ -4,6 +4,7 @@
 #include "Camera.h"
 #include "Physics.h"
 #include "D3DDebug.h"
+#include "SceneQuery.h"
 
 InputManager::InputManager()
 {
@@ -30,15 +31,15 @@ void InputManager::OnMouseDown(WPARAM btnState, int x, int y)
 		lastMousePos.x = x;
 		lastMousePos.y = y;
 
-		// 콺  ʰ Ѵ.
+		// 마우스를 보이지 않게 한다.
 		::SetCursor(NULL);
 
 		SetCapture(D3DFramework::GetInstance()->GetMainWnd());
 	}
 	else if ((btnState & MK_RBUTTON) != 0)
 	{
-		HitInfo hitInfo;
-		bool result = D3DFramework::GetInstance()->Picking(hitInfo, x, y);
+		// 결과는 질의가 끝난 뒤 D3DFramework에서 확인한다.
+		D3DFramework::GetInstance()->Picking(x, y);
 	}
 }
 
@@ -51,14 +52,14 @@ void InputManager::OnMouseMove(WPARAM btnState, int x, int y)
 {
 	Camera* camera = D3DFramework::GetInstance()->GetCamera();
 
-	//  콺 ư ٸ ī޶ ȸŲ.
+	// 왼쪽 마우스 버튼이 눌려졌다면 카메라를 회전시킨다.
 	if ((btnState & MK_LBUTTON) != 0)
 	{
-		// 1ȼ ӿ cameraRotateSpeedŭ ȸѴ.
+		// 1픽셀 움직임에 cameraRotateSpeed만큼 회전한다.
 		float dx =  static_cast<float>(x - lastMousePos.x);
 		float dy =  static_cast<float>(y - lastMousePos.y);
 
-		// ȸ  ̴.
+		// 회전의 단위는 라디안이다.
 		camera->RotateY(dx);
 		camera->Pitch(dy);
 	}
@@ -69,7 +70,7 @@ void InputManager::OnMouseMove(WPARAM btnState, int x, int y)
 
 void InputManager::OnKeyDown(unsigned int input)
 {
-	// input ׻ ڸ  ʴ´ٴ  Ѵ.
+	// input이 항상 문자만 들어오지 않는다는 것을 주의한다.
 	keys[input] = true;
 }
 
@@ -3,7 +3,7 @@
 #include <Windows.h>
 
 /*
-÷̾ Է¿  ൿ Ѵ.
+플레이어의 입력에 관한 행동들을 관리한다.
 */
 class InputManager
 {
@@ -23,9 +23,9 @@ public:
 	static InputManager* GetInstance();
 
 public:
-	//  Ű ƽŰ ڵ ŭ Ѵ.
-	//  Ű      ִ.
+	// 눌린 키를 아스키 코드의 수만큼 보관한다.
+	// 따라서 키의 모든 값을 가지고 있을 수 있다.
 	static inline bool keys[256];
-	//  ġ 콺 ġ 
+	// 마지막에 위치한 마우스 위치 값
 	static inline POINT lastMousePos;
 };
\ No newline at end of file
@@ -0,0 +1,182 @@
+#include "../PrecompiledHeader/pch.h"
+#include "JobSystem.h"
+
+
+JobSystem::JobSystem(const UINT32 workerNum) : globalQueue(queueCapacity)
+{
+	// 생성한 스레드를 0번 스레드로 등록한다.
+	threadIndex = 0;
+
+	queues.reserve(workerNum + 1);
+	for (UINT32 i = 0; i < workerNum + 1; ++i)
+		queues.emplace_back(std::make_unique<WorkStealingQueue<Job*>>(queueCapacity));
+
+	workerThreads.reserve(workerNum);
+	for (UINT32 i = 1; i <= workerNum; ++i)
+		workerThreads.emplace_back([this, i]() { this->WorkerThread(i); });
+}
+
+JobSystem::~JobSystem()
+{
+	Shutdown();
+}
+
+JobSystem* JobSystem::GetInstance()
+{
+	static JobSystem* instance = nullptr;
+	if (instance == nullptr)
+	{
+		// 메인 스레드가 작업에 참여하므로 코어의 개수보다 하나 적은 워커 스레드를 만든다.
+		const UINT32 coreNum = (std::max)(std::thread::hardware_concurrency(), 1u);
+		instance = new JobSystem(coreNum - 1);
+	}
+	return instance;
+}
+
+void JobSystem::Run(std::function<void()>&& function, JobCounter* counter, JobCounter* dependency)
+{
+	if (counter)
+		counter->value.fetch_add(1, std::memory_order_relaxed);
+
+	Job* job = new Job{ std::move(function), counter };
+
+	if (dependency)
+	{
+		// 아직 끝나지 않았다면 카운터가 0이 될 때 Finish에서 추가된다.
+		std::lock_guard<std::mutex> lock(dependency->mutex);
+		if (!dependency->IsDone())
+		{
+			dependency->continuations.push_back(job);
+			return;
+		}
+	}
+
+	Submit(job);
+}
+
+void JobSystem::Wait(JobCounter& counter)
+{
+	while (!counter.IsDone())
+	{
+		Job* job = GetJob();
+		if (job)
+			Execute(job);
+		else
+			std::this_thread::yield();
+	}
+
+	// 마지막 작업의 Finish가 카운터를 다 사용할 때까지 기다려야 카운터를 안전하게 파괴할 수 있다.
+	std::lock_guard<std::mutex> lock(counter.mutex);
+}
+
+void JobSystem::Shutdown()
+{
+	if (!isRunning.exchange(false))
+		return;
+
+	queuedJobNum.fetch_add(1, std::memory_order_release);
+	queuedJobNum.notify_all();
+
+	for (auto& thread : workerThreads)
+		thread.join();
+	workerThreads.clear();
+}
+
+UINT32 JobSystem::GetThreadNum() const
+{
+	return (UINT32)queues.size();
+}
+
+UINT32 JobSystem::GetThreadIndex()
+{
+	return threadIndex;
+}
+
+void JobSystem::WorkerThread(const UINT32 threadIndex)
+{
+	JobSystem::threadIndex = threadIndex;
+
+	while (isRunning.load(std::memory_order_acquire))
+	{
+		Job* job = GetJob();
+		if (job)
+		{
+			Execute(job);
+			continue;
+		}
+
+		// 할 일이 없다면 새로운 작업이 추가될 때까지 잠든다.
+		queuedJobNum.wait(0, std::memory_order_acquire);
+	}
+}
+
+void JobSystem::Submit(Job* job)
+{
+	// 워커 스레드가 모두 종료되었다면 바로 실행한다.
+	if (!isRunning.load(std::memory_order_acquire))
+	{
+		Execute(job);
+		return;
+	}
+
+	bool isPushed = false;
+	if (threadIndex != invalidThreadIndex)
+		isPushed = queues[threadIndex]->Push(job);
+	if (!isPushed)
+		isPushed = globalQueue.Push(std::move(job));
+
+	// 모든 큐가 가득 찼다면 바로 실행한다.
+	if (!isPushed)
+	{
+		Execute(job);
+		return;
+	}
+
+	queuedJobNum.fetch_add(1, std::memory_order_release);
+	queuedJobNum.notify_one();
+}
+
+Job* JobSystem::GetJob()
+{
+	Job* job = nullptr;
+	bool isFound = false;
+
+	// 자신의 덱, 전역 큐, 다른 스레드의 덱 순서로 작업을 찾는다.
+	if (threadIndex != invalidThreadIndex)
+		isFound = queues[threadIndex]->Pop(job);
+	if (!isFound)
+		isFound = globalQueue.Pop(job);
+
+	const UINT32 queueNum = (UINT32)queues.size();
+	const UINT32 startIndex = threadIndex != invalidThreadIndex ? threadIndex : 0;
+	for (UINT32 i = 1; i <= queueNum && !isFound; ++i)
+		isFound = queues[(startIndex + i) % queueNum]->Steal(job);
+
+	if (!isFound)
+		return nullptr;
+
+	queuedJobNum.fetch_sub(1, std::memory_order_relaxed);
+	return job;
+}
+
+void JobSystem::Execute(Job* job)
+{
+	job->function();
+
+	if (job->counter)
+		Finish(job->counter);
+	delete job;
+}
+
+void JobSystem::Finish(JobCounter* counter)
+{
+	std::vector<Job*> continuations;
+	{
+		std::lock_guard<std::mutex> lock(counter->mutex);
+		if (counter->value.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			continuations.swap(counter->continuations);
+	}
+
+	for (Job* job : continuations)
+		Submit(job);
+}
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "WorkStealingQueue.hpp"
+#include "LockFreeQueue.hpp"
+#include <basetsd.h>
+#include <algorithm>
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class JobSystem;
+struct Job;
+
+/*
+작업이 끝났는지 확인하기 위한 카운터
+Run에 넘겨진 작업의 개수만큼 증가하고, 작업이 끝날 때마다 감소한다.
+카운터가 0이 되면 이 카운터에 의존하는 작업들이 실행된다.
+*/
+class JobCounter
+{
+public:
+	JobCounter() = default;
+	JobCounter(const JobCounter& rhs) = delete;
+	JobCounter& operator=(const JobCounter& rhs) = delete;
+	~JobCounter() = default;
+
+public:
+	bool IsDone() const { return value.load(std::memory_order_acquire) == 0; }
+
+private:
+	friend class JobSystem;
+
+	std::atomic<UINT32> value = 0;
+	// 카운터가 0이 될 때까지 미뤄진 작업들
+	std::mutex mutex;
+	std::vector<Job*> continuations;
+};
+
+struct Job
+{
+	std::function<void()> function;
+	JobCounter* counter = nullptr;
+};
+
+/*
+작업 훔치기 방식의 작업 스케쥴러
+스레드마다 Chase-Lev 덱을 가지며, 자신의 덱에서 작업을 꺼내고
+비어있다면 전역 큐를 확인한 뒤 다른 스레드의 덱에서 작업을 훔쳐온다.
+처음 GetInstance를 호출한 스레드(메인 스레드)는 0번 스레드로 등록되어
+Wait하는 동안 다른 작업들을 대신 실행한다. 등록되지 않은 스레드에서 추가된 작업은 전역 큐에 들어간다.
+*/
+class JobSystem
+{
+public:
+	JobSystem(const UINT32 workerNum);
+	JobSystem(const JobSystem& rhs) = delete;
+	JobSystem& operator=(const JobSystem& rhs) = delete;
+	~JobSystem();
+
+public:
+	static JobSystem* GetInstance();
+
+public:
+	// 작업을 추가한다. counter가 있다면 작업이 끝날 때 감소하며,
+	// dependency가 있다면 dependency가 0이 된 후에 작업이 실행된다.
+	void Run(std::function<void()>&& function, JobCounter* counter = nullptr, JobCounter* dependency = nullptr);
+	// counter가 0이 될 때까지 다른 작업들을 실행하며 기다린다.
+	void Wait(JobCounter& counter);
+
+	// [0, count) 구간을 grainSize개씩 작업으로 나누어 func(index)를 호출하고 모두 끝날 때까지 기다린다.
+	template<typename Func>
+	void ParallelFor(const UINT32 count, const UINT32 grainSize, Func&& func);
+
+	// 워커 스레드들을 종료한다. 이후 추가된 작업은 호출한 스레드에서 바로 실행된다.
+	void Shutdown();
+
+	// 메인 스레드를 포함한 전체 스레드의 개수
+	UINT32 GetThreadNum() const;
+	// 현재 스레드의 번호로, JobSystem의 스레드가 아니라면 invalidThreadIndex이다.
+	static UINT32 GetThreadIndex();
+
+public:
+	static constexpr UINT32 invalidThreadIndex = UINT32_MAX;
+
+private:
+	void WorkerThread(const UINT32 threadIndex);
+
+	void Submit(Job* job);
+	Job* GetJob();
+	void Execute(Job* job);
+	void Finish(JobCounter* counter);
+
+private:
+	static constexpr size_t queueCapacity = 4096;
+	static inline thread_local UINT32 threadIndex = invalidThreadIndex;
+
+private:
+	std::vector<std::unique_ptr<WorkStealingQueue<Job*>>> queues;
+	LockFreeQueue<Job*> globalQueue;
+	std::vector<std::thread> workerThreads;
+
+	// 큐에 들어있는 작업의 개수로, 워커 스레드는 0이라면 잠든다.
+	std::atomic<INT32> queuedJobNum = 0;
+	std::atomic<bool> isRunning = true;
+};
+
+template<typename Func>
+void JobSystem::ParallelFor(const UINT32 count, const UINT32 grainSize, Func&& func)
+{
+	if (count == 0)
+		return;
+
+	JobCounter counter;
+	for (UINT32 begin = 0; begin < count; begin += grainSize)
+	{
+		const UINT32 end = (std::min)(begin + grainSize, count);
+		Run([&func, begin, end]()
+		{
+			for (UINT32 i = begin; i < end; ++i)
+				func(i);
+		}, &counter);
+	}
+
+	Wait(counter);
+}
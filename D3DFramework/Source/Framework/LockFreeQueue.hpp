@@ -0,0 +1,113 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cassert>
+
+/*
+여러 스레드가 동시에 넣고 뺄 수 있는 크기가 고정된 큐이다.
+각 칸마다 순번을 두어 락 없이 CAS만으로 위치를 예약한다.
+용량은 반드시 2의 제곱수이어야 한다.
+*/
+template <typename T>
+class LockFreeQueue
+{
+private:
+	struct Cell
+	{
+		std::atomic<size_t> sequence;
+		T data;
+	};
+
+public:
+	LockFreeQueue(const size_t capacity) : mask(capacity - 1)
+	{
+		assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+
+		buffer = std::make_unique<Cell[]>(capacity);
+		for (size_t i = 0; i < capacity; ++i)
+			buffer[i].sequence.store(i, std::memory_order_relaxed);
+
+		enqueuePos.store(0, std::memory_order_relaxed);
+		dequeuePos.store(0, std::memory_order_relaxed);
+	}
+	LockFreeQueue(const LockFreeQueue& rhs) = delete;
+	LockFreeQueue& operator=(const LockFreeQueue& rhs) = delete;
+	~LockFreeQueue() { }
+
+public:
+	// 큐가 가득 찼다면 false를 반환한다.
+	bool Push(T&& data)
+	{
+		Cell* cell;
+		size_t pos = enqueuePos.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			cell = &buffer[pos & mask];
+			size_t seq = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)pos;
+
+			// 비어있는 칸이라면 위치를 예약한다.
+			if (diff == 0)
+			{
+				if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			// 한 바퀴 돌아 아직 읽히지 않은 칸을 만났다면 큐가 가득 찬 것이다.
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = enqueuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		cell->data = std::move(data);
+		cell->sequence.store(pos + 1, std::memory_order_release);
+		return true;
+	}
+
+	// 큐가 비어있다면 false를 반환한다.
+	bool Pop(T& data)
+	{
+		Cell* cell;
+		size_t pos = dequeuePos.load(std::memory_order_relaxed);
+
+		while (true)
+		{
+			cell = &buffer[pos & mask];
+			size_t seq = cell->sequence.load(std::memory_order_acquire);
+			intptr_t diff = (intptr_t)seq - (intptr_t)(pos + 1);
+
+			// 데이터가 채워진 칸이라면 위치를 예약한다.
+			if (diff == 0)
+			{
+				if (dequeuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+					break;
+			}
+			else if (diff < 0)
+			{
+				return false;
+			}
+			else
+			{
+				pos = dequeuePos.load(std::memory_order_relaxed);
+			}
+		}
+
+		data = std::move(cell->data);
+		cell->sequence.store(pos + mask + 1, std::memory_order_release);
+		return true;
+	}
+
+private:
+	std::unique_ptr<Cell[]> buffer;
+	const size_t mask;
+
+	// 넣는 쪽과 빼는 쪽이 서로 다른 캐시 라인을 사용하도록 한다.
+	alignas(64) std::atomic<size_t> enqueuePos;
+	alignas(64) std::atomic<size_t> dequeuePos;
+};
@@ -0,0 +1,1488 @@
+#include "../PrecompiledHeader/pch.h"
+#include "NullDevice.h"
+
+// 새로 만든 객체에서 요청한 인터페이스를 얻고, 생성할 때의 참조를 놓는다.
+template<typename T>
+static HRESULT QueryNewObject(T* obj, REFIID riid, void** ppvObject)
+{
+	// 출력 포인터가 없다면 생성할 수 있는지만 확인하는 호출이다.
+	if (ppvObject == nullptr)
+	{
+		obj->Release();
+		return S_FALSE;
+	}
+
+	const HRESULT result = obj->QueryInterface(riid, ppvObject);
+	obj->Release();
+	return result;
+}
+
+static bool IsCpuAccessible(const D3D12_HEAP_PROPERTIES& heapProperties)
+{
+	switch (heapProperties.Type)
+	{
+	case D3D12_HEAP_TYPE_UPLOAD:
+	case D3D12_HEAP_TYPE_READBACK:
+		return true;
+	case D3D12_HEAP_TYPE_CUSTOM:
+		return heapProperties.CPUPageProperty != D3D12_CPU_PAGE_PROPERTY_NOT_AVAILABLE;
+	default:
+		return false;
+	}
+}
+
+static UINT64 AlignUp(const UINT64 value, const UINT64 alignment)
+{
+	return (value + alignment - 1) & ~(alignment - 1);
+}
+
+// 포맷의 블록 하나의 크기(바이트)와 블록 한 변의 텍셀 수를 구한다. 압축 포맷이 아니라면 블록은 텍셀 하나이다.
+static void GetFormatBlock(const DXGI_FORMAT format, UINT32& blockBytes, UINT32& blockSize)
+{
+	blockSize = 1;
+
+	switch (format)
+	{
+	case DXGI_FORMAT_BC1_TYPELESS: case DXGI_FORMAT_BC1_UNORM: case DXGI_FORMAT_BC1_UNORM_SRGB:
+	case DXGI_FORMAT_BC4_TYPELESS: case DXGI_FORMAT_BC4_UNORM: case DXGI_FORMAT_BC4_SNORM:
+		blockBytes = 8;
+		blockSize = 4;
+		return;
+	case DXGI_FORMAT_BC2_TYPELESS: case DXGI_FORMAT_BC2_UNORM: case DXGI_FORMAT_BC2_UNORM_SRGB:
+	case DXGI_FORMAT_BC3_TYPELESS: case DXGI_FORMAT_BC3_UNORM: case DXGI_FORMAT_BC3_UNORM_SRGB:
+	case DXGI_FORMAT_BC5_TYPELESS: case DXGI_FORMAT_BC5_UNORM: case DXGI_FORMAT_BC5_SNORM:
+	case DXGI_FORMAT_BC6H_TYPELESS: case DXGI_FORMAT_BC6H_UF16: case DXGI_FORMAT_BC6H_SF16:
+	case DXGI_FORMAT_BC7_TYPELESS: case DXGI_FORMAT_BC7_UNORM: case DXGI_FORMAT_BC7_UNORM_SRGB:
+		blockBytes = 16;
+		blockSize = 4;
+		return;
+	case DXGI_FORMAT_R32G32B32A32_TYPELESS: case DXGI_FORMAT_R32G32B32A32_FLOAT:
+	case DXGI_FORMAT_R32G32B32A32_UINT: case DXGI_FORMAT_R32G32B32A32_SINT:
+		blockBytes = 16;
+		return;
+	case DXGI_FORMAT_R32G32B32_TYPELESS: case DXGI_FORMAT_R32G32B32_FLOAT:
+	case DXGI_FORMAT_R32G32B32_UINT: case DXGI_FORMAT_R32G32B32_SINT:
+		blockBytes = 12;
+		return;
+	case DXGI_FORMAT_R16G16B16A16_TYPELESS: case DXGI_FORMAT_R16G16B16A16_FLOAT: case DXGI_FORMAT_R16G16B16A16_UNORM:
+	case DXGI_FORMAT_R16G16B16A16_UINT: case DXGI_FORMAT_R16G16B16A16_SNORM: case DXGI_FORMAT_R16G16B16A16_SINT:
+	case DXGI_FORMAT_R32G32_TYPELESS: case DXGI_FORMAT_R32G32_FLOAT: case DXGI_FORMAT_R32G32_UINT: case DXGI_FORMAT_R32G32_SINT:
+		blockBytes = 8;
+		return;
+	case DXGI_FORMAT_R16_TYPELESS: case DXGI_FORMAT_R16_FLOAT: case DXGI_FORMAT_D16_UNORM: case DXGI_FORMAT_R16_UNORM:
+	case DXGI_FORMAT_R16_UINT: case DXGI_FORMAT_R16_SNORM: case DXGI_FORMAT_R16_SINT:
+	case DXGI_FORMAT_R8G8_TYPELESS: case DXGI_FORMAT_R8G8_UNORM: case DXGI_FORMAT_R8G8_UINT:
+	case DXGI_FORMAT_R8G8_SNORM: case DXGI_FORMAT_R8G8_SINT:
+	case DXGI_FORMAT_B5G6R5_UNORM: case DXGI_FORMAT_B5G5R5A1_UNORM: case DXGI_FORMAT_B4G4R4A4_UNORM:
+		blockBytes = 2;
+		return;
+	case DXGI_FORMAT_R8_TYPELESS: case DXGI_FORMAT_R8_UNORM: case DXGI_FORMAT_R8_UINT:
+	case DXGI_FORMAT_R8_SNORM: case DXGI_FORMAT_R8_SINT: case DXGI_FORMAT_A8_UNORM:
+		blockBytes = 1;
+		return;
+	default:
+		// 나머지 포맷은 프레임워크에서 텍셀당 4바이트인 것만 사용한다.
+		blockBytes = 4;
+		return;
+	}
+}
+
+NullBackendStats& NullBackendStats::operator+=(const NullBackendStats& rhs)
+{
+	drawCalls += rhs.drawCalls;
+	drawInstances += rhs.drawInstances;
+	dispatches += rhs.dispatches;
+	indirectExecutes += rhs.indirectExecutes;
+	pipelineStateChanges += rhs.pipelineStateChanges;
+	rootSignatureChanges += rhs.rootSignatureChanges;
+	rootArguments += rhs.rootArguments;
+	descriptorHeapChanges += rhs.descriptorHeapChanges;
+	vertexBufferChanges += rhs.vertexBufferChanges;
+	indexBufferChanges += rhs.indexBufferChanges;
+	renderTargetChanges += rhs.renderTargetChanges;
+	resourceBarriers += rhs.resourceBarriers;
+	copies += rhs.copies;
+	clears += rhs.clears;
+
+	executedCommandLists += rhs.executedCommandLists;
+	fenceSignals += rhs.fenceSignals;
+	createdResources += rhs.createdResources;
+	createdDescriptors += rhs.createdDescriptors;
+	createdPipelineStates += rhs.createdPipelineStates;
+	validationErrors += rhs.validationErrors;
+
+	return *this;
+}
+
+/*
+NullDevice
+*/
+
+// 가짜 주소가 실제 포인터처럼 보이지 않도록 시작 위치를 띄워둔다.
+static constexpr UINT64 gpuAddressAlignment = D3D12_DEFAULT_RESOURCE_PLACEMENT_ALIGNMENT;
+static constexpr UINT64 gpuAddressStart = 0x100000000;
+static constexpr SIZE_T cpuDescriptorStart = 0x10000;
+static constexpr UINT64 gpuDescriptorStart = 0x200000000;
+
+NullDevice::NullDevice()
+	: nextGpuAddress(gpuAddressStart),
+	  nextCpuDescriptor(cpuDescriptorStart),
+	  nextGpuDescriptor(gpuDescriptorStart) { }
+
+NullDevice::~NullDevice() { }
+
+void NullDevice::AddStats(const NullBackendStats& listStats)
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+	stats += listStats;
+}
+
+void NullDevice::Count(UINT64 NullBackendStats::* counter, const UINT64 value)
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+	stats.*counter += value;
+}
+
+NullBackendStats NullDevice::GetStats() const
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+	return stats;
+}
+
+void NullDevice::ResetStats()
+{
+	std::lock_guard<std::mutex> lock(statsMutex);
+	stats = NullBackendStats();
+}
+
+void NullDevice::PrintStats(const UINT32 frameCount) const
+{
+	const NullBackendStats current = GetStats();
+	const double frameNum = (double)(std::max)(frameCount, 1u);
+
+	auto print = [frameNum](const char* name, const UINT64 value)
+	{
+		std::cout << "  " << name << " : " << value << " (" << value / frameNum << " / frame)" << std::endl;
+	};
+
+	std::cout << "Null Backend : " << frameCount << " frames" << std::endl;
+	print("Draw Calls        ", current.drawCalls);
+	print("Draw Instances    ", current.drawInstances);
+	print("Dispatches        ", current.dispatches);
+	print("Indirect Executes ", current.indirectExecutes);
+	print("Pipeline States   ", current.pipelineStateChanges);
+	print("Root Signatures   ", current.rootSignatureChanges);
+	print("Root Arguments    ", current.rootArguments);
+	print("Descriptor Heaps  ", current.descriptorHeapChanges);
+	print("Vertex Buffers    ", current.vertexBufferChanges);
+	print("Index Buffers     ", current.indexBufferChanges);
+	print("Render Targets    ", current.renderTargetChanges);
+	print("Resource Barriers ", current.resourceBarriers);
+	print("Copies            ", current.copies);
+	print("Clears            ", current.clears);
+	print("Command Lists     ", current.executedCommandLists);
+	print("Fence Signals     ", current.fenceSignals);
+	std::cout << "  Created : " << current.createdResources << " resources, " << current.createdDescriptors << " descriptors, "
+		<< current.createdPipelineStates << " pipeline states" << std::endl;
+	std::cout << "  Validation Errors : " << current.validationErrors << std::endl;
+}
+
+void NullDevice::ReportError(const char* message)
+{
+	UINT64 errorCount = 0;
+	{
+		std::lock_guard<std::mutex> lock(statsMutex);
+		errorCount = ++stats.validationErrors;
+	}
+
+	if (errorCount <= maxPrintedErrors)
+		std::cout << "Null Backend : " << message << std::endl;
+	if (errorCount == maxPrintedErrors)
+		std::cout << "Null Backend : 이후의 검증 오류는 출력하지 않습니다." << std::endl;
+}
+
+HRESULT NullDevice::ReportUnsupported(const char* function)
+{
+	ReportError((std::string(function) + " : 널 백엔드가 지원하지 않는 호출입니다.").c_str());
+	return E_NOTIMPL;
+}
+
+void NullDevice::ApplyBarriers(const std::vector<D3D12_RESOURCE_BARRIER>& barriers)
+{
+	std::lock_guard<std::mutex> lock(barrierMutex);
+
+	for (const auto& barrier : barriers)
+	{
+		if (barrier.Type != D3D12_RESOURCE_BARRIER_TYPE_TRANSITION)
+			continue;
+
+		// 서브리소스 단위의 상태는 추적하지 않는다.
+		const D3D12_RESOURCE_TRANSITION_BARRIER& transition = barrier.Transition;
+		if (transition.Subresource != D3D12_RESOURCE_BARRIER_ALL_SUBRESOURCES)
+			continue;
+
+		// COMMON 상태는 암묵적으로 승격되거나 실행이 끝나면 되돌아오므로 비교하지 않는다.
+		NullResource* resource = static_cast<NullResource*>(transition.pResource);
+		if (resource->state != D3D12_RESOURCE_STATE_COMMON && transition.StateBefore != D3D12_RESOURCE_STATE_COMMON &&
+			resource->state != transition.StateBefore)
+		{
+			ReportError("ResourceBarrier : StateBefore가 리소스의 현재 상태와 다릅니다.");
+		}
+
+		resource->state = transition.StateAfter;
+	}
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS NullDevice::AllocateGpuAddress(const UINT64 size)
+{
+	const UINT64 alignedSize = (size + gpuAddressAlignment - 1) & ~(gpuAddressAlignment - 1);
+	return nextGpuAddress.fetch_add((std::max)(alignedSize, gpuAddressAlignment));
+}
+
+void NullDevice::AllocateDescriptors(const D3D12_DESCRIPTOR_HEAP_DESC& desc,
+	D3D12_CPU_DESCRIPTOR_HANDLE& cpuStart, D3D12_GPU_DESCRIPTOR_HANDLE& gpuStart)
+{
+	// 힙 사이에 한 칸을 비워 범위를 넘어선 핸들이 다음 힙을 가리키지 않게 한다.
+	const UINT64 size = ((UINT64)desc.NumDescriptors + 1) * descriptorIncrementSize;
+
+	cpuStart.ptr = nextCpuDescriptor.fetch_add((SIZE_T)size);
+	gpuStart.ptr = (desc.Flags & D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE) ? nextGpuDescriptor.fetch_add(size) : 0;
+}
+
+void NullDevice::ValidateDescriptor(const D3D12_CPU_DESCRIPTOR_HANDLE handle, const char* function)
+{
+	Count(&NullBackendStats::createdDescriptors);
+
+	if (handle.ptr < cpuDescriptorStart)
+	{
+		std::string message = function;
+		message += " : 잘못된 서술자 핸들입니다.";
+		ReportError(message.c_str());
+	}
+}
+
+UINT NullDevice::GetNodeCount()
+{
+	return 1;
+}
+
+HRESULT NullDevice::CreateCommandQueue(const D3D12_COMMAND_QUEUE_DESC* pDesc, REFIID riid, void** ppCommandQueue)
+{
+	if (pDesc == nullptr)
+		return E_INVALIDARG;
+
+	return QueryNewObject(new NullCommandQueue(this, *pDesc), riid, ppCommandQueue);
+}
+
+HRESULT NullDevice::CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE type, REFIID riid, void** ppCommandAllocator)
+{
+	return QueryNewObject(new NullCommandAllocator(this, type), riid, ppCommandAllocator);
+}
+
+HRESULT NullDevice::CreateGraphicsPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC* pDesc, REFIID riid, void** ppPipelineState)
+{
+	if (pDesc == nullptr)
+		return E_INVALIDARG;
+
+	if (pDesc->pRootSignature == nullptr)
+		ReportError("CreateGraphicsPipelineState : 루트 서명이 없습니다.");
+	if (pDesc->VS.pShaderBytecode == nullptr)
+		ReportError("CreateGraphicsPipelineState : 정점 셰이더가 없습니다.");
+
+	Count(&NullBackendStats::createdPipelineStates);
+	return QueryNewObject(new NullPipelineState(this, false), riid, ppPipelineState);
+}
+
+HRESULT NullDevice::CreateComputePipelineState(const D3D12_COMPUTE_PIPELINE_STATE_DESC* pDesc, REFIID riid, void** ppPipelineState)
+{
+	if (pDesc == nullptr)
+		return E_INVALIDARG;
+
+	if (pDesc->pRootSignature == nullptr)
+		ReportError("CreateComputePipelineState : 루트 서명이 없습니다.");
+	if (pDesc->CS.pShaderBytecode == nullptr)
+		ReportError("CreateComputePipelineState : 계산 셰이더가 없습니다.");
+
+	Count(&NullBackendStats::createdPipelineStates);
+	return QueryNewObject(new NullPipelineState(this, true), riid, ppPipelineState);
+}
+
+HRESULT NullDevice::CreateCommandList(UINT nodeMask, D3D12_COMMAND_LIST_TYPE type, ID3D12CommandAllocator* pCommandAllocator,
+	ID3D12PipelineState* pInitialState, REFIID riid, void** ppCommandList)
+{
+	if (pCommandAllocator == nullptr)
+		return E_INVALIDARG;
+
+	return QueryNewObject(new NullCommandList(this, type, pInitialState), riid, ppCommandList);
+}
+
+HRESULT NullDevice::CheckFeatureSupport(D3D12_FEATURE Feature, void* pFeatureSupportData, UINT FeatureSupportDataSize)
+{
+	if (pFeatureSupportData == nullptr)
+		return E_INVALIDARG;
+
+	switch (Feature)
+	{
+	case D3D12_FEATURE_MULTISAMPLE_QUALITY_LEVELS:
+	{
+		if (FeatureSupportDataSize != sizeof(D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS))
+			return E_INVALIDARG;
+
+		auto data = static_cast<D3D12_FEATURE_DATA_MULTISAMPLE_QUALITY_LEVELS*>(pFeatureSupportData);
+		data->NumQualityLevels = 1;
+		return S_OK;
+	}
+	case D3D12_FEATURE_FORMAT_SUPPORT:
+	{
+		if (FeatureSupportDataSize != sizeof(D3D12_FEATURE_DATA_FORMAT_SUPPORT))
+			return E_INVALIDARG;
+
+		// 모든 형식의 모든 용도를 지원한다고 답한다.
+		auto data = static_cast<D3D12_FEATURE_DATA_FORMAT_SUPPORT*>(pFeatureSupportData);
+		data->Support1 = (D3D12_FORMAT_SUPPORT1)~0u;
+		data->Support2 = (D3D12_FORMAT_SUPPORT2)~0u;
+		return S_OK;
+	}
+	default:
+		// 그 외의 기능은 가장 낮은 단계로 답한다.
+		ZeroMemory(pFeatureSupportData, FeatureSupportDataSize);
+		return S_OK;
+	}
+}
+
+HRESULT NullDevice::CreateDescriptorHeap(const D3D12_DESCRIPTOR_HEAP_DESC* pDescriptorHeapDesc, REFIID riid, void** ppvHeap)
+{
+	if (pDescriptorHeapDesc == nullptr || pDescriptorHeapDesc->NumDescriptors == 0)
+		return E_INVALIDARG;
+
+	D3D12_CPU_DESCRIPTOR_HANDLE cpuStart;
+	D3D12_GPU_DESCRIPTOR_HANDLE gpuStart;
+	AllocateDescriptors(*pDescriptorHeapDesc, cpuStart, gpuStart);
+
+	return QueryNewObject(new NullDescriptorHeap(this, *pDescriptorHeapDesc, cpuStart, gpuStart), riid, ppvHeap);
+}
+
+UINT NullDevice::GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapType)
+{
+	return descriptorIncrementSize;
+}
+
+HRESULT NullDevice::CreateRootSignature(UINT nodeMask, const void* pBlobWithRootSignature, SIZE_T blobLengthInBytes,
+	REFIID riid, void** ppvRootSignature)
+{
+	if (pBlobWithRootSignature == nullptr || blobLengthInBytes == 0)
+		return E_INVALIDARG;
+
+	// 루트 인자의 인덱스를 검증할 수 있도록 직렬화된 서명에서 인자의 개수를 읽는다.
+	UINT32 parameterCount = UINT32_MAX;
+	Microsoft::WRL::ComPtr<ID3D12RootSignatureDeserializer> deserializer;
+	if (SUCCEEDED(D3D12CreateRootSignatureDeserializer(pBlobWithRootSignature, blobLengthInBytes, IID_PPV_ARGS(&deserializer))))
+		parameterCount = deserializer->GetRootSignatureDesc()->NumParameters;
+
+	return QueryNewObject(new NullRootSignature(this, parameterCount), riid, ppvRootSignature);
+}
+
+void NullDevice::CreateConstantBufferView(const D3D12_CONSTANT_BUFFER_VIEW_DESC* pDesc, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+{
+	ValidateDescriptor(DestDescriptor, "CreateConstantBufferView");
+}
+
+void NullDevice::CreateShaderResourceView(ID3D12Resource* pResource, const D3D12_SHADER_RESOURCE_VIEW_DESC* pDesc,
+	D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+{
+	ValidateDescriptor(DestDescriptor, "CreateShaderResourceView");
+}
+
+void NullDevice::CreateUnorderedAccessView(ID3D12Resource* pResource, ID3D12Resource* pCounterResource,
+	const D3D12_UNORDERED_ACCESS_VIEW_DESC* pDesc, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+{
+	ValidateDescriptor(DestDescriptor, "CreateUnorderedAccessView");
+}
+
+void NullDevice::CreateRenderTargetView(ID3D12Resource* pResource, const D3D12_RENDER_TARGET_VIEW_DESC* pDesc,
+	D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+{
+	ValidateDescriptor(DestDescriptor, "CreateRenderTargetView");
+}
+
+void NullDevice::CreateDepthStencilView(ID3D12Resource* pResource, const D3D12_DEPTH_STENCIL_VIEW_DESC* pDesc,
+	D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+{
+	ValidateDescriptor(DestDescriptor, "CreateDepthStencilView");
+}
+
+void NullDevice::CreateSampler(const D3D12_SAMPLER_DESC* pDesc, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor)
+{
+	ValidateDescriptor(DestDescriptor, "CreateSampler");
+}
+
+void NullDevice::CopyDescriptors(UINT NumDestDescriptorRanges, const D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
+	const UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges, const D3D12_CPU_DESCRIPTOR_HANDLE* pSrcDescriptorRangeStarts,
+	const UINT* pSrcDescriptorRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType)
+{
+	UINT64 descriptorCount = 0;
+	for (UINT i = 0; i < NumDestDescriptorRanges; ++i)
+		descriptorCount += pDestDescriptorRangeSizes ? pDestDescriptorRangeSizes[i] : 1;
+
+	Count(&NullBackendStats::createdDescriptors, descriptorCount);
+}
+
+void NullDevice::CopyDescriptorsSimple(UINT NumDescriptors, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptorRangeStart,
+	D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRangeStart, D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType)
+{
+	Count(&NullBackendStats::createdDescriptors, NumDescriptors);
+}
+
+D3D12_RESOURCE_ALLOCATION_INFO NullDevice::GetResourceAllocationInfo(UINT visibleMask, UINT numResourceDescs,
+	const D3D12_RESOURCE_DESC* pResourceDescs)
+{
+	D3D12_RESOURCE_ALLOCATION_INFO info = { 0, gpuAddressAlignment };
+
+	// 텍스처는 텍셀당 16바이트로 넉넉하게 계산한다.
+	for (UINT i = 0; i < numResourceDescs; ++i)
+	{
+		const D3D12_RESOURCE_DESC& desc = pResourceDescs[i];
+		UINT64 size = desc.Width;
+		if (desc.Dimension != D3D12_RESOURCE_DIMENSION_BUFFER)
+			size = desc.Width * desc.Height * desc.DepthOrArraySize * (std::max)((UINT16)1, desc.MipLevels) * 16;
+
+		info.SizeInBytes += (size + gpuAddressAlignment - 1) & ~(gpuAddressAlignment - 1);
+	}
+
+	return info;
+}
+
+D3D12_HEAP_PROPERTIES NullDevice::GetCustomHeapProperties(UINT nodeMask, D3D12_HEAP_TYPE heapType)
+{
+	D3D12_HEAP_PROPERTIES properties = {};
+	properties.Type = D3D12_HEAP_TYPE_CUSTOM;
+	properties.CPUPageProperty = heapType == D3D12_HEAP_TYPE_DEFAULT ?
+		D3D12_CPU_PAGE_PROPERTY_NOT_AVAILABLE : D3D12_CPU_PAGE_PROPERTY_WRITE_BACK;
+	properties.MemoryPoolPreference = D3D12_MEMORY_POOL_L0;
+	properties.CreationNodeMask = 1;
+	properties.VisibleNodeMask = 1;
+	return properties;
+}
+
+HRESULT NullDevice::CreateCommittedResource(const D3D12_HEAP_PROPERTIES* pHeapProperties, D3D12_HEAP_FLAGS HeapFlags,
+	const D3D12_RESOURCE_DESC* pDesc, D3D12_RESOURCE_STATES InitialResourceState, const D3D12_CLEAR_VALUE* pOptimizedClearValue,
+	REFIID riidResource, void** ppvResource)
+{
+	if (pHeapProperties == nullptr || pDesc == nullptr)
+		return E_INVALIDARG;
+
+	// 업로드 힙과 리드백 힙은 정해진 상태로만 생성할 수 있다.
+	if (pHeapProperties->Type == D3D12_HEAP_TYPE_UPLOAD && InitialResourceState != D3D12_RESOURCE_STATE_GENERIC_READ)
+		ReportError("CreateCommittedResource : 업로드 힙의 리소스는 GENERIC_READ 상태로 생성해야 합니다.");
+	if (pHeapProperties->Type == D3D12_HEAP_TYPE_READBACK && InitialResourceState != D3D12_RESOURCE_STATE_COPY_DEST)
+		ReportError("CreateCommittedResource : 리드백 힙의 리소스는 COPY_DEST 상태로 생성해야 합니다.");
+	if (pDesc->Dimension == D3D12_RESOURCE_DIMENSION_BUFFER && pDesc->Width == 0)
+		ReportError("CreateCommittedResource : 크기가 0인 버퍼입니다.");
+
+	Count(&NullBackendStats::createdResources);
+	return QueryNewObject(new NullResource(this, *pHeapProperties, HeapFlags, *pDesc, InitialResourceState), riidResource, ppvResource);
+}
+
+HRESULT NullDevice::CreateHeap(const D3D12_HEAP_DESC* pDesc, REFIID riid, void** ppvHeap)
+{
+	return ReportUnsupported("CreateHeap");
+}
+
+HRESULT NullDevice::CreatePlacedResource(ID3D12Heap* pHeap, UINT64 HeapOffset, const D3D12_RESOURCE_DESC* pDesc,
+	D3D12_RESOURCE_STATES InitialState, const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riid, void** ppvResource)
+{
+	return ReportUnsupported("CreatePlacedResource");
+}
+
+HRESULT NullDevice::CreateReservedResource(const D3D12_RESOURCE_DESC* pDesc, D3D12_RESOURCE_STATES InitialState,
+	const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riid, void** ppvResource)
+{
+	return ReportUnsupported("CreateReservedResource");
+}
+
+HRESULT NullDevice::CreateSharedHandle(ID3D12DeviceChild* pObject, const SECURITY_ATTRIBUTES* pAttributes,
+	DWORD Access, LPCWSTR Name, HANDLE* pHandle)
+{
+	return ReportUnsupported("CreateSharedHandle");
+}
+
+HRESULT NullDevice::OpenSharedHandle(HANDLE NTHandle, REFIID riid, void** ppvObj)
+{
+	return ReportUnsupported("OpenSharedHandle");
+}
+
+HRESULT NullDevice::OpenSharedHandleByName(LPCWSTR Name, DWORD Access, HANDLE* pNTHandle)
+{
+	return ReportUnsupported("OpenSharedHandleByName");
+}
+
+HRESULT NullDevice::MakeResident(UINT NumObjects, ID3D12Pageable* const* ppObjects)
+{
+	return S_OK;
+}
+
+HRESULT NullDevice::Evict(UINT NumObjects, ID3D12Pageable* const* ppObjects)
+{
+	return S_OK;
+}
+
+HRESULT NullDevice::CreateFence(UINT64 InitialValue, D3D12_FENCE_FLAGS Flags, REFIID riid, void** ppFence)
+{
+	return QueryNewObject(new NullFence(this, InitialValue), riid, ppFence);
+}
+
+HRESULT NullDevice::GetDeviceRemovedReason()
+{
+	return S_OK;
+}
+
+void NullDevice::GetCopyableFootprints(const D3D12_RESOURCE_DESC* pResourceDesc, UINT FirstSubresource, UINT NumSubresources,
+	UINT64 BaseOffset, D3D12_PLACED_SUBRESOURCE_FOOTPRINT* pLayouts, UINT* pNumRows, UINT64* pRowSizeInBytes, UINT64* pTotalBytes)
+{
+	// 실제 드라이버와 같은 규칙으로 배치하여 UpdateSubresources가 업로드 버퍼로 텍셀을 그대로 복사하게 한다.
+	// 각 서브리소스는 512바이트, 각 줄은 256바이트 단위로 정렬된다.
+	const D3D12_RESOURCE_DESC& desc = *pResourceDesc;
+	const bool isBuffer = desc.Dimension == D3D12_RESOURCE_DIMENSION_BUFFER;
+	const bool is3D = desc.Dimension == D3D12_RESOURCE_DIMENSION_TEXTURE3D;
+	const UINT32 mipLevels = (std::max)((UINT16)1, desc.MipLevels);
+
+	UINT32 blockBytes = 1;
+	UINT32 blockSize = 1;
+	if (!isBuffer)
+		GetFormatBlock(desc.Format, blockBytes, blockSize);
+
+	UINT64 offset = BaseOffset;
+	UINT64 totalBytes = 0;
+
+	for (UINT i = 0; i < NumSubresources; ++i)
+	{
+		const UINT32 mip = (FirstSubresource + i) % mipLevels;
+		const UINT32 width = isBuffer ? (UINT32)desc.Width : (std::max)((UINT32)(desc.Width >> mip), 1u);
+		const UINT32 height = isBuffer ? 1 : (std::max)(desc.Height >> mip, 1u);
+		const UINT32 depth = is3D ? (std::max)((UINT32)desc.DepthOrArraySize >> mip, 1u) : 1;
+
+		// 압축 포맷은 4x4 블록이 한 단위이므로 줄의 개수도 블록 단위로 센다.
+		const UINT32 numRows = (height + blockSize - 1) / blockSize;
+		const UINT64 rowSize = (UINT64)((width + blockSize - 1) / blockSize) * blockBytes;
+		const UINT64 rowPitch = AlignUp(rowSize, D3D12_TEXTURE_DATA_PITCH_ALIGNMENT);
+
+		offset = AlignUp(offset, D3D12_TEXTURE_DATA_PLACEMENT_ALIGNMENT);
+
+		if (pLayouts)
+		{
+			pLayouts[i].Offset = offset;
+			pLayouts[i].Footprint.Format = desc.Format;
+			pLayouts[i].Footprint.Width = width;
+			pLayouts[i].Footprint.Height = height;
+			pLayouts[i].Footprint.Depth = depth;
+			pLayouts[i].Footprint.RowPitch = (UINT)rowPitch;
+		}
+		if (pNumRows)
+			pNumRows[i] = numRows;
+		if (pRowSizeInBytes)
+			pRowSizeInBytes[i] = rowSize;
+
+		// 마지막 줄은 피치만큼 채우지 않아도 되므로 줄의 실제 크기만 더한다.
+		const UINT64 subresourceBytes = rowPitch * ((UINT64)numRows * depth - 1) + rowSize;
+		totalBytes = offset + subresourceBytes - BaseOffset;
+		offset += subresourceBytes;
+	}
+
+	if (pTotalBytes)
+		*pTotalBytes = totalBytes;
+}
+
+HRESULT NullDevice::CreateQueryHeap(const D3D12_QUERY_HEAP_DESC* pDesc, REFIID riid, void** ppvHeap)
+{
+	return ReportUnsupported("CreateQueryHeap");
+}
+
+HRESULT NullDevice::SetStablePowerState(BOOL Enable)
+{
+	return S_OK;
+}
+
+HRESULT NullDevice::CreateCommandSignature(const D3D12_COMMAND_SIGNATURE_DESC* pDesc, ID3D12RootSignature* pRootSignature,
+	REFIID riid, void** ppvCommandSignature)
+{
+	if (pDesc == nullptr || pDesc->NumArgumentDescs == 0)
+		return E_INVALIDARG;
+
+	return QueryNewObject(new NullCommandSignature(this), riid, ppvCommandSignature);
+}
+
+void NullDevice::GetResourceTiling(ID3D12Resource* pTiledResource, UINT* pNumTilesForEntireResource,
+	D3D12_PACKED_MIP_INFO* pPackedMipDesc, D3D12_TILE_SHAPE* pStandardTileShapeForNonPackedMips, UINT* pNumSubresourceTilings,
+	UINT FirstSubresourceTilingToGet, D3D12_SUBRESOURCE_TILING* pSubresourceTilingsForNonPackedMips)
+{
+	if (pNumTilesForEntireResource)
+		*pNumTilesForEntireResource = 0;
+	if (pPackedMipDesc)
+		*pPackedMipDesc = {};
+	if (pStandardTileShapeForNonPackedMips)
+		*pStandardTileShapeForNonPackedMips = {};
+	if (pNumSubresourceTilings)
+		*pNumSubresourceTilings = 0;
+}
+
+LUID NullDevice::GetAdapterLuid()
+{
+	return LUID{ 0, 0 };
+}
+
+/*
+NullResource
+*/
+
+NullResource::NullResource(NullDevice* device, const D3D12_HEAP_PROPERTIES& heapProperties, const D3D12_HEAP_FLAGS heapFlags,
+	const D3D12_RESOURCE_DESC& desc, const D3D12_RESOURCE_STATES initialState)
+	: NullDeviceChild(device),
+	  state(initialState),
+	  heapProperties(heapProperties),
+	  heapFlags(heapFlags),
+	  desc(desc)
+{
+	// 텍스처는 GPU 가상 주소를 가지지 않는다.
+	if (desc.Dimension != D3D12_RESOURCE_DIMENSION_BUFFER)
+		return;
+
+	gpuAddress = device->AllocateGpuAddress(desc.Width);
+
+	if (IsCpuAccessible(heapProperties))
+	{
+		memory = std::make_unique<BYTE[]>((size_t)(std::max)(desc.Width, (UINT64)1));
+		ZeroMemory(memory.get(), (size_t)desc.Width);
+	}
+}
+
+NullResource::~NullResource() { }
+
+HRESULT NullResource::Map(UINT Subresource, const D3D12_RANGE* pReadRange, void** ppData)
+{
+	if (memory == nullptr)
+	{
+		device->ReportError("Map : CPU에서 접근할 수 없는 리소스입니다.");
+		if (ppData)
+			*ppData = nullptr;
+		return E_INVALIDARG;
+	}
+
+	if (ppData)
+		*ppData = memory.get();
+	return S_OK;
+}
+
+void NullResource::Unmap(UINT Subresource, const D3D12_RANGE* pWrittenRange) { }
+
+D3D12_RESOURCE_DESC NullResource::GetDesc()
+{
+	return desc;
+}
+
+D3D12_GPU_VIRTUAL_ADDRESS NullResource::GetGPUVirtualAddress()
+{
+	return gpuAddress;
+}
+
+HRESULT NullResource::WriteToSubresource(UINT DstSubresource, const D3D12_BOX* pDstBox, const void* pSrcData,
+	UINT SrcRowPitch, UINT SrcDepthPitch)
+{
+	return S_OK;
+}
+
+HRESULT NullResource::ReadFromSubresource(void* pDstData, UINT DstRowPitch, UINT DstDepthPitch,
+	UINT SrcSubresource, const D3D12_BOX* pSrcBox)
+{
+	return S_OK;
+}
+
+HRESULT NullResource::GetHeapProperties(D3D12_HEAP_PROPERTIES* pHeapProperties, D3D12_HEAP_FLAGS* pHeapFlags)
+{
+	if (pHeapProperties)
+		*pHeapProperties = heapProperties;
+	if (pHeapFlags)
+		*pHeapFlags = heapFlags;
+	return S_OK;
+}
+
+/*
+NullDescriptorHeap
+*/
+
+NullDescriptorHeap::NullDescriptorHeap(NullDevice* device, const D3D12_DESCRIPTOR_HEAP_DESC& desc,
+	const D3D12_CPU_DESCRIPTOR_HANDLE cpuStart, const D3D12_GPU_DESCRIPTOR_HANDLE gpuStart)
+	: NullDeviceChild(device),
+	  desc(desc),
+	  cpuStart(cpuStart),
+	  gpuStart(gpuStart) { }
+
+NullDescriptorHeap::~NullDescriptorHeap() { }
+
+D3D12_DESCRIPTOR_HEAP_DESC NullDescriptorHeap::GetDesc()
+{
+	return desc;
+}
+
+D3D12_CPU_DESCRIPTOR_HANDLE NullDescriptorHeap::GetCPUDescriptorHandleForHeapStart()
+{
+	return cpuStart;
+}
+
+D3D12_GPU_DESCRIPTOR_HANDLE NullDescriptorHeap::GetGPUDescriptorHandleForHeapStart()
+{
+	return gpuStart;
+}
+
+bool NullDescriptorHeap::Contains(const D3D12_GPU_DESCRIPTOR_HANDLE handle) const
+{
+	if (gpuStart.ptr == 0)
+		return false;
+
+	return handle.ptr >= gpuStart.ptr &&
+		handle.ptr < gpuStart.ptr + (UINT64)desc.NumDescriptors * NullDevice::descriptorIncrementSize;
+}
+
+/*
+NullFence
+*/
+
+NullFence::NullFence(NullDevice* device, const UINT64 initialValue)
+	: NullDeviceChild(device),
+	  value(initialValue) { }
+
+NullFence::~NullFence() { }
+
+UINT64 NullFence::GetCompletedValue()
+{
+	return value;
+}
+
+HRESULT NullFence::SetEventOnCompletion(UINT64 Value, HANDLE hEvent)
+{
+	std::lock_guard<std::mutex> lock(eventMutex);
+
+	if (value >= Value)
+	{
+		if (hEvent)
+			SetEvent(hEvent);
+		return S_OK;
+	}
+
+	// 이벤트 없이 기다리는 호출은 Signal을 호출할 스레드가 없으므로 바로 반환한다.
+	if (hEvent)
+		pendingEvents.emplace_back(Value, hEvent);
+	return S_OK;
+}
+
+HRESULT NullFence::Signal(UINT64 Value)
+{
+	std::lock_guard<std::mutex> lock(eventMutex);
+
+	value = Value;
+
+	std::erase_if(pendingEvents, [Value](const std::pair<UINT64, HANDLE>& pending)
+	{
+		if (pending.first > Value)
+			return false;
+
+		SetEvent(pending.second);
+		return true;
+	});
+
+	return S_OK;
+}
+
+/*
+NullCommandAllocator, NullRootSignature, NullPipelineState, NullCommandSignature
+*/
+
+NullCommandAllocator::NullCommandAllocator(NullDevice* device, const D3D12_COMMAND_LIST_TYPE type)
+	: NullDeviceChild(device),
+	  type(type) { }
+
+NullCommandAllocator::~NullCommandAllocator() { }
+
+HRESULT NullCommandAllocator::Reset()
+{
+	return S_OK;
+}
+
+NullRootSignature::NullRootSignature(NullDevice* device, const UINT32 parameterCount)
+	: NullDeviceChild(device),
+	  parameterCount(parameterCount) { }
+
+NullRootSignature::~NullRootSignature() { }
+
+NullPipelineState::NullPipelineState(NullDevice* device, const bool isCompute)
+	: NullDeviceChild(device),
+	  isCompute(isCompute) { }
+
+NullPipelineState::~NullPipelineState() { }
+
+HRESULT NullPipelineState::GetCachedBlob(ID3DBlob** ppBlob)
+{
+	return device->ReportUnsupported("GetCachedBlob");
+}
+
+NullCommandSignature::NullCommandSignature(NullDevice* device)
+	: NullDeviceChild(device) { }
+
+NullCommandSignature::~NullCommandSignature() { }
+
+/*
+NullCommandQueue
+*/
+
+NullCommandQueue::NullCommandQueue(NullDevice* device, const D3D12_COMMAND_QUEUE_DESC& desc)
+	: NullDeviceChild(device),
+	  desc(desc) { }
+
+NullCommandQueue::~NullCommandQueue() { }
+
+void NullCommandQueue::UpdateTileMappings(ID3D12Resource* pResource, UINT NumResourceRegions,
+	const D3D12_TILED_RESOURCE_COORDINATE* pResourceRegionStartCoordinates, const D3D12_TILE_REGION_SIZE* pResourceRegionSizes,
+	ID3D12Heap* pHeap, UINT NumRanges, const D3D12_TILE_RANGE_FLAGS* pRangeFlags, const UINT* pHeapRangeStartOffsets,
+	const UINT* pRangeTileCounts, D3D12_TILE_MAPPING_FLAGS Flags) { }
+
+void NullCommandQueue::CopyTileMappings(ID3D12Resource* pDstResource, const D3D12_TILED_RESOURCE_COORDINATE* pDstRegionStartCoordinate,
+	ID3D12Resource* pSrcResource, const D3D12_TILED_RESOURCE_COORDINATE* pSrcRegionStartCoordinate,
+	const D3D12_TILE_REGION_SIZE* pRegionSize, D3D12_TILE_MAPPING_FLAGS Flags) { }
+
+void NullCommandQueue::ExecuteCommandLists(UINT NumCommandLists, ID3D12CommandList* const* ppCommandLists)
+{
+	for (UINT i = 0; i < NumCommandLists; ++i)
+	{
+		NullCommandList* cmdList = static_cast<NullCommandList*>(ppCommandLists[i]);
+
+		if (cmdList->IsRecording())
+		{
+			device->ReportError("ExecuteCommandLists : 닫히지 않은 명령 리스트를 실행합니다.");
+			continue;
+		}
+
+		if (cmdList->GetType() != desc.Type)
+			device->ReportError("ExecuteCommandLists : 명령 리스트와 명령 큐의 타입이 다릅니다.");
+
+		device->ApplyBarriers(cmdList->GetBarriers());
+		device->AddStats(cmdList->GetStats());
+	}
+
+	device->Count(&NullBackendStats::executedCommandLists, NumCommandLists);
+}
+
+void NullCommandQueue::SetMarker(UINT Metadata, const void* pData, UINT Size) { }
+
+void NullCommandQueue::BeginEvent(UINT Metadata, const void* pData, UINT Size) { }
+
+void NullCommandQueue::EndEvent() { }
+
+HRESULT NullCommandQueue::Signal(ID3D12Fence* pFence, UINT64 Value)
+{
+	if (pFence == nullptr)
+		return E_INVALIDARG;
+
+	// 앞선 명령들은 이미 모두 실행된 것으로 본다.
+	device->Count(&NullBackendStats::fenceSignals);
+	return pFence->Signal(Value);
+}
+
+HRESULT NullCommandQueue::Wait(ID3D12Fence* pFence, UINT64 Value)
+{
+	return S_OK;
+}
+
+HRESULT NullCommandQueue::GetTimestampFrequency(UINT64* pFrequency)
+{
+	if (pFrequency == nullptr)
+		return E_INVALIDARG;
+
+	LARGE_INTEGER frequency;
+	QueryPerformanceFrequency(&frequency);
+	*pFrequency = (UINT64)frequency.QuadPart;
+	return S_OK;
+}
+
+HRESULT NullCommandQueue::GetClockCalibration(UINT64* pGpuTimestamp, UINT64* pCpuTimestamp)
+{
+	LARGE_INTEGER counter;
+	QueryPerformanceCounter(&counter);
+
+	if (pGpuTimestamp)
+		*pGpuTimestamp = (UINT64)counter.QuadPart;
+	if (pCpuTimestamp)
+		*pCpuTimestamp = (UINT64)counter.QuadPart;
+	return S_OK;
+}
+
+D3D12_COMMAND_QUEUE_DESC NullCommandQueue::GetDesc()
+{
+	return desc;
+}
+
+/*
+NullCommandList
+*/
+
+NullCommandList::NullCommandList(NullDevice* device, const D3D12_COMMAND_LIST_TYPE type, ID3D12PipelineState* initialState)
+	: NullDeviceChild(device),
+	  type(type),
+	  pipelineState(initialState) { }
+
+NullCommandList::~NullCommandList() { }
+
+bool NullCommandList::IsRecording() const
+{
+	return isRecording;
+}
+
+const NullBackendStats& NullCommandList::GetStats() const
+{
+	return stats;
+}
+
+const std::vector<D3D12_RESOURCE_BARRIER>& NullCommandList::GetBarriers() const
+{
+	return barriers;
+}
+
+void NullCommandList::ReportError(const char* function, const char* message)
+{
+	std::string text = function;
+	text += " : ";
+	text += message;
+	device->ReportError(text.c_str());
+}
+
+bool NullCommandList::ValidateRecording(const char* function)
+{
+	if (isRecording)
+		return true;
+
+	ReportError(function, "닫힌 명령 리스트에 명령을 기록합니다.");
+	return false;
+}
+
+bool NullCommandList::ValidateDraw(const char* function, const bool isIndexed)
+{
+	if (!ValidateRecording(function))
+		return false;
+
+	bool isValid = true;
+	auto check = [this, function, &isValid](const bool condition, const char* message)
+	{
+		if (condition)
+			return;
+
+		ReportError(function, message);
+		isValid = false;
+	};
+
+	check(pipelineState != nullptr && !static_cast<NullPipelineState*>(pipelineState)->isCompute, "그래픽스 파이프라인 상태가 설정되지 않았습니다.");
+	check(graphicsRootSignature != nullptr, "그래픽스 루트 서명이 설정되지 않았습니다.");
+	check(topology != D3D_PRIMITIVE_TOPOLOGY_UNDEFINED, "기본 도형 위상 구조가 설정되지 않았습니다.");
+	check(hasViewport && hasScissorRect, "뷰포트 또는 가위 사각형이 설정되지 않았습니다.");
+	check(renderTargetCount > 0 || hasDepthStencil, "렌더 타겟이 설정되지 않았습니다.");
+	if (isIndexed)
+		check(hasIndexBuffer, "인덱스 버퍼가 설정되지 않았습니다.");
+
+	return isValid;
+}
+
+bool NullCommandList::ValidateDispatch(const char* function)
+{
+	if (!ValidateRecording(function))
+		return false;
+
+	bool isValid = true;
+	if (pipelineState == nullptr || !static_cast<NullPipelineState*>(pipelineState)->isCompute)
+	{
+		ReportError(function, "계산 파이프라인 상태가 설정되지 않았습니다.");
+		isValid = false;
+	}
+	if (computeRootSignature == nullptr)
+	{
+		ReportError(function, "계산 루트 서명이 설정되지 않았습니다.");
+		isValid = false;
+	}
+
+	return isValid;
+}
+
+bool NullCommandList::ValidateRootArgument(const char* function, const bool isCompute, const UINT rootParameterIndex)
+{
+	if (!ValidateRecording(function))
+		return false;
+
+	++stats.rootArguments;
+
+	const NullRootSignature* rootSignature = isCompute ? computeRootSignature : graphicsRootSignature;
+	if (rootSignature == nullptr)
+	{
+		ReportError(function, "루트 서명이 설정되기 전에 루트 인자를 설정합니다.");
+		return false;
+	}
+
+	if (rootParameterIndex >= rootSignature->parameterCount)
+	{
+		ReportError(function, "루트 인자의 인덱스가 루트 서명의 범위를 벗어납니다.");
+		return false;
+	}
+
+	return true;
+}
+
+bool NullCommandList::ValidateDescriptorTable(const char* function, const D3D12_GPU_DESCRIPTOR_HANDLE handle)
+{
+	for (const NullDescriptorHeap* heap : descriptorHeaps)
+	{
+		if (heap && heap->Contains(handle))
+			return true;
+	}
+
+	ReportError(function, "서술자 테이블이 설정된 서술자 힙에 속하지 않습니다.");
+	return false;
+}
+
+void NullCommandList::ClearBindings()
+{
+	pipelineState = nullptr;
+	graphicsRootSignature = nullptr;
+	computeRootSignature = nullptr;
+	topology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	hasViewport = false;
+	hasScissorRect = false;
+	hasIndexBuffer = false;
+	renderTargetCount = 0;
+	hasDepthStencil = false;
+	descriptorHeaps[0] = nullptr;
+	descriptorHeaps[1] = nullptr;
+}
+
+D3D12_COMMAND_LIST_TYPE NullCommandList::GetType()
+{
+	return type;
+}
+
+HRESULT NullCommandList::Close()
+{
+	if (!isRecording)
+	{
+		ReportError("Close", "이미 닫힌 명령 리스트입니다.");
+		return E_FAIL;
+	}
+
+	isRecording = false;
+	return S_OK;
+}
+
+HRESULT NullCommandList::Reset(ID3D12CommandAllocator* pAllocator, ID3D12PipelineState* pInitialState)
+{
+	if (isRecording)
+	{
+		ReportError("Reset", "기록 중인 명령 리스트를 리셋합니다.");
+		return E_FAIL;
+	}
+	if (pAllocator == nullptr)
+		return E_INVALIDARG;
+
+	ClearBindings();
+	pipelineState = pInitialState;
+	isRecording = true;
+
+	stats = NullBackendStats();
+	barriers.clear();
+	return S_OK;
+}
+
+void NullCommandList::ClearState(ID3D12PipelineState* pPipelineState)
+{
+	if (!ValidateRecording("ClearState"))
+		return;
+
+	ClearBindings();
+	pipelineState = pPipelineState;
+}
+
+void NullCommandList::DrawInstanced(UINT VertexCountPerInstance, UINT InstanceCount,
+	UINT StartVertexLocation, UINT StartInstanceLocation)
+{
+	if (!ValidateDraw("DrawInstanced", false))
+		return;
+
+	++stats.drawCalls;
+	stats.drawInstances += InstanceCount;
+}
+
+void NullCommandList::DrawIndexedInstanced(UINT IndexCountPerInstance, UINT InstanceCount, UINT StartIndexLocation,
+	INT BaseVertexLocation, UINT StartInstanceLocation)
+{
+	if (!ValidateDraw("DrawIndexedInstanced", true))
+		return;
+
+	++stats.drawCalls;
+	stats.drawInstances += InstanceCount;
+}
+
+void NullCommandList::Dispatch(UINT ThreadGroupCountX, UINT ThreadGroupCountY, UINT ThreadGroupCountZ)
+{
+	if (!ValidateDispatch("Dispatch"))
+		return;
+
+	if (ThreadGroupCountX == 0 || ThreadGroupCountY == 0 || ThreadGroupCountZ == 0)
+		ReportError("Dispatch", "스레드 그룹의 개수가 0입니다.");
+
+	++stats.dispatches;
+}
+
+void NullCommandList::CopyBufferRegion(ID3D12Resource* pDstBuffer, UINT64 DstOffset, ID3D12Resource* pSrcBuffer,
+	UINT64 SrcOffset, UINT64 NumBytes)
+{
+	if (!ValidateRecording("CopyBufferRegion"))
+		return;
+
+	if (DstOffset + NumBytes > pDstBuffer->GetDesc().Width || SrcOffset + NumBytes > pSrcBuffer->GetDesc().Width)
+		ReportError("CopyBufferRegion", "복사할 범위가 버퍼의 크기를 벗어납니다.");
+
+	++stats.copies;
+}
+
+void NullCommandList::CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION* pDst, UINT DstX, UINT DstY, UINT DstZ,
+	const D3D12_TEXTURE_COPY_LOCATION* pSrc, const D3D12_BOX* pSrcBox)
+{
+	if (!ValidateRecording("CopyTextureRegion"))
+		return;
+
+	++stats.copies;
+}
+
+void NullCommandList::CopyResource(ID3D12Resource* pDstResource, ID3D12Resource* pSrcResource)
+{
+	if (!ValidateRecording("CopyResource"))
+		return;
+
+	if (pDstResource == pSrcResource)
+		ReportError("CopyResource", "원본과 대상이 같은 리소스입니다.");
+
+	++stats.copies;
+}
+
+void NullCommandList::CopyTiles(ID3D12Resource* pTiledResource, const D3D12_TILED_RESOURCE_COORDINATE* pTileRegionStartCoordinate,
+	const D3D12_TILE_REGION_SIZE* pTileRegionSize, ID3D12Resource* pBuffer, UINT64 BufferStartOffsetInBytes, D3D12_TILE_COPY_FLAGS Flags)
+{
+	if (!ValidateRecording("CopyTiles"))
+		return;
+
+	++stats.copies;
+}
+
+void NullCommandList::ResolveSubresource(ID3D12Resource* pDstResource, UINT DstSubresource, ID3D12Resource* pSrcResource,
+	UINT SrcSubresource, DXGI_FORMAT Format)
+{
+	if (!ValidateRecording("ResolveSubresource"))
+		return;
+
+	++stats.copies;
+}
+
+void NullCommandList::IASetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY PrimitiveTopology)
+{
+	if (!ValidateRecording("IASetPrimitiveTopology"))
+		return;
+
+	topology = PrimitiveTopology;
+}
+
+void NullCommandList::RSSetViewports(UINT NumViewports, const D3D12_VIEWPORT* pViewports)
+{
+	if (!ValidateRecording("RSSetViewports"))
+		return;
+
+	hasViewport = NumViewports > 0;
+}
+
+void NullCommandList::RSSetScissorRects(UINT NumRects, const D3D12_RECT* pRects)
+{
+	if (!ValidateRecording("RSSetScissorRects"))
+		return;
+
+	hasScissorRect = NumRects > 0;
+}
+
+void NullCommandList::OMSetBlendFactor(const FLOAT BlendFactor[4])
+{
+	ValidateRecording("OMSetBlendFactor");
+}
+
+void NullCommandList::OMSetStencilRef(UINT StencilRef)
+{
+	ValidateRecording("OMSetStencilRef");
+}
+
+void NullCommandList::SetPipelineState(ID3D12PipelineState* pPipelineState)
+{
+	if (!ValidateRecording("SetPipelineState"))
+		return;
+
+	pipelineState = pPipelineState;
+	++stats.pipelineStateChanges;
+}
+
+void NullCommandList::ResourceBarrier(UINT NumBarriers, const D3D12_RESOURCE_BARRIER* pBarriers)
+{
+	if (!ValidateRecording("ResourceBarrier"))
+		return;
+
+	for (UINT i = 0; i < NumBarriers; ++i)
+	{
+		const D3D12_RESOURCE_BARRIER& barrier = pBarriers[i];
+		if (barrier.Type == D3D12_RESOURCE_BARRIER_TYPE_TRANSITION)
+		{
+			if (barrier.Transition.StateBefore == barrier.Transition.StateAfter)
+				ReportError("ResourceBarrier", "이전 상태와 이후 상태가 같습니다.");
+
+			barriers.push_back(barrier);
+		}
+	}
+
+	stats.resourceBarriers += NumBarriers;
+}
+
+void NullCommandList::ExecuteBundle(ID3D12GraphicsCommandList* pCommandList)
+{
+	ValidateRecording("ExecuteBundle");
+}
+
+void NullCommandList::SetDescriptorHeaps(UINT NumDescriptorHeaps, ID3D12DescriptorHeap* const* ppDescriptorHeaps)
+{
+	if (!ValidateRecording("SetDescriptorHeaps"))
+		return;
+
+	descriptorHeaps[0] = nullptr;
+	descriptorHeaps[1] = nullptr;
+
+	for (UINT i = 0; i < NumDescriptorHeaps; ++i)
+	{
+		NullDescriptorHeap* heap = static_cast<NullDescriptorHeap*>(ppDescriptorHeaps[i]);
+		const D3D12_DESCRIPTOR_HEAP_DESC desc = heap->GetDesc();
+
+		if (!(desc.Flags & D3D12_DESCRIPTOR_HEAP_FLAG_SHADER_VISIBLE))
+			ReportError("SetDescriptorHeaps", "셰이더에서 보이지 않는 서술자 힙입니다.");
+
+		switch (desc.Type)
+		{
+		case D3D12_DESCRIPTOR_HEAP_TYPE_CBV_SRV_UAV:
+			descriptorHeaps[0] = heap;
+			break;
+		case D3D12_DESCRIPTOR_HEAP_TYPE_SAMPLER:
+			descriptorHeaps[1] = heap;
+			break;
+		default:
+			ReportError("SetDescriptorHeaps", "RTV, DSV 힙은 설정할 수 없습니다.");
+			break;
+		}
+	}
+
+	++stats.descriptorHeapChanges;
+}
+
+void NullCommandList::SetComputeRootSignature(ID3D12RootSignature* pRootSignature)
+{
+	if (!ValidateRecording("SetComputeRootSignature"))
+		return;
+
+	NullRootSignature* rootSignature = static_cast<NullRootSignature*>(pRootSignature);
+	computeRootSignature = rootSignature;
+	++stats.rootSignatureChanges;
+}
+
+void NullCommandList::SetGraphicsRootSignature(ID3D12RootSignature* pRootSignature)
+{
+	if (!ValidateRecording("SetGraphicsRootSignature"))
+		return;
+
+	NullRootSignature* rootSignature = static_cast<NullRootSignature*>(pRootSignature);
+	graphicsRootSignature = rootSignature;
+	++stats.rootSignatureChanges;
+}
+
+void NullCommandList::SetComputeRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
+{
+	if (ValidateRootArgument("SetComputeRootDescriptorTable", true, RootParameterIndex))
+		ValidateDescriptorTable("SetComputeRootDescriptorTable", BaseDescriptor);
+}
+
+void NullCommandList::SetGraphicsRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor)
+{
+	if (ValidateRootArgument("SetGraphicsRootDescriptorTable", false, RootParameterIndex))
+		ValidateDescriptorTable("SetGraphicsRootDescriptorTable", BaseDescriptor);
+}
+
+void NullCommandList::SetComputeRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues)
+{
+	ValidateRootArgument("SetComputeRoot32BitConstant", true, RootParameterIndex);
+}
+
+void NullCommandList::SetGraphicsRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues)
+{
+	ValidateRootArgument("SetGraphicsRoot32BitConstant", false, RootParameterIndex);
+}
+
+void NullCommandList::SetComputeRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+	const void* pSrcData, UINT DestOffsetIn32BitValues)
+{
+	ValidateRootArgument("SetComputeRoot32BitConstants", true, RootParameterIndex);
+}
+
+void NullCommandList::SetGraphicsRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+	const void* pSrcData, UINT DestOffsetIn32BitValues)
+{
+	ValidateRootArgument("SetGraphicsRoot32BitConstants", false, RootParameterIndex);
+}
+
+void NullCommandList::SetComputeRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	ValidateRootArgument("SetComputeRootConstantBufferView", true, RootParameterIndex);
+}
+
+void NullCommandList::SetGraphicsRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	ValidateRootArgument("SetGraphicsRootConstantBufferView", false, RootParameterIndex);
+}
+
+void NullCommandList::SetComputeRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	ValidateRootArgument("SetComputeRootShaderResourceView", true, RootParameterIndex);
+}
+
+void NullCommandList::SetGraphicsRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	ValidateRootArgument("SetGraphicsRootShaderResourceView", false, RootParameterIndex);
+}
+
+void NullCommandList::SetComputeRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	ValidateRootArgument("SetComputeRootUnorderedAccessView", true, RootParameterIndex);
+}
+
+void NullCommandList::SetGraphicsRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation)
+{
+	ValidateRootArgument("SetGraphicsRootUnorderedAccessView", false, RootParameterIndex);
+}
+
+void NullCommandList::IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* pView)
+{
+	if (!ValidateRecording("IASetIndexBuffer"))
+		return;
+
+	hasIndexBuffer = pView != nullptr;
+	++stats.indexBufferChanges;
+}
+
+void NullCommandList::IASetVertexBuffers(UINT StartSlot, UINT NumViews, const D3D12_VERTEX_BUFFER_VIEW* pViews)
+{
+	if (!ValidateRecording("IASetVertexBuffers"))
+		return;
+
+	++stats.vertexBufferChanges;
+}
+
+void NullCommandList::SOSetTargets(UINT StartSlot, UINT NumViews, const D3D12_STREAM_OUTPUT_BUFFER_VIEW* pViews)
+{
+	ValidateRecording("SOSetTargets");
+}
+
+void NullCommandList::OMSetRenderTargets(UINT NumRenderTargetDescriptors, const D3D12_CPU_DESCRIPTOR_HANDLE* pRenderTargetDescriptors,
+	BOOL RTsSingleHandleToDescriptorRange, const D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor)
+{
+	if (!ValidateRecording("OMSetRenderTargets"))
+		return;
+
+	if (NumRenderTargetDescriptors > D3D12_SIMULTANEOUS_RENDER_TARGET_COUNT)
+		ReportError("OMSetRenderTargets", "렌더 타겟의 개수가 너무 많습니다.");
+
+	renderTargetCount = NumRenderTargetDescriptors;
+	hasDepthStencil = pDepthStencilDescriptor != nullptr;
+	++stats.renderTargetChanges;
+}
+
+void NullCommandList::ClearDepthStencilView(D3D12_CPU_DESCRIPTOR_HANDLE DepthStencilView, D3D12_CLEAR_FLAGS ClearFlags,
+	FLOAT Depth, UINT8 Stencil, UINT NumRects, const D3D12_RECT* pRects)
+{
+	if (!ValidateRecording("ClearDepthStencilView"))
+		return;
+
+	++stats.clears;
+}
+
+void NullCommandList::ClearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView, const FLOAT ColorRGBA[4],
+	UINT NumRects, const D3D12_RECT* pRects)
+{
+	if (!ValidateRecording("ClearRenderTargetView"))
+		return;
+
+	++stats.clears;
+}
+
+void NullCommandList::ClearUnorderedAccessViewUint(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+	D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const UINT Values[4], UINT NumRects, const D3D12_RECT* pRects)
+{
+	if (!ValidateRecording("ClearUnorderedAccessViewUint"))
+		return;
+
+	ValidateDescriptorTable("ClearUnorderedAccessViewUint", ViewGPUHandleInCurrentHeap);
+	++stats.clears;
+}
+
+void NullCommandList::ClearUnorderedAccessViewFloat(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+	D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const FLOAT Values[4], UINT NumRects, const D3D12_RECT* pRects)
+{
+	if (!ValidateRecording("ClearUnorderedAccessViewFloat"))
+		return;
+
+	ValidateDescriptorTable("ClearUnorderedAccessViewFloat", ViewGPUHandleInCurrentHeap);
+	++stats.clears;
+}
+
+void NullCommandList::DiscardResource(ID3D12Resource* pResource, const D3D12_DISCARD_REGION* pRegion)
+{
+	ValidateRecording("DiscardResource");
+}
+
+void NullCommandList::BeginQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index)
+{
+	ValidateRecording("BeginQuery");
+}
+
+void NullCommandList::EndQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index)
+{
+	ValidateRecording("EndQuery");
+}
+
+void NullCommandList::ResolveQueryData(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT StartIndex, UINT NumQueries,
+	ID3D12Resource* pDestinationBuffer, UINT64 AlignedDestinationBufferOffset)
+{
+	ValidateRecording("ResolveQueryData");
+}
+
+void NullCommandList::SetPredication(ID3D12Resource* pBuffer, UINT64 AlignedBufferOffset, D3D12_PREDICATION_OP Operation)
+{
+	ValidateRecording("SetPredication");
+}
+
+void NullCommandList::SetMarker(UINT Metadata, const void* pData, UINT Size) { }
+
+void NullCommandList::BeginEvent(UINT Metadata, const void* pData, UINT Size) { }
+
+void NullCommandList::EndEvent() { }
+
+void NullCommandList::ExecuteIndirect(ID3D12CommandSignature* pCommandSignature, UINT MaxCommandCount,
+	ID3D12Resource* pArgumentBuffer, UINT64 ArgumentBufferOffset, ID3D12Resource* pCountBuffer, UINT64 CountBufferOffset)
+{
+	if (!ValidateRecording("ExecuteIndirect"))
+		return;
+
+	if (pCommandSignature == nullptr || pArgumentBuffer == nullptr)
+		ReportError("ExecuteIndirect", "명령 서명 또는 인자 버퍼가 없습니다.");
+
+	++stats.indirectExecutes;
+}
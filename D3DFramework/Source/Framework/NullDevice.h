@@ -0,0 +1,500 @@
+#pragma once
+
+#include <d3d12.h>
+#include <wrl.h>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// 널 백엔드가 기록한 호출의 개수
+struct NullBackendStats
+{
+	UINT64 drawCalls = 0;
+	UINT64 drawInstances = 0;
+	UINT64 dispatches = 0;
+	UINT64 indirectExecutes = 0;
+	UINT64 pipelineStateChanges = 0;
+	UINT64 rootSignatureChanges = 0;
+	UINT64 rootArguments = 0;
+	UINT64 descriptorHeapChanges = 0;
+	UINT64 vertexBufferChanges = 0;
+	UINT64 indexBufferChanges = 0;
+	UINT64 renderTargetChanges = 0;
+	UINT64 resourceBarriers = 0;
+	UINT64 copies = 0;
+	UINT64 clears = 0;
+
+	UINT64 executedCommandLists = 0;
+	UINT64 fenceSignals = 0;
+	UINT64 createdResources = 0;
+	UINT64 createdDescriptors = 0;
+	UINT64 createdPipelineStates = 0;
+	UINT64 validationErrors = 0;
+
+	NullBackendStats& operator+=(const NullBackendStats& rhs);
+};
+
+/*
+널 백엔드의 COM 객체가 공통으로 구현하는 IUnknown과 ID3D12Object
+*/
+template<typename Interface>
+class NullObject : public Interface
+{
+public:
+	NullObject() = default;
+	NullObject(const NullObject& rhs) = delete;
+	NullObject& operator=(const NullObject& rhs) = delete;
+	virtual ~NullObject() = default;
+
+public:
+	virtual HRESULT STDMETHODCALLTYPE QueryInterface(REFIID riid, void** ppvObject) override
+	{
+		if (ppvObject == nullptr)
+			return E_POINTER;
+
+		if (riid == __uuidof(Interface) || IsBase<IUnknown>(riid) || IsBase<ID3D12Object>(riid) ||
+			IsBase<ID3D12DeviceChild>(riid) || IsBase<ID3D12Pageable>(riid) || IsBase<ID3D12CommandList>(riid))
+		{
+			*ppvObject = static_cast<Interface*>(this);
+			AddRef();
+			return S_OK;
+		}
+
+		*ppvObject = nullptr;
+		return E_NOINTERFACE;
+	}
+
+	virtual ULONG STDMETHODCALLTYPE AddRef() override { return ++refCount; }
+
+	virtual ULONG STDMETHODCALLTYPE Release() override
+	{
+		const ULONG count = --refCount;
+		if (count == 0)
+			delete this;
+		return count;
+	}
+
+	virtual HRESULT STDMETHODCALLTYPE GetPrivateData(REFGUID guid, UINT* pDataSize, void* pData) override { return DXGI_ERROR_NOT_FOUND; }
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateData(REFGUID guid, UINT DataSize, const void* pData) override { return S_OK; }
+	virtual HRESULT STDMETHODCALLTYPE SetPrivateDataInterface(REFGUID guid, const IUnknown* pData) override { return S_OK; }
+	virtual HRESULT STDMETHODCALLTYPE SetName(LPCWSTR Name) override { return S_OK; }
+
+private:
+	template<typename Base>
+	static bool IsBase(REFIID riid)
+	{
+		if constexpr (std::is_base_of_v<Base, Interface>)
+			return riid == __uuidof(Base);
+		else
+			return false;
+	}
+
+private:
+	std::atomic<ULONG> refCount = 1;
+};
+
+/*
+GPU 작업을 전혀 하지 않는 ID3D12Device
+창과 GPU가 없는 환경에서도 프레임 루프 전체를 실행하여 CPU 쪽의 비용을 잴 수 있도록
+리소스와 서술자는 가짜 주소만 나누어주고, 명령 리스트는 호출을 세고 상태를 검증한다.
+업로드 힙과 리드백 힙의 버퍼만 CPU 메모리를 가지며, 업로드 버퍼의 배치는 실제 드라이버와 같이 계산하여
+텍셀을 업로드 버퍼로 복사하는 비용까지 재지만 GPU 쪽 텍스처로는 복사하지 않는다.
+힙, 예약 리소스, 공유 핸들, 쿼리 힙처럼 프레임워크가 사용하지 않는 기능은 구현하지 않으며,
+호출되면 E_NOTIMPL을 반환하고 검증 오류로 기록하여 조용히 실패하지 않게 한다.
+명령 큐의 Signal은 바로 완료되므로 펜스를 기다리는 일이 없다.
+검증 오류는 처음 몇 개만 출력하고 나머지는 개수만 센다.
+*/
+class NullDevice final : public NullObject<ID3D12Device>
+{
+public:
+	NullDevice();
+	virtual ~NullDevice();
+
+public:
+	// 명령 큐가 실행한 명령 리스트의 통계를 합친다.
+	void AddStats(const NullBackendStats& listStats);
+	void Count(UINT64 NullBackendStats::* counter, const UINT64 value = 1);
+	NullBackendStats GetStats() const;
+	void ResetStats();
+	// 전체 통계와 프레임당 평균을 출력한다.
+	void PrintStats(const UINT32 frameCount) const;
+
+	// 검증 오류를 기록한다.
+	void ReportError(const char* message);
+	// 프레임워크가 사용하지 않아 구현하지 않은 호출을 검증 오류로 기록하고 E_NOTIMPL을 반환한다.
+	HRESULT ReportUnsupported(const char* function);
+
+	// 실행되는 명령 리스트의 리소스 장벽을 리소스의 상태에 적용하고 검증한다.
+	void ApplyBarriers(const std::vector<D3D12_RESOURCE_BARRIER>& barriers);
+
+	D3D12_GPU_VIRTUAL_ADDRESS AllocateGpuAddress(const UINT64 size);
+
+public:
+	virtual UINT STDMETHODCALLTYPE GetNodeCount() override;
+	virtual HRESULT STDMETHODCALLTYPE CreateCommandQueue(const D3D12_COMMAND_QUEUE_DESC* pDesc, REFIID riid, void** ppCommandQueue) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE type, REFIID riid, void** ppCommandAllocator) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateGraphicsPipelineState(const D3D12_GRAPHICS_PIPELINE_STATE_DESC* pDesc, REFIID riid, void** ppPipelineState) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateComputePipelineState(const D3D12_COMPUTE_PIPELINE_STATE_DESC* pDesc, REFIID riid, void** ppPipelineState) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateCommandList(UINT nodeMask, D3D12_COMMAND_LIST_TYPE type, ID3D12CommandAllocator* pCommandAllocator,
+		ID3D12PipelineState* pInitialState, REFIID riid, void** ppCommandList) override;
+	virtual HRESULT STDMETHODCALLTYPE CheckFeatureSupport(D3D12_FEATURE Feature, void* pFeatureSupportData, UINT FeatureSupportDataSize) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateDescriptorHeap(const D3D12_DESCRIPTOR_HEAP_DESC* pDescriptorHeapDesc, REFIID riid, void** ppvHeap) override;
+	virtual UINT STDMETHODCALLTYPE GetDescriptorHandleIncrementSize(D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapType) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateRootSignature(UINT nodeMask, const void* pBlobWithRootSignature, SIZE_T blobLengthInBytes,
+		REFIID riid, void** ppvRootSignature) override;
+	virtual void STDMETHODCALLTYPE CreateConstantBufferView(const D3D12_CONSTANT_BUFFER_VIEW_DESC* pDesc, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	virtual void STDMETHODCALLTYPE CreateShaderResourceView(ID3D12Resource* pResource, const D3D12_SHADER_RESOURCE_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	virtual void STDMETHODCALLTYPE CreateUnorderedAccessView(ID3D12Resource* pResource, ID3D12Resource* pCounterResource,
+		const D3D12_UNORDERED_ACCESS_VIEW_DESC* pDesc, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	virtual void STDMETHODCALLTYPE CreateRenderTargetView(ID3D12Resource* pResource, const D3D12_RENDER_TARGET_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	virtual void STDMETHODCALLTYPE CreateDepthStencilView(ID3D12Resource* pResource, const D3D12_DEPTH_STENCIL_VIEW_DESC* pDesc,
+		D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	virtual void STDMETHODCALLTYPE CreateSampler(const D3D12_SAMPLER_DESC* pDesc, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptor) override;
+	virtual void STDMETHODCALLTYPE CopyDescriptors(UINT NumDestDescriptorRanges, const D3D12_CPU_DESCRIPTOR_HANDLE* pDestDescriptorRangeStarts,
+		const UINT* pDestDescriptorRangeSizes, UINT NumSrcDescriptorRanges, const D3D12_CPU_DESCRIPTOR_HANDLE* pSrcDescriptorRangeStarts,
+		const UINT* pSrcDescriptorRangeSizes, D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType) override;
+	virtual void STDMETHODCALLTYPE CopyDescriptorsSimple(UINT NumDescriptors, D3D12_CPU_DESCRIPTOR_HANDLE DestDescriptorRangeStart,
+		D3D12_CPU_DESCRIPTOR_HANDLE SrcDescriptorRangeStart, D3D12_DESCRIPTOR_HEAP_TYPE DescriptorHeapsType) override;
+	virtual D3D12_RESOURCE_ALLOCATION_INFO STDMETHODCALLTYPE GetResourceAllocationInfo(UINT visibleMask, UINT numResourceDescs,
+		const D3D12_RESOURCE_DESC* pResourceDescs) override;
+	virtual D3D12_HEAP_PROPERTIES STDMETHODCALLTYPE GetCustomHeapProperties(UINT nodeMask, D3D12_HEAP_TYPE heapType) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateCommittedResource(const D3D12_HEAP_PROPERTIES* pHeapProperties, D3D12_HEAP_FLAGS HeapFlags,
+		const D3D12_RESOURCE_DESC* pDesc, D3D12_RESOURCE_STATES InitialResourceState, const D3D12_CLEAR_VALUE* pOptimizedClearValue,
+		REFIID riidResource, void** ppvResource) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateHeap(const D3D12_HEAP_DESC* pDesc, REFIID riid, void** ppvHeap) override;
+	virtual HRESULT STDMETHODCALLTYPE CreatePlacedResource(ID3D12Heap* pHeap, UINT64 HeapOffset, const D3D12_RESOURCE_DESC* pDesc,
+		D3D12_RESOURCE_STATES InitialState, const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riid, void** ppvResource) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateReservedResource(const D3D12_RESOURCE_DESC* pDesc, D3D12_RESOURCE_STATES InitialState,
+		const D3D12_CLEAR_VALUE* pOptimizedClearValue, REFIID riid, void** ppvResource) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateSharedHandle(ID3D12DeviceChild* pObject, const SECURITY_ATTRIBUTES* pAttributes,
+		DWORD Access, LPCWSTR Name, HANDLE* pHandle) override;
+	virtual HRESULT STDMETHODCALLTYPE OpenSharedHandle(HANDLE NTHandle, REFIID riid, void** ppvObj) override;
+	virtual HRESULT STDMETHODCALLTYPE OpenSharedHandleByName(LPCWSTR Name, DWORD Access, HANDLE* pNTHandle) override;
+	virtual HRESULT STDMETHODCALLTYPE MakeResident(UINT NumObjects, ID3D12Pageable* const* ppObjects) override;
+	virtual HRESULT STDMETHODCALLTYPE Evict(UINT NumObjects, ID3D12Pageable* const* ppObjects) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateFence(UINT64 InitialValue, D3D12_FENCE_FLAGS Flags, REFIID riid, void** ppFence) override;
+	virtual HRESULT STDMETHODCALLTYPE GetDeviceRemovedReason() override;
+	virtual void STDMETHODCALLTYPE GetCopyableFootprints(const D3D12_RESOURCE_DESC* pResourceDesc, UINT FirstSubresource, UINT NumSubresources,
+		UINT64 BaseOffset, D3D12_PLACED_SUBRESOURCE_FOOTPRINT* pLayouts, UINT* pNumRows, UINT64* pRowSizeInBytes, UINT64* pTotalBytes) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateQueryHeap(const D3D12_QUERY_HEAP_DESC* pDesc, REFIID riid, void** ppvHeap) override;
+	virtual HRESULT STDMETHODCALLTYPE SetStablePowerState(BOOL Enable) override;
+	virtual HRESULT STDMETHODCALLTYPE CreateCommandSignature(const D3D12_COMMAND_SIGNATURE_DESC* pDesc, ID3D12RootSignature* pRootSignature,
+		REFIID riid, void** ppvCommandSignature) override;
+	virtual void STDMETHODCALLTYPE GetResourceTiling(ID3D12Resource* pTiledResource, UINT* pNumTilesForEntireResource,
+		D3D12_PACKED_MIP_INFO* pPackedMipDesc, D3D12_TILE_SHAPE* pStandardTileShapeForNonPackedMips, UINT* pNumSubresourceTilings,
+		UINT FirstSubresourceTilingToGet, D3D12_SUBRESOURCE_TILING* pSubresourceTilingsForNonPackedMips) override;
+	virtual LUID STDMETHODCALLTYPE GetAdapterLuid() override;
+
+private:
+	// 서술자 힙의 시작 주소를 나누어준다. 0은 잘못된 핸들로 쓰이므로 나누어주지 않는다.
+	void AllocateDescriptors(const D3D12_DESCRIPTOR_HEAP_DESC& desc, D3D12_CPU_DESCRIPTOR_HANDLE& cpuStart, D3D12_GPU_DESCRIPTOR_HANDLE& gpuStart);
+	void ValidateDescriptor(const D3D12_CPU_DESCRIPTOR_HANDLE handle, const char* function);
+
+public:
+	// 모든 종류의 서술자에 같은 크기를 사용한다.
+	static constexpr UINT descriptorIncrementSize = 32;
+	// 출력할 검증 오류의 최대 개수
+	static constexpr UINT32 maxPrintedErrors = 32;
+
+private:
+	mutable std::mutex statsMutex;
+	NullBackendStats stats;
+
+	// 여러 명령 큐가 동시에 리소스의 상태를 바꾸지 않도록 보호한다.
+	std::mutex barrierMutex;
+
+	std::atomic<UINT64> nextGpuAddress;
+	std::atomic<SIZE_T> nextCpuDescriptor;
+	std::atomic<UINT64> nextGpuDescriptor;
+};
+
+/*
+널 백엔드의 디바이스 자식 객체가 공통으로 구현하는 ID3D12DeviceChild
+생성한 디바이스의 참조를 가진다.
+*/
+template<typename Interface>
+class NullDeviceChild : public NullObject<Interface>
+{
+public:
+	NullDeviceChild(NullDevice* device) : device(device) { }
+	virtual ~NullDeviceChild() = default;
+
+public:
+	virtual HRESULT STDMETHODCALLTYPE GetDevice(REFIID riid, void** ppvDevice) override
+	{
+		return device->QueryInterface(riid, ppvDevice);
+	}
+
+	NullDevice* GetNullDevice() const { return device.Get(); }
+
+protected:
+	Microsoft::WRL::ComPtr<NullDevice> device;
+};
+
+class NullResource final : public NullDeviceChild<ID3D12Resource>
+{
+public:
+	NullResource(NullDevice* device, const D3D12_HEAP_PROPERTIES& heapProperties, const D3D12_HEAP_FLAGS heapFlags,
+		const D3D12_RESOURCE_DESC& desc, const D3D12_RESOURCE_STATES initialState);
+	virtual ~NullResource();
+
+public:
+	virtual HRESULT STDMETHODCALLTYPE Map(UINT Subresource, const D3D12_RANGE* pReadRange, void** ppData) override;
+	virtual void STDMETHODCALLTYPE Unmap(UINT Subresource, const D3D12_RANGE* pWrittenRange) override;
+	virtual D3D12_RESOURCE_DESC STDMETHODCALLTYPE GetDesc() override;
+	virtual D3D12_GPU_VIRTUAL_ADDRESS STDMETHODCALLTYPE GetGPUVirtualAddress() override;
+	virtual HRESULT STDMETHODCALLTYPE WriteToSubresource(UINT DstSubresource, const D3D12_BOX* pDstBox, const void* pSrcData,
+		UINT SrcRowPitch, UINT SrcDepthPitch) override;
+	virtual HRESULT STDMETHODCALLTYPE ReadFromSubresource(void* pDstData, UINT DstRowPitch, UINT DstDepthPitch,
+		UINT SrcSubresource, const D3D12_BOX* pSrcBox) override;
+	virtual HRESULT STDMETHODCALLTYPE GetHeapProperties(D3D12_HEAP_PROPERTIES* pHeapProperties, D3D12_HEAP_FLAGS* pHeapFlags) override;
+
+public:
+	// 실행된 장벽까지 반영된 리소스의 상태. NullDevice::ApplyBarriers만 접근한다.
+	D3D12_RESOURCE_STATES state;
+
+private:
+	D3D12_HEAP_PROPERTIES heapProperties;
+	D3D12_HEAP_FLAGS heapFlags;
+	D3D12_RESOURCE_DESC desc;
+	D3D12_GPU_VIRTUAL_ADDRESS gpuAddress = 0;
+
+	// 업로드 힙과 리드백 힙의 버퍼만 CPU 메모리를 가진다.
+	std::unique_ptr<BYTE[]> memory;
+};
+
+class NullDescriptorHeap final : public NullDeviceChild<ID3D12DescriptorHeap>
+{
+public:
+	NullDescriptorHeap(NullDevice* device, const D3D12_DESCRIPTOR_HEAP_DESC& desc,
+		const D3D12_CPU_DESCRIPTOR_HANDLE cpuStart, const D3D12_GPU_DESCRIPTOR_HANDLE gpuStart);
+	virtual ~NullDescriptorHeap();
+
+public:
+	virtual D3D12_DESCRIPTOR_HEAP_DESC STDMETHODCALLTYPE GetDesc() override;
+	virtual D3D12_CPU_DESCRIPTOR_HANDLE STDMETHODCALLTYPE GetCPUDescriptorHandleForHeapStart() override;
+	virtual D3D12_GPU_DESCRIPTOR_HANDLE STDMETHODCALLTYPE GetGPUDescriptorHandleForHeapStart() override;
+
+	// GPU 서술자 핸들이 이 힙에 속하는지 여부를 반환한다.
+	bool Contains(const D3D12_GPU_DESCRIPTOR_HANDLE handle) const;
+
+private:
+	D3D12_DESCRIPTOR_HEAP_DESC desc;
+	D3D12_CPU_DESCRIPTOR_HANDLE cpuStart;
+	D3D12_GPU_DESCRIPTOR_HANDLE gpuStart;
+};
+
+class NullFence final : public NullDeviceChild<ID3D12Fence>
+{
+public:
+	NullFence(NullDevice* device, const UINT64 initialValue);
+	virtual ~NullFence();
+
+public:
+	virtual UINT64 STDMETHODCALLTYPE GetCompletedValue() override;
+	virtual HRESULT STDMETHODCALLTYPE SetEventOnCompletion(UINT64 Value, HANDLE hEvent) override;
+	virtual HRESULT STDMETHODCALLTYPE Signal(UINT64 Value) override;
+
+private:
+	std::atomic<UINT64> value;
+
+	// 아직 도달하지 않은 값을 기다리는 이벤트들
+	std::mutex eventMutex;
+	std::vector<std::pair<UINT64, HANDLE>> pendingEvents;
+};
+
+class NullCommandAllocator final : public NullDeviceChild<ID3D12CommandAllocator>
+{
+public:
+	NullCommandAllocator(NullDevice* device, const D3D12_COMMAND_LIST_TYPE type);
+	virtual ~NullCommandAllocator();
+
+public:
+	virtual HRESULT STDMETHODCALLTYPE Reset() override;
+
+private:
+	D3D12_COMMAND_LIST_TYPE type;
+};
+
+class NullRootSignature final : public NullDeviceChild<ID3D12RootSignature>
+{
+public:
+	NullRootSignature(NullDevice* device, const UINT32 parameterCount);
+	virtual ~NullRootSignature();
+
+public:
+	// 직렬화된 서명을 해석하지 못했다면 UINT32_MAX이며 인덱스를 검증하지 않는다.
+	const UINT32 parameterCount;
+};
+
+class NullPipelineState final : public NullDeviceChild<ID3D12PipelineState>
+{
+public:
+	NullPipelineState(NullDevice* device, const bool isCompute);
+	virtual ~NullPipelineState();
+
+public:
+	virtual HRESULT STDMETHODCALLTYPE GetCachedBlob(ID3DBlob** ppBlob) override;
+
+public:
+	const bool isCompute;
+};
+
+class NullCommandSignature final : public NullDeviceChild<ID3D12CommandSignature>
+{
+public:
+	NullCommandSignature(NullDevice* device);
+	virtual ~NullCommandSignature();
+};
+
+class NullCommandQueue final : public NullDeviceChild<ID3D12CommandQueue>
+{
+public:
+	NullCommandQueue(NullDevice* device, const D3D12_COMMAND_QUEUE_DESC& desc);
+	virtual ~NullCommandQueue();
+
+public:
+	virtual void STDMETHODCALLTYPE UpdateTileMappings(ID3D12Resource* pResource, UINT NumResourceRegions,
+		const D3D12_TILED_RESOURCE_COORDINATE* pResourceRegionStartCoordinates, const D3D12_TILE_REGION_SIZE* pResourceRegionSizes,
+		ID3D12Heap* pHeap, UINT NumRanges, const D3D12_TILE_RANGE_FLAGS* pRangeFlags, const UINT* pHeapRangeStartOffsets,
+		const UINT* pRangeTileCounts, D3D12_TILE_MAPPING_FLAGS Flags) override;
+	virtual void STDMETHODCALLTYPE CopyTileMappings(ID3D12Resource* pDstResource, const D3D12_TILED_RESOURCE_COORDINATE* pDstRegionStartCoordinate,
+		ID3D12Resource* pSrcResource, const D3D12_TILED_RESOURCE_COORDINATE* pSrcRegionStartCoordinate,
+		const D3D12_TILE_REGION_SIZE* pRegionSize, D3D12_TILE_MAPPING_FLAGS Flags) override;
+	virtual void STDMETHODCALLTYPE ExecuteCommandLists(UINT NumCommandLists, ID3D12CommandList* const* ppCommandLists) override;
+	virtual void STDMETHODCALLTYPE SetMarker(UINT Metadata, const void* pData, UINT Size) override;
+	virtual void STDMETHODCALLTYPE BeginEvent(UINT Metadata, const void* pData, UINT Size) override;
+	virtual void STDMETHODCALLTYPE EndEvent() override;
+	virtual HRESULT STDMETHODCALLTYPE Signal(ID3D12Fence* pFence, UINT64 Value) override;
+	virtual HRESULT STDMETHODCALLTYPE Wait(ID3D12Fence* pFence, UINT64 Value) override;
+	virtual HRESULT STDMETHODCALLTYPE GetTimestampFrequency(UINT64* pFrequency) override;
+	virtual HRESULT STDMETHODCALLTYPE GetClockCalibration(UINT64* pGpuTimestamp, UINT64* pCpuTimestamp) override;
+	virtual D3D12_COMMAND_QUEUE_DESC STDMETHODCALLTYPE GetDesc() override;
+
+private:
+	D3D12_COMMAND_QUEUE_DESC desc;
+};
+
+/*
+명령을 실행하지 않고 세기만 하는 명령 리스트
+기록 중인지, 그리기 전에 파이프라인 상태와 루트 서명, 뷰포트, 렌더 타겟이 설정되었는지,
+루트 인자의 인덱스와 서술자 테이블이 설정된 힙에 속하는지 등을 검증한다.
+리소스 장벽은 기록해두었다가 명령 큐에서 실행될 때 리소스의 상태와 비교한다.
+*/
+class NullCommandList final : public NullDeviceChild<ID3D12GraphicsCommandList>
+{
+public:
+	NullCommandList(NullDevice* device, const D3D12_COMMAND_LIST_TYPE type, ID3D12PipelineState* initialState);
+	virtual ~NullCommandList();
+
+public:
+	bool IsRecording() const;
+	const NullBackendStats& GetStats() const;
+	const std::vector<D3D12_RESOURCE_BARRIER>& GetBarriers() const;
+
+public:
+	virtual D3D12_COMMAND_LIST_TYPE STDMETHODCALLTYPE GetType() override;
+	virtual HRESULT STDMETHODCALLTYPE Close() override;
+	virtual HRESULT STDMETHODCALLTYPE Reset(ID3D12CommandAllocator* pAllocator, ID3D12PipelineState* pInitialState) override;
+	virtual void STDMETHODCALLTYPE ClearState(ID3D12PipelineState* pPipelineState) override;
+	virtual void STDMETHODCALLTYPE DrawInstanced(UINT VertexCountPerInstance, UINT InstanceCount,
+		UINT StartVertexLocation, UINT StartInstanceLocation) override;
+	virtual void STDMETHODCALLTYPE DrawIndexedInstanced(UINT IndexCountPerInstance, UINT InstanceCount, UINT StartIndexLocation,
+		INT BaseVertexLocation, UINT StartInstanceLocation) override;
+	virtual void STDMETHODCALLTYPE Dispatch(UINT ThreadGroupCountX, UINT ThreadGroupCountY, UINT ThreadGroupCountZ) override;
+	virtual void STDMETHODCALLTYPE CopyBufferRegion(ID3D12Resource* pDstBuffer, UINT64 DstOffset, ID3D12Resource* pSrcBuffer,
+		UINT64 SrcOffset, UINT64 NumBytes) override;
+	virtual void STDMETHODCALLTYPE CopyTextureRegion(const D3D12_TEXTURE_COPY_LOCATION* pDst, UINT DstX, UINT DstY, UINT DstZ,
+		const D3D12_TEXTURE_COPY_LOCATION* pSrc, const D3D12_BOX* pSrcBox) override;
+	virtual void STDMETHODCALLTYPE CopyResource(ID3D12Resource* pDstResource, ID3D12Resource* pSrcResource) override;
+	virtual void STDMETHODCALLTYPE CopyTiles(ID3D12Resource* pTiledResource, const D3D12_TILED_RESOURCE_COORDINATE* pTileRegionStartCoordinate,
+		const D3D12_TILE_REGION_SIZE* pTileRegionSize, ID3D12Resource* pBuffer, UINT64 BufferStartOffsetInBytes, D3D12_TILE_COPY_FLAGS Flags) override;
+	virtual void STDMETHODCALLTYPE ResolveSubresource(ID3D12Resource* pDstResource, UINT DstSubresource, ID3D12Resource* pSrcResource,
+		UINT SrcSubresource, DXGI_FORMAT Format) override;
+	virtual void STDMETHODCALLTYPE IASetPrimitiveTopology(D3D12_PRIMITIVE_TOPOLOGY PrimitiveTopology) override;
+	virtual void STDMETHODCALLTYPE RSSetViewports(UINT NumViewports, const D3D12_VIEWPORT* pViewports) override;
+	virtual void STDMETHODCALLTYPE RSSetScissorRects(UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE OMSetBlendFactor(const FLOAT BlendFactor[4]) override;
+	virtual void STDMETHODCALLTYPE OMSetStencilRef(UINT StencilRef) override;
+	virtual void STDMETHODCALLTYPE SetPipelineState(ID3D12PipelineState* pPipelineState) override;
+	virtual void STDMETHODCALLTYPE ResourceBarrier(UINT NumBarriers, const D3D12_RESOURCE_BARRIER* pBarriers) override;
+	virtual void STDMETHODCALLTYPE ExecuteBundle(ID3D12GraphicsCommandList* pCommandList) override;
+	virtual void STDMETHODCALLTYPE SetDescriptorHeaps(UINT NumDescriptorHeaps, ID3D12DescriptorHeap* const* ppDescriptorHeaps) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootSignature(ID3D12RootSignature* pRootSignature) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootSignature(ID3D12RootSignature* pRootSignature) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootDescriptorTable(UINT RootParameterIndex, D3D12_GPU_DESCRIPTOR_HANDLE BaseDescriptor) override;
+	virtual void STDMETHODCALLTYPE SetComputeRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRoot32BitConstant(UINT RootParameterIndex, UINT SrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetComputeRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+		const void* pSrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRoot32BitConstants(UINT RootParameterIndex, UINT Num32BitValuesToSet,
+		const void* pSrcData, UINT DestOffsetIn32BitValues) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootConstantBufferView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootShaderResourceView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetComputeRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE SetGraphicsRootUnorderedAccessView(UINT RootParameterIndex, D3D12_GPU_VIRTUAL_ADDRESS BufferLocation) override;
+	virtual void STDMETHODCALLTYPE IASetIndexBuffer(const D3D12_INDEX_BUFFER_VIEW* pView) override;
+	virtual void STDMETHODCALLTYPE IASetVertexBuffers(UINT StartSlot, UINT NumViews, const D3D12_VERTEX_BUFFER_VIEW* pViews) override;
+	virtual void STDMETHODCALLTYPE SOSetTargets(UINT StartSlot, UINT NumViews, const D3D12_STREAM_OUTPUT_BUFFER_VIEW* pViews) override;
+	virtual void STDMETHODCALLTYPE OMSetRenderTargets(UINT NumRenderTargetDescriptors, const D3D12_CPU_DESCRIPTOR_HANDLE* pRenderTargetDescriptors,
+		BOOL RTsSingleHandleToDescriptorRange, const D3D12_CPU_DESCRIPTOR_HANDLE* pDepthStencilDescriptor) override;
+	virtual void STDMETHODCALLTYPE ClearDepthStencilView(D3D12_CPU_DESCRIPTOR_HANDLE DepthStencilView, D3D12_CLEAR_FLAGS ClearFlags,
+		FLOAT Depth, UINT8 Stencil, UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE ClearRenderTargetView(D3D12_CPU_DESCRIPTOR_HANDLE RenderTargetView, const FLOAT ColorRGBA[4],
+		UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewUint(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+		D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const UINT Values[4], UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE ClearUnorderedAccessViewFloat(D3D12_GPU_DESCRIPTOR_HANDLE ViewGPUHandleInCurrentHeap,
+		D3D12_CPU_DESCRIPTOR_HANDLE ViewCPUHandle, ID3D12Resource* pResource, const FLOAT Values[4], UINT NumRects, const D3D12_RECT* pRects) override;
+	virtual void STDMETHODCALLTYPE DiscardResource(ID3D12Resource* pResource, const D3D12_DISCARD_REGION* pRegion) override;
+	virtual void STDMETHODCALLTYPE BeginQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index) override;
+	virtual void STDMETHODCALLTYPE EndQuery(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT Index) override;
+	virtual void STDMETHODCALLTYPE ResolveQueryData(ID3D12QueryHeap* pQueryHeap, D3D12_QUERY_TYPE Type, UINT StartIndex, UINT NumQueries,
+		ID3D12Resource* pDestinationBuffer, UINT64 AlignedDestinationBufferOffset) override;
+	virtual void STDMETHODCALLTYPE SetPredication(ID3D12Resource* pBuffer, UINT64 AlignedBufferOffset, D3D12_PREDICATION_OP Operation) override;
+	virtual void STDMETHODCALLTYPE SetMarker(UINT Metadata, const void* pData, UINT Size) override;
+	virtual void STDMETHODCALLTYPE BeginEvent(UINT Metadata, const void* pData, UINT Size) override;
+	virtual void STDMETHODCALLTYPE EndEvent() override;
+	virtual void STDMETHODCALLTYPE ExecuteIndirect(ID3D12CommandSignature* pCommandSignature, UINT MaxCommandCount,
+		ID3D12Resource* pArgumentBuffer, UINT64 ArgumentBufferOffset, ID3D12Resource* pCountBuffer, UINT64 CountBufferOffset) override;
+
+private:
+	// 기록 중이 아니라면 오류를 보고하고 false를 반환한다.
+	bool ValidateRecording(const char* function);
+	bool ValidateDraw(const char* function, const bool isIndexed);
+	bool ValidateDispatch(const char* function);
+	bool ValidateRootArgument(const char* function, const bool isCompute, const UINT rootParameterIndex);
+	bool ValidateDescriptorTable(const char* function, const D3D12_GPU_DESCRIPTOR_HANDLE handle);
+
+	void ReportError(const char* function, const char* message);
+	// 바인딩된 상태를 모두 지운다.
+	void ClearBindings();
+
+private:
+	D3D12_COMMAND_LIST_TYPE type;
+	bool isRecording = true;
+
+	ID3D12PipelineState* pipelineState = nullptr;
+	NullRootSignature* graphicsRootSignature = nullptr;
+	NullRootSignature* computeRootSignature = nullptr;
+	D3D12_PRIMITIVE_TOPOLOGY topology = D3D_PRIMITIVE_TOPOLOGY_UNDEFINED;
+	bool hasViewport = false;
+	bool hasScissorRect = false;
+	bool hasIndexBuffer = false;
+	UINT renderTargetCount = 0;
+	bool hasDepthStencil = false;
+	// CBV_SRV_UAV 힙과 샘플러 힙
+	NullDescriptorHeap* descriptorHeaps[2] = { nullptr, nullptr };
+
+	NullBackendStats stats;
+	// 명령 큐에서 실행될 때 검증할 리소스 장벽. Reset해도 용량은 유지한다.
+	std::vector<D3D12_RESOURCE_BARRIER> barriers;
+};
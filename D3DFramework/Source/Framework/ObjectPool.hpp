@@ -0,0 +1,248 @@
+#pragma once
+
+#include <basetsd.h>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#include <algorithm>
+#include <iostream>
+
+// 하나의 풀에 대한 통계
+struct PoolStats
+{
+	std::string name;
+	size_t blockSize = 0;
+	UINT32 chunkCount = 0;
+	// 할당된 블록의 전체 개수와 현재 사용 중인 개수, 최대로 사용된 개수
+	UINT32 capacity = 0;
+	UINT32 used = 0;
+	UINT32 peak = 0;
+	UINT64 allocCount = 0;
+	UINT64 freeCount = 0;
+};
+
+/*
+모든 ObjectPool의 공통 기반 클래스
+생성된 풀들을 등록하여 풀마다의 통계를 한 번에 확인할 수 있게 한다.
+*/
+class PoolBase
+{
+public:
+	PoolBase()
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		pools.push_back(this);
+	}
+	PoolBase(const PoolBase& rhs) = delete;
+	PoolBase& operator=(const PoolBase& rhs) = delete;
+	virtual ~PoolBase()
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+		pools.erase(std::remove(pools.begin(), pools.end(), this), pools.end());
+	}
+
+public:
+	virtual PoolStats GetStats() const = 0;
+
+	// 등록된 모든 풀의 통계를 반환한다.
+	static std::vector<PoolStats> GetAllStats()
+	{
+		std::lock_guard<std::mutex> lock(registryMutex);
+
+		std::vector<PoolStats> stats;
+		stats.reserve(pools.size());
+		for (const auto pool : pools)
+			stats.push_back(pool->GetStats());
+		return stats;
+	}
+
+	static void PrintStats()
+	{
+#if defined(DEBUG) || defined(_DEBUG)
+		for (const auto& stats : GetAllStats())
+		{
+			std::cout << "Pool " << stats.name << " : blockSize " << stats.blockSize
+				<< ", chunks " << stats.chunkCount << ", used " << stats.used << "/" << stats.capacity
+				<< ", peak " << stats.peak << ", alloc " << stats.allocCount << ", free " << stats.freeCount << std::endl;
+		}
+#endif
+	}
+
+private:
+	static inline std::mutex registryMutex;
+	static inline std::vector<PoolBase*> pools;
+};
+
+// 풀에서 할당된 객체를 기반 클래스 포인터로 소유할 때, 원래의 풀로 되돌려주는 삭제자
+// destroy가 없다면 일반적인 delete를 사용한다.
+template<typename Base>
+struct PoolDeleter
+{
+	void (*destroy)(Base*) = nullptr;
+
+	void operator()(Base* ptr) const
+	{
+		if (destroy)
+			destroy(ptr);
+		else
+			delete ptr;
+	}
+};
+
+template<typename T>
+using PoolPtr = std::unique_ptr<T, PoolDeleter<T>>;
+
+/*
+타입별로 분리된 고정 크기 블록 풀
+블록들은 청크 단위로 연속하게 할당되므로 같은 타입의 객체들이 메모리 상에 모이게 되고,
+해제된 블록은 프리 리스트로 재사용하여 생성과 파괴가 잦아도 힙을 사용하지 않는다.
+청크의 크기는 할당될 때마다 두 배로 커지며 풀이 파괴될 때까지 해제되지 않는다.
+*/
+template<typename T>
+class ObjectPool : public PoolBase
+{
+private:
+	// 비어있는 블록은 다음 빈 블록을 가리키는 데에 사용된다.
+	struct FreeBlock
+	{
+		FreeBlock* next;
+	};
+
+	static constexpr size_t blockAlign = (std::max)(alignof(T), alignof(FreeBlock));
+	static constexpr size_t blockSize = ((std::max)(sizeof(T), sizeof(FreeBlock)) + blockAlign - 1) / blockAlign * blockAlign;
+	static constexpr UINT32 minChunkBlocks = 32;
+	static constexpr UINT32 maxChunkBlocks = 4096;
+
+public:
+	ObjectPool() = default;
+	virtual ~ObjectPool()
+	{
+		for (auto chunk : chunks)
+			::operator delete(chunk, std::align_val_t(blockAlign));
+	}
+
+public:
+	static ObjectPool* GetInstance()
+	{
+		static ObjectPool* instance = nullptr;
+		if (instance == nullptr)
+			instance = new ObjectPool();
+		return instance;
+	}
+
+public:
+	template<typename... Args>
+	T* Create(Args&&... args)
+	{
+		void* block = Allocate();
+		try
+		{
+			return new (block) T(std::forward<Args>(args)...);
+		}
+		catch (...)
+		{
+			Deallocate(block);
+			throw;
+		}
+	}
+
+	void Destroy(T* obj)
+	{
+		if (obj == nullptr)
+			return;
+
+		obj->~T();
+		Deallocate(obj);
+	}
+
+	// 기반 클래스 포인터로 소유권을 넘길 수 있는 unique_ptr로 생성한다.
+	template<typename Base = T, typename... Args>
+	PoolPtr<Base> MakeUnique(Args&&... args)
+	{
+		T* obj = Create(std::forward<Args>(args)...);
+		return PoolPtr<Base>(obj, PoolDeleter<Base>{ [](Base* ptr) { GetInstance()->Destroy(static_cast<T*>(ptr)); } });
+	}
+
+	// 제어 블록은 힙에 할당되지만, 객체는 풀에 할당된다.
+	template<typename... Args>
+	std::shared_ptr<T> MakeShared(Args&&... args)
+	{
+		return std::shared_ptr<T>(Create(std::forward<Args>(args)...), [](T* ptr) { GetInstance()->Destroy(ptr); });
+	}
+
+	// count개의 객체를 더 생성하더라도 청크를 추가하지 않도록 부족한 만큼 하나의 청크로 미리 할당한다.
+	void Reserve(const UINT32 count)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		const UINT32 freeNum = stats.capacity - stats.used;
+		if (count > freeNum)
+			AllocateChunk(count - freeNum);
+	}
+
+	virtual PoolStats GetStats() const override
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		PoolStats stats = this->stats;
+		stats.name = typeid(T).name();
+		stats.blockSize = blockSize;
+		stats.chunkCount = (UINT32)chunks.size();
+		return stats;
+	}
+
+private:
+	void* Allocate()
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		if (freeList == nullptr)
+			AllocateChunk((std::min)((std::max)(stats.capacity, minChunkBlocks), maxChunkBlocks));
+
+		FreeBlock* block = freeList;
+		freeList = block->next;
+
+		++stats.used;
+		++stats.allocCount;
+		stats.peak = (std::max)(stats.peak, stats.used);
+		return block;
+	}
+
+	void Deallocate(void* ptr)
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		// 마지막에 해제된 블록을 먼저 재사용하여 캐시에 남아있는 메모리를 사용한다.
+		FreeBlock* block = static_cast<FreeBlock*>(ptr);
+		block->next = freeList;
+		freeList = block;
+
+		--stats.used;
+		++stats.freeCount;
+	}
+
+	void AllocateChunk(const UINT32 blockNum)
+	{
+		std::byte* chunk = static_cast<std::byte*>(::operator new(blockSize * blockNum, std::align_val_t(blockAlign)));
+		chunks.push_back(chunk);
+
+		// 주소가 낮은 블록부터 할당되도록 역순으로 프리 리스트에 연결한다.
+		for (UINT32 i = blockNum; i > 0; --i)
+		{
+			FreeBlock* block = reinterpret_cast<FreeBlock*>(chunk + (size_t)(i - 1) * blockSize);
+			block->next = freeList;
+			freeList = block;
+		}
+
+		stats.capacity += blockNum;
+	}
+
+private:
+	mutable std::mutex mutex;
+	std::vector<std::byte*> chunks;
+	FreeBlock* freeList = nullptr;
+	PoolStats stats;
+};
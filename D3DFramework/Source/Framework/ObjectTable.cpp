@@ -0,0 +1,195 @@
+#include "../PrecompiledHeader/pch.h"
+#include "ObjectTable.h"
+#include "../Object/GameObject.h"
+
+ObjectTable::ObjectTable() { }
+
+ObjectTable::~ObjectTable()
+{
+	Clear();
+}
+
+ObjectHandle ObjectTable::Add(std::unique_ptr<GameObject>&& obj)
+{
+	return Add(PoolPtr<GameObject>(obj.release()));
+}
+
+ObjectHandle ObjectTable::Add(PoolPtr<GameObject>&& obj)
+{
+	std::unique_lock lock(indexMutex);
+
+	UINT32 index;
+	if (!freeSlots.empty())
+	{
+		index = freeSlots.back();
+		freeSlots.pop_back();
+	}
+	else
+	{
+		assert(slots.size() <= ObjectHandle::indexMask);
+		index = (UINT32)slots.size();
+		slots.emplace_back();
+	}
+
+	Slot& slot = slots[index];
+
+	ObjectHandle handle;
+	handle.value = (slot.generation << ObjectHandle::indexBits) | index;
+
+	obj->handle = handle;
+
+	std::vector<ObjectHandle>& nameHandles = nameIndex[obj->GetName()];
+	std::vector<ObjectHandle>& typeHandles = typeIndex[typeid(*obj)];
+	slot.namePosition = (UINT32)nameHandles.size();
+	slot.typePosition = (UINT32)typeHandles.size();
+
+	uidIndex[obj->GetUID()] = handle;
+	nameHandles.push_back(handle);
+	typeHandles.push_back(handle);
+
+	slot.obj = std::move(obj);
+	++count;
+
+	return handle;
+}
+
+void ObjectTable::Remove(const ObjectHandle handle)
+{
+	if (!IsValid(handle))
+		return;
+
+	std::unique_lock lock(indexMutex);
+
+	Slot& slot = slots[handle.GetIndex()];
+	GameObject* obj = slot.obj.get();
+
+	uidIndex.erase(obj->GetUID());
+
+	auto nameIter = nameIndex.find(obj->GetName());
+	EraseHandle(nameIter->second, slot.namePosition, &Slot::namePosition);
+	if (nameIter->second.empty())
+		nameIndex.erase(nameIter);
+
+	auto typeIter = typeIndex.find(typeid(*obj));
+	EraseHandle(typeIter->second, slot.typePosition, &Slot::typePosition);
+
+	slot.obj = nullptr;
+
+	// 세대가 한 바퀴 돌면 0을 건너뛴다.
+	slot.generation = (slot.generation + 1) & ObjectHandle::generationMask;
+	if (slot.generation == 0)
+		slot.generation = 1;
+
+	freeSlots.push_back(handle.GetIndex());
+	--count;
+}
+
+void ObjectTable::Clear()
+{
+	std::unique_lock lock(indexMutex);
+
+	uidIndex.clear();
+	nameIndex.clear();
+	typeIndex.clear();
+	slots.clear();
+	freeSlots.clear();
+	count = 0;
+}
+
+void ObjectTable::Reserve(const UINT32 count)
+{
+	std::unique_lock lock(indexMutex);
+
+	// 재사용할 슬롯이 있다면 그만큼은 새로운 슬롯이 필요하지 않다.
+	const size_t newSlotNum = count > freeSlots.size() ? count - freeSlots.size() : 0;
+	slots.reserve(slots.size() + newSlotNum);
+	uidIndex.reserve(this->count + count);
+}
+
+GameObject* ObjectTable::Get(const ObjectHandle handle) const
+{
+	const UINT32 index = handle.GetIndex();
+	if (index >= slots.size())
+		return nullptr;
+
+	const Slot& slot = slots[index];
+	if (slot.generation != handle.GetGeneration())
+		return nullptr;
+
+	return slot.obj.get();
+}
+
+bool ObjectTable::IsValid(const ObjectHandle handle) const
+{
+	return Get(handle) != nullptr;
+}
+
+UINT32 ObjectTable::GetCount() const
+{
+	return count;
+}
+
+ObjectTable::Iterator ObjectTable::begin() const
+{
+	return Iterator(&slots, 0);
+}
+
+ObjectTable::Iterator ObjectTable::end() const
+{
+	return Iterator(&slots, slots.size());
+}
+
+ObjectHandle ObjectTable::FindByUID(const UINT64 uid) const
+{
+	std::shared_lock lock(indexMutex);
+
+	auto iter = uidIndex.find(uid);
+	if (iter == uidIndex.end())
+		return ObjectHandle();
+
+	return iter->second;
+}
+
+ObjectHandle ObjectTable::FindByName(std::string_view name) const
+{
+	std::shared_lock lock(indexMutex);
+
+	auto iter = nameIndex.find(name);
+	if (iter == nameIndex.end())
+		return ObjectHandle();
+
+	return iter->second.front();
+}
+
+UINT32 ObjectTable::FindAllByName(std::string_view name, std::vector<ObjectHandle>& outHandles) const
+{
+	std::shared_lock lock(indexMutex);
+
+	auto iter = nameIndex.find(name);
+	if (iter == nameIndex.end())
+		return 0;
+
+	outHandles.insert(outHandles.end(), iter->second.begin(), iter->second.end());
+	return (UINT32)iter->second.size();
+}
+
+UINT32 ObjectTable::FindAllByType(const std::type_index type, std::vector<ObjectHandle>& outHandles) const
+{
+	std::shared_lock lock(indexMutex);
+
+	auto iter = typeIndex.find(type);
+	if (iter == typeIndex.end())
+		return 0;
+
+	outHandles.insert(outHandles.end(), iter->second.begin(), iter->second.end());
+	return (UINT32)iter->second.size();
+}
+
+void ObjectTable::EraseHandle(std::vector<ObjectHandle>& handles, const UINT32 position, UINT32 Slot::*positionMember)
+{
+	// 마지막 핸들을 지워질 자리로 옮기므로 목록의 순서는 유지되지 않는다.
+	const ObjectHandle last = handles.back();
+	handles[position] = last;
+	slots[last.GetIndex()].*positionMember = position;
+	handles.pop_back();
+}
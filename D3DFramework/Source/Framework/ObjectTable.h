@@ -0,0 +1,152 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <typeindex>
+#include <shared_mutex>
+#include "ObjectPool.hpp"
+
+class GameObject;
+
+/*
+ObjectTable의 슬롯을 가리키는 32비트 핸들
+하위 비트는 슬롯 인덱스, 상위 비트는 세대이며 슬롯이 해제될 때마다
+세대가 증가하므로 오래된 핸들은 원자적 연산 없이 O(1)로 걸러진다.
+값이 0인 핸들은 아무것도 가리키지 않는다.
+*/
+struct ObjectHandle
+{
+	static constexpr UINT32 indexBits = 20;
+	static constexpr UINT32 indexMask = (1u << indexBits) - 1;
+	static constexpr UINT32 generationMask = (1u << (32 - indexBits)) - 1;
+
+	UINT32 value = 0;
+
+	UINT32 GetIndex() const { return value & indexMask; }
+	UINT32 GetGeneration() const { return value >> indexBits; }
+	bool IsNull() const { return value == 0; }
+
+	bool operator==(const ObjectHandle& rhs) const { return value == rhs.value; }
+	bool operator!=(const ObjectHandle& rhs) const { return value != rhs.value; }
+};
+
+/*
+모든 GameObject를 소유하는 핸들 테이블
+객체의 소유권은 이 테이블에만 있으며, 광역 단계나 렌더 리스트, 질의처럼
+객체를 참조하는 곳은 ObjectHandle만을 저장한다.
+테이블을 수정하는 것은 메인 스레드에서만 이루어지며,
+Get은 읽기만 하므로 수정이 없는 동안 워커 스레드에서도 사용할 수 있다.
+객체가 추가되고 제거될 때 UID, 이름, 타입별 해시 인덱스를 함께 갱신하므로
+Find 함수들은 선형 탐색 없이 동작하며, 읽기 락을 잡으므로 어느 스레드에서나 부를 수 있다.
+슬롯은 인덱스 목록에서 자신의 위치를 기억하므로 제거도 마지막 원소와 자리를 바꾸어 O(1)로 이루어진다.
+Create로 생성된 객체는 타입별 ObjectPool에서 할당되고, 제거될 때 같은 풀로 되돌아간다.
+*/
+class ObjectTable
+{
+private:
+	struct Slot
+	{
+		PoolPtr<GameObject> obj = nullptr;
+		// 0은 널 핸들을 위해 사용하지 않는다.
+		UINT32 generation = 1;
+		// 이름, 타입별 인덱스의 목록에서 이 객체의 핸들이 있는 위치
+		UINT32 namePosition = 0;
+		UINT32 typePosition = 0;
+	};
+
+	// string_view로 std::string 키를 임시 객체 생성 없이 찾기 위한 해시
+	struct StringHash
+	{
+		using is_transparent = void;
+		size_t operator()(std::string_view str) const { return std::hash<std::string_view>{}(str); }
+	};
+
+public:
+	// 살아있는 객체만을 인덱스 순서대로 순회한다.
+	class Iterator
+	{
+	public:
+		Iterator(const std::vector<Slot>* slots, size_t index) : slots(slots), index(index) { SkipEmpty(); }
+
+		GameObject* operator*() const { return (*slots)[index].obj.get(); }
+		Iterator& operator++() { ++index; SkipEmpty(); return *this; }
+		bool operator!=(const Iterator& rhs) const { return index != rhs.index; }
+
+	private:
+		void SkipEmpty() { while (index < slots->size() && (*slots)[index].obj == nullptr) ++index; }
+
+	private:
+		const std::vector<Slot>* slots;
+		size_t index;
+	};
+
+public:
+	ObjectTable();
+	ObjectTable(const ObjectTable& rhs) = delete;
+	ObjectTable& operator=(const ObjectTable& rhs) = delete;
+	~ObjectTable();
+
+public:
+	// 객체를 생성하여 테이블에 추가한다. 핸들은 GameObject::GetHandle로 얻는다.
+	template <typename T, typename... Args>
+	T* Create(Args&&... args)
+	{
+		PoolPtr<GameObject> obj = ObjectPool<T>::GetInstance()->template MakeUnique<GameObject>(std::forward<Args>(args)...);
+		T* result = static_cast<T*>(obj.get());
+		Add(std::move(obj));
+		return result;
+	}
+
+	// 객체의 소유권을 테이블로 옮기고 핸들을 반환한다.
+	ObjectHandle Add(PoolPtr<GameObject>&& obj);
+	// 풀 밖에서 할당된 객체는 제거될 때 delete로 해제된다.
+	ObjectHandle Add(std::unique_ptr<GameObject>&& obj);
+	// 객체를 파괴하고 슬롯의 세대를 증가시켜 기존 핸들을 무효화한다.
+	void Remove(const ObjectHandle handle);
+	void Clear();
+	// count개의 객체를 한 번에 추가하기 전에 슬롯과 UID 인덱스의 공간을 미리 확보한다.
+	void Reserve(const UINT32 count);
+
+	// 핸들이 유효하지 않다면 nullptr를 반환한다.
+	GameObject* Get(const ObjectHandle handle) const;
+	template <typename T>
+	T* Get(const ObjectHandle handle) const { return static_cast<T*>(Get(handle)); }
+
+	bool IsValid(const ObjectHandle handle) const;
+	UINT32 GetCount() const;
+
+	// UID로 객체의 핸들을 찾는다. 없다면 널 핸들을 반환한다.
+	ObjectHandle FindByUID(const UINT64 uid) const;
+	// 해당 이름을 가진 객체 중 하나의 핸들을 반환한다.
+	// 같은 이름의 객체가 제거된 적이 있다면 어느 객체인지는 보장되지 않는다.
+	ObjectHandle FindByName(std::string_view name) const;
+	// 해당 이름을 가진 모든 객체의 핸들을 outHandles에 추가하고 개수를 반환한다.
+	UINT32 FindAllByName(std::string_view name, std::vector<ObjectHandle>& outHandles) const;
+	// 정확히 T 타입인 모든 객체의 핸들을 outHandles에 추가하고 개수를 반환한다.
+	template <typename T>
+	UINT32 FindAllByType(std::vector<ObjectHandle>& outHandles) const { return FindAllByType(typeid(T), outHandles); }
+	UINT32 FindAllByType(const std::type_index type, std::vector<ObjectHandle>& outHandles) const;
+
+	Iterator begin() const;
+	Iterator end() const;
+
+private:
+	// 인덱스 목록의 position 위치에서 핸들을 제거하고, 그 자리로 옮겨진 핸들의 위치를 갱신한다.
+	void EraseHandle(std::vector<ObjectHandle>& handles, const UINT32 position, UINT32 Slot::*positionMember);
+
+private:
+	std::vector<Slot> slots;
+	// 재사용할 수 있는 슬롯의 인덱스들
+	std::vector<UINT32> freeSlots;
+	UINT32 count = 0;
+
+	// 객체의 추가, 제거와 Find 함수들 사이를 보호한다.
+	mutable std::shared_mutex indexMutex;
+	std::unordered_map<UINT64, ObjectHandle> uidIndex;
+	// 같은 이름을 가진 객체들은 하나의 키 문자열을 공유한다.
+	std::unordered_map<std::string, std::vector<ObjectHandle>, StringHash, std::equal_to<>> nameIndex;
+	std::unordered_map<std::type_index, std::vector<ObjectHandle>> typeIndex;
+};
@@ -0,0 +1,324 @@
+#include "../PrecompiledHeader/pch.h"
+#include "OcclusionBuffer.h"
+#include "ParallelFor.hpp"
+
+OcclusionBuffer::OcclusionBuffer(const UINT32 width, const UINT32 height)
+{
+	Resize(width, height);
+	XMStoreFloat4x4(&viewProj, XMMatrixIdentity());
+}
+
+OcclusionBuffer::~OcclusionBuffer() { }
+
+void OcclusionBuffer::Resize(const UINT32 width, const UINT32 height)
+{
+	// 타일 행과 열을 나누어 떨어지게 하고, 한 행을 4픽셀씩 처리할 수 있게 한다.
+	tileColumnNum = (std::max)((width + tileSize - 1) / tileSize, 1u);
+	tileRowNum = (std::max)((height + tileSize - 1) / tileSize, 1u);
+	this->width = tileColumnNum * tileSize;
+	this->height = tileRowNum * tileSize;
+
+	depths.assign((size_t)this->width * this->height, 1.0f);
+	tileMaxDepths.assign((size_t)tileColumnNum * tileRowNum, 1.0f);
+	isRendered = false;
+}
+
+void OcclusionBuffer::Render(std::span<const OccluderMesh> occluders, const XMFLOAT4X4& viewProj)
+{
+	this->viewProj = viewProj;
+
+	// 오클루더마다 정점과 삼각형을 쓸 위치를 미리 정해 병렬로 설정할 수 있게 한다.
+	UINT32 vertexCount = 0;
+	UINT32 triangleCount = 0;
+	occluderOffsets.resize(occluders.size());
+	for (size_t i = 0; i < occluders.size(); ++i)
+	{
+		occluderOffsets[i] = { vertexCount, triangleCount };
+		vertexCount += occluders[i].vertexCount;
+		triangleCount += occluders[i].indexCount / 3;
+	}
+
+	clipVertices.resize(vertexCount);
+	triangles.resize(triangleCount);
+
+	ParallelFor((UINT32)occluders.size(), 1, [this, occluders](const UINT32 i)
+	{
+		const auto [vertexOffset, triangleOffset] = occluderOffsets[i];
+		SetupTriangles(occluders[i], clipVertices.data() + vertexOffset, triangles.data() + triangleOffset);
+	});
+
+	rasterizedTriangleCount = 0;
+	for (const TriangleSetup& triangle : triangles)
+		rasterizedTriangleCount += triangle.isValid ? 1 : 0;
+
+	// 타일 행마다 자신의 픽셀만 쓰므로 서로 겹치지 않는다.
+	ParallelFor(tileRowNum, 1, [this](const UINT32 tileRow)
+	{
+		RasterizeTileRow(tileRow);
+	});
+
+	isRendered = true;
+}
+
+void OcclusionBuffer::SetupTriangles(const OccluderMesh& occluder, XMFLOAT4* clipVertices, TriangleSetup* triangles) const
+{
+	const XMMATRIX worldViewProj = XMLoadFloat4x4(&occluder.world) * XMLoadFloat4x4(&viewProj);
+	const BYTE* vertices = static_cast<const BYTE*>(occluder.vertices);
+
+	for (UINT32 i = 0; i < occluder.vertexCount; ++i)
+	{
+		const XMFLOAT3* pos = reinterpret_cast<const XMFLOAT3*>(vertices + (size_t)i * occluder.vertexStride);
+		XMStoreFloat4(&clipVertices[i], XMVector3Transform(XMLoadFloat3(pos), worldViewProj));
+	}
+
+	const float screenScaleX = 0.5f * (float)width;
+	const float screenScaleY = -0.5f * (float)height;
+
+	const UINT32 triangleCount = occluder.indexCount / 3;
+	for (UINT32 t = 0; t < triangleCount; ++t)
+	{
+		TriangleSetup& triangle = triangles[t];
+		triangle.isValid = false;
+
+		float x[3], y[3], z[3];
+		bool isClipped = false;
+		for (int k = 0; k < 3; ++k)
+		{
+			const UINT16 index = occluder.indices[t * 3 + k];
+			if (index >= occluder.vertexCount)
+			{
+				isClipped = true;
+				break;
+			}
+
+			// 근평면 앞에 있는 정점이 있다면 자르는 대신 그리지 않는다.
+			// 오클루더를 덜 그리는 것은 가려지지 않은 것으로 판정될 뿐이므로 안전하다.
+			const XMFLOAT4& clip = clipVertices[index];
+			if (clip.z < 0.0f || clip.w <= FLT_EPSILON)
+			{
+				isClipped = true;
+				break;
+			}
+
+			const float invW = 1.0f / clip.w;
+			x[k] = (clip.x * invW + 1.0f) * screenScaleX;
+			y[k] = (clip.y * invW - 1.0f) * screenScaleY;
+			z[k] = clip.z * invW;
+		}
+
+		if (isClipped)
+			continue;
+
+		// 앞면과 뒷면 모두 그리며, 넓이가 양수가 되도록 정점의 순서를 맞춘다.
+		float area = (x[1] - x[0]) * (y[2] - y[0]) - (y[1] - y[0]) * (x[2] - x[0]);
+		if (std::abs(area) <= FLT_EPSILON)
+			continue;
+
+		if (area < 0.0f)
+		{
+			std::swap(x[1], x[2]);
+			std::swap(y[1], y[2]);
+			std::swap(z[1], z[2]);
+			area = -area;
+		}
+
+		// 픽셀의 중심(i + 0.5)이 삼각형의 바운드 안에 있는 픽셀만 본다.
+		const float minX = (std::min)({ x[0], x[1], x[2] });
+		const float maxX = (std::max)({ x[0], x[1], x[2] });
+		const float minY = (std::min)({ y[0], y[1], y[2] });
+		const float maxY = (std::max)({ y[0], y[1], y[2] });
+
+		triangle.minX = (std::max)((INT32)std::ceil(minX - 0.5f), 0);
+		triangle.maxX = (std::min)((INT32)std::floor(maxX - 0.5f), (INT32)width - 1);
+		triangle.minY = (std::max)((INT32)std::ceil(minY - 0.5f), 0);
+		triangle.maxY = (std::min)((INT32)std::floor(maxY - 0.5f), (INT32)height - 1);
+
+		if (triangle.minX > triangle.maxX || triangle.minY > triangle.maxY)
+			continue;
+
+		// 모서리 (a, b)의 함수는 세 번째 정점에서 넓이와 같은 양수가 된다.
+		for (int k = 0; k < 3; ++k)
+		{
+			const int a = k;
+			const int b = (k + 1) % 3;
+			triangle.edgeA[k] = y[a] - y[b];
+			triangle.edgeB[k] = x[b] - x[a];
+			triangle.edgeC[k] = -(triangle.edgeA[k] * x[a] + triangle.edgeB[k] * y[a]);
+		}
+
+		const float invArea = 1.0f / area;
+		triangle.zA = ((z[1] - z[0]) * (y[2] - y[0]) - (z[2] - z[0]) * (y[1] - y[0])) * invArea;
+		triangle.zB = ((z[2] - z[0]) * (x[1] - x[0]) - (z[1] - z[0]) * (x[2] - x[0])) * invArea;
+		triangle.zC = z[0] - triangle.zA * x[0] - triangle.zB * y[0];
+		triangle.minZ = (std::min)({ z[0], z[1], z[2] });
+		triangle.isValid = true;
+	}
+}
+
+void OcclusionBuffer::RasterizeTileRow(const UINT32 tileRow)
+{
+	const INT32 rowBegin = (INT32)(tileRow * tileSize);
+	const INT32 rowEnd = rowBegin + (INT32)tileSize - 1;
+
+	std::fill(depths.begin() + (size_t)rowBegin * width, depths.begin() + (size_t)(rowEnd + 1) * width, 1.0f);
+
+	const XMVECTOR zero = XMVectorZero();
+	const XMVECTOR pixelOffsets = XMVectorSet(0.5f, 1.5f, 2.5f, 3.5f);
+
+	for (const TriangleSetup& triangle : triangles)
+	{
+		if (!triangle.isValid || triangle.maxY < rowBegin || triangle.minY > rowEnd)
+			continue;
+
+		const INT32 minY = (std::max)(triangle.minY, rowBegin);
+		const INT32 maxY = (std::min)(triangle.maxY, rowEnd);
+		// 4픽셀 단위로 정렬된 위치부터 시작한다. 너비가 4의 배수이므로 넘치지 않는다.
+		const INT32 minX = triangle.minX & ~3;
+
+		const XMVECTOR edgeA0 = XMVectorReplicate(triangle.edgeA[0]);
+		const XMVECTOR edgeA1 = XMVectorReplicate(triangle.edgeA[1]);
+		const XMVECTOR edgeA2 = XMVectorReplicate(triangle.edgeA[2]);
+		const XMVECTOR zA = XMVectorReplicate(triangle.zA);
+		const XMVECTOR minZ = XMVectorReplicate(triangle.minZ);
+
+		for (INT32 py = minY; py <= maxY; ++py)
+		{
+			const float centerY = (float)py + 0.5f;
+			const XMVECTOR rowEdge0 = XMVectorReplicate(triangle.edgeB[0] * centerY + triangle.edgeC[0]);
+			const XMVECTOR rowEdge1 = XMVectorReplicate(triangle.edgeB[1] * centerY + triangle.edgeC[1]);
+			const XMVECTOR rowEdge2 = XMVectorReplicate(triangle.edgeB[2] * centerY + triangle.edgeC[2]);
+			const XMVECTOR rowZ = XMVectorReplicate(triangle.zB * centerY + triangle.zC);
+
+			float* row = depths.data() + (size_t)py * width;
+			for (INT32 px = minX; px <= triangle.maxX; px += 4)
+			{
+				const XMVECTOR centerX = XMVectorReplicate((float)px) + pixelOffsets;
+
+				// 세 모서리 함수가 모두 0 이상인 픽셀만 덮는다. 픽셀의 중심만 보므로 오클루더의 실루엣에서는
+				// 일부만 덮인 픽셀도 덮인 것으로 기록되어, 가장자리 바로 뒤의 물체가 최대 반 픽셀만큼
+				// 잘못 가려질 수 있다. 픽셀 전체가 안에 있을 때만 덮도록 줄이면 보수적이지만, 메쉬 내부의
+				// 공유 모서리를 따라 어느 삼각형도 덮지 않는 틈이 생겨 가리는 효과가 크게 줄어든다.
+				// 반 픽셀은 256 x 128 버퍼에서 화면의 1% 미만이므로 틈이 없는 쪽을 택한다.
+				XMVECTOR mask = XMVectorGreaterOrEqual(XMVectorMultiplyAdd(centerX, edgeA0, rowEdge0), zero);
+				mask = XMVectorAndInt(mask, XMVectorGreaterOrEqual(XMVectorMultiplyAdd(centerX, edgeA1, rowEdge1), zero));
+				mask = XMVectorAndInt(mask, XMVectorGreaterOrEqual(XMVectorMultiplyAdd(centerX, edgeA2, rowEdge2), zero));
+				if (XMVector4EqualInt(mask, XMVectorFalseInt()))
+					continue;
+
+				// 평면의 외삽으로 정점보다 가까워지지 않도록 제한한다.
+				const XMVECTOR z = XMVectorMax(XMVectorMultiplyAdd(centerX, zA, rowZ), minZ);
+
+				XMFLOAT4* dst = reinterpret_cast<XMFLOAT4*>(row + px);
+				const XMVECTOR depth = XMLoadFloat4(dst);
+				XMStoreFloat4(dst, XMVectorSelect(depth, XMVectorMin(depth, z), mask));
+			}
+		}
+	}
+
+	// 이 행의 타일마다 가장 먼 깊이를 구한다.
+	for (UINT32 tileColumn = 0; tileColumn < tileColumnNum; ++tileColumn)
+	{
+		XMVECTOR maxDepth = XMVectorZero();
+		for (INT32 py = rowBegin; py <= rowEnd; ++py)
+		{
+			const float* tile = depths.data() + (size_t)py * width + tileColumn * tileSize;
+			for (UINT32 i = 0; i < tileSize; i += 4)
+				maxDepth = XMVectorMax(maxDepth, XMLoadFloat4(reinterpret_cast<const XMFLOAT4*>(tile + i)));
+		}
+
+		maxDepth = XMVectorMax(maxDepth, XMVectorSwizzle<2, 3, 0, 1>(maxDepth));
+		maxDepth = XMVectorMax(maxDepth, XMVectorSwizzle<1, 0, 3, 2>(maxDepth));
+		tileMaxDepths[tileRow * tileColumnNum + tileColumn] = XMVectorGetX(maxDepth);
+	}
+}
+
+bool OcclusionBuffer::IsOccluded(const BoundingBox& bounds) const
+{
+	if (!isRendered)
+		return false;
+
+	XMFLOAT3 corners[BoundingBox::CORNER_COUNT];
+	bounds.GetCorners(corners);
+
+	const XMMATRIX matViewProj = XMLoadFloat4x4(&viewProj);
+	float minX = FLT_MAX, maxX = -FLT_MAX;
+	float minY = FLT_MAX, maxY = -FLT_MAX;
+	float minZ = FLT_MAX;
+
+	for (const XMFLOAT3& corner : corners)
+	{
+		XMFLOAT4 clip;
+		XMStoreFloat4(&clip, XMVector3Transform(XMLoadFloat3(&corner), matViewProj));
+
+		// 근평면을 넘는 바운드는 화면에서의 크기를 알 수 없다.
+		if (clip.z < 0.0f || clip.w <= FLT_EPSILON)
+			return false;
+
+		const float invW = 1.0f / clip.w;
+		const float x = (clip.x * invW + 1.0f) * 0.5f * (float)width;
+		const float y = (1.0f - clip.y * invW) * 0.5f * (float)height;
+
+		minX = (std::min)(minX, x);
+		maxX = (std::max)(maxX, x);
+		minY = (std::min)(minY, y);
+		maxY = (std::max)(maxY, y);
+		minZ = (std::min)(minZ, clip.z * invW);
+	}
+
+	if (maxX < 0.0f || maxY < 0.0f || minX >= (float)width || minY >= (float)height)
+		return false;
+
+	// 바운드가 걸치는 모든 픽셀을 포함하도록 내림한다.
+	const UINT32 pixelMinX = (UINT32)(std::max)((INT32)std::floor(minX), 0);
+	const UINT32 pixelMaxX = (UINT32)(std::min)((INT32)std::floor(maxX), (INT32)width - 1);
+	const UINT32 pixelMinY = (UINT32)(std::max)((INT32)std::floor(minY), 0);
+	const UINT32 pixelMaxY = (UINT32)(std::min)((INT32)std::floor(maxY), (INT32)height - 1);
+
+	for (UINT32 tileRow = pixelMinY / tileSize; tileRow <= pixelMaxY / tileSize; ++tileRow)
+	{
+		for (UINT32 tileColumn = pixelMinX / tileSize; tileColumn <= pixelMaxX / tileSize; ++tileColumn)
+		{
+			// 타일의 가장 먼 오클루더보다 바운드가 멀다면 이 타일에서는 가려진다.
+			if (tileMaxDepths[tileRow * tileColumnNum + tileColumn] < minZ)
+				continue;
+
+			// 아니라면 바운드가 걸치는 픽셀들만 다시 확인한다.
+			const UINT32 beginX = (std::max)(tileColumn * tileSize, pixelMinX);
+			const UINT32 endX = (std::min)((tileColumn + 1) * tileSize - 1, pixelMaxX);
+			const UINT32 beginY = (std::max)(tileRow * tileSize, pixelMinY);
+			const UINT32 endY = (std::min)((tileRow + 1) * tileSize - 1, pixelMaxY);
+
+			for (UINT32 py = beginY; py <= endY; ++py)
+			{
+				const float* row = depths.data() + (size_t)py * width;
+				for (UINT32 px = beginX; px <= endX; ++px)
+				{
+					if (row[px] >= minZ)
+						return false;
+				}
+			}
+		}
+	}
+
+	return true;
+}
+
+UINT32 OcclusionBuffer::GetWidth() const
+{
+	return width;
+}
+
+UINT32 OcclusionBuffer::GetHeight() const
+{
+	return height;
+}
+
+float OcclusionBuffer::GetDepth(const UINT32 x, const UINT32 y) const
+{
+	return depths[(size_t)y * width + x];
+}
+
+UINT32 OcclusionBuffer::GetRasterizedTriangleCount() const
+{
+	return rasterizedTriangleCount;
+}
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "Vector.h"
+#include <DirectXCollision.h>
+#include <span>
+#include <vector>
+
+// 오클루전 컬링의 해상도와 오클루더를 고르는 기준
+struct OcclusionSettings
+{
+	// 깊이 버퍼의 해상도. 타일 크기의 배수로 올림된다.
+	UINT32 width = 256;
+	UINT32 height = 128;
+	// 한 프레임에 래스터화할 오클루더의 최대 개수. 화면상 크기가 큰 것부터 고른다.
+	UINT32 maxOccluderCount = 32;
+	// 바운드의 반지름을 카메라와의 거리로 나눈 값이 이보다 작다면 오클루더로 사용하지 않는다.
+	float minOccluderSize = 0.2f;
+	// 삼각형이 이보다 많은 메쉬는 래스터화 비용이 커서 오클루더로 사용하지 않는다.
+	UINT32 maxOccluderTriangles = 2048;
+};
+
+// 래스터화할 하나의 오클루더. 정점과 인덱스는 메쉬가 시스템 메모리에 남겨둔 복사본을 가리킨다.
+struct OccluderMesh
+{
+	// 정점의 첫 12바이트가 모델 좌표계의 위치여야 한다.
+	const void* vertices = nullptr;
+	UINT32 vertexCount = 0;
+	UINT32 vertexStride = 0;
+	const UINT16* indices = nullptr;
+	UINT32 indexCount = 0;
+	XMFLOAT4X4 world;
+};
+
+/*
+CPU에서 오클루더들을 래스터화한 저해상도 깊이 버퍼
+깊이는 NDC의 z로 0이 가장 가깝고, 오클루더가 없는 곳은 1이다.
+tileSize x tileSize 타일마다 가장 먼 깊이를 저장한 계층을 두어, 바운드가 덮는 타일들의
+최대 깊이보다 바운드의 가장 가까운 깊이가 멀다면 픽셀을 보지 않고 가려진 것으로 판정한다.
+래스터화는 화면의 타일 행마다 병렬로 처리하며, 한 행에서 픽셀 4개를 SIMD로 동시에 처리한다.
+D3D12 장치를 사용하지 않으므로 CPU만으로 검증할 수 있다.
+*/
+class OcclusionBuffer
+{
+public:
+	static constexpr UINT32 tileSize = 8;
+
+public:
+	OcclusionBuffer(const UINT32 width = 256, const UINT32 height = 128);
+	~OcclusionBuffer();
+
+public:
+	void Resize(const UINT32 width, const UINT32 height);
+
+	// viewProj로 오클루더들을 래스터화하여 깊이 버퍼와 타일 계층을 새로 만든다.
+	void Render(std::span<const OccluderMesh> occluders, const XMFLOAT4X4& viewProj);
+	// 월드 공간의 AABB가 오클루더들에 완전히 가려진다면 true를 반환한다.
+	// 바운드가 카메라의 근평면을 넘거나 화면 밖에 있다면 판정하지 않고 false를 반환한다.
+	bool IsOccluded(const BoundingBox& bounds) const;
+
+	UINT32 GetWidth() const;
+	UINT32 GetHeight() const;
+	float GetDepth(const UINT32 x, const UINT32 y) const;
+	// 마지막 Render에서 화면에 그려진 삼각형의 개수
+	UINT32 GetRasterizedTriangleCount() const;
+
+private:
+	// 화면 공간에서 설정이 끝난 삼각형
+	// 모서리 함수 e = a * x + b * y + c가 모두 0 이상인 픽셀이 삼각형 안에 있다.
+	struct TriangleSetup
+	{
+		INT32 minX, maxX, minY, maxY;
+		float edgeA[3], edgeB[3], edgeC[3];
+		// 깊이 평면 z = zA * x + zB * y + zC
+		float zA, zB, zC;
+		float minZ;
+		bool isValid;
+	};
+
+	void SetupTriangles(const OccluderMesh& occluder, XMFLOAT4* clipVertices, TriangleSetup* triangles) const;
+	// 픽셀의 중심에서 덮임을 판정하므로 실루엣에서는 보수적이지 않다. 자세한 내용은 구현을 참고한다.
+	void RasterizeTileRow(const UINT32 tileRow);
+
+private:
+	UINT32 width = 0;
+	UINT32 height = 0;
+	UINT32 tileColumnNum = 0;
+	UINT32 tileRowNum = 0;
+
+	std::vector<float> depths;
+	std::vector<float> tileMaxDepths;
+
+	// 래스터화에 사용되는 작업 공간으로, 매 프레임 재사용된다.
+	std::vector<XMFLOAT4> clipVertices;
+	std::vector<TriangleSetup> triangles;
+	// 오클루더마다 clipVertices와 triangles에서 시작하는 위치
+	std::vector<std::pair<UINT32, UINT32>> occluderOffsets;
+
+	XMFLOAT4X4 viewProj;
+	UINT32 rasterizedTriangleCount = 0;
+	bool isRendered = false;
+};
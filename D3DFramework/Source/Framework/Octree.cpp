@@ -3,6 +3,7 @@
 #include "Enumeration.h"
 #include "D3DDebug.h"
 #include "Physics.h"
+#include "FrameAllocator.h"
 #include "../Component/Mesh.h"
 #include "../Object/GameObject.h"
 
@@ -39,309 +40,186 @@ inline XMFLOAT3 operator/(const XMFLOAT3& lhs, const float scalar)
 	return result;
 }
 
-Octree::Octree(const BoundingBox& boundingBox, const std::list<std::shared_ptr<GameObject>>& objList)
+Octree::Octree(const ObjectTable* objects, const BoundingBox& boundingBox, std::span<const ObjectHandle> handles)
 {
+	this->objects = objects;
 	this->boundingBox = boundingBox;
 
-	for (const auto& obj : objList)
+	objectList.reserve(handles.size());
+	for (const auto handle : handles)
 	{
-		if(IsEnabledCollision(obj))
-			weakObjectList.emplace_front(obj);
+		GameObject* obj = objects->Get(handle);
+		if (obj && IsEnabledCollision(obj))
+			objectList.push_back(handle);
 	}
 
 	for (int i = 0; i < OCT; ++i)
 		childNodes[i] = nullptr;
 }
 
-Octree::Octree(const BoundingBox& boundingBox)
+Octree::Octree(const ObjectTable* objects, const BoundingBox& boundingBox)
 {
+	this->objects = objects;
 	this->boundingBox = boundingBox;
 
 	for (int i = 0; i < 8; ++i)
 		childNodes[i] = nullptr;
 }
 
+Octree::~Octree()
+{
+	for (int i = 0; i < OCT; ++i)
+	{
+		delete childNodes[i];
+		childNodes[i] = nullptr;
+	}
+}
+
 void Octree::BuildTree()
 {
-	// Ʈ 1   BuildTree Ѵ.
-	if (weakObjectList.size() <= 1)
+	// 오브젝트가 1개 이하일 경우 BuildTree를 종료한다.
+	if (objectList.size() <= 1)
 		return;
 
 	if (boundingBox.Extents.x <= MIN_SIZE)
 		return;
 
 	BoundingBox octant[OCT];
-	//  ٿ ڽ 8  
+	// 현재 바운딩 박스를 8개의 공간으로 분할
 	SpatialDivision(octant, boundingBox.Center, boundingBox.Extents);
 
-	//  8  Ʈ Ʈ
-	std::list<std::shared_ptr<GameObject>> octList[8];
-	//   ִ Ʈ Ʈκ ־  Ʈ  Ʈ
-	std::list<std::shared_ptr<GameObject>> delist;
+	// 각 8개의 노드의 오브젝트 리스트
+	// 노드를 만들 때 복사되므로 프레임 할당자의 임시 메모리를 사용한다.
+	FrameVector<ObjectHandle> octList[OCT];
+	// 하위 노드에 포함되지 않아 이 노드에 남을 오브젝트 리스트
+	FrameVector<ObjectHandle> remainList;
 
-	for (const auto& weakObj : weakObjectList)
+	for (const auto handle : objectList)
 	{
-		auto obj = weakObj.lock();
+		GameObject* obj = objects->Get(handle);
 		if (obj == nullptr)
 			continue;
 
+		bool isContained = false;
 		for (int i = 0; i < OCT; ++i)
 		{
-			//   ٿ ڽ ü  ϰ
-			// ִٸ  忡 ԽŰ Ʈ ߰Ѵ.
-			if (Physics::Contain(obj.get(), octant[i]))
+			// 현재 노드의 바운딩 박스가 객체를 완전히 포함하고
+			// 있다면 하위 노드에 포함시키도록 리스트에 추가한다.
+			if (Physics::Contain(obj, octant[i]))
 			{
-				octList[i].emplace_front(obj);
-				delist.emplace_front(obj);
+				octList[i].push_back(handle);
+				isContained = true;
+				break;
 			}
 		}
-	}
 
-	delist.unique();
-
-	//  忡 Ե Ʈ  忡 Ѵ.
-	for (auto& obj : delist)
-	{
-		DeleteObject(obj);
+		if (!isContained)
+			remainList.push_back(handle);
 	}
 
-	// ڽ 忡 Ʈ Ѵٸ BuildTree  Ѵ.
+	// 하위 노드에 포함된 오브젝트는 이 노드에서부터 삭제한다.
+	objectList.assign(remainList.begin(), remainList.end());
+
+	// 자식 노드에 오브젝트가 존재한다면 BuildTree를 재귀적으로 실행한다.
 	for (int i = 0; i < OCT; ++i)
 	{
 		if (!octList[i].empty())
 		{
-			// ڽ 带 ϰ ڽ 嵵   ݺѴ.
+			// 자식 노드를 생성하고 자식 노드도 같은 일을 반복한다.
 			childNodes[i] = CreateNode(octant[i], octList[i]);
 			activeNodes |= (UINT8)(1 << i);
 			childNodes[i]->BuildTree();
 		}
 	}
-
-	treeBuilt = true;
-	treeReady = true;
 }
 
-bool Octree::Insert(std::shared_ptr<GameObject> obj)
+bool Octree::Insert(const ObjectHandle handle)
 {
-	if (IsEnabledCollision(obj))
+	GameObject* obj = objects->Get(handle);
+	if (obj == nullptr || !IsEnabledCollision(obj))
 		return false;
 
-	// ش 忡  ü ٸ   ʿ䰡 .
-	if (weakObjectList.size() == 0)
+	// 해당 노드에 저장된 객체가 없다면 공간을 나눌 필요가 없다.
+	if (objectList.size() == 0)
 	{
-		weakObjectList.emplace_front(obj);
+		objectList.push_back(handle);
 		return true;
 	}
 
 	if (boundingBox.Extents.x <= MIN_SIZE)
 	{
-		weakObjectList.emplace_front(obj);
+		objectList.push_back(handle);
 		return true;
 	}
 
 	BoundingBox octant[OCT];
-	//  ٿ ڽ 8  
+	// 현재 바운딩 박스를 8개의 공간으로 분할
 	SpatialDivision(octant, boundingBox.Center, boundingBox.Extents);
 
 	for (int i = 0; i < OCT; ++i)
 	{
-		//  ٿ ڽ ü  Ѵٸ
-		if (Physics::Contain(obj.get(), octant[i]))
+		// 현재 바운딩 박스가 객체를 완전히 포함한다면
+		if (Physics::Contain(obj, octant[i]))
 		{
-			// ڽ 尡 Ѵٸ
+			// 자식 노드가 존재한다면
 			if (childNodes[i] != nullptr)
 			{
-				// ڽ 忡 ü Ѵ.
-				return childNodes[i]->Insert(obj);
+				// 자식 노드에 객체를 삽입한다.
+				return childNodes[i]->Insert(handle);
 			}
-			// ƴ϶
+			// 아니라면
 			else
 			{
-				// ڽ 带 ϰ ü Ѵ.
-				childNodes[i] = CreateNode(octant[i], obj);
+				// 객체를 가진 자식 노드를 생성한다.
+				childNodes[i] = CreateNode(octant[i], handle);
 				activeNodes |= (UINT8)(1 << i);
-				return childNodes[i]->Insert(obj);
+				return true;
 			}
 		}
 	}
 
-	//  ڽ 忡  Ե ʴ´ٸ
-	//  忡 Ѵ.
-	weakObjectList.emplace_front(obj);
+	// 모든 자식 노드에 완전히 포함되지 않는다면
+	// 현재 노드에 삽입한다.
+	objectList.push_back(handle);
 	return true;
 }
 
-void Octree::Update(float deltaTime)
+void Octree::Query(const BoundingBox& aabb, std::vector<GameObject*>& outObjects) const
 {
-	if (treeBuilt == false || treeReady == false)
-	{
+	// 이 노드와 겹치지 않는다면 하위 노드도 겹치지 않는다.
+	if (!boundingBox.Intersects(aabb))
 		return;
-	}
-
-	//  尡 Ʈ   ʴٸ īƮ ٿ ϰ,
-	// īƮ ٿ 0  ÿ  带 Ѵ.
-	// ױ  带 ٽ ϰ ƴٸ    ø.
-	// ̷ν ʿ ޸ Ҵ     ִ.
-	if (weakObjectList.size() == 0)
-	{
-		if (!hasChildren)
-		{
-			if (currLife == -1)
-				currLife = maxLifespan;
-			else if (currLife > 0)
-				--currLife;
-		}
-	}
-	else
-	{
-		if (currLife != -1)
-		{
-			if (maxLifespan <= 64)
-				maxLifespan *= 2;
-			currLife = -1;
-		}
-	}
 
-	//   Ʈ  зѴ.
-	std::list<std::shared_ptr<GameObject>> movedObjects;
-	for (auto iter = weakObjectList.begin(); iter != weakObjectList.end();)
+	for (const auto handle : objectList)
 	{
-		auto obj = iter->lock();
+		GameObject* obj = objects->Get(handle);
 		if (obj == nullptr)
-		{
-			iter = weakObjectList.erase(iter);
-		}
-		else
-		{
-			//  Լ Tick Ҹ  Ŀ WorldUpdate ǹǷ
-			// UpdateԼ Object TickԼ  ҷ Ѵ.
-			if (obj->GetIsWorldUpdate())
-				movedObjects.emplace_front(obj);
-			++iter;
-		}
-	}
-
-	hasChildren = false;
-	// CurrLife 0   Ѵ.
-	for (int flags = activeNodes, index = 0; flags > 0; flags >>= 1, ++index)
-	{
-		if (childNodes[index] != nullptr)
-		{
-			hasChildren = true;
-
-			if ((flags & 1) == 1 && (childNodes[index]->currLife == 0))
-			{
-				// Ʈ  , 带 ؼ ȵȴ.
-				if (childNodes[index]->GetObjectCount() > 0)
-				{
-					childNodes[index]->currLife = -1;
-				}
-				// Ʈ , CurrLife = 0̶ 带 Ѵ.
-				else
-				{
-					delete childNodes[index];
-					childNodes[index] = nullptr;
-					activeNodes ^= (UINT8)(1 << index);
-				}
-			}
-		}
-	}
-
-	// ڽ 鵵 ƮѴ.
-	for (int flags = activeNodes, index = 0; flags > 0; flags >>= 1, index++)
-	{
-		if ((flags & 1) == 1)
-		{
-			if (childNodes != nullptr && childNodes[index] != nullptr)
-				childNodes[index]->Update(deltaTime);
-		}
-	}
-	
-	/*****************************************************************************/
-	//  ڽ  Ʈ Լ  ̴.
-
-	// Ʈ ٸ θ  ̵Ͽ ˸´ 带 ٽ ã´.
-	for (auto& obj : movedObjects)
-	{
-		Octree* currentNode = this;
-		auto objBounding = obj->GetCollisionBounding();
-
-		// Ʈ ٿ ڽ   θ 带 ؼ ãư.
-		while (Physics::Contain(obj.get(), currentNode->GetBoundingBox()) == false)
-		{
-			if (currentNode->parent != nullptr)
-				currentNode = currentNode->parent;
-			else
-				break;
-		}
-	
-		if (currentNode == this)
 			continue;
 
-		//  忡  Ʈ ϰ,
-		// ˸ 忡 ٽ Ѵ.
-		currentNode->Insert(obj);
-		DeleteObject(obj);
-	}
-
-	// θ忡 ִ Ʈ 1:1˻縦  
-	//  忡 ִ Ʈ 浹˻縦 Ѵ.
-	std::list<std::weak_ptr<GameObject>> currentObjList, parentObjList;
-	currentObjList = weakObjectList;
-	GetParentObjectList(parentObjList);
-
-	while (!parentObjList.empty())
-	{
-		auto obj = parentObjList.front().lock();
-		parentObjList.pop_front();
-
-		for (auto& weakOther : currentObjList)
-		{
-			auto other = weakOther.lock();
-			// Ʈ 浹ߴٸ
-			if (Physics::IsCollision(obj.get(), other.get()))
-			{
-				// 浹  ൿ Ѵ.
-				Physics::Collide(obj.get(), other.get(), deltaTime);
-			}
-		}
+		if (obj->GetCollisionAabb().Intersects(aabb))
+			outObjects.push_back(obj);
 	}
 
-	while (!currentObjList.empty())
+	for (int flags = activeNodes, index = 0; flags > 0; flags >>= 1, ++index)
 	{
-		auto obj = currentObjList.front().lock();
-		currentObjList.pop_front();
-
-		for (auto& weakOther : currentObjList)
-		{
-			auto other = weakOther.lock();
-			// Ʈ 浹ߴٸ
-			if (Physics::IsCollision(obj.get(), other.get()))
-			{
-				// 浹  ൿ Ѵ.
-				Physics::Collide(obj.get(), other.get(), deltaTime);
-			}
-		}
+		if ((flags & 1) == 1 && childNodes[index] != nullptr)
+			childNodes[index]->Query(aabb, outObjects);
 	}
 }
 
-
-Octree* Octree::CreateNode(const BoundingBox& boundingBox, std::list<std::shared_ptr<GameObject>> objList)
+Octree* Octree::CreateNode(const BoundingBox& boundingBox, std::span<const ObjectHandle> handles)
 {
-	if (objList.empty())
+	if (handles.empty())
 		return nullptr;
 
-	Octree* newOctant = new Octree(boundingBox, objList);
+	Octree* newOctant = new Octree(objects, boundingBox, handles);
 	newOctant->parent = this;
 	return newOctant;
 }
 
-Octree* Octree::CreateNode(const BoundingBox& boundingBox, std::shared_ptr<GameObject> obj)
+Octree* Octree::CreateNode(const BoundingBox& boundingBox, const ObjectHandle handle)
 {
-	std::list<std::shared_ptr<GameObject>> objList;
-	objList.emplace_front(obj);
-
-	Octree* newOctant = new Octree(boundingBox, objList);
+	Octree* newOctant = new Octree(objects, boundingBox, std::span<const ObjectHandle>(&handle, 1));
 	newOctant->parent = this;
 	return newOctant;
 }
@@ -351,14 +229,15 @@ void Octree::SpatialDivision(BoundingBox* octant, const DirectX::XMFLOAT3& cente
 	float half = extents.x / 2.0f;
 	XMFLOAT3 halfExtents = { half, half, half };
 
-	octant[0] = BoundingBox((center - extents) / 2.0f, halfExtents);
-	octant[1] = BoundingBox((center + XMFLOAT3(-extents.x, -extents.y, extents.z)) / 2.0f, halfExtents);
-	octant[2] = BoundingBox((center + XMFLOAT3(extents.x, -extents.y, extents.z)) / 2.0f, halfExtents);
-	octant[3] = BoundingBox((center + XMFLOAT3(extents.x, -extents.y, -extents.z)) / 2.0f, halfExtents);
-	octant[5] = BoundingBox((center + extents) / 2.0f, halfExtents);
-	octant[4] = BoundingBox((center + XMFLOAT3(-extents.x, extents.y, extents.z)) / 2.0f, halfExtents);
-	octant[6] = BoundingBox((center + XMFLOAT3(extents.x, extents.y, -extents.z)) / 2.0f, halfExtents);
-	octant[7] = BoundingBox((center + XMFLOAT3(-extents.x, extents.y, -extents.z)) / 2.0f, halfExtents);
+	// 각 팔분면의 중심은 현재 중심에서 extents의 절반만큼 떨어져 있다.
+	octant[0] = BoundingBox(center + (XMFLOAT3(-extents.x, -extents.y, -extents.z) / 2.0f), halfExtents);
+	octant[1] = BoundingBox(center + (XMFLOAT3(-extents.x, -extents.y, extents.z) / 2.0f), halfExtents);
+	octant[2] = BoundingBox(center + (XMFLOAT3(extents.x, -extents.y, extents.z) / 2.0f), halfExtents);
+	octant[3] = BoundingBox(center + (XMFLOAT3(extents.x, -extents.y, -extents.z) / 2.0f), halfExtents);
+	octant[5] = BoundingBox(center + (extents / 2.0f), halfExtents);
+	octant[4] = BoundingBox(center + (XMFLOAT3(-extents.x, extents.y, extents.z) / 2.0f), halfExtents);
+	octant[6] = BoundingBox(center + (XMFLOAT3(extents.x, extents.y, -extents.z) / 2.0f), halfExtents);
+	octant[7] = BoundingBox(center + (XMFLOAT3(-extents.x, extents.y, -extents.z) / 2.0f), halfExtents);
 }
 
 void Octree::GetBoundingWorlds(std::vector<XMFLOAT4X4>& worlds) const
@@ -377,42 +256,7 @@ void Octree::GetBoundingWorlds(std::vector<XMFLOAT4X4>& worlds) const
 	}
 }
 
-void Octree::GetParentObjectList(std::list<std::weak_ptr<GameObject>>& objList) const
-{
-	Octree* parentNode = parent;
-	while (parentNode != nullptr)
-	{
-		const std::list<std::weak_ptr<GameObject>>& parentObjList = parentNode->weakObjectList;
-		objList.insert(objList.end(), parentObjList.begin(), parentObjList.end());
-		parentNode = parentNode->parent;
-	}
-}
-
-void Octree::GetChildObjectList(std::list<std::weak_ptr<class GameObject>>& objList) const
-{
-	if (childNodes == nullptr)
-		return;
-
-	for (int i = 0; i < OCT; ++i)
-	{
-		if (childNodes[i] != nullptr)
-		{
-			const std::list<std::weak_ptr<class GameObject>> chileObjList = childNodes[i]->weakObjectList;
-			objList.insert(objList.end(), chileObjList.begin(), chileObjList.end());
-			childNodes[i]->GetChildObjectList(objList);
-		}
-	}
-}
-
-void Octree::DeleteObject(std::shared_ptr<class GameObject> obj)
-{
-	// UID ȮϿ ü  Ȯ  Ѵ.
-	weakObjectList.remove_if([&obj](std::weak_ptr<GameObject>& weakObj)->bool
-	{ auto listedObj = weakObj.lock();
-	if (obj->GetUID() == listedObj->GetUID()) return true; return false; });
-}
-
-bool Octree::IsEnabledCollision(std::shared_ptr<GameObject> obj)
+bool Octree::IsEnabledCollision(const GameObject* obj) const
 {
 	CollisionType collisionType = obj->GetCollisionType();
 	if (collisionType == CollisionType::None || collisionType == CollisionType::Point)
@@ -435,7 +279,7 @@ void Octree::DrawDebug()
 
 UINT32 Octree::GetObjectCount() const
 {
-	return (UINT32)weakObjectList.size();
+	return (UINT32)objectList.size();
 }
 
 BoundingBox Octree::GetBoundingBox() const
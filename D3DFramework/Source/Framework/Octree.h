@@ -2,7 +2,10 @@
 
 #include <memory>
 #include <list>
+#include <vector>
+#include <span>
 #include <DirectXCollision.h>
+#include "ObjectTable.h"
 
 class GameObject;
 
@@ -10,81 +13,63 @@ class GameObject;
 #define MIN_SIZE 1.0f
 
 /*
-ӿũ Ǵ   Ʈ
-浹 Ѵ. ϳ ū ٿ ڽ ο ü
-Ѵٴ Ͽ ü ġ   Ͽ
-浹 ˰ ȭѴ.
+움직이지 않는 정적 게임 오브젝트들을 담는 팔진트리이다.
+하나의 큰 바운딩 박스 내부에 객체가 존재한다는 가정하에
+객체의 위치에 따라 공간을 분할하여 질의를 최적화한다.
+트리는 한 번 생성되면 정적 객체가 바뀌기 전까지 다시 만들지 않으며,
+움직이는 객체는 Broadphase에서 따로 관리한다.
 */
 class Octree
 {
 public:
-	Octree(const DirectX::BoundingBox& boundingBox, const std::list<std::shared_ptr<GameObject>>& objList); 
-	Octree(const DirectX::BoundingBox& boundingBox);
+	Octree(const ObjectTable* objects, const DirectX::BoundingBox& boundingBox, std::span<const ObjectHandle> handles);
+	Octree(const ObjectTable* objects, const DirectX::BoundingBox& boundingBox);
+	~Octree();
 
 public:
-	//  ִ Ʈ Ʈ Ʈ Ѵ.
+	// 가지고 있는 오브젝트 리스트로 팔진트리를 생성한다.
 	void BuildTree();
-	// Ʈ  忡 Ʈ Ѵ.
-	bool Insert(std::shared_ptr<GameObject> obj);
+	// 팔진트리에 적당한 노드에 오브젝트를 삽입한다.
+	bool Insert(const ObjectHandle handle);
 
-	// Ʈ  쿡  Ʈ Ѵ. 
-	// UpdateԼ Object TickԼ  ҷ Ѵ.
-	void Update(float deltaTime); 
+	// aabb와 겹치는 오브젝트들을 outObjects에 추가한다.
+	void Query(const DirectX::BoundingBox& aabb, std::vector<GameObject*>& outObjects) const;
 
-	//  尡  ִ ٿ ڽ   ȯѴ.
+	// 현재 노드가 가지고 있는 바운딩 박스의 월드 행렬을 반환한다.
 	void GetBoundingWorlds(std::vector<DirectX::XMFLOAT4X4>& worlds) const;
-	// D3DDebug Ͽ ٿ ڽ ׸.
+	// D3DDebug를 사용하여 바운딩 박스를 그린다.
 	void DrawDebug();
 
 	UINT32 GetObjectCount() const;
 	DirectX::BoundingBox GetBoundingBox() const;
 
 private:
-	// ο 带 Ѵ.
-	Octree* CreateNode(const DirectX::BoundingBox& boundingBox, std::list<std::shared_ptr<GameObject>> objList);
-	Octree* CreateNode(const DirectX::BoundingBox& boundingBox, std::shared_ptr<GameObject> obj);
+	// 새로운 노드를 생성한다.
+	Octree* CreateNode(const DirectX::BoundingBox& boundingBox, std::span<const ObjectHandle> handles);
+	Octree* CreateNode(const DirectX::BoundingBox& boundingBox, const ObjectHandle handle);
 
-	// ٿ ڽ ̷  8 .
+	// 바운딩 박스로 이루어진 공간을 8개로 나눈다.
 	void SpatialDivision(DirectX::BoundingBox* octant, const DirectX::XMFLOAT3& center, const DirectX::XMFLOAT3& extents) const;
  
-	// θ κ ü Ʈ Ѵ.
-	void GetParentObjectList(std::list<std::weak_ptr<GameObject>>& objList) const;
-	// ڽ κ ü Ʈ Ѵ.
-	void GetChildObjectList(std::list<std::weak_ptr<GameObject>>& objList) const;
-	// ü Ʈ ش ü Ѵ.
-	void DeleteObject(std::shared_ptr<GameObject> obj);
-
-	// ش ü 浹  θ ȮѴ.
-	bool IsEnabledCollision(std::shared_ptr<GameObject> obj);
-
-public:
-	static inline bool treeReady = false;
-	static inline bool treeBuilt = false;
+	// 해당 객체가 충돌 가능한지 여부를 확인한다.
+	bool IsEnabledCollision(const GameObject* obj) const;
 
 public:
 	Octree* parent = nullptr;
 
-	//  尡  ִ Ʈ Ʈ
-	// shared_ptr    ִ weak_ptr̹Ƿ
-	//   lock()Լ ̿Ͽ shared_ptr ȯѴ.
-	std::list<std::weak_ptr<GameObject>> weakObjectList;
-
-	//  带 ϱ  ٷ  
-	// ޸ Ҵ  Ŵ  ̹Ƿ  ɸ 
-	// ٷ  ʰ,   ʴ  ð  Ѵ.
-	INT32 maxLifespan = 8;
-	INT32 currLife = -1;
+	// 이 노드가 가지고 있는 오브젝트의 핸들
+	// 사용할 때는 ObjectTable에서 객체를 얻어 유효한지 확인한다.
+	std::vector<ObjectHandle> objectList;
 
 private:
-	//  Ʈ AABB  ִٰ Ѵ.
+	const ObjectTable* objects = nullptr;
+
+	// 이 팔진트리는 AABB만을 가지고 있다고 가정한다.
 	DirectX::BoundingBox boundingBox;
 
-	// ش 忡 п ڽĳ
+	// 해당 노드에서 분열된 자식노드
 	Octree* childNodes[8];
 
-	// 8 Child Node  Ǵ  带 Ʈ ǥѴ.
+	// 8개의 Child Node 중 사용되는 중인 노드를 비트로 표현한다.
 	UINT8 activeNodes = 0;
-
-	// ڽ 带 ϳ  ִٸ true̴.
-	bool hasChildren = false;
 };
\ No newline at end of file
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "Defines.h"
+#include "JobSystem.h"
+#include <basetsd.h>
+
+/*
+[0, count) 구간을 grainSize개씩 나누어 각 인덱스마다 func(index)를 호출한다.
+PARALLEL_UPDATE가 정의되어 있다면 나뉜 구간들을 JobSystem의 작업으로 처리하고,
+정의되어 있지 않다면 같은 순서로 직렬 처리하여 두 결과를 비교할 수 있게 한다.
+func는 서로 다른 인덱스끼리 같은 데이터를 수정해서는 안 된다.
+*/
+template<typename Func>
+void ParallelFor(const UINT32 count, const UINT32 grainSize, Func&& func)
+{
+#ifdef PARALLEL_UPDATE
+	if (count > grainSize)
+	{
+		JobSystem::GetInstance()->ParallelFor(count, grainSize, std::forward<Func>(func));
+		return;
+	}
+#endif
+
+	for (UINT32 i = 0; i < count; ++i)
+		func(i);
+}
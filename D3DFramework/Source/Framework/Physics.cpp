@@ -1,11 +1,12 @@
 #include "../PrecompiledHeader/pch.h"
 #include "Physics.h"
+#include "ParallelFor.hpp"
 #include "../Component/Mesh.h"
 #include "../Object/GameObject.h"
 
 /*
-ش ü AABB Ȥ OBB  
-ٿ ڽ Extents ȯѴ.
+해당 객체가 AABB 혹은 OBB일 경우 
+바운딩 박스의 Extents를 반환한다.
 */
 XMFLOAT3 GetBoxExtents(GameObject* obj)
 {
@@ -27,17 +28,17 @@ XMFLOAT3 GetBoxExtents(GameObject* obj)
 }
 
 /*
-ü ߽ ڽ  վٸ
-߽ɰ ڽ    ȯѴ.
+객체의 중심이 박스의 안쪽으로 뚫었다면
+중심과 박스에서 가장 가까운 점을 반환한다.
 */
 void GetClosestPointInBox(const XMFLOAT3& center, const XMFLOAT3& extents, XMFLOAT3& cloestPoint)
 {
-	// ߽ ǥ ڽ extents  Ѵ.
+	// 중심 좌표와 박스의 extents의 차를 구한다.
 	float x = abs(extents.x - abs(center.x));
 	float y = abs(extents.y - abs(center.y));
 	float z = abs(extents.z - abs(center.z));
 
-	//       Ѵ.
+	// 차이의 값이 가장 작은 곳으로 점을 투영한다.
 	if (x < y && x < z)
 	{
 		cloestPoint.x = center.x < 0.0f ? -extents.x : extents.x;
@@ -54,46 +55,46 @@ void GetClosestPointInBox(const XMFLOAT3& center, const XMFLOAT3& extents, XMFLO
 }
 
 /*
-ü ش  Ͽ  ̸ ȯѴ.
+객체에서 해당 축으로 투영하였을 때의 길이를 반환한다.
 */
 float TransformToAxis(GameObject* obj, const XMVECTOR& axis)
 {
-	// ü  Ѵ.
+	// 객체의 축을 구한다.
 	XMFLOAT3 extents = GetBoxExtents(obj);
 	XMVECTOR boxXAxis = obj->GetAxis(0);
 	XMVECTOR boxYAxis = obj->GetAxis(1);
 	XMVECTOR boxZAxis = obj->GetAxis(2);
 
-	// ü   ش      Ÿ.
+	// 객체의 각 축과 해당 축과의 내적은 각 축과의 정도를 나타낸다.
 	float xAmount = Vector3::DotProduct(axis, boxXAxis);
 	float yAmount = Vector3::DotProduct(axis, boxYAxis);
 	float zAmount = Vector3::DotProduct(axis, boxZAxis);
 
-	// Ͽ ģŭ  ȯѴ.
+	// 투영하여 겹친만큼의 길이을 반환한다.
 	return extents.x * abs(xAmount) + extents.y * abs(yAmount) + extents.z * abs(zAmount);
 }
 
 /*
- ü ش ࿡ ġ  ȯѴ.
+두 객체가 해당 축에 겹치는 정도를 반환한다.
 */
 float OverlapOnAxis(GameObject* obj1, GameObject* obj2, const XMVECTOR& axis, const XMFLOAT3& toCenter)
 {
-	// ü  ġ  Ѵ.
+	// 객체와 축과의 겹치는 정도를 구한다.
 	float oneProject = TransformToAxis(obj1, axis);
 	float twoProject = TransformToAxis(obj2, axis);
 
-	// ߽ Ϳ  ġ  Ѵ.
+	// 중심으로의 벡터와 축과의 겹치는 정도를 구한다.
 	XMVECTOR vecToCenter = XMLoadFloat3(&toCenter);
 	float distance = abs(Vector3::DotProduct(vecToCenter, axis));
 
-	// 0̸ ġ ʴ´, 0ʰ̸ ģ.
+	// 0이하이면 겹치지 않는다, 0초과이면 겹친다.
 	return oneProject + twoProject - distance;
 }
 
 /*
- ü ࿡  ġ  θ ȯϰ
-ռ ߴ 밪 ε  ̹ ġ ͺ
- ũٸ   üѴ.
+두 객체가 축에 대해 겹치는 지 여부를 반환하고
+앞서 계산했던 관통값과 인덱스 값이 이번 겹치는 것보다
+더 크다면 작은 값으로 대체한다.
 */
 bool OverlapBoxAxis(GameObject* obj1, GameObject* obj2, const XMVECTOR& axis, const XMFLOAT3& toCenter, const int index,
 	float& smallestPenetration, int& smallestIndex)
@@ -104,7 +105,7 @@ bool OverlapBoxAxis(GameObject* obj1, GameObject* obj2, const XMVECTOR& axis, co
 	if (penetration <= 0.0f)
 		return false;
 
-	//  ü ġ     Ѵ.
+	// 두 객체의 겹치는 정도가 가장 작은 값들을 저장한다.
 	if (penetration < smallestPenetration)
 	{
 		smallestPenetration = penetration;
@@ -115,7 +116,7 @@ bool OverlapBoxAxis(GameObject* obj1, GameObject* obj2, const XMVECTOR& axis, co
 }
 
 /*
-־   ϰ ࿡  ġ  ȮѴ.
+주어진 두 축을 외적하고 축에 대해 겹치는 지 확인한다.
 */
 bool OverlapBoxAxis(GameObject* obj1, GameObject* obj2, const XMVECTOR& axis1, const XMVECTOR& axis2,
 	const XMFLOAT3& toCenter, const int index, float& smallestPenetration, int& smallestIndex)
@@ -132,8 +133,8 @@ bool OverlapBoxAxis(GameObject* obj1, GameObject* obj2, const XMVECTOR& axis1, c
 	if(!OverlapBoxAxis(obj1, obj2, axis1, axis2, toCenter, index, smallestPenetration, smallestIndex)) return contactInfo;
 
 /*
- ü ڽ̰, ڽ ε 
- 鿡 ε Ǵϰ   ȯѴ.
+두 객체는 박스이고, 박스끼리 부딪혔을 때
+어느 면에 부딪혔는지 판단하고 물리 정보를 반환한다.
 */
 ContactInfo ContactFaceAxisInBox(GameObject* obj1, GameObject* obj2, const XMFLOAT3& toCenter,
 	float smallestPenetration, int smallestIndex)
@@ -306,6 +307,39 @@ void Physics::Collide(GameObject* obj1, GameObject* obj2, const float deltaTime)
 	ResolveInterpenetration(obj1, obj2, deltaTime, contactInfo);
 }
 
+void Physics::Narrowphase(const std::vector<std::pair<GameObject*, GameObject*>>& pairs,
+	std::vector<CollisionContact>& contacts)
+{
+	// 쌍마다 하나의 칸을 미리 할당하여 병렬로 채운 뒤, 충돌하지 않은 칸을 순서를 유지하며 제거한다.
+	contacts.clear();
+	contacts.resize(pairs.size());
+
+	ParallelFor((UINT32)pairs.size(), 64, [&pairs, &contacts](const UINT32 i)
+	{
+		const auto& pair = pairs[i];
+
+		// 오브젝트끼리 충돌했다면 물리 정보를 구한다.
+		if (IsCollision(pair.first, pair.second))
+		{
+			CollisionContact& contact = contacts[i];
+			contact.obj1 = pair.first;
+			contact.obj2 = pair.second;
+			contact.contactInfo = Contact(pair.first, pair.second);
+		}
+	});
+
+	std::erase_if(contacts, [](const CollisionContact& contact) { return contact.obj1 == nullptr; });
+}
+
+void Physics::Solve(const std::vector<CollisionContact>& contacts, const float deltaTime)
+{
+	for (const auto& contact : contacts)
+	{
+		ResolveVelocity(contact.obj1, contact.obj2, deltaTime, contact.contactInfo);
+		ResolveInterpenetration(contact.obj1, contact.obj2, deltaTime, contact.contactInfo);
+	}
+}
+
 ContactInfo Physics::Contact(GameObject* obj1, GameObject* obj2)
 {
 	ContactInfo contactInfo;
@@ -396,11 +430,11 @@ ContactInfo Physics::ContactSphereAndSphere(GameObject* obj1, GameObject* obj2)
 	float radius1 = std::any_cast<BoundingSphere>(obj1->GetCollisionBounding()).Radius;
 	float radius2 = std::any_cast<BoundingSphere>(obj2->GetCollisionBounding()).Radius;
 
-	//  ü ġ   ߽ ͸ Ѵ.
+	// 두 객체 위치 벡터의 차로 중심으로의 벡터를 구한다.
 	XMFLOAT3 midLine = Vector3::Subtract(pos1, pos2);
 	float size = Vector3::Length(midLine);
 
-	// ߽ Ͱ  ü  պ ۴ٸ 浹 ʴ´.
+	// 중심 벡터가 두 객체의 반지름 합보다 작다면 충돌하지 않는다.
 	if (size <= 0.0f || size >= radius1 + radius2)
 		return contactInfo;
 
@@ -418,8 +452,8 @@ ContactInfo Physics::ContactBoxAndSphere(class GameObject* obj1, class GameObjec
 	const BoundingSphere& sphere = std::any_cast<BoundingSphere>(obj2->GetCollisionBounding());
 	XMFLOAT3 extents = GetBoxExtents(obj1);
 
-	//  ߽ ǥ ڽ  ǥ ȯѴ.
-	// ̷ ν ڽ  浹 ܼȭų  ִ.
+	// 구의 중심 좌표를 박스의 로컬 좌표계로 변환한다.
+	// 이렇게 함으로써 박스와 구의 충돌을 단순화시킬 수 있다.
 	XMFLOAT3 sphereCenter = obj1->TransformWorldToLocal(obj2->GetPosition());
 	XMFLOAT3 cloestPoint = XMFLOAT3(0.0f, 0.0f, 0.0f);
 
@@ -430,17 +464,17 @@ ContactInfo Physics::ContactBoxAndSphere(class GameObject* obj1, class GameObjec
 	if (Vector3::Equal(cloestPoint, sphereCenter))
 	{
 		GetClosestPointInBox(sphereCenter, extents, cloestPoint);
-		//  ߽ ڽ ȿ ִٸ
-		// 浹   ٲ.
+		// 구의 중심이 박스 안에 있다면
+		// 충돌 노멀은 방향이 바뀐다.
 		contactInfo.normalDirection *= -1.0f;
 	}
 
 	float distance = Vector3::Length(Vector3::Subtract(cloestPoint, sphereCenter));
-	// 浹     ߽  ũٸ 浹  ʴ´.
+	// 충돌에서 가장 가까운 지점과 구의 중심이 반지름보다 크다면 충돌은 나지 않는다.
 	if (distance > sphere.Radius * sphere.Radius)
 		return contactInfo;
 
-	//     ǥ ȯѴ.
+	// 가장 가까운 지점을 월드 좌표계로 변환한다.
 	cloestPoint = obj1->TransformLocalToWorld(cloestPoint);
 
 	contactInfo.contactNormal = Vector3::Normalize(Vector3::Subtract(cloestPoint, obj2->GetPosition()));
@@ -458,7 +492,7 @@ ContactInfo Physics::ContactAabbAndAabb(GameObject* obj1, GameObject* obj2)
 	float smallestPenetration = FLT_MAX;
 	int smallestIndex = -1;
 
-	// AABB X, Y, Z 浹 Ȯϸ ȴ.
+	// AABB는 X축, Y축, Z축과의 충돌만 확인하면 된다.
 	CHECK_OVERLAP(XMVectorSet(1.0f, 0.0f, 0.0f, 0.0f), 0);
 	CHECK_OVERLAP(XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f), 1);
 	CHECK_OVERLAP(XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), 2);
@@ -521,52 +555,52 @@ void Physics::ResolveVelocity(GameObject* obj1, GameObject* obj2, const float de
 	XMFLOAT3 velDif = Vector3::Subtract(obj1->GetVelocity(), obj2->GetVelocity());
 	XMFLOAT3 contactNormal = Vector3::Normalize(Vector3::Multiply(contactInfo.contactNormal, contactInfo.normalDirection));
 
-	//  ü  ⿡  иӵ Ѵ.
+	// 두 물체의 접촉 방향에 대한 분리속도를 계산한다.
 	float separatingVelocity = Vector3::DotProduct(velDif, contactNormal);
 
-	//  Ͼ ü иǰ ְų
-	//    ݷ ʿ.
+	// 접촉이 일어났으나 물체가 분리되고 있거나
+	// 가만히 잇을 경우 충격량이 필요없다.
 	if (separatingVelocity >= 0.0f)
 		return;
 
-	// 浹  ݹ   ü  ּ ݹ  ´.
+	// 충돌 시 반발 계수는 두 객체 중 최소의 반발 계수로 잡는다.
 	float restitution = std::min<float>(obj1->restitution, obj2->restitution);
 
-	// Ӱ  и ӵ
+	// 새롭게 계산한 분리 속도
 	float newSepVel = -separatingVelocity * restitution;
-	// ӵ ӵ   ˻Ѵ.
+	// 속도가 가속도에 의한 것인지를 검사한다.
 	XMFLOAT3 accDif = Vector3::Subtract(obj1->GetAcceleration(), obj2->GetAcceleration());
 	float accCausedSepVel = Vector3::DotProduct(accDif, contactNormal) * deltaTime;
 
-	// ӵ   ӵ 
-	// ̸ ο и ӵ Ѵ.
+	// 가속도에 의해 접근 속도가 생겼으면
+	// 이를 새로운 분리 속도에서 제거한다.
 	if (accCausedSepVel <= 0.0f)
 	{
 		newSepVel += accCausedSepVel * restitution;
 
-		//  ʿ ͺ   ´ ȮѴ.
+		// 실제 필요한 것보다 더 많이 빼냈는지 확인한다.
 		if (newSepVel <= 0.0f)
 			newSepVel = 0.0f;
 	}
 
 	float deltaVel = newSepVel - separatingVelocity;
 
-	//  ü Ͽ  ݺϿ ӵ Ѵ.
-	//   üϼ ӵ ȭ ϴ.
+	// 각각의 물체에 대하여 질량에 반비례하여 속도를 변경한다.
+	// 질량이 작은 물체일수록 속도의 변화가 심하다.
 	float totalInvMass = obj1->GetInvMass() + obj2->GetInvMass();
 
-	//  ü  Ѵ̸ ݷ ȿ .
+	// 모든 물체의 질량이 무한대이면 충격량에 효과가 없다.
 	if (totalInvMass <= 0)
 		return;
 
-	//  ݷ Ѵ.
+	// 적용할 충격략을 계산한다.
 	float impulseScale = deltaVel / totalInvMass;
 	XMFLOAT3 impulse = Vector3::Multiply(contactNormal, impulseScale);
 	XMFLOAT3 impulseOpp = Vector3::Multiply(impulse, -1.0f);
 
-	// ݷ Ѵ.
+	// 충격량을 적용한다.
 	obj1->Impulse(impulse);
-	// ݴ ݷ Ѵ.
+	// 반대방향으로 충격량을 적용한다.
 	obj2->Impulse(impulseOpp);
 }
 
@@ -574,29 +608,29 @@ void Physics::ResolveInterpenetration(GameObject* obj1, GameObject* obj2, const
 {
 	static const float slop = 0.01f;
 
-	//  κ  ǳʶڴ.
+	// 겹쳐진 부분이 없으면 건너뛴다.
 	if (contactInfo.penetration <= 0.0f)
 		return;
 
-	// ü Űִ Ÿ  ݺϹǷ   Ѵ.
+	// 물체를 옮겨주는 거리는 질량에 반비례하므로 질량을 다 더한다.
 	float totalInvMass = obj1->GetInvMass() + obj2->GetInvMass();
 
-	//  ü  Ѵ̸ ƹ ó  ʴ´.
+	// 모든 물체의 질량이 무한대이면 아무런 처리도 하지 않는다.
 	if (totalInvMass <= 0.0f)
 		return;
 
 	XMFLOAT3 contactNormal = Vector3::Normalize(Vector3::Multiply(contactInfo.contactNormal, contactInfo.normalDirection));
 
-	// ü Űܰ Ÿ  ݺѴ.
-	// ü ٸ ü  , ϴ    slop ش.
+	// 물체가 옮겨갈 거리는 질량에 반비례한다.
+	// 물체가 다른 물체에 놓여있을 때, 진동하는 것을 막기 위해 slop을 적용해준다.
 	float move = std::max<float>(contactInfo.penetration - slop, 0.0f) / totalInvMass;
 	XMFLOAT3 movePerInvMass = Vector3::Multiply(contactNormal, move);
 	XMFLOAT3 movement1 = Vector3::Multiply(movePerInvMass, obj1->GetInvMass());
 	XMFLOAT3 movement2 = Vector3::Multiply(movePerInvMass, obj2->GetInvMass() * -1.0f);
 
-	// ü ű.
+	// 물체를 옮긴다.
 	obj1->Move(movement1);
-	// ݴ ű.
+	// 반대방향으로 옮긴다.
 	obj2->Move(movement2);
 }
 
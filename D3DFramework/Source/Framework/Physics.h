@@ -6,8 +6,8 @@
 class GameObject;
 
 /*
-Ray Castring   
-εģ ü  Ѱִ ü
+Ray Castring 시 광선의 정보와
+부딪친 객체의 정보를 넘겨주는 구조체
 */
 struct HitInfo
 {
@@ -18,8 +18,8 @@ struct HitInfo
 };
 
 /*
-ü 浹   ȣۿ ϱ 
-ʿ  
+물체의 충돌 시 물리적인 상호작용을 수행하기 위해
+필요한 물리 정보들
 */
 struct ContactInfo
 {
@@ -27,13 +27,38 @@ struct ContactInfo
 	float penetration = 0.0f;
 	XMFLOAT3 contactPoint = { 0.0f, 0.0f, 0.0f };
 
-	// 浹   obj1->GetPosition() - obj2->GetPosition()
-	//  obj1 obj2  ڹٲ  ֹ⵵ ٲپ ־ Ѵ.
+	// 충돌 노멀은 보통 obj1->GetPosition() - obj2->GetPosition()으로
+	// 정하지만 obj1과 obj2가 서로 뒤바뀐 경우 노멀방향도 바꾸어 주어야 한다.
 	float normalDirection = 1.0f;
 };
 
 /*
-ü  ȣۿ  Ŭ
+좁은 단계에서 실제로 충돌한 두 물체와 그 물리 정보
+*/
+struct CollisionContact
+{
+	GameObject* obj1 = nullptr;
+	GameObject* obj2 = nullptr;
+	ContactInfo contactInfo;
+};
+
+/*
+한 물리 스텝의 단계별 소요 시간(ms)과 충돌 쌍, 접촉 개수
+*/
+struct PhysicsStats
+{
+	double integrateTime = 0.0;
+	double broadphaseTime = 0.0;
+	double narrowphaseTime = 0.0;
+	double solveTime = 0.0;
+	double clothTime = 0.0;
+
+	UINT32 pairCount = 0;
+	UINT32 contactCount = 0;
+};
+
+/*
+물체들의 물리 상호작용을 구현한 클래스
 */
 class Physics
 {
@@ -41,29 +66,35 @@ public:
 	static inline XMFLOAT3 gravity = { 0.0f, -9.8f, 0.0f };
 
 public:
-	// ü ü  浹 ȮѴ.
+	// 물체와 물체 사이의 충돌을 확인한다.
 	static bool IsCollision(GameObject* obj1, GameObject* obj2);
-	// ü   浹 ȮѴ.
+	// 물체와 광선 사이의 충돌을 확인한다.
 	static bool IsCollision(GameObject* obj, const XMVECTOR& rayOrigin, const XMVECTOR& rayDir,
 		float& dist, bool isMeshCollision = false);
 
-	// ü  浹  ʿ   ȯѴ.
+	// 물체 사이의 충돌 시 필요한 물리 정보들을 반환한다.
 	static struct ContactInfo Contact(GameObject* obj1, GameObject* obj2);
-	// ü 浹Ͽ ,  ȣۿ Ѵ.
+	// 물체가 충돌하였을 때, 물리 상호작용을 수행한다.
 	static void Collide(GameObject* obj1, GameObject* obj2, const float deltaTime);
 
-	// ü  浹Ͽ , ü ӷ Ͽ ƨ⵵ Ѵ.
+	// 광역 단계에서 찾은 쌍 중 실제로 충돌한 쌍의 물리 정보를 구한다.
+	static void Narrowphase(const std::vector<std::pair<GameObject*, GameObject*>>& pairs,
+		std::vector<CollisionContact>& contacts);
+	// 좁은 단계에서 구한 물리 정보로 충돌을 해결한다.
+	static void Solve(const std::vector<CollisionContact>& contacts, const float deltaTime);
+
+	// 물체가 서로 충돌하였을 때, 물체의 속력을 수정하여 튕기도록 한다.
 	static void ResolveVelocity(GameObject* obj1, GameObject* obj2, const float deltaTime, const ContactInfo& contactInfo);
-	// ü  Ǿ , ü ġ Ͽ  ذѴ.
+	// 물체가 서로 관통되었을 때, 물체의 위치를 수정하여 관통을 해결한다.
 	static void ResolveInterpenetration(GameObject* obj1, GameObject* obj2, const float deltaTime, const ContactInfo& contactInfo);
 
-	//  ٿ 浹 Ȯϰ   ȯѴ.
+	// 각 바운딩끼리의 충돌을 확인하고 물리 정보를 반환한다.
 	static ContactInfo ContactSphereAndSphere(GameObject* obj1, GameObject* obj2);
 	static ContactInfo ContactBoxAndSphere(GameObject* obj1, GameObject* obj2);
 	static ContactInfo ContactAabbAndAabb(GameObject* obj1, GameObject* obj2);
 	static ContactInfo ContactBoxAndBox(GameObject* obj1, GameObject* obj2);
 
-	// ü ٿ aabb  ԵǾ  ȮѴ.
+	// 객체의 바운딩이 aabb내에 완전히 포함되어 있을지를 확인한다.
 	static bool Contain(GameObject* obj, const BoundingBox& aabb);
 
 };
\ No newline at end of file
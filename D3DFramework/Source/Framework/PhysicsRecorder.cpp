@@ -0,0 +1,241 @@
+#include "../PrecompiledHeader/pch.h"
+#include "PhysicsRecorder.h"
+#include "Random.h"
+#include "../Object/GameObject.h"
+
+PhysicsRecorder::PhysicsRecorder(const PhysicsRecordMode mode, const std::string& fileName, const float fixedDeltaTime)
+	: mode(mode), fileName(fileName), fixedDeltaTime(fixedDeltaTime) { }
+
+PhysicsRecorder::~PhysicsRecorder()
+{
+	Close();
+}
+
+bool PhysicsRecorder::Load()
+{
+	if (mode == PhysicsRecordMode::Record)
+	{
+		// 기록을 시작하는 시점부터 난수가 같은 순서로 생성되도록 한다.
+		seed = Random::GetSeed();
+		Random::SetSeed(seed);
+		return true;
+	}
+
+	if (mode != PhysicsRecordMode::Replay)
+		return true;
+
+	std::ifstream file(fileName, std::ios::binary);
+	if (!file.is_open())
+	{
+		std::cout << "Physics Replay : " << fileName << " 파일을 열 수 없습니다." << std::endl;
+		return false;
+	}
+
+	FileHeader header;
+	file.read(reinterpret_cast<char*>(&header), sizeof(FileHeader));
+	if (!file || header.magic != fileMagic || header.version != fileVersion)
+	{
+		std::cout << "Physics Replay : " << fileName << " 파일의 형식이 올바르지 않습니다." << std::endl;
+		return false;
+	}
+
+	initialStates.resize(header.objectCount);
+	inputEvents.resize(header.inputCount);
+	file.read(reinterpret_cast<char*>(initialStates.data()), sizeof(ObjectState) * header.objectCount);
+	file.read(reinterpret_cast<char*>(inputEvents.data()), sizeof(InputEvent) * header.inputCount);
+	if (!file)
+	{
+		std::cout << "Physics Replay : " << fileName << " 파일이 손상되었습니다." << std::endl;
+		return false;
+	}
+
+	seed = header.seed;
+	fixedDeltaTime = header.fixedDeltaTime;
+	stepCount = header.stepCount;
+
+	Random::SetSeed(seed);
+
+	return true;
+}
+
+void PhysicsRecorder::Close()
+{
+	if (isClosed)
+		return;
+	isClosed = true;
+
+	if (mode == PhysicsRecordMode::Record)
+	{
+		std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			std::cout << "Physics Record : " << fileName << " 파일을 쓸 수 없습니다." << std::endl;
+			return;
+		}
+
+		FileHeader header;
+		header.magic = fileMagic;
+		header.version = fileVersion;
+		header.seed = seed;
+		header.fixedDeltaTime = fixedDeltaTime;
+		header.objectCount = (UINT32)initialStates.size();
+		header.stepCount = currentStep;
+		header.inputCount = (UINT32)inputEvents.size();
+
+		file.write(reinterpret_cast<const char*>(&header), sizeof(FileHeader));
+		file.write(reinterpret_cast<const char*>(initialStates.data()), sizeof(ObjectState) * initialStates.size());
+		file.write(reinterpret_cast<const char*>(inputEvents.data()), sizeof(InputEvent) * inputEvents.size());
+
+		std::cout << "Physics Record : " << fileName << " (" << currentStep << " steps, "
+			<< inputEvents.size() << " inputs)" << std::endl;
+	}
+	else if (mode == PhysicsRecordMode::Replay)
+	{
+		Report();
+	}
+}
+
+void PhysicsRecorder::CaptureInitialState(const ObjectTable& objects)
+{
+	if (mode != PhysicsRecordMode::Record)
+		return;
+
+	initialStates.clear();
+	initialStates.reserve(objects.GetCount());
+
+	for (GameObject* obj : objects)
+	{
+		ObjectState state;
+		state.uid = obj->GetUID();
+		state.position = obj->GetPosition();
+		state.rotation = obj->GetRotation();
+		state.scale = obj->GetScale();
+		state.velocity = obj->GetVelocity();
+		state.angularVelocity = obj->GetAngularVelocity();
+		initialStates.push_back(state);
+	}
+}
+
+bool PhysicsRecorder::RestoreInitialState(const ObjectTable& objects) const
+{
+	if (mode != PhysicsRecordMode::Replay)
+		return true;
+
+	// 객체들은 기록할 때와 같은 순서로 생성되어야 한다.
+	if (objects.GetCount() != initialStates.size())
+	{
+		std::cout << "Physics Replay : 객체의 개수가 기록과 다릅니다." << std::endl;
+		return false;
+	}
+
+	auto iter = initialStates.cbegin();
+	for (GameObject* obj : objects)
+	{
+		const ObjectState& state = *iter++;
+		if (obj->GetUID() != state.uid)
+		{
+			std::cout << "Physics Replay : " << obj->ToString() << " 객체가 기록과 다릅니다." << std::endl;
+			return false;
+		}
+
+		obj->SetPosition(state.position);
+		obj->SetRotation(state.rotation);
+		obj->SetScale(state.scale);
+		obj->SetVelocity(state.velocity);
+		obj->SetAngularVelocity(state.angularVelocity);
+	}
+
+	return true;
+}
+
+void PhysicsRecorder::RecordInput(const bool* keys)
+{
+	if (mode != PhysicsRecordMode::Record)
+		return;
+
+	for (UINT32 i = 0; i < (UINT32)prevKeys.size(); ++i)
+	{
+		if (keys[i] == prevKeys[i])
+			continue;
+
+		InputEvent input;
+		input.step = currentStep;
+		input.key = (UINT8)i;
+		input.isDown = keys[i];
+		input.padding = 0;
+		inputEvents.push_back(input);
+
+		prevKeys[i] = keys[i];
+	}
+}
+
+void PhysicsRecorder::ReplayInput(bool* keys)
+{
+	if (mode != PhysicsRecordMode::Replay)
+		return;
+
+	while (nextInputIndex < inputEvents.size() && inputEvents[nextInputIndex].step <= currentStep)
+	{
+		const InputEvent& input = inputEvents[nextInputIndex++];
+		keys[input.key] = input.isDown;
+	}
+}
+
+void PhysicsRecorder::EndStep(const PhysicsStats& stats)
+{
+	++currentStep;
+
+	totalStats.integrateTime += stats.integrateTime;
+	totalStats.broadphaseTime += stats.broadphaseTime;
+	totalStats.narrowphaseTime += stats.narrowphaseTime;
+	totalStats.solveTime += stats.solveTime;
+	totalStats.clothTime += stats.clothTime;
+	totalStats.pairCount += stats.pairCount;
+	totalStats.contactCount += stats.contactCount;
+
+	maxStats.integrateTime = (std::max)(maxStats.integrateTime, stats.integrateTime);
+	maxStats.broadphaseTime = (std::max)(maxStats.broadphaseTime, stats.broadphaseTime);
+	maxStats.narrowphaseTime = (std::max)(maxStats.narrowphaseTime, stats.narrowphaseTime);
+	maxStats.solveTime = (std::max)(maxStats.solveTime, stats.solveTime);
+	maxStats.clothTime = (std::max)(maxStats.clothTime, stats.clothTime);
+	maxStats.pairCount = (std::max)(maxStats.pairCount, stats.pairCount);
+	maxStats.contactCount = (std::max)(maxStats.contactCount, stats.contactCount);
+}
+
+bool PhysicsRecorder::IsFinished() const
+{
+	return mode == PhysicsRecordMode::Replay && currentStep >= stepCount;
+}
+
+void PhysicsRecorder::Report() const
+{
+	if (currentStep == 0)
+		return;
+
+	const double stepNum = (double)currentStep;
+
+	std::cout << "Physics Replay : " << fileName << " (" << currentStep << " / " << stepCount << " steps, seed "
+		<< seed << ", dt " << fixedDeltaTime << ")" << std::endl;
+	std::cout << "  Integrate   : avg " << totalStats.integrateTime / stepNum << "ms, max " << maxStats.integrateTime << "ms" << std::endl;
+	std::cout << "  Broadphase  : avg " << totalStats.broadphaseTime / stepNum << "ms, max " << maxStats.broadphaseTime << "ms" << std::endl;
+	std::cout << "  Narrowphase : avg " << totalStats.narrowphaseTime / stepNum << "ms, max " << maxStats.narrowphaseTime << "ms" << std::endl;
+	std::cout << "  Solve       : avg " << totalStats.solveTime / stepNum << "ms, max " << maxStats.solveTime << "ms" << std::endl;
+	std::cout << "  Cloth       : avg " << totalStats.clothTime / stepNum << "ms, max " << maxStats.clothTime << "ms" << std::endl;
+	std::cout << "  Pairs       : avg " << totalStats.pairCount / stepNum << ", max " << maxStats.pairCount << std::endl;
+	std::cout << "  Contacts    : avg " << totalStats.contactCount / stepNum << ", max " << maxStats.contactCount << std::endl;
+}
+
+PhysicsRecordMode PhysicsRecorder::GetMode() const
+{
+	return mode;
+}
+
+float PhysicsRecorder::GetFixedDeltaTime() const
+{
+	return fixedDeltaTime;
+}
+
+UINT32 PhysicsRecorder::GetCurrentStep() const
+{
+	return currentStep;
+}
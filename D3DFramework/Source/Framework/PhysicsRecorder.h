@@ -0,0 +1,111 @@
+#pragma once
+
+#include "Enumeration.h"
+#include "Physics.h"
+#include "ObjectTable.h"
+#include <array>
+
+class GameObject;
+
+/*
+물리 시뮬레이션을 기록하고 재생하는 클래스
+기록할 때는 초기 월드 상태와 난수 시드, 매 스텝의 입력 변화를 이진 파일에 저장하고,
+재생할 때는 같은 고정 시간 간격으로 같은 입력을 넣어 시뮬레이션을 그대로 재현한다.
+기록과 재생 모두 한 프레임이 고정 시간 간격의 한 스텝이므로 객체의 Tick도 같은 시간 간격을 받는다.
+재생이 끝나면 단계별 소요 시간과 충돌 쌍, 접촉 개수를 보고하여 성능 회귀 측정에 사용한다.
+같은 빌드, 같은 플랫폼에서만 비트 단위로 같은 결과가 보장된다.
+*/
+class PhysicsRecorder
+{
+public:
+	PhysicsRecorder(const PhysicsRecordMode mode, const std::string& fileName, const float fixedDeltaTime = 1.0f / 60.0f);
+	PhysicsRecorder(const PhysicsRecorder& rhs) = delete;
+	PhysicsRecorder& operator=(const PhysicsRecorder& rhs) = delete;
+	~PhysicsRecorder();
+
+public:
+	// 재생 모드라면 파일을 읽어 시드와 초기 상태, 입력들을 불러오고 시드를 적용한다.
+	// 기록 모드라면 현재 시드로 난수 생성기를 다시 초기화한다.
+	// 시드는 객체가 생성되기 전에 적용되어야 하므로 객체 생성 이전에 불려져야 한다.
+	bool Load();
+	// 파일을 닫는다. 기록 모드라면 파일을 쓰고, 재생 모드라면 통계를 출력한다.
+	void Close();
+
+	// 기록 모드에서 객체들의 초기 상태를 저장한다.
+	void CaptureInitialState(const ObjectTable& objects);
+	// 재생 모드에서 기록된 초기 상태로 객체들을 되돌린다.
+	bool RestoreInitialState(const ObjectTable& objects) const;
+
+	// 이번 스텝에서 이전 스텝과 달라진 키 입력을 기록한다.
+	void RecordInput(const bool* keys);
+	// 이번 스텝에 기록된 키 입력을 적용한다.
+	void ReplayInput(bool* keys);
+
+	// 한 스텝을 끝마치고 해당 스텝의 통계를 누적한다.
+	void EndStep(const PhysicsStats& stats);
+
+	// 재생할 스텝이 모두 끝났는지 확인한다.
+	bool IsFinished() const;
+
+	PhysicsRecordMode GetMode() const;
+	float GetFixedDeltaTime() const;
+	UINT32 GetCurrentStep() const;
+
+private:
+	// 기록 파일에 저장되는 구조체들이다.
+	// 파일을 그대로 읽고 쓰기 때문에 크기가 고정된 타입만 사용한다.
+	struct FileHeader
+	{
+		UINT32 magic;
+		UINT32 version;
+		UINT64 seed;
+		float fixedDeltaTime;
+		UINT32 objectCount;
+		UINT32 stepCount;
+		UINT32 inputCount;
+	};
+
+	struct ObjectState
+	{
+		UINT64 uid;
+		XMFLOAT3 position;
+		XMFLOAT4 rotation;
+		XMFLOAT3 scale;
+		XMFLOAT3 velocity;
+		XMFLOAT3 angularVelocity;
+	};
+
+	// 키 입력은 변화가 생긴 스텝에서만 기록한다.
+	struct InputEvent
+	{
+		UINT32 step;
+		UINT8 key;
+		UINT8 isDown;
+		UINT16 padding;
+	};
+
+	static constexpr UINT32 fileMagic = 0x59485052; // "RPHY"
+	static constexpr UINT32 fileVersion = 2;
+
+	// 재생이 끝난 후 누적된 통계를 출력한다.
+	void Report() const;
+
+private:
+	PhysicsRecordMode mode = PhysicsRecordMode::None;
+	std::string fileName;
+	float fixedDeltaTime = 0.0f;
+	UINT64 seed = 0;
+
+	std::vector<ObjectState> initialStates;
+	std::vector<InputEvent> inputEvents;
+	// 재생 시 다음에 적용할 입력의 인덱스
+	size_t nextInputIndex = 0;
+
+	std::array<bool, 256> prevKeys = {};
+	UINT32 currentStep = 0;
+	UINT32 stepCount = 0;
+
+	PhysicsStats totalStats;
+	PhysicsStats maxStats;
+	bool isClosed = false;
+};
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "ParallelFor.hpp"
+#include <array>
+#include <vector>
+#include <basetsd.h>
+
+// 하나의 작업이 히스토그램을 만들고 분배할 원소의 개수
+static constexpr UINT32 radixSortChunkSize = 4096;
+
+/*
+getKey(item)가 반환하는 64비트 키의 오름차순으로 items를 안정 정렬하는 LSD 기수 정렬
+한 번에 8비트씩 처리하며, 모든 원소가 같은 자릿값을 가지는 패스는 건너뛴다.
+원소가 많다면 radixSortChunkSize개씩 나눈 청크마다 히스토그램과 분배를 병렬로 처리한다.
+scratch와 histograms는 호출 간에 재사용되는 작업 공간으로, 정렬 후 내용은 의미가 없다.
+*/
+template<typename T, typename KeyFunc>
+void RadixSort(std::vector<T>& items, std::vector<T>& scratch, std::vector<std::array<UINT32, 256>>& histograms, KeyFunc&& getKey)
+{
+	constexpr UINT32 radixBits = 8;
+	constexpr UINT32 bucketNum = 1 << radixBits;
+	constexpr UINT32 passNum = 64 / radixBits;
+
+	const UINT32 count = (UINT32)items.size();
+	if (count <= 1)
+		return;
+
+	const UINT32 chunkNum = (count + radixSortChunkSize - 1) / radixSortChunkSize;
+	scratch.resize(count);
+	histograms.resize(chunkNum);
+
+	T* src = items.data();
+	T* dst = scratch.data();
+
+	for (UINT32 pass = 0; pass < passNum; ++pass)
+	{
+		const UINT32 shift = pass * radixBits;
+
+		ParallelFor(chunkNum, 1, [src, count, shift, &histograms, &getKey](const UINT32 chunk)
+		{
+			auto& histogram = histograms[chunk];
+			histogram.fill(0);
+
+			const UINT32 end = (std::min)((chunk + 1) * radixSortChunkSize, count);
+			for (UINT32 i = chunk * radixSortChunkSize; i < end; ++i)
+				++histogram[(getKey(src[i]) >> shift) & (bucketNum - 1)];
+		});
+
+		// 청크 순서대로 분배 위치를 매겨 같은 자릿값끼리의 순서를 유지한다.
+		UINT32 offset = 0;
+		bool isTrivial = false;
+		for (UINT32 bucket = 0; bucket < bucketNum && !isTrivial; ++bucket)
+		{
+			const UINT32 bucketStart = offset;
+			for (UINT32 chunk = 0; chunk < chunkNum; ++chunk)
+			{
+				const UINT32 bucketCount = histograms[chunk][bucket];
+				histograms[chunk][bucket] = offset;
+				offset += bucketCount;
+			}
+
+			isTrivial = offset - bucketStart == count;
+		}
+
+		if (isTrivial)
+			continue;
+
+		ParallelFor(chunkNum, 1, [src, dst, count, shift, &histograms, &getKey](const UINT32 chunk)
+		{
+			auto& offsets = histograms[chunk];
+
+			const UINT32 end = (std::min)((chunk + 1) * radixSortChunkSize, count);
+			for (UINT32 i = chunk * radixSortChunkSize; i < end; ++i)
+				dst[offsets[(getKey(src[i]) >> shift) & (bucketNum - 1)]++] = src[i];
+		});
+
+		std::swap(src, dst);
+	}
+
+	// 홀수 번 분배되었다면 결과가 작업 공간에 있다.
+	if (src != items.data())
+		items.swap(scratch);
+}
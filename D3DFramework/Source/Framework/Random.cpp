@@ -1,20 +1,37 @@
 #include "../PrecompiledHeader/pch.h"
 #include "Random.h"
-#include <random>
 
-float Random::GetRandomFloat(float min, float max)
+void Random::SetSeed(const UINT64 seed)
 {
-	static std::random_device rd;
-	static std::mt19937_64 mt(rd());
+	Random::seed = seed;
+	engine.seed(seed);
+}
 
-	// min max ̰  ų  ۴ٸ
-	// ּҰ ׳ ȯѴ.
+UINT64 Random::GetSeed()
+{
+	return seed;
+}
+
+const std::mt19937_64& Random::GetEngine()
+{
+	return engine;
+}
+
+void Random::SetEngine(const std::mt19937_64& state)
+{
+	engine = state;
+}
+
+float Random::GetRandomFloat(float min, float max)
+{
+	// min과 max의 차이가 거의 같거나 더 작다면
+	// 최소값을 그냥 반환한다.
 	if (max - min < FLT_EPSILON)
 		return min;
 
 	std::uniform_real_distribution uid(min, max);
 
-	return uid(mt);
+	return uid(engine);
 }
 
 XMFLOAT2 Random::GetRandomFloat2(const XMFLOAT2& min, const XMFLOAT2& max)
@@ -1,9 +1,10 @@
 #pragma once
 
 #include "Vector.h"
+#include <random>
 
 /*
-  ȯϴ Ŭ
+랜덤한 수를 반환하는 클래스
 */
 class Random
 {
@@ -17,4 +18,17 @@ public:
 	static XMFLOAT3 GetRandomFloat3(const XMFLOAT3& min, const XMFLOAT3& max);
 	static XMFLOAT4 GetRandomFloat4(const XMFLOAT4& min, const XMFLOAT4& max);
 	static XMFLOAT3 GetRandomNormal();
+
+	// 난수 생성기의 시드를 설정한다. 같은 시드라면 항상 같은 순서의 난수가 만들어진다.
+	static void SetSeed(const UINT64 seed);
+	static UINT64 GetSeed();
+
+	// 되감기를 위해 난수 생성기의 상태를 통째로 읽고 쓴다.
+	static const std::mt19937_64& GetEngine();
+	static void SetEngine(const std::mt19937_64& state);
+
+private:
+	// 시드를 따로 설정하지 않는다면 random_device로 시드를 정한다.
+	static inline UINT64 seed = ((UINT64)std::random_device{}() << 32) | std::random_device{}();
+	static inline std::mt19937_64 engine{ seed };
 };
\ No newline at end of file
@@ -4,7 +4,7 @@
 #include <DirectXCollision.h>
 
 /*
-׸  ִ Ʈ  ̽ ӹ޴´.
+그릴 수 있는 오브젝트는 이 인터페이스를 상속받는다.
 */
 class Renderable
 {
@@ -0,0 +1,386 @@
+#include "../PrecompiledHeader/pch.h"
+#include "SceneFile.h"
+#include "AssetManager.h"
+#include "TransformStore.h"
+#include "../Component/Mesh.h"
+#include "../Component/Material.h"
+#include "../Object/GameObject.h"
+#include "../Object/SkySphere.h"
+#include <fstream>
+#include <filesystem>
+#include <unordered_map>
+
+// 테이블은 8바이트 경계에서 시작한다.
+static UINT64 AlignOffset(const UINT64 offset)
+{
+	return (offset + 7) & ~7ull;
+}
+
+SceneFile::SceneFile() { }
+
+SceneFile::~SceneFile()
+{
+	Close();
+}
+
+bool SceneFile::Save(const std::wstring& fileName, const ObjectTable& objects, const RenderLayers& renderLayers)
+{
+	std::string stringData;
+	std::vector<SceneString> meshNames;
+	std::vector<SceneString> materialNames;
+	std::vector<SceneString> objectNames;
+	std::vector<SceneTransform> transforms;
+	std::vector<SceneObjectRecord> records;
+
+	// 같은 문자열은 한 번만 저장하고 테이블의 인덱스를 반환한다.
+	auto addString = [&stringData](std::unordered_map<std::string, UINT32>& indices, std::vector<SceneString>& table,
+		const std::string& str) -> UINT32
+	{
+		auto iter = indices.find(str);
+		if (iter != indices.end())
+			return iter->second;
+
+		const UINT32 index = (UINT32)table.size();
+		table.push_back({ (UINT32)stringData.size(), (UINT32)str.size() });
+		stringData += str;
+		indices.emplace(str, index);
+		return index;
+	};
+
+	std::unordered_map<std::string, UINT32> meshIndices;
+	std::unordered_map<std::string, UINT32> materialIndices;
+	std::unordered_map<std::string, UINT32> nameIndices;
+	const auto& meshes = AssetManager::GetInstance()->meshes;
+	const auto& materials = AssetManager::GetInstance()->materials;
+
+	for (int layer = 0; layer < (int)RenderLayer::Count; ++layer)
+	{
+		for (const auto handle : renderLayers[layer])
+		{
+			const GameObject* obj = objects.Get(handle);
+			if (obj == nullptr || obj->GetMesh() == nullptr || obj->GetMaterial() == nullptr)
+				continue;
+
+			SceneObjectType type;
+			if (typeid(*obj) == typeid(GameObject))
+				type = SceneObjectType::GameObject;
+			else if (typeid(*obj) == typeid(SkySphere))
+				type = SceneObjectType::SkySphere;
+			else
+				continue;
+
+			// 애셋으로 로드된 메쉬와 재질을 사용하는 객체만 이름으로 다시 찾을 수 있다.
+			const std::string meshName = obj->GetMesh()->GetName();
+			const std::string materialName = obj->GetMaterial()->GetName();
+			auto meshIter = meshes.find(meshName);
+			auto materialIter = materials.find(materialName);
+			if (meshIter == meshes.end() || meshIter->second.get() != obj->GetMesh() ||
+				materialIter == materials.end() || materialIter->second.get() != obj->GetMaterial())
+				continue;
+
+			SceneTransform transform;
+			transform.position = obj->GetPosition();
+			transform.rotation = obj->GetRotation();
+			transform.scale = obj->GetScale();
+			transforms.push_back(transform);
+
+			SceneObjectRecord record;
+			record.meshIndex = addString(meshIndices, meshNames, meshName);
+			record.materialIndex = addString(materialIndices, materialNames, materialName);
+			record.nameIndex = addString(nameIndices, objectNames, obj->GetName());
+			record.mass = obj->GetMass();
+			record.type = type;
+			record.renderLayer = (UINT8)layer;
+			record.collisionType = (UINT8)obj->collisionType;
+			record.flags = (obj->isStatic ? flagStatic : 0) | (obj->isPhysics ? flagPhysics : 0) | (obj->isVisible ? flagVisible : 0);
+			records.push_back(record);
+		}
+	}
+
+	SceneFileHeader header = {};
+	header.magic = magic;
+	header.version = version;
+	header.objectCount = (UINT32)records.size();
+	header.meshCount = (UINT32)meshNames.size();
+	header.materialCount = (UINT32)materialNames.size();
+	header.nameCount = (UINT32)objectNames.size();
+
+	header.stringDataOffset = AlignOffset(sizeof(SceneFileHeader));
+	header.stringDataSize = stringData.size();
+	header.meshNameOffset = AlignOffset(header.stringDataOffset + header.stringDataSize);
+	header.materialNameOffset = AlignOffset(header.meshNameOffset + meshNames.size() * sizeof(SceneString));
+	header.objectNameOffset = AlignOffset(header.materialNameOffset + materialNames.size() * sizeof(SceneString));
+	header.transformOffset = AlignOffset(header.objectNameOffset + objectNames.size() * sizeof(SceneString));
+	header.objectOffset = AlignOffset(header.transformOffset + transforms.size() * sizeof(SceneTransform));
+
+	std::filesystem::path path(fileName);
+	if (path.has_parent_path())
+		std::filesystem::create_directories(path.parent_path());
+
+	std::ofstream fout(fileName, std::ios::binary | std::ios::trunc);
+	if (!fout)
+	{
+#if defined(DEBUG) || defined(_DEBUG)
+		std::wcout << fileName << L" Can't Write Scene File" << std::endl;
+#endif
+		return false;
+	}
+
+	// 오프셋에 맞춰 0으로 채운 뒤 테이블을 쓴다.
+	auto writeTable = [&fout](const UINT64 offset, const void* tableData, const size_t size)
+	{
+		static const char padding[8] = {};
+		const UINT64 position = (UINT64)fout.tellp();
+		fout.write(padding, (std::streamsize)(offset - position));
+		fout.write(static_cast<const char*>(tableData), (std::streamsize)size);
+	};
+
+	writeTable(0, &header, sizeof(SceneFileHeader));
+	writeTable(header.stringDataOffset, stringData.data(), stringData.size());
+	writeTable(header.meshNameOffset, meshNames.data(), meshNames.size() * sizeof(SceneString));
+	writeTable(header.materialNameOffset, materialNames.data(), materialNames.size() * sizeof(SceneString));
+	writeTable(header.objectNameOffset, objectNames.data(), objectNames.size() * sizeof(SceneString));
+	writeTable(header.transformOffset, transforms.data(), transforms.size() * sizeof(SceneTransform));
+	writeTable(header.objectOffset, records.data(), records.size() * sizeof(SceneObjectRecord));
+
+	return (bool)fout;
+}
+
+bool SceneFile::Open(const std::wstring& fileName)
+{
+	Close();
+
+	fileHandle = CreateFileW(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING,
+		FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (fileHandle == INVALID_HANDLE_VALUE)
+		return false;
+
+	LARGE_INTEGER size;
+	if (!GetFileSizeEx(fileHandle, &size) || size.QuadPart < (LONGLONG)sizeof(SceneFileHeader))
+	{
+		Close();
+		return false;
+	}
+	fileSize = (UINT64)size.QuadPart;
+
+	mappingHandle = CreateFileMappingW(fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mappingHandle == NULL)
+	{
+		Close();
+		return false;
+	}
+
+	data = static_cast<const BYTE*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+	if (data == nullptr)
+	{
+		Close();
+		return false;
+	}
+
+	header = GetTable<SceneFileHeader>(0);
+
+	const bool isValid = header->magic == magic && header->version == version &&
+		IsInRange(header->stringDataOffset, header->stringDataSize) &&
+		IsInRange(header->meshNameOffset, (UINT64)header->meshCount * sizeof(SceneString)) &&
+		IsInRange(header->materialNameOffset, (UINT64)header->materialCount * sizeof(SceneString)) &&
+		IsInRange(header->objectNameOffset, (UINT64)header->nameCount * sizeof(SceneString)) &&
+		IsInRange(header->transformOffset, (UINT64)header->objectCount * sizeof(SceneTransform)) &&
+		IsInRange(header->objectOffset, (UINT64)header->objectCount * sizeof(SceneObjectRecord));
+
+	if (!isValid)
+	{
+#if defined(DEBUG) || defined(_DEBUG)
+		std::wcout << fileName << L" Invalid Scene File" << std::endl;
+#endif
+		Close();
+		return false;
+	}
+
+	return true;
+}
+
+void SceneFile::Close()
+{
+	if (data)
+		UnmapViewOfFile(data);
+	if (mappingHandle)
+		CloseHandle(mappingHandle);
+	if (fileHandle != INVALID_HANDLE_VALUE)
+		CloseHandle(fileHandle);
+
+	data = nullptr;
+	mappingHandle = NULL;
+	fileHandle = INVALID_HANDLE_VALUE;
+	fileSize = 0;
+	header = nullptr;
+}
+
+bool SceneFile::IsOpen() const
+{
+	return header != nullptr;
+}
+
+UINT32 SceneFile::Instantiate(ObjectTable& objects, RenderLayers& renderLayers) const
+{
+	if (!IsOpen())
+		return 0;
+
+	const auto transforms = GetTransforms();
+	const auto records = GetObjects();
+
+	// 메쉬와 재질은 객체마다가 아니라 테이블의 항목마다 한 번씩만 찾는다.
+	const auto& meshes = AssetManager::GetInstance()->meshes;
+	const auto& materials = AssetManager::GetInstance()->materials;
+
+	std::vector<Mesh*> meshTable(header->meshCount, nullptr);
+	for (UINT32 i = 0; i < header->meshCount; ++i)
+	{
+		auto iter = meshes.find(std::string(GetMeshName(i)));
+		if (iter != meshes.end())
+			meshTable[i] = iter->second.get();
+	}
+
+	std::vector<Material*> materialTable(header->materialCount, nullptr);
+	for (UINT32 i = 0; i < header->materialCount; ++i)
+	{
+		auto iter = materials.find(std::string(GetMaterialName(i)));
+		if (iter != materials.end())
+			materialTable[i] = iter->second.get();
+	}
+
+	// 잘못된 레코드를 거르고, 타입과 레이어별 개수를 세어 공간을 미리 확보한다.
+	auto isValidRecord = [this, &meshTable, &materialTable](const SceneObjectRecord& record)
+	{
+		return IsValidRecord(record) && meshTable[record.meshIndex] != nullptr && materialTable[record.materialIndex] != nullptr;
+	};
+
+	std::array<UINT32, (int)SceneObjectType::Count> typeCounts = {};
+	std::array<UINT32, (int)RenderLayer::Count> layerCounts = {};
+	UINT32 validCount = 0;
+	for (const auto& record : records)
+	{
+		if (!isValidRecord(record))
+			continue;
+
+		++typeCounts[(int)record.type];
+		++layerCounts[record.renderLayer];
+		++validCount;
+	}
+
+	ObjectPool<GameObject>::GetInstance()->Reserve(typeCounts[(int)SceneObjectType::GameObject]);
+	ObjectPool<SkySphere>::GetInstance()->Reserve(typeCounts[(int)SceneObjectType::SkySphere]);
+	objects.Reserve(validCount);
+	TransformStore::GetInstance()->Reserve(TransformStore::GetInstance()->GetCount() + validCount);
+	for (int layer = 0; layer < (int)RenderLayer::Count; ++layer)
+		renderLayers[layer].reserve(renderLayers[layer].size() + layerCounts[layer]);
+
+	for (UINT32 i = 0; i < header->objectCount; ++i)
+	{
+		const SceneObjectRecord& record = records[i];
+		if (!isValidRecord(record))
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			std::cout << "Scene Object " << i << " is Invalid" << std::endl;
+#endif
+			continue;
+		}
+
+		GameObject* obj = CreateObject(i, objects, meshTable[record.meshIndex], materialTable[record.materialIndex]);
+		renderLayers[record.renderLayer].push_back(obj->GetHandle());
+	}
+
+	return validCount;
+}
+
+GameObject* SceneFile::CreateObject(const UINT32 index, ObjectTable& objects, Mesh* mesh, Material* material) const
+{
+	const SceneObjectRecord& record = GetObjects()[index];
+
+	std::string name(GetObjectName(record.nameIndex));
+	GameObject* obj;
+	if (record.type == SceneObjectType::SkySphere)
+		obj = objects.Create<SkySphere>(std::move(name));
+	else
+		obj = objects.Create<GameObject>(std::move(name));
+
+	const SceneTransform& transform = GetTransforms()[index];
+	obj->SetPosition(transform.position);
+	obj->SetRotation(transform.rotation);
+	obj->SetScale(transform.scale);
+	obj->SetMaterial(material);
+	obj->SetMesh(mesh);
+	obj->SetMass(record.mass);
+
+	obj->collisionType = (CollisionType)record.collisionType;
+	obj->isStatic = (record.flags & flagStatic) != 0;
+	obj->isPhysics = (record.flags & flagPhysics) != 0;
+	obj->isVisible = (record.flags & flagVisible) != 0;
+	if (obj->isPhysics)
+		obj->SetInverseInertiaTensor();
+
+	return obj;
+}
+
+bool SceneFile::IsValidRecord(const SceneObjectRecord& record) const
+{
+	return record.meshIndex < header->meshCount && record.materialIndex < header->materialCount &&
+		record.nameIndex < header->nameCount && record.type < SceneObjectType::Count &&
+		record.renderLayer < (UINT8)RenderLayer::Count && record.collisionType <= (UINT8)CollisionType::Point;
+}
+
+UINT32 SceneFile::GetObjectCount() const
+{
+	return header ? header->objectCount : 0;
+}
+
+UINT32 SceneFile::GetMeshCount() const
+{
+	return header ? header->meshCount : 0;
+}
+
+UINT32 SceneFile::GetMaterialCount() const
+{
+	return header ? header->materialCount : 0;
+}
+
+std::span<const SceneTransform> SceneFile::GetTransforms() const
+{
+	if (!header)
+		return {};
+	return std::span<const SceneTransform>(GetTable<SceneTransform>(header->transformOffset), header->objectCount);
+}
+
+std::span<const SceneObjectRecord> SceneFile::GetObjects() const
+{
+	if (!header)
+		return {};
+	return std::span<const SceneObjectRecord>(GetTable<SceneObjectRecord>(header->objectOffset), header->objectCount);
+}
+
+std::string_view SceneFile::GetMeshName(const UINT32 index) const
+{
+	return GetString(GetTable<SceneString>(header->meshNameOffset)[index]);
+}
+
+std::string_view SceneFile::GetMaterialName(const UINT32 index) const
+{
+	return GetString(GetTable<SceneString>(header->materialNameOffset)[index]);
+}
+
+std::string_view SceneFile::GetObjectName(const UINT32 index) const
+{
+	return GetString(GetTable<SceneString>(header->objectNameOffset)[index]);
+}
+
+std::string_view SceneFile::GetString(const SceneString& str) const
+{
+	// 문자열 데이터를 벗어나는 문자열은 빈 문자열로 취급한다.
+	if ((UINT64)str.offset + str.length > header->stringDataSize)
+		return {};
+	return std::string_view(reinterpret_cast<const char*>(data + header->stringDataOffset + str.offset), str.length);
+}
+
+bool SceneFile::IsInRange(const UINT64 offset, const UINT64 size) const
+{
+	return offset % 8 == 0 && offset <= fileSize && size <= fileSize - offset;
+}
@@ -0,0 +1,145 @@
+#pragma once
+
+#include "Enumeration.h"
+#include "Vector.h"
+#include "ObjectTable.h"
+#include <array>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class GameObject;
+class Mesh;
+class Material;
+
+/*
+씬 파일은 헤더와 평평한 테이블들로 이루어진다.
+각 테이블은 헤더에 적힌 오프셋에서 시작하며, 객체의 i번째 원소는 각 테이블의 i번째 원소이다.
+메쉬와 재질, 이름은 문자열 테이블의 인덱스로만 저장하여 객체마다 문자열을 비교하지 않는다.
+*/
+enum class SceneObjectType : UINT8
+{
+	GameObject = 0,
+	SkySphere,
+	Count,
+};
+
+struct SceneFileHeader
+{
+	UINT32 magic;
+	UINT32 version;
+	UINT32 objectCount;
+	UINT32 meshCount;
+	UINT32 materialCount;
+	UINT32 nameCount;
+
+	// 각 테이블의 파일 시작으로부터의 오프셋
+	UINT64 stringDataOffset;
+	UINT64 stringDataSize;
+	UINT64 meshNameOffset;
+	UINT64 materialNameOffset;
+	UINT64 objectNameOffset;
+	UINT64 transformOffset;
+	UINT64 objectOffset;
+};
+
+// 문자열 데이터 안에서의 위치. 널 문자로 끝나지 않는다.
+struct SceneString
+{
+	UINT32 offset;
+	UINT32 length;
+};
+
+struct SceneTransform
+{
+	XMFLOAT3 position;
+	// 사원수
+	XMFLOAT4 rotation;
+	XMFLOAT3 scale;
+};
+
+struct SceneObjectRecord
+{
+	UINT32 meshIndex;
+	UINT32 materialIndex;
+	UINT32 nameIndex;
+	float mass;
+	SceneObjectType type;
+	UINT8 renderLayer;
+	UINT8 collisionType;
+	UINT8 flags;
+};
+
+/*
+객체들을 이진 씬 파일로 저장하고 메모리 맵으로 읽어 한 번에 생성하는 클래스
+파일은 읽기 전용으로 매핑되어 테이블들을 복사 없이 그대로 사용한다.
+Instantiate는 메쉬와 재질을 테이블 단위로 한 번씩만 찾고, 객체 풀과 ObjectTable,
+TransformStore의 공간을 객체의 개수만큼 미리 확보한 뒤 한 번의 순회로 모든 객체를 생성한다.
+*/
+class SceneFile
+{
+public:
+	// 파일의 처음 네 바이트는 "SCNE"이다.
+	static constexpr UINT32 magic = 0x454E4353;
+	static constexpr UINT32 version = 1;
+
+	static constexpr UINT8 flagStatic = 1 << 0;
+	static constexpr UINT8 flagPhysics = 1 << 1;
+	static constexpr UINT8 flagVisible = 1 << 2;
+
+	using RenderLayers = std::array<std::vector<ObjectHandle>, (int)RenderLayer::Count>;
+
+public:
+	SceneFile();
+	SceneFile(const SceneFile& rhs) = delete;
+	SceneFile& operator=(const SceneFile& rhs) = delete;
+	~SceneFile();
+
+public:
+	// renderLayers에 들어있는 객체들 중 씬 파일로 표현할 수 있는 객체들을 저장한다.
+	static bool Save(const std::wstring& fileName, const ObjectTable& objects, const RenderLayers& renderLayers);
+
+public:
+	// 파일을 메모리에 매핑하고 헤더와 테이블의 범위를 검사한다.
+	bool Open(const std::wstring& fileName);
+	void Close();
+	bool IsOpen() const;
+
+	// 모든 객체를 생성하여 objects에 추가하고 렌더 레이어에 핸들을 넣는다. 생성한 객체의 개수를 반환한다.
+	UINT32 Instantiate(ObjectTable& objects, RenderLayers& renderLayers) const;
+	// index번째 레코드로 객체 하나를 생성한다. 렌더 레이어에는 추가하지 않는다.
+	GameObject* CreateObject(const UINT32 index, ObjectTable& objects, Mesh* mesh, Material* material) const;
+	// 레코드의 인덱스와 열거형 값들이 테이블의 범위 안에 있는지 확인한다.
+	bool IsValidRecord(const SceneObjectRecord& record) const;
+
+	UINT32 GetObjectCount() const;
+	UINT32 GetMeshCount() const;
+	UINT32 GetMaterialCount() const;
+	std::span<const SceneTransform> GetTransforms() const;
+	std::span<const SceneObjectRecord> GetObjects() const;
+
+	std::string_view GetMeshName(const UINT32 index) const;
+	std::string_view GetMaterialName(const UINT32 index) const;
+	std::string_view GetObjectName(const UINT32 index) const;
+
+private:
+	std::string_view GetString(const SceneString& str) const;
+
+	// 테이블이 파일의 범위 안에 있는지 확인한다.
+	bool IsInRange(const UINT64 offset, const UINT64 size) const;
+
+	template<typename T>
+	const T* GetTable(const UINT64 offset) const
+	{
+		return reinterpret_cast<const T*>(data + offset);
+	}
+
+private:
+	HANDLE fileHandle = INVALID_HANDLE_VALUE;
+	HANDLE mappingHandle = NULL;
+	const BYTE* data = nullptr;
+	UINT64 fileSize = 0;
+
+	const SceneFileHeader* header = nullptr;
+};
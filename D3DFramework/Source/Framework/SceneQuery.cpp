@@ -0,0 +1,482 @@
+#include "../PrecompiledHeader/pch.h"
+#include "SceneQuery.h"
+#include "Broadphase.h"
+#include "../Object/GameObject.h"
+
+/*
+질의할 수 있는 충돌 타입인지 확인한다.
+*/
+static bool IsQueryable(const CollisionType collisionType)
+{
+	return collisionType != CollisionType::None && collisionType != CollisionType::Point;
+}
+
+/*
+객체의 충돌 바운딩으로 프록시를 만든다. 질의할 수 없는 객체라면 false를 반환한다.
+*/
+static bool MakeProxy(GameObject* obj, SceneQuery::Proxy& outProxy)
+{
+	// 충돌 바운딩은 충돌 체크 여부와 상관없이 메쉬의 충돌 타입으로 계산된다.
+	CollisionType meshCollisionType = obj->GetMeshCollisionType();
+	if (!IsQueryable(meshCollisionType))
+		return false;
+
+	outProxy.handle = obj->GetHandle();
+	outProxy.collisionType = obj->GetCollisionType();
+	outProxy.meshCollisionType = meshCollisionType;
+
+	auto bounding = obj->GetCollisionBounding();
+	switch (meshCollisionType)
+	{
+		case CollisionType::AABB:
+		{
+			outProxy.aabb = std::any_cast<BoundingBox>(bounding);
+			break;
+		}
+		case CollisionType::OBB:
+		{
+			outProxy.obb = std::any_cast<BoundingOrientedBox>(bounding);
+			XMFLOAT3 corners[BoundingOrientedBox::CORNER_COUNT];
+			outProxy.obb.GetCorners(corners);
+			BoundingBox::CreateFromPoints(outProxy.aabb, BoundingOrientedBox::CORNER_COUNT, corners, sizeof(XMFLOAT3));
+			break;
+		}
+		case CollisionType::Sphere:
+		{
+			outProxy.sphere = std::any_cast<BoundingSphere>(bounding);
+			BoundingBox::CreateFromSphere(outProxy.aabb, outProxy.sphere);
+			break;
+		}
+	}
+
+	outProxy.minX = outProxy.aabb.Center.x - outProxy.aabb.Extents.x;
+	outProxy.maxX = outProxy.aabb.Center.x + outProxy.aabb.Extents.x;
+	return true;
+}
+
+/*
+origin에서 direction으로 distance만큼 움직이는 반지름 radius의 구가 지나는 x축 구간을 구한다.
+*/
+static void GetSegmentRangeX(const float originX, const float directionX, const float distance, const float radius,
+	float& outMinX, float& outMaxX)
+{
+	const float endX = originX + directionX * distance;
+	outMinX = (std::min)(originX, endX) - radius;
+	outMaxX = (std::max)(originX, endX) + radius;
+}
+
+/*
+nodeTest를 통과한 노드만 내려가며 리프의 프록시들을 proxyTest로 검사한다.
+*/
+template <typename NodeTest, typename ProxyTest>
+static void TraverseStaticTree(const SceneQuery::StaticTree* tree, NodeTest&& nodeTest, ProxyTest&& proxyTest)
+{
+	if (tree == nullptr || tree->nodes.empty())
+		return;
+
+	// 중앙값으로 나누므로 깊이는 프록시 개수의 로그에 비례한다.
+	UINT32 stack[64];
+	UINT32 stackSize = 0;
+	stack[stackSize++] = 0;
+
+	while (stackSize > 0)
+	{
+		const UINT32 nodeIndex = stack[--stackSize];
+		const SceneQuery::StaticNode& node = tree->nodes[nodeIndex];
+		if (!nodeTest(node.aabb))
+			continue;
+
+		if (node.count > 0)
+		{
+			for (UINT32 i = node.first; i < node.first + node.count; ++i)
+				proxyTest(tree->proxies[i]);
+		}
+		else
+		{
+			stack[stackSize++] = node.rightChild;
+			stack[stackSize++] = nodeIndex + 1;
+		}
+	}
+}
+
+SceneQuery::SceneQuery()
+{
+	currentSnapshot = std::make_shared<Snapshot>();
+}
+
+SceneQuery::~SceneQuery()
+{
+	// 작업들이 이 객체의 스냅샷을 사용하므로 모두 끝날 때까지 기다린다.
+	JobSystem::GetInstance()->Wait(queryCounter);
+}
+
+void SceneQuery::UpdateSnapshot(const ObjectTable& objects, const Broadphase& broadphase)
+{
+	// 정적 객체는 움직이지 않으므로 Broadphase의 정적 객체가 바뀌었을 때만 정적 트리를 다시 만든다.
+	if (staticTree == nullptr || staticRevision != broadphase.GetStaticRevision())
+		RebuildStaticTree(objects, broadphase);
+
+	// 질의 작업이 더 이상 사용하지 않는 이전 스냅샷이 있다면 재사용한다.
+	std::shared_ptr<Snapshot> snapshot;
+	if (spareSnapshot != nullptr && spareSnapshot.use_count() == 1)
+		snapshot = std::move(spareSnapshot);
+	else
+		snapshot = std::make_shared<Snapshot>();
+
+	snapshot->staticTree = staticTree;
+	snapshot->dynamicProxies.clear();
+	snapshot->dynamicProxies.reserve(objects.GetCount());
+	snapshot->maxDynamicWidth = 0.0f;
+
+	for (GameObject* obj : objects)
+	{
+		// 정적 트리에 들어간 객체는 건너뛴다.
+		const ObjectHandle handle = obj->GetHandle();
+		if (handle.GetIndex() < staticHandleValues.size() && staticHandleValues[handle.GetIndex()] == handle.value)
+			continue;
+
+		Proxy proxy;
+		if (!MakeProxy(obj, proxy))
+			continue;
+
+		snapshot->maxDynamicWidth = (std::max)(snapshot->maxDynamicWidth, proxy.maxX - proxy.minX);
+		snapshot->dynamicProxies.push_back(std::move(proxy));
+	}
+
+	// Broadphase의 동적 리스트와 같이 x축 최솟값으로 정렬한다.
+	std::sort(snapshot->dynamicProxies.begin(), snapshot->dynamicProxies.end(),
+		[](const Proxy& lhs, const Proxy& rhs) { return lhs.minX < rhs.minX; });
+
+	std::shared_ptr<const Snapshot> prevSnapshot;
+	{
+		std::lock_guard<std::mutex> lock(snapshotMutex);
+		prevSnapshot = std::move(currentSnapshot);
+		currentSnapshot = std::move(snapshot);
+	}
+	spareSnapshot = std::const_pointer_cast<Snapshot>(prevSnapshot);
+}
+
+void SceneQuery::RebuildStaticTree(const ObjectTable& objects, const Broadphase& broadphase)
+{
+	// 이전 트리는 그것을 가진 스냅샷들이 모두 사라질 때 해제된다.
+	auto tree = std::make_shared<StaticTree>();
+	std::fill(staticHandleValues.begin(), staticHandleValues.end(), 0);
+
+	const auto& staticObjects = broadphase.GetStaticObjects();
+	tree->proxies.reserve(staticObjects.size());
+	for (const ObjectHandle handle : staticObjects)
+	{
+		GameObject* obj = objects.Get(handle);
+		Proxy proxy;
+		if (obj == nullptr || !MakeProxy(obj, proxy))
+			continue;
+
+		tree->proxies.push_back(std::move(proxy));
+
+		if (handle.GetIndex() >= staticHandleValues.size())
+			staticHandleValues.resize(handle.GetIndex() + 1, 0);
+		staticHandleValues[handle.GetIndex()] = handle.value;
+	}
+
+	if (!tree->proxies.empty())
+	{
+		tree->nodes.reserve(tree->proxies.size() * 2 / staticLeafSize + 1);
+		BuildStaticNode(*tree, 0, (UINT32)tree->proxies.size());
+	}
+
+	staticTree = std::move(tree);
+	staticRevision = broadphase.GetStaticRevision();
+}
+
+void SceneQuery::BuildStaticNode(StaticTree& tree, const UINT32 first, const UINT32 count)
+{
+	const UINT32 nodeIndex = (UINT32)tree.nodes.size();
+	tree.nodes.emplace_back();
+
+	BoundingBox aabb = tree.proxies[first].aabb;
+	for (UINT32 i = first + 1; i < first + count; ++i)
+		BoundingBox::CreateMerged(aabb, aabb, tree.proxies[i].aabb);
+	tree.nodes[nodeIndex].aabb = aabb;
+
+	if (count <= staticLeafSize)
+	{
+		tree.nodes[nodeIndex].first = first;
+		tree.nodes[nodeIndex].count = count;
+		return;
+	}
+
+	// 가장 긴 축에서 중심의 중앙값으로 나눈다.
+	int axis = 0;
+	if (aabb.Extents.y > aabb.Extents.x)
+		axis = 1;
+	if (aabb.Extents.z > (&aabb.Extents.x)[axis])
+		axis = 2;
+
+	const UINT32 half = count / 2;
+	auto begin = tree.proxies.begin() + first;
+	std::nth_element(begin, begin + half, begin + count, [axis](const Proxy& lhs, const Proxy& rhs)
+		{ return (&lhs.aabb.Center.x)[axis] < (&rhs.aabb.Center.x)[axis]; });
+
+	BuildStaticNode(tree, first, half);
+	tree.nodes[nodeIndex].rightChild = (UINT32)tree.nodes.size();
+	BuildStaticNode(tree, first + half, count - half);
+}
+
+size_t SceneQuery::FindFirstDynamicProxy(const Snapshot& snapshot, const float minX)
+{
+	// maxDynamicWidth보다 왼쪽에서 시작하는 프록시는 minX에 닿을 수 없다.
+	const float startX = minX - snapshot.maxDynamicWidth;
+	auto iter = std::lower_bound(snapshot.dynamicProxies.begin(), snapshot.dynamicProxies.end(), startX,
+		[](const Proxy& proxy, const float x) { return proxy.minX < x; });
+	return (size_t)(iter - snapshot.dynamicProxies.begin());
+}
+
+std::future<SceneQueryResult> SceneQuery::Raycast(const XMFLOAT3& origin, const XMFLOAT3& direction,
+	const float distance, const bool isMeshCollision)
+{
+	Request request;
+	request.type = SceneQueryType::Raycast;
+	request.origin = origin;
+	request.direction = Vector3::Normalize(direction);
+	request.distance = distance;
+	request.isMeshCollision = isMeshCollision;
+
+	return Submit(std::move(request));
+}
+
+std::future<SceneQueryResult> SceneQuery::Sweep(const BoundingSphere& sphere, const XMFLOAT3& direction, const float distance)
+{
+	Request request;
+	request.type = SceneQueryType::Sweep;
+	request.origin = sphere.Center;
+	request.direction = Vector3::Normalize(direction);
+	request.distance = distance;
+	request.sphere = sphere;
+
+	return Submit(std::move(request));
+}
+
+std::future<SceneQueryResult> SceneQuery::Overlap(const BoundingBox& aabb)
+{
+	Request request;
+	request.type = SceneQueryType::Overlap;
+	request.aabb = aabb;
+
+	return Submit(std::move(request));
+}
+
+std::future<SceneQueryResult> SceneQuery::Submit(Request&& request)
+{
+	std::future<SceneQueryResult> result = request.promise.get_future();
+
+	// std::function은 복사할 수 있어야 하므로 promise를 가진 요청은 shared_ptr로 넘긴다.
+	auto sharedRequest = std::make_shared<Request>(std::move(request));
+	JobSystem::GetInstance()->Run([this, sharedRequest]()
+	{
+		Execute(*sharedRequest);
+	}, &queryCounter);
+
+	return result;
+}
+
+void SceneQuery::Execute(Request& request)
+{
+	std::shared_ptr<const Snapshot> snapshot = GetSnapshot();
+
+	switch (request.type)
+	{
+		case SceneQueryType::Raycast:
+			request.promise.set_value(ExecuteRaycast(*snapshot, request));
+			break;
+		case SceneQueryType::Sweep:
+			request.promise.set_value(ExecuteSweep(*snapshot, request));
+			break;
+		case SceneQueryType::Overlap:
+			request.promise.set_value(ExecuteOverlap(*snapshot, request));
+			break;
+	}
+}
+
+SceneQueryResult SceneQuery::ExecuteRaycast(const Snapshot& snapshot, const Request& request) const
+{
+	SceneQueryResult result;
+	XMVECTOR rayOrigin = XMLoadFloat3(&request.origin);
+	XMVECTOR rayDir = XMLoadFloat3(&request.direction);
+
+	auto testProxy = [&](const Proxy& proxy)
+	{
+		if (!request.isMeshCollision && !IsQueryable(proxy.collisionType))
+			return;
+
+		// AABB로 먼저 걸러내고 실제 바운딩으로 다시 검사한다.
+		float hitDist = FLT_MAX;
+		if (!proxy.aabb.Intersects(rayOrigin, rayDir, hitDist) || hitDist > result.dist)
+			return;
+
+		bool isHit = false;
+		switch (proxy.meshCollisionType)
+		{
+			case CollisionType::AABB:
+				isHit = true;
+				break;
+			case CollisionType::OBB:
+				isHit = proxy.obb.Intersects(rayOrigin, rayDir, hitDist);
+				break;
+			case CollisionType::Sphere:
+				isHit = proxy.sphere.Intersects(rayOrigin, rayDir, hitDist);
+				break;
+		}
+
+		// 충돌된 객체들 중 가장 가까운 객체가 선택된 객체이다.
+		if (isHit && hitDist < result.dist && hitDist <= request.distance)
+		{
+			result.isHit = true;
+			result.dist = hitDist;
+			result.handle = proxy.handle;
+		}
+	};
+
+	// 정적 트리는 지금까지 찾은 가장 가까운 충돌보다 가까이에서 광선과 부딪히는 노드만 내려간다.
+	TraverseStaticTree(snapshot.staticTree.get(), [&](const BoundingBox& aabb)
+	{
+		float hitDist = 0.0f;
+		return aabb.Intersects(rayOrigin, rayDir, hitDist) && hitDist <= (std::min)(result.dist, request.distance);
+	}, testProxy);
+
+	// 동적 객체는 광선이 지나는 x축 구간과 겹치는 것만 검사한다.
+	float minX, maxX;
+	GetSegmentRangeX(request.origin.x, request.direction.x, request.distance, 0.0f, minX, maxX);
+
+	const auto& proxies = snapshot.dynamicProxies;
+	for (size_t i = FindFirstDynamicProxy(snapshot, minX); i < proxies.size() && proxies[i].minX <= maxX; ++i)
+	{
+		if (proxies[i].maxX >= minX)
+			testProxy(proxies[i]);
+	}
+
+	return result;
+}
+
+SceneQueryResult SceneQuery::ExecuteSweep(const Snapshot& snapshot, const Request& request) const
+{
+	SceneQueryResult result;
+	XMVECTOR rayOrigin = XMLoadFloat3(&request.origin);
+	XMVECTOR rayDir = XMLoadFloat3(&request.direction);
+	const float radius = request.sphere.Radius;
+	const XMFLOAT3 radiusExtents(radius, radius, radius);
+
+	auto testProxy = [&](const Proxy& proxy)
+	{
+		if (!IsQueryable(proxy.collisionType))
+			return;
+
+		// 구의 반지름만큼 바운딩을 부풀리고 구의 중심으로 광선 충돌 검사를 한다.
+		// 박스의 모서리 부분에서는 실제보다 조금 일찍 부딪힌 것으로 판정된다.
+		float hitDist = FLT_MAX;
+		bool isHit = false;
+		switch (proxy.meshCollisionType)
+		{
+			case CollisionType::AABB:
+			{
+				BoundingBox aabb(proxy.aabb.Center, Vector3::Add(proxy.aabb.Extents, radiusExtents));
+				isHit = aabb.Intersects(rayOrigin, rayDir, hitDist);
+				break;
+			}
+			case CollisionType::OBB:
+			{
+				BoundingOrientedBox obb(proxy.obb.Center, Vector3::Add(proxy.obb.Extents, radiusExtents),
+					proxy.obb.Orientation);
+				isHit = obb.Intersects(rayOrigin, rayDir, hitDist);
+				break;
+			}
+			case CollisionType::Sphere:
+			{
+				BoundingSphere sphere(proxy.sphere.Center, proxy.sphere.Radius + radius);
+				isHit = sphere.Intersects(rayOrigin, rayDir, hitDist);
+				break;
+			}
+		}
+
+		if (isHit && hitDist < result.dist && hitDist <= request.distance)
+		{
+			result.isHit = true;
+			result.dist = hitDist;
+			result.handle = proxy.handle;
+		}
+	};
+
+	// 노드의 바운딩도 구의 반지름만큼 부풀려 검사한다.
+	TraverseStaticTree(snapshot.staticTree.get(), [&](const BoundingBox& aabb)
+	{
+		float hitDist = 0.0f;
+		BoundingBox expanded(aabb.Center, Vector3::Add(aabb.Extents, radiusExtents));
+		return expanded.Intersects(rayOrigin, rayDir, hitDist) && hitDist <= (std::min)(result.dist, request.distance);
+	}, testProxy);
+
+	float minX, maxX;
+	GetSegmentRangeX(request.origin.x, request.direction.x, request.distance, radius, minX, maxX);
+
+	const auto& proxies = snapshot.dynamicProxies;
+	for (size_t i = FindFirstDynamicProxy(snapshot, minX); i < proxies.size() && proxies[i].minX <= maxX; ++i)
+	{
+		if (proxies[i].maxX >= minX)
+			testProxy(proxies[i]);
+	}
+
+	return result;
+}
+
+SceneQueryResult SceneQuery::ExecuteOverlap(const Snapshot& snapshot, const Request& request) const
+{
+	SceneQueryResult result;
+
+	auto testProxy = [&](const Proxy& proxy)
+	{
+		if (!IsQueryable(proxy.collisionType))
+			return;
+
+		if (!request.aabb.Intersects(proxy.aabb))
+			return;
+
+		bool isHit = false;
+		switch (proxy.meshCollisionType)
+		{
+			case CollisionType::AABB:
+				isHit = true;
+				break;
+			case CollisionType::OBB:
+				isHit = request.aabb.Intersects(proxy.obb);
+				break;
+			case CollisionType::Sphere:
+				isHit = request.aabb.Intersects(proxy.sphere);
+				break;
+		}
+
+		if (isHit)
+		{
+			result.isHit = true;
+			result.overlaps.push_back(proxy.handle);
+		}
+	};
+
+	TraverseStaticTree(snapshot.staticTree.get(),
+		[&](const BoundingBox& aabb) { return request.aabb.Intersects(aabb); }, testProxy);
+
+	const float minX = request.aabb.Center.x - request.aabb.Extents.x;
+	const float maxX = request.aabb.Center.x + request.aabb.Extents.x;
+
+	const auto& proxies = snapshot.dynamicProxies;
+	for (size_t i = FindFirstDynamicProxy(snapshot, minX); i < proxies.size() && proxies[i].minX <= maxX; ++i)
+	{
+		if (proxies[i].maxX >= minX)
+			testProxy(proxies[i]);
+	}
+
+	return result;
+}
+
+std::shared_ptr<const SceneQuery::Snapshot> SceneQuery::GetSnapshot()
+{
+	std::lock_guard<std::mutex> lock(snapshotMutex);
+	return currentSnapshot;
+}
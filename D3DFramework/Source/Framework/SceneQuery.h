@@ -0,0 +1,146 @@
+#pragma once
+
+#include "JobSystem.h"
+#include "Enumeration.h"
+#include "ObjectTable.h"
+#include <DirectXCollision.h>
+#include <future>
+#include <mutex>
+
+class GameObject;
+class Broadphase;
+
+/*
+질의 결과를 담는 구조체
+Raycast와 Sweep은 가장 가까운 객체를, Overlap은 겹치는 모든 객체를 반환한다.
+handle은 질의 당시의 객체이므로 사용할 때는 ObjectTable에서 객체를 얻어 유효한지 확인한다.
+*/
+struct SceneQueryResult
+{
+	bool isHit = false;
+	float dist = FLT_MAX;
+	ObjectHandle handle;
+	std::vector<ObjectHandle> overlaps;
+};
+
+/*
+광선 충돌, 스윕, 겹침 검사를 JobSystem의 작업으로 비동기 수행하는 클래스
+요청마다 하나의 작업을 추가하므로 프레임의 다른 작업들과 같은 스레드들을 나누어 쓰며,
+작업은 물리 단계 이후에 만들어진 읽기 전용 스냅샷을 대상으로 질의를 수행한다. 결과는 future로 반환된다.
+스냅샷은 Broadphase와 같이 나뉜다. Broadphase의 정적 객체들은 정적 트리가 바뀔 때만
+다시 만드는 BVH에 담겨 여러 스냅샷이 공유하고, 나머지 객체들은 매 프레임 x축으로 정렬되어
+질의의 x축 구간과 겹치는 객체들만 검사한다.
+*/
+class SceneQuery
+{
+public:
+	// 정적 트리의 리프 노드가 가지는 최대 프록시 개수
+	static constexpr UINT32 staticLeafSize = 4;
+
+	// 스냅샷에 저장되는 객체 하나의 충돌 정보
+	struct Proxy
+	{
+		ObjectHandle handle;
+		CollisionType collisionType = CollisionType::None;
+		CollisionType meshCollisionType = CollisionType::None;
+		DirectX::BoundingBox aabb;
+		DirectX::BoundingOrientedBox obb;
+		DirectX::BoundingSphere sphere;
+		float minX = 0.0f;
+		float maxX = 0.0f;
+	};
+
+	// 정적 프록시들의 BVH 노드. 자식이 있다면 왼쪽 자식은 바로 다음 노드이다.
+	struct StaticNode
+	{
+		DirectX::BoundingBox aabb;
+		// 리프라면 proxies에서 시작하는 위치와 개수, 아니라면 count는 0이다.
+		UINT32 first = 0;
+		UINT32 count = 0;
+		UINT32 rightChild = 0;
+	};
+
+	// Broadphase의 정적 객체들로 만든 BVH로, 만들어진 후에는 바뀌지 않는다.
+	struct StaticTree
+	{
+		std::vector<Proxy> proxies;
+		std::vector<StaticNode> nodes;
+	};
+
+	struct Snapshot
+	{
+		std::shared_ptr<const StaticTree> staticTree;
+		// minX로 정렬된 정적 트리 밖의 객체들
+		std::vector<Proxy> dynamicProxies;
+		// dynamicProxies 중 가장 넓은 x축 폭으로, 이진 탐색의 시작 위치를 구할 때 사용한다.
+		float maxDynamicWidth = 0.0f;
+	};
+
+	struct Request
+	{
+		SceneQueryType type = SceneQueryType::Raycast;
+		DirectX::XMFLOAT3 origin = { 0.0f, 0.0f, 0.0f };
+		DirectX::XMFLOAT3 direction = { 0.0f, 0.0f, 1.0f };
+		float distance = 0.0f;
+		// Sweep은 구를, Overlap은 AABB를 사용한다.
+		DirectX::BoundingSphere sphere;
+		DirectX::BoundingBox aabb;
+		bool isMeshCollision = false;
+		std::promise<SceneQueryResult> promise;
+	};
+
+public:
+	SceneQuery();
+	SceneQuery(const SceneQuery& rhs) = delete;
+	SceneQuery& operator=(const SceneQuery& rhs) = delete;
+	~SceneQuery();
+
+public:
+	// 물리 단계가 끝난 뒤에 불러 질의에 사용될 스냅샷을 갱신한다.
+	// 정적 트리는 broadphase의 정적 객체가 바뀌었을 때만 다시 만든다.
+	void UpdateSnapshot(const ObjectTable& objects, const Broadphase& broadphase);
+
+	// 광선과 가장 먼저 부딪히는 객체를 찾는다. 충돌 체크를 끈 객체까지
+	// 검사하고 싶다면 isMeshCollision을 true로 한다.
+	std::future<SceneQueryResult> Raycast(const DirectX::XMFLOAT3& origin, const DirectX::XMFLOAT3& direction,
+		const float distance, const bool isMeshCollision = false);
+	// 구를 direction 방향으로 distance만큼 움직였을 때 가장 먼저 부딪히는 객체를 찾는다.
+	std::future<SceneQueryResult> Sweep(const DirectX::BoundingSphere& sphere, const DirectX::XMFLOAT3& direction,
+		const float distance);
+	// AABB와 겹치는 모든 객체를 찾는다.
+	std::future<SceneQueryResult> Overlap(const DirectX::BoundingBox& aabb);
+
+private:
+	std::future<SceneQueryResult> Submit(Request&& request);
+	void Execute(Request& request);
+
+	SceneQueryResult ExecuteRaycast(const Snapshot& snapshot, const Request& request) const;
+	SceneQueryResult ExecuteSweep(const Snapshot& snapshot, const Request& request) const;
+	SceneQueryResult ExecuteOverlap(const Snapshot& snapshot, const Request& request) const;
+
+	std::shared_ptr<const Snapshot> GetSnapshot();
+
+	// broadphase의 정적 객체들로 정적 트리를 다시 만든다.
+	void RebuildStaticTree(const ObjectTable& objects, const Broadphase& broadphase);
+	// proxies의 [first, first + count) 구간으로 노드를 만들고 재귀적으로 나눈다.
+	static void BuildStaticNode(StaticTree& tree, const UINT32 first, const UINT32 count);
+	// x축 구간 [minX, maxX]와 겹칠 수 있는 동적 프록시의 시작 위치를 찾는다.
+	static size_t FindFirstDynamicProxy(const Snapshot& snapshot, const float minX);
+
+private:
+	// 아직 끝나지 않은 질의 작업들로, 파괴하기 전에 모두 끝날 때까지 기다린다.
+	JobCounter queryCounter;
+
+	// 작업이 질의하는 동안 스냅샷이 사라지지 않도록 shared_ptr로 관리한다.
+	// 뮤텍스는 포인터를 교체하거나 복사할 때만 잡는다.
+	std::shared_ptr<const Snapshot> currentSnapshot;
+	std::mutex snapshotMutex;
+	// 이전 스냅샷의 메모리를 재사용한다.
+	std::shared_ptr<Snapshot> spareSnapshot;
+
+	// 마지막으로 정적 트리를 만들었을 때 Broadphase의 정적 객체 리비전
+	UINT64 staticRevision = UINT64_MAX;
+	std::shared_ptr<const StaticTree> staticTree;
+	// 슬롯 인덱스마다 정적 트리에 들어간 핸들의 값으로, 동적 프록시에서 제외할 때 사용한다.
+	std::vector<UINT32> staticHandleValues;
+};
@@ -0,0 +1,196 @@
+#include "../PrecompiledHeader/pch.h"
+#include "SelfCheck.h"
+#include "NullDevice.h"
+#include "IndirectDraw.h"
+#include "DrawList.h"
+#include "OcclusionBuffer.h"
+#include "../Component/Mesh.h"
+#include "../Component/Material.h"
+#include <tuple>
+
+using namespace std::literals;
+using Microsoft::WRL::ComPtr;
+
+static UINT32 failureCount = 0;
+
+static void Check(const bool condition, const char* name)
+{
+	if (condition)
+		return;
+
+	++failureCount;
+	std::cout << "Self Check : " << name << " 실패" << std::endl;
+}
+
+static void CheckIndirectDraw()
+{
+	// 메쉬의 버퍼는 널 백엔드에 만들어 GPU 없이 인덱스 개수와 버퍼 뷰를 얻는다.
+	NullDevice* nullDevice = new NullDevice();
+	ComPtr<ID3D12Device> device;
+	device.Attach(nullDevice);
+
+	ComPtr<ID3D12CommandAllocator> cmdAlloc;
+	ComPtr<ID3D12GraphicsCommandList> cmdList;
+	ThrowIfFailed(device->CreateCommandAllocator(D3D12_COMMAND_LIST_TYPE_DIRECT, IID_PPV_ARGS(&cmdAlloc)));
+	ThrowIfFailed(device->CreateCommandList(0, D3D12_COMMAND_LIST_TYPE_DIRECT, cmdAlloc.Get(), nullptr, IID_PPV_ARGS(&cmdList)));
+
+	UINT16 quadIndices[] = { 0, 1, 2, 0, 2, 3 };
+	UINT16 triangleIndices[] = { 0, 1, 2 };
+	UINT16 lineIndices[] = { 0, 1 };
+
+	Mesh quad("CheckQuad"s);
+	quad.BuildIndices(device.Get(), cmdList.Get(), quadIndices, _countof(quadIndices), (UINT32)sizeof(UINT16));
+	quad.SetPrimitiveType(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	Mesh triangle("CheckTriangle"s);
+	triangle.BuildIndices(device.Get(), cmdList.Get(), triangleIndices, _countof(triangleIndices), (UINT32)sizeof(UINT16));
+	triangle.SetPrimitiveType(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
+	Mesh line("CheckLine"s);
+	line.BuildIndices(device.Get(), cmdList.Get(), lineIndices, _countof(lineIndices), (UINT32)sizeof(UINT16));
+	line.SetPrimitiveType(D3D_PRIMITIVE_TOPOLOGY_LINELIST);
+	ThrowIfFailed(cmdList->Close());
+
+	Material materialA("CheckMaterialA"s);
+	Material materialB("CheckMaterialB"s);
+
+	// 2번 레코드는 컬링되어 visibleIndices에 없다.
+	// 보이는 순서로 [quad A x3][triangle A][quad B][line A x2][quad A]이며, line에서 위상 구조가 바뀐다.
+	DrawRecord records[9];
+	const std::tuple<Mesh*, Material*, UINT32> recordInfos[] =
+	{
+		{ &quad, &materialA, 10 }, { &quad, &materialA, 11 }, { &quad, &materialA, 99 },
+		{ &quad, &materialA, 12 }, { &triangle, &materialA, 20 }, { &quad, &materialB, 30 },
+		{ &line, &materialA, 40 }, { &line, &materialA, 41 }, { &quad, &materialA, 50 },
+	};
+	for (UINT32 i = 0; i < _countof(records); ++i)
+		std::tie(records[i].mesh, records[i].material, records[i].cbIndex) = recordInfos[i];
+
+	const UINT32 visibleIndices[] = { 0, 1, 3, 4, 5, 6, 7, 8 };
+	const UINT32 visibleCount = _countof(visibleIndices);
+	constexpr UINT32 instanceOffset = 100;
+
+	IndirectDrawCommand commands[visibleCount] = {};
+	UINT32 instanceIndices[visibleCount] = {};
+
+	// 삼각형 리스트인 앞쪽 세 묶음을 만들고 선 리스트 앞에서 멈춘다.
+	IndirectDrawBatch batch = BuildIndirectDrawCommands(records, visibleIndices, 0, visibleCount,
+		commands, instanceIndices, instanceOffset);
+	Check(batch.primitiveType == D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST, "IndirectDraw : 첫 묶음의 위상 구조");
+	Check(batch.recordEnd == 5, "IndirectDraw : 위상 구조가 바뀌는 곳에서 멈춤");
+	Check(batch.commandCount == 3, "IndirectDraw : 첫 묶음의 명령 개수");
+	Check(batch.instanceCount == 3, "IndirectDraw : 첫 묶음의 인스턴스 인덱스 개수");
+
+	Check(commands[0].drawArguments.IndexCountPerInstance == 6 && commands[0].drawArguments.InstanceCount == 3,
+		"IndirectDraw : 같은 메쉬와 재질의 인스턴싱");
+	Check(commands[0].instanceBase == instanceOffset, "IndirectDraw : 인스턴싱 명령의 instanceBase");
+	Check(instanceIndices[0] == 10 && instanceIndices[1] == 11 && instanceIndices[2] == 12,
+		"IndirectDraw : 컬링된 레코드를 건너뛴 인스턴스 인덱스");
+	Check(commands[0].indexBufferView.BufferLocation == quad.GetIndexBufferView().BufferLocation &&
+		commands[0].vertexBufferView.BufferLocation == quad.GetVertexBufferView().BufferLocation,
+		"IndirectDraw : 명령의 버퍼 뷰");
+
+	Check(commands[1].drawArguments.IndexCountPerInstance == 3 && commands[1].drawArguments.InstanceCount == 1 &&
+		commands[1].instanceBase == 20, "IndirectDraw : 하나뿐인 묶음은 identity 구간을 가리킴");
+	Check(commands[2].drawArguments.InstanceCount == 1 && commands[2].instanceBase == 30,
+		"IndirectDraw : 재질이 다르면 묶지 않음");
+
+	// 이어서 부를 때는 호출자가 instanceIndices와 instanceOffset을 쓴 만큼 옮긴다.
+	const UINT32 nextOffset = instanceOffset + batch.instanceCount;
+	batch = BuildIndirectDrawCommands(records, visibleIndices, batch.recordEnd, visibleCount,
+		commands, instanceIndices + batch.instanceCount, nextOffset);
+	Check(batch.primitiveType == D3D_PRIMITIVE_TOPOLOGY_LINELIST, "IndirectDraw : 두 번째 묶음의 위상 구조");
+	Check(batch.recordEnd == 7 && batch.commandCount == 1 && batch.instanceCount == 2, "IndirectDraw : 두 번째 묶음의 범위");
+	Check(commands[0].drawArguments.IndexCountPerInstance == 2 && commands[0].drawArguments.InstanceCount == 2 &&
+		commands[0].instanceBase == nextOffset, "IndirectDraw : 두 번째 묶음의 인스턴싱 명령");
+	Check(instanceIndices[3] == 40 && instanceIndices[4] == 41, "IndirectDraw : 이어서 쓴 인스턴스 인덱스");
+
+	batch = BuildIndirectDrawCommands(records, visibleIndices, batch.recordEnd, visibleCount,
+		commands, instanceIndices + 5, nextOffset + 2);
+	Check(batch.primitiveType == D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST && batch.recordEnd == visibleCount &&
+		batch.commandCount == 1 && batch.instanceCount == 0 && commands[0].instanceBase == 50,
+		"IndirectDraw : 마지막 묶음");
+
+	batch = BuildIndirectDrawCommands(records, visibleIndices, visibleCount, visibleCount,
+		commands, instanceIndices, instanceOffset);
+	Check(batch.recordEnd == visibleCount && batch.commandCount == 0 && batch.instanceCount == 0,
+		"IndirectDraw : 빈 구간");
+
+	Check(nullDevice->GetStats().validationErrors == 0, "IndirectDraw : 널 백엔드의 검증 오류");
+}
+
+static void CheckOcclusionBuffer()
+{
+	// 원점에서 +z를 바라보는 카메라. 수직 시야각이 90도이므로 z = 10에서 화면의 높이는 20이다.
+	constexpr UINT32 width = 256;
+	constexpr UINT32 height = 128;
+	const XMMATRIX view = XMMatrixLookToLH(XMVectorZero(), XMVectorSet(0.0f, 0.0f, 1.0f, 0.0f), XMVectorSet(0.0f, 1.0f, 0.0f, 0.0f));
+	const XMMATRIX proj = XMMatrixPerspectiveFovLH(XM_PIDIV2, (float)width / height, 1.0f, 1000.0f);
+	XMFLOAT4X4 viewProj;
+	XMStoreFloat4x4(&viewProj, view * proj);
+
+	OcclusionBuffer buffer(width, height);
+	Check(!buffer.IsOccluded(BoundingBox(XMFLOAT3(0.0f, 0.0f, 20.0f), XMFLOAT3(1.0f, 1.0f, 1.0f))),
+		"Occlusion : 그리기 전에는 판정하지 않음");
+
+	// z = 10에서 [-5, 5] x [-5, 5]를 덮는 사각형은 화면의 (96, 32) ~ (160, 96)을 덮는다.
+	const XMFLOAT3 quadVertices[] =
+	{
+		{ -5.0f, -5.0f, 10.0f }, { -5.0f, 5.0f, 10.0f }, { 5.0f, 5.0f, 10.0f }, { 5.0f, -5.0f, 10.0f },
+	};
+	const UINT16 quadIndices[] = { 0, 1, 2, 0, 2, 3 };
+
+	OccluderMesh quad;
+	quad.vertices = quadVertices;
+	quad.vertexCount = _countof(quadVertices);
+	quad.vertexStride = (UINT32)sizeof(XMFLOAT3);
+	quad.indices = quadIndices;
+	quad.indexCount = _countof(quadIndices);
+	XMStoreFloat4x4(&quad.world, XMMatrixIdentity());
+
+	buffer.Render(std::span<const OccluderMesh>(&quad, 1), viewProj);
+	Check(buffer.GetRasterizedTriangleCount() == 2, "Occlusion : 사각형의 삼각형 개수");
+	Check(buffer.GetDepth(width / 2, height / 2) < 1.0f, "Occlusion : 사각형 안의 깊이");
+	Check(buffer.GetDepth(0, 0) == 1.0f && buffer.GetDepth(width - 1, height - 1) == 1.0f, "Occlusion : 사각형 밖의 깊이");
+
+	Check(buffer.IsOccluded(BoundingBox(XMFLOAT3(0.0f, 0.0f, 20.0f), XMFLOAT3(1.0f, 1.0f, 1.0f))),
+		"Occlusion : 사각형 뒤의 상자는 가려짐");
+	Check(!buffer.IsOccluded(BoundingBox(XMFLOAT3(0.0f, 0.0f, 5.0f), XMFLOAT3(1.0f, 1.0f, 1.0f))),
+		"Occlusion : 사각형 앞의 상자는 보임");
+	Check(!buffer.IsOccluded(BoundingBox(XMFLOAT3(15.0f, 0.0f, 20.0f), XMFLOAT3(1.0f, 1.0f, 1.0f))),
+		"Occlusion : 사각형 옆의 상자는 보임");
+	Check(!buffer.IsOccluded(BoundingBox(XMFLOAT3(10.0f, 0.0f, 20.0f), XMFLOAT3(1.0f, 1.0f, 1.0f))),
+		"Occlusion : 사각형의 가장자리에 걸친 상자는 보임");
+
+	// 근평면을 넘는 바운드는 투영된 크기를 믿을 수 없으므로 판정하지 않는다.
+	Check(!buffer.IsOccluded(BoundingBox(XMFLOAT3(0.0f, 0.0f, 0.5f), XMFLOAT3(0.2f, 0.2f, 1.0f))),
+		"Occlusion : 근평면에 걸친 상자는 판정하지 않음");
+	Check(!buffer.IsOccluded(BoundingBox(XMFLOAT3(0.0f, 0.0f, -20.0f), XMFLOAT3(1.0f, 1.0f, 1.0f))),
+		"Occlusion : 카메라 뒤의 상자는 판정하지 않음");
+
+	// 근평면 앞에 정점이 있는 오클루더의 삼각형은 그리지 않는다.
+	const XMFLOAT3 nearVertices[] =
+	{
+		{ -5.0f, -5.0f, 0.5f }, { -5.0f, 5.0f, 10.0f }, { 5.0f, 5.0f, 10.0f }, { 5.0f, -5.0f, 0.5f },
+	};
+	OccluderMesh nearQuad = quad;
+	nearQuad.vertices = nearVertices;
+
+	buffer.Render(std::span<const OccluderMesh>(&nearQuad, 1), viewProj);
+	Check(buffer.GetRasterizedTriangleCount() == 0, "Occlusion : 근평면을 넘는 오클루더는 그리지 않음");
+	Check(!buffer.IsOccluded(BoundingBox(XMFLOAT3(0.0f, 0.0f, 20.0f), XMFLOAT3(1.0f, 1.0f, 1.0f))),
+		"Occlusion : 그려지지 않은 오클루더는 가리지 않음");
+}
+
+UINT32 RunSelfChecks()
+{
+	failureCount = 0;
+
+	CheckIndirectDraw();
+	CheckOcclusionBuffer();
+
+	if (failureCount == 0)
+		std::cout << "Self Check : 모든 검사를 통과했습니다." << std::endl;
+	else
+		std::cout << "Self Check : " << failureCount << "개의 검사가 실패했습니다." << std::endl;
+
+	return failureCount;
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include <basetsd.h>
+
+// 장치나 창 없이 CPU에서 실행할 수 있는 렌더링 보조 함수들을 알려진 입력으로 검사한다.
+// 간접 그리기 명령의 생성과 오클루전 버퍼의 래스터화, 가려짐 판정을 검사한다.
+// 실패한 검사를 출력하고 그 개수를 반환한다.
+UINT32 RunSelfChecks();
@@ -4,8 +4,10 @@
 #include <basetsd.h>
 #include <DirectXCollision.h>
 
+class VisibleSet;
+
 /*
-   Ŭ  ̽ ӹ޴´.
+쉐도우 맵 관련 클래스는 이 인터페이스를 상속받는다.
 */
 class ShadowMap
 {
@@ -17,5 +19,6 @@ public:
 	virtual void BuildDescriptors(ID3D12Device* device) = 0;
 	virtual void BuildResource(ID3D12Device* device) = 0;
 	virtual void OnResize(ID3D12Device* device, UINT32 width, UINT32 height) = 0;
-	virtual void RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList, BoundingFrustum* camFrustum = nullptr) = 0;
+	// 컬링 단계가 이 그림자 뷰에서 보이는 것으로 남긴 객체들을 그린다.
+	virtual void RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList, const VisibleSet& visibleSet) = 0;
 };
\ No newline at end of file
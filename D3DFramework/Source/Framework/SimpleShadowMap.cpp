@@ -40,26 +40,26 @@ void SimpleShadowMap::OnResize(ID3D12Device* device, const UINT32 newWidth, cons
 	}
 }
 
-void SimpleShadowMap::RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList, DirectX::BoundingFrustum* frustum)
+void SimpleShadowMap::RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList, const VisibleSet& visibleSet)
 {
 	cmdList->RSSetViewports(1, &viewport);
 	cmdList->RSSetScissorRects(1, &scissorRect);
 
-	//  ۸   ҽ 踮 ȯѴ.
+	// 깊이 버퍼를 쓰기 위해 리소스 배리어를 전환한다.
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(shadowMap.Get(),
 		D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_DEPTH_WRITE));
 
 	cmdList->ClearDepthStencilView(hCpuDsv,
 		D3D12_CLEAR_FLAG_DEPTH | D3D12_CLEAR_FLAG_STENCIL, 1.0f, 0, 0, nullptr);
 
-	//   ۿ  ̹Ƿ   η Ѵ.
-	//     ϸ  Ⱑ Ȱȭȴ.
-	// ݵ Ȱ PSO    0 ؾ  ϱ ٶ.
+	// 장면을 깊이 버퍼에만 렌더링할 것이므로 렌더 대상은 널로 설정한다.
+	// 어차피 널 렌더 대상을 지정하면 색상 쓰기가 비활성화된다.
+	// 반드시 활성 PSO의 렌더 대상 개수도 0으로 지정해야 함을 주의하기 바란다.
 	cmdList->OMSetRenderTargets(0, nullptr, false, &hCpuDsv);
 
-	D3DFramework::GetInstance()->RenderActualObjects(cmdList, frustum);
+	D3DFramework::GetInstance()->RenderActualObjects(cmdList, visibleSet);
 
-	// ؽó ٽ   ֵ ҽ GENERIC_READ ٲپ ش.
+	// 텍스처를 다시 읽을 수 있도록 리소스를 GENERIC_READ로 바꾸어 준다.
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(shadowMap.Get(),
 		D3D12_RESOURCE_STATE_DEPTH_WRITE, D3D12_RESOURCE_STATE_GENERIC_READ));
 }
@@ -107,7 +107,7 @@ void SimpleShadowMap::BuildResource(ID3D12Device* device)
 	optClear.DepthStencil.Depth = 1.0f;
 	optClear.DepthStencil.Stencil = 0;
 
-	// ҽ Ѵ.
+	// 리소스를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
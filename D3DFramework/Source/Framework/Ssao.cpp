@@ -18,12 +18,12 @@ Ssao::Ssao(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList, const UINT3
 
 std::vector<float> Ssao::CalcGaussWeights(const float sigma) const
 {
-	// ñ׸  Ѵ.
+	// 시그마 값을 계산한다.
 	float twoSigma2 = 2.0f * sigma * sigma;
-	//   Ѵ.
+	// 블러 반지름을 측정한다.
 	INT32 blurRadius = (int)ceil(2.0f * sigma);
 
-	//   ִ    .
+	// 블러 반지름은 최대 반지름을 넘을 수 없다.
 	if(blurRadius <= maxBlurRadius)
 		blurRadius = maxBlurRadius;
 
@@ -32,7 +32,7 @@ std::vector<float> Ssao::CalcGaussWeights(const float sigma) const
 
 	float weightSum = 0.0f;
 
-	// ġ  Ѵ.
+	// 가중치 값을 계산한다.
 	for (int i = -blurRadius; i <= blurRadius; ++i)
 	{
 		float x = (float)i;
@@ -40,7 +40,7 @@ std::vector<float> Ssao::CalcGaussWeights(const float sigma) const
 		weightSum += weights[i + blurRadius];
 	}
 
-	// ġ  ȭϱ  ü  .
+	// 가중치 값을 정규화하기 위해 전체 합으로 나눈다.
 	for (int i = 0; i < weights.size(); ++i)
 	{
 		weights[i] /= weightSum;
@@ -56,7 +56,7 @@ void Ssao::BuildDescriptors(ID3D12Device* device,
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hGpuSrv,
 	CD3DX12_CPU_DESCRIPTOR_HANDLE hCpuRtv)
 {
-	// Normal Map Depth Map 2 ؼ ִ.
+	// Normal Map과 Depth Map은 2개가 연속해서 만들어져있다.
 	this->hNormalMapGpuSrv = hNormalMapGpuSrv;
 	this->hPositionMapGpuSrv = hPositionMapGpuSrv;
 
@@ -113,7 +113,7 @@ void Ssao::OnResize(ID3D12Device* device, const UINT32 newWidth, const UINT32 ne
 
 		scissorRect = { 0, 0, (int)renderTargetWidth, (int)renderTargetHeight };
 
-		// ҽ Ѵ.
+		// 리소스를 생성한다.
 		BuildResources(device);
 	}
 }
@@ -127,14 +127,14 @@ void Ssao::ComputeSsao(ID3D12GraphicsCommandList* cmdList, ID3D12PipelineState*
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(ambientMap0.Get(),
 		D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_RENDER_TARGET));
 
-	// ssao  ,  ܰ迡 εѴ.
+	// ssao 맵을 지우고, 출력 단계에 바인딩한다.
 	cmdList->ClearRenderTargetView(hAmbientMap0CpuRtv, (float*)&clearColor, 0, nullptr);
 	cmdList->OMSetRenderTargets(1, &hAmbientMap0CpuRtv, true, nullptr);
 
-	// ssao   ü εѴ.
+	// ssao에 사용할 파이프라인 객체를 바인딩한다.
 	cmdList->SetPipelineState(ssaoPso);
 
-	// ssao  ׸  ҽ ο εѴ.
+	// ssao 맵을 그리기 위한 리소스들을 파이프라인에 바인딩한다.
 	cmdList->SetGraphicsRootConstantBufferView((int)RpSsao::SsaoCB, ssaoCBAddress);
 	cmdList->SetGraphicsRootConstantBufferView((int)RpSsao::Pass, passCBAddress);
 	cmdList->SetGraphicsRoot32BitConstant((int)RpSsao::Constants, 0, 0);
@@ -142,7 +142,7 @@ void Ssao::ComputeSsao(ID3D12GraphicsCommandList* cmdList, ID3D12PipelineState*
 	cmdList->SetGraphicsRootDescriptorTable((int)RpSsao::BufferMap, hNormalMapGpuSrv);
 	cmdList->SetGraphicsRootDescriptorTable((int)RpSsao::SsaoMap, hRandomVectorMapGpuSrv);
 
-	// ssao  ׸.
+	// ssao 맵을 그린다.
 	cmdList->IASetVertexBuffers(0, 0, nullptr);
 	cmdList->IASetIndexBuffer(nullptr);
 	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -169,9 +169,9 @@ void Ssao::BlurAmbientMap(ID3D12GraphicsCommandList* cmdList, bool horzBlur)
 	CD3DX12_GPU_DESCRIPTOR_HANDLE inputSrv;
 	CD3DX12_CPU_DESCRIPTOR_HANDLE outputRtv;
 
-	// ϱ  (ping-ponging) Ѵ.
-	//       
-	//    Է ҽ  ҽ Ѵ.
+	// 블러하기 위해 핑퐁(ping-ponging)을 수행한다.
+	// 블러는 수평 블러와 수직 블러로 나누어 지고
+	// 수평과 수직에 따라 입력 리소스와 출력 리소스를 설정한다.
 	if (horzBlur == true)
 	{
 		output = ambientMap1.Get();
@@ -193,15 +193,15 @@ void Ssao::BlurAmbientMap(ID3D12GraphicsCommandList* cmdList, bool horzBlur)
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(output,
 		D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_RENDER_TARGET));
 
-	//  Ÿ ,  ܰ迡 εѴ.
+	// 렌더 타겟은 지우고, 출력 단계에 바인딩한다.
 	cmdList->ClearRenderTargetView(outputRtv, (float*)&clearColor, 0, nullptr);
 	cmdList->OMSetRenderTargets(1, &outputRtv, true, nullptr);
 
-	//  ʰ  ssao  ο εѴ.
+	// 노멀 맵과 사용할 ssao 맵을 파이프라인에 바인딩한다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpSsao::BufferMap, hNormalMapGpuSrv);
 	cmdList->SetGraphicsRootDescriptorTable((int)RpSsao::SsaoMap, inputSrv);
 
-	// ssao  帮Ѵ.
+	// ssao 맵을 흐리기한다.
 	cmdList->IASetVertexBuffers(0, 0, nullptr);
 	cmdList->IASetIndexBuffer(nullptr);
 	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -213,7 +213,7 @@ void Ssao::BlurAmbientMap(ID3D12GraphicsCommandList* cmdList, bool horzBlur)
 
 void Ssao::BuildResources(ID3D12Device* device)
 {
-	// ̹ ϴ ҽ Ѵ.
+	// 이미 존재하는 리소스를 해제한다.
 	ambientMap0 = nullptr;
 	ambientMap1 = nullptr;
 
@@ -232,7 +232,7 @@ void Ssao::BuildResources(ID3D12Device* device)
 	texDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
 	CD3DX12_CLEAR_VALUE optClear = CD3DX12_CLEAR_VALUE(ambientMapFormat, (float*)&clearColor);
 
-	// ù ° ssao Ѵ.
+	// 첫 번째 ssao맵을 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -241,7 +241,7 @@ void Ssao::BuildResources(ID3D12Device* device)
 		&optClear,
 		IID_PPV_ARGS(&ambientMap0)));
 
-	//  ° ssao Ѵ.
+	// 두 번째 ssao맵을 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -267,7 +267,7 @@ void Ssao::BuildRandomVectorTexture(ID3D12Device* device, ID3D12GraphicsCommandL
 	texDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
 	texDesc.Flags = D3D12_RESOURCE_FLAG_NONE;
 
-	//    ҽ Ѵ.
+	// 랜덤 벡터 맵의 리소스를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -276,13 +276,13 @@ void Ssao::BuildRandomVectorTexture(ID3D12Device* device, ID3D12GraphicsCommandL
 		nullptr,
 		IID_PPV_ARGS(&randomVectorMap)));
 
-	// CPU ޸ ͸ Ʈ ۿ ϱ ؼ
-	// ӽ ε ۸ ؾ Ѵ.
+	// CPU 메모리 데이터를 디폴트 버퍼에 복사하기 위해선
+	// 임시적인 업로드 버퍼를 생성해야 한다.
 
 	const UINT num2DSubresources = texDesc.DepthOrArraySize * texDesc.MipLevels;
 	const UINT64 uploadBufferSize = GetRequiredIntermediateSize(randomVectorMap.Get(), 0, num2DSubresources);
 
-	//   ʿ  ε ۸ Ѵ.
+	// 랜덤 벡터 맵에 복사할 업로드 버퍼를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD),
 		D3D12_HEAP_FLAG_NONE,
@@ -296,7 +296,7 @@ void Ssao::BuildRandomVectorTexture(ID3D12Device* device, ID3D12GraphicsCommandL
 	{
 		for (int j = 0; j < RANDOM_VECTORMAP_SIZE; ++j)
 		{
-			//   ʿ   Ѵ.
+			// 랜덤 벡터 맵에 랜덤한 값을 정의한다.
 			XMFLOAT3 v(Random::GetRandomFloat(0.0f, 1.0f), Random::GetRandomFloat(0.0f, 1.0f), Random::GetRandomFloat(0.0f, 1.0f));
 			initData[i * 256 + j] = PackedVector::XMCOLOR(v.x, v.y, v.z, 0.0f);
 		}
@@ -309,7 +309,7 @@ void Ssao::BuildRandomVectorTexture(ID3D12Device* device, ID3D12GraphicsCommandL
 
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(randomVectorMap.Get(),
 		D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_COPY_DEST));
-	// ε ۸ ؼ ͸   (gpu ) Ѵ.
+	// 업로드 버퍼를 통해서 데이터를 랜덤 벡터 맵(gpu에 존재)에 복사한다.
 	UpdateSubresources(cmdList, randomVectorMap.Get(), randomVectorMapUploadBuffer.Get(),
 		0, 0, num2DSubresources, &subResourceData);
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(randomVectorMap.Get(),
@@ -318,8 +318,8 @@ void Ssao::BuildRandomVectorTexture(ID3D12Device* device, ID3D12GraphicsCommandL
 
 void Ssao::BuildOffsetVectors()
 {
-	// ť  8   6  ߽ 
-	// SAMPLE_COUNTŭ й  ͸ Ѵ.
+	// 큐브의 각 8개의 꼭짓점과 각 6개의 면의 중심점을 골라
+	// SAMPLE_COUNT만큼 분배된 랜덤한 벡터를 생성한다.
 
 	// 8 cube corners
 	offsets[0] = XMFLOAT4(+1.0f, +1.0f, +1.0f, 0.0f);
@@ -13,7 +13,7 @@
 #define RANDOM_VECTORMAP_SIZE 256
 
 /*
-ü  ϴ ssao  ĸȭ Ŭ
+객체들의 차폐를 계산하는 ssao 맵을 캡슐화한 클래스
 */
 class Ssao
 {
@@ -24,10 +24,10 @@ public:
 	~Ssao() = default;
 
 public:
-	// ϱ  콺 ġ Ѵ.
+	// 블러하기 위한 가우스 가중치를 계산한다.
 	std::vector<float> CalcGaussWeights(const float sigma) const;
 
-	//  ڵ ϰ  並 Ѵ.
+	// 서술자 핸들을 저장하고 서술자 뷰를 생성한다.
 	void BuildDescriptors(ID3D12Device* device,
 		CD3DX12_GPU_DESCRIPTOR_HANDLE hNormalMapGpuSrv,
 		CD3DX12_GPU_DESCRIPTOR_HANDLE hDiffuseMapGpuSrv,
@@ -35,9 +35,9 @@ public:
 		CD3DX12_GPU_DESCRIPTOR_HANDLE hGpuSrv,
 		CD3DX12_CPU_DESCRIPTOR_HANDLE hCpuRtv);
 
-	//  並 Ѵ.
+	// 서술자 뷰를 재생성한다.
 	void RebuildDescriptors(ID3D12Device* device);
-	// ο ػ󵵷 ٲٰ ҽ ٽ Ѵ.
+	// 새로운 해상도로 바꾸고 리소스를 다시 생성한다.
 	void OnResize(ID3D12Device* device, const UINT32 newWidth, const UINT32 newHeight);
 
 	void ComputeSsao(ID3D12GraphicsCommandList* cmdList, ID3D12PipelineState* ssaoPso,
@@ -50,7 +50,7 @@ public:
 	UINT32 GetHeight() const;
 
 private:
-	// ssao Ų.
+	// ssao맵을 블러시킨다.
 	void BlurAmbientMap(ID3D12GraphicsCommandList* cmdList, bool horzBlur);
 
 	void BuildResources(ID3D12Device* device);
@@ -59,26 +59,26 @@ private:
 
 public:
 	static inline const DXGI_FORMAT ambientMapFormat = DXGI_FORMAT_R16_UNORM;
-	//    ִ    .
+	// 블러 반지름은 이 최대 반지름을 넘을 수 없다.
 	static inline const INT32 maxBlurRadius = 5;
 
 
 private:
-	// ssaoʿ ʿ ҽ̴.
+	// ssao맵에 필요한 리소스들이다.
 	Microsoft::WRL::ComPtr<ID3D12Resource> randomVectorMap;
 	Microsoft::WRL::ComPtr<ID3D12Resource> randomVectorMapUploadBuffer;
 	Microsoft::WRL::ComPtr<ID3D12Resource> ambientMap0;
 	Microsoft::WRL::ComPtr<ID3D12Resource> ambientMap1;
 
-	// ssao ʿ ָʰ ǻ  ڵ̴.
+	// ssao에서 필요한 노멀맵과 디퓨즈 맵의 핸들이다.
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hNormalMapGpuSrv;
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hPositionMapGpuSrv;
 
-	// ssao ʿ  ͸   ִ  ڵ̴.
+	// ssao에서 필요한 랜덤 벡터를 추출할 수 있는 서술자 핸들이다.
 	CD3DX12_CPU_DESCRIPTOR_HANDLE hRandomVectorMapCpuSrv;
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hRandomVectorMapGpuSrv;
 
-	// ϴ  (ping-ponging)    ҽ ʿϴ.
+	// 블러하는 동안 핑퐁(ping-ponging)을 위해 두 개의 리소스가 필요하다.
 	CD3DX12_CPU_DESCRIPTOR_HANDLE hAmbientMap0CpuSrv;
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hAmbientMap0GpuSrv;
 	CD3DX12_CPU_DESCRIPTOR_HANDLE hAmbientMap0CpuRtv;
@@ -93,7 +93,7 @@ private:
 	D3D12_VIEWPORT viewportRect;
 	D3D12_RECT scissorRect;
 
-	// ssao ش  ٸ  ̵Ű ̴.
+	// ssao에서 해당 정점에서 다른 정점으로 이동시키는 오프셋이다.
 	XMFLOAT4 offsets[SAMPLE_COUNT];
 
 	const XMFLOAT4 clearColor = { 1.0f, 1.0f, 1.0f, 1.0f };
@@ -24,7 +24,7 @@ void Ssr::OnResize(ID3D12Device* device, const UINT32 newWidth, const UINT32 new
 
 		scissorRect = { 0, 0, (int)renderTargetWidth, (int)renderTargetHeight };
 
-		// ҽ Ѵ.
+		// 리소스를 생성한다.
 		BuildResources(device);
 	}
 }
@@ -36,13 +36,13 @@ void Ssr::BuildDescriptors(ID3D12Device* device,
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hGpuSrv,
 	CD3DX12_CPU_DESCRIPTOR_HANDLE hCpuRtv)
 {
-	// ο εϱ   ڵ Ѵ.
+	// 파이프라인에 바인딩하기 위한 서술자 핸들을 저장한다.
 	this->hPositionMapGpuSrv = hPositionMapGpuSrv;
 	this->hNormalMapGpuSrv = hNormalMapGpuSrv;
 	hSsrMapGpuSrv = hGpuSrv;
 	hSsrMapCpuRtv = hCpuRtv;
 
-	// ssr  SRV 並 Ѵ.
+	// ssr 맵 SRV 뷰를 생성한다.
 	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
@@ -51,7 +51,7 @@ void Ssr::BuildDescriptors(ID3D12Device* device,
 	srvDesc.Texture2D.MipLevels = 1;
 	device->CreateShaderResourceView(ssrMap.Get(), &srvDesc, hCpuSrv);
 
-	// ssr  RTV 並 Ѵ.
+	// ssr 맵 RTV 뷰를 생성한다.
 	D3D12_RENDER_TARGET_VIEW_DESC rtvDesc = {};
 	rtvDesc.ViewDimension = D3D12_RTV_DIMENSION_TEXTURE2D;
 	rtvDesc.Format = ssrMapFormat;
@@ -77,7 +77,7 @@ void Ssr::BuildResources(ID3D12Device* device)
 	texDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_RENDER_TARGET;
 	CD3DX12_CLEAR_VALUE optClear = CD3DX12_CLEAR_VALUE(ssrMapFormat, (float*)&clearColor);
 
-	// ssr  ҽ Ѵ.
+	// ssr 맵 리소스를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -96,18 +96,18 @@ void Ssr::ComputeSsr(ID3D12GraphicsCommandList* cmdList, CD3DX12_GPU_DESCRIPTOR_
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(ssrMap.Get(),
 		D3D12_RESOURCE_STATE_GENERIC_READ, D3D12_RESOURCE_STATE_RENDER_TARGET));
 
-	// ssr  ,  ܰ迡 εѴ.
+	// ssr 맵을 지우고, 출력 단계에 바인딩한다.
 	cmdList->ClearRenderTargetView(hSsrMapCpuRtv, (float*)&clearColor, 0, nullptr);
 	cmdList->OMSetRenderTargets(1, &hSsrMapCpuRtv, true, nullptr);
 
-	// srr ʿ ҽ ο εѴ.
+	// srr에서 필요한 리소스들을 파이프라인에 바인딩한다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpSsr::PositionMap, hPositionMapGpuSrv);
 	cmdList->SetGraphicsRootDescriptorTable((int)RpSsr::NormalMap, hNormalMapGpuSrv);
 	cmdList->SetGraphicsRootDescriptorTable((int)RpSsr::ColorMap, currColorMapGpuSrv);
 	cmdList->SetGraphicsRootConstantBufferView((int)RpSsr::SsrCB, ssrCBAddress);
 	cmdList->SetGraphicsRootConstantBufferView((int)RpSsr::Pass, passCBAddress);
 
-	// ssr ׸.
+	// ssr맵을 그린다.
 	cmdList->IASetVertexBuffers(0, 0, nullptr);
 	cmdList->IASetIndexBuffer(nullptr);
 	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST);
@@ -7,8 +7,8 @@
 #include <wrl.h>
 
 /*
-  G۸ Ͽ ü ݻ
- ׸ ĸȭ Ŭ
+지연 렌더링의 G버퍼를 사용하여 객체의 반사된
+모습을 그리도록 캡슐화한 클래스
 */
 class Ssr
 {
@@ -21,7 +21,7 @@ public:
 public:
 	ID3D12Resource* Output();
 
-	//  ڵ ϰ,  並 Ѵ.
+	// 서술자 핸들을 저장하고, 서술자 뷰를 생성한다.
 	void BuildDescriptors(ID3D12Device* device,
 		CD3DX12_GPU_DESCRIPTOR_HANDLE hPositionMapGpuSrv,
 		CD3DX12_GPU_DESCRIPTOR_HANDLE hNormalMapGpuSrv,
@@ -29,7 +29,7 @@ public:
 		CD3DX12_GPU_DESCRIPTOR_HANDLE hGpuSrv,
 		CD3DX12_CPU_DESCRIPTOR_HANDLE hCpuRtv);
 
-	// ο ػ󵵷 ٲٰ, ҽ  Ѵ.
+	// 새로운 해상도로 바꾸고, 리소스를 새로 생성한다.
 	void OnResize(ID3D12Device* device, const UINT32 newWidth, const UINT32 newHeight);
 
 	void ComputeSsr(ID3D12GraphicsCommandList* cmdList, CD3DX12_GPU_DESCRIPTOR_HANDLE currColorMapGpuSrv,
@@ -44,11 +44,11 @@ private:
 private:
 	Microsoft::WRL::ComPtr<ID3D12Resource> ssrMap;
 
-	// ssr ϱ  ġ ʰ   ڵ̴.
+	// ssr에서 사용하기 위한 위치 맵과 노멀 맵의 핸들이다.
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hPositionMapGpuSrv;
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hNormalMapGpuSrv;
 
-	// ssr  ssr   ڵ̴.
+	// ssr에서 사용할 ssr 맵의 서술자 핸들이다.
 	CD3DX12_GPU_DESCRIPTOR_HANDLE hSsrMapGpuSrv;
 	CD3DX12_CPU_DESCRIPTOR_HANDLE hSsrMapCpuRtv;
 
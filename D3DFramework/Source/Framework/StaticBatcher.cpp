@@ -0,0 +1,183 @@
+#include "../PrecompiledHeader/pch.h"
+#include "StaticBatcher.h"
+#include "D3DStructure.h"
+#include "TransformStore.h"
+#include "../Component/Mesh.h"
+#include "../Component/Material.h"
+#include "../Object/GameObject.h"
+#include <map>
+#include <tuple>
+#include <unordered_set>
+
+using namespace std::literals;
+
+// 인덱스 버퍼가 16비트이므로 하나의 배치가 가질 수 있는 정점의 개수가 제한된다.
+static constexpr UINT32 maxBatchVertexCount = (UINT32)UINT16_MAX + 1;
+
+StaticBatcher::StaticBatcher() { }
+
+StaticBatcher::~StaticBatcher() { }
+
+void StaticBatcher::Build(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
+	ObjectTable& objects, std::vector<ObjectHandle>& handles)
+{
+	// 정점에 적용할 월드 행렬이 최신이어야 한다.
+	TransformStore::GetInstance()->UpdateWorlds();
+
+	// 재질과 클러스터의 좌표로 객체들을 모은다. 재질의 인덱스 순서로 정렬되어 배치의 순서가 고정된다.
+	using ClusterKey = std::tuple<UINT32, INT32, INT32, INT32>;
+	std::map<ClusterKey, Batch> clusters;
+
+	for (const auto handle : handles)
+	{
+		GameObject* obj = objects.Get(handle);
+		if (obj == nullptr || !IsBatchable(obj))
+			continue;
+
+		const XMFLOAT3 pos = obj->GetWorldPosition();
+		const ClusterKey key = { obj->GetMaterial()->GetMaterialIndex(),
+			(INT32)std::floor(pos.x / clusterSize), (INT32)std::floor(pos.y / clusterSize), (INT32)std::floor(pos.z / clusterSize) };
+
+		Batch& cluster = clusters[key];
+		cluster.material = obj->GetMaterial();
+		cluster.objects.push_back(obj);
+	}
+
+	std::unordered_set<GameObject*> batchedObjects;
+	std::vector<ObjectHandle> batchHandles;
+
+	for (auto& [key, cluster] : clusters)
+	{
+		// 정점의 개수가 제한을 넘지 않도록 클러스터를 여러 배치로 나눈다.
+		std::vector<Batch> batches;
+		UINT32 vertexCount = maxBatchVertexCount;
+		for (GameObject* obj : cluster.objects)
+		{
+			const UINT32 objVertexCount = obj->GetMesh()->GetVertexCount();
+			if (vertexCount + objVertexCount > maxBatchVertexCount)
+			{
+				batches.emplace_back();
+				batches.back().material = cluster.material;
+				vertexCount = 0;
+			}
+
+			batches.back().objects.push_back(obj);
+			vertexCount += objVertexCount;
+		}
+
+		for (const auto& batch : batches)
+		{
+			// 하나의 객체만 있다면 합쳐도 그리기 호출이 줄지 않는다.
+			if (batch.objects.size() <= 1)
+				continue;
+
+			Mesh* mesh = BuildBatchMesh(device, commandList, batch);
+
+			GameObject* batchObject = objects.Create<GameObject>("StaticBatch"s + std::to_string(batchMeshes.size() - 1));
+			batchObject->SetMesh(mesh);
+			batchObject->SetMaterial(batch.material);
+			batchObject->SetCollisionEnabled(false);
+			batchObject->isStatic = true;
+			batchHandles.push_back(batchObject->GetHandle());
+
+			for (GameObject* obj : batch.objects)
+				batchedObjects.insert(obj);
+		}
+	}
+
+	// 합쳐진 객체들은 렌더 레이어에서 빼고 합쳐진 객체를 대신 넣는다.
+	std::erase_if(handles, [&objects, &batchedObjects](const ObjectHandle handle)
+	{
+		return batchedObjects.count(objects.Get(handle)) > 0;
+	});
+	handles.insert(handles.end(), batchHandles.begin(), batchHandles.end());
+
+#if defined(DEBUG) || defined(_DEBUG)
+	std::cout << "StaticBatcher : " << batchedObjects.size() << " objects -> " << batchHandles.size() << " batches" << std::endl;
+#endif
+}
+
+bool StaticBatcher::IsBatchable(const GameObject* obj) const
+{
+	if (!obj->isStatic || !obj->isVisible || obj->GetMaterial() == nullptr)
+		return false;
+
+	// 월드 행렬로 변환할 수 있는 일반적인 정점 형식의 삼각형 리스트만 합친다.
+	const Mesh* mesh = obj->GetMesh();
+	if (mesh == nullptr || mesh->GetVertexData() == nullptr || mesh->GetIndexData() == nullptr)
+		return false;
+
+	return mesh->GetVertexStride() == (UINT32)sizeof(Vertex) &&
+		mesh->GetPrimitiveType() == D3D_PRIMITIVE_TOPOLOGY_TRIANGLELIST &&
+		mesh->GetVertexCount() <= maxBatchVertexCount;
+}
+
+Mesh* StaticBatcher::BuildBatchMesh(ID3D12Device* device, ID3D12GraphicsCommandList* commandList, const Batch& batch)
+{
+	UINT32 totalVertexCount = 0;
+	UINT32 totalIndexCount = 0;
+	for (const GameObject* obj : batch.objects)
+	{
+		totalVertexCount += obj->GetMesh()->GetVertexCount();
+		totalIndexCount += obj->GetMesh()->GetIndexCount();
+	}
+
+	std::vector<Vertex> vertices;
+	std::vector<UINT16> indices;
+	vertices.reserve(totalVertexCount);
+	indices.reserve(totalIndexCount);
+
+	for (const GameObject* obj : batch.objects)
+	{
+		const Mesh* mesh = obj->GetMesh();
+		const Vertex* srcVertices = static_cast<const Vertex*>(mesh->GetVertexData());
+		const UINT16* srcIndices = mesh->GetIndexData();
+
+		XMMATRIX world = obj->GetWorld();
+		// 크기가 균등하지 않을 수 있으므로 노멀은 역전치 행렬로 변환한다.
+		XMMATRIX invTransposeWorld = XMMatrixTranspose(XMMatrixInverse(&XMMatrixDeterminant(world), world));
+
+		const UINT16 baseVertex = (UINT16)vertices.size();
+		for (UINT32 i = 0; i < mesh->GetVertexCount(); ++i)
+		{
+			const Vertex& src = srcVertices[i];
+			Vertex vertex = src;
+
+			XMStoreFloat3(&vertex.pos, XMVector3TransformCoord(XMLoadFloat3(&src.pos), world));
+			XMStoreFloat3(&vertex.normal, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(&src.normal), invTransposeWorld)));
+			XMStoreFloat3(&vertex.tangentU, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(&src.tangentU), world)));
+			XMStoreFloat3(&vertex.binormalU, XMVector3Normalize(XMVector3TransformNormal(XMLoadFloat3(&src.binormalU), world)));
+
+			vertices.push_back(vertex);
+		}
+
+		// 음수 크기로 좌우가 뒤집혔다면 삼각형의 감기는 순서도 뒤집는다.
+		const bool isMirrored = XMVectorGetX(XMMatrixDeterminant(world)) < 0.0f;
+		for (UINT32 i = 0; i + 2 < mesh->GetIndexCount(); i += 3)
+		{
+			indices.push_back((UINT16)(baseVertex + srcIndices[i]));
+			indices.push_back((UINT16)(baseVertex + srcIndices[isMirrored ? i + 2 : i + 1]));
+			indices.push_back((UINT16)(baseVertex + srcIndices[isMirrored ? i + 1 : i + 2]));
+		}
+	}
+
+	PoolPtr<Mesh> mesh = ObjectPool<Mesh>::GetInstance()->MakeUnique("StaticBatchMesh"s + std::to_string(batchMeshes.size()));
+	mesh->BuildVertices(device, commandList, vertices.data(), (UINT32)vertices.size(), (UINT32)sizeof(Vertex));
+	mesh->BuildIndices(device, commandList, indices.data(), (UINT32)indices.size(), (UINT32)sizeof(UINT16));
+	// 클러스터 단위로 프러스텀 컬링을 할 수 있도록 월드 공간의 AABB를 만든다.
+	mesh->BuildCollisionBound(&vertices[0].pos, (UINT32)vertices.size(), (UINT32)sizeof(Vertex), CollisionType::AABB);
+
+	batchMeshes.push_back(std::move(mesh));
+	return batchMeshes.back().get();
+}
+
+void StaticBatcher::DisposeUploaders()
+{
+	for (auto& mesh : batchMeshes)
+		mesh->DisposeUploaders();
+}
+
+UINT32 StaticBatcher::GetBatchCount() const
+{
+	return (UINT32)batchMeshes.size();
+}
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "ObjectTable.h"
+#include "ObjectPool.hpp"
+#include <vector>
+
+class Mesh;
+class Material;
+class GameObject;
+
+/*
+로드할 때 움직이지 않는 객체들을 합쳐 그리기 호출을 줄이는 클래스
+같은 재질을 사용하는 정적 객체들을 공간 격자의 클러스터별로 모으고,
+월드 행렬을 미리 적용한 정점으로 하나의 정점/인덱스 버퍼를 만든다.
+합쳐진 메쉬는 단위 행렬을 가진 새로운 객체로 렌더 레이어에 추가되므로
+기존의 그리기 경로와 클러스터 단위의 프러스텀 컬링을 그대로 사용한다.
+원래 객체들은 렌더 레이어에서만 빠지고 충돌과 질의에는 자신의 바운드를 계속 사용한다.
+*/
+class StaticBatcher
+{
+private:
+	struct Batch
+	{
+		Material* material = nullptr;
+		std::vector<GameObject*> objects;
+	};
+
+public:
+	StaticBatcher();
+	~StaticBatcher();
+
+public:
+	// handles 중 합칠 수 있는 정적 객체들을 합쳐 그 핸들을 합쳐진 객체의 핸들로 바꾼다.
+	// 업로드 명령이 commandList에 기록되므로 초기화 명령 목록이 닫히기 전에 불려야 한다.
+	void Build(ID3D12Device* device, ID3D12GraphicsCommandList* commandList,
+		ObjectTable& objects, std::vector<ObjectHandle>& handles);
+
+	// GPU로의 업로드가 끝난 후에 업로드 버퍼를 해제한다.
+	void DisposeUploaders();
+
+	UINT32 GetBatchCount() const;
+
+private:
+	// 합칠 수 있는 메쉬를 가진 정적 객체인지 확인한다.
+	bool IsBatchable(const GameObject* obj) const;
+	// 배치의 객체들을 월드 공간의 하나의 메쉬로 만든다.
+	Mesh* BuildBatchMesh(ID3D12Device* device, ID3D12GraphicsCommandList* commandList, const Batch& batch);
+
+public:
+	// 클러스터를 나누는 격자 한 칸의 크기
+	float clusterSize = 100.0f;
+
+private:
+	std::vector<PoolPtr<Mesh>> batchMeshes;
+};
@@ -3,17 +3,17 @@
 #include <chrono>
 
 /*
-ð ϴ Ŭ
+시간을 측정하는 클래스
 */
 class StopWatch
 {
 public:
-	// ð  Ѵ.
+	// 시간 측정을 시작한다.
 	void Start() { start = std::chrono::system_clock::now(); }
-	// ð  ģ.
+	// 시간 측정을 끝마친다.
 	void End() { end = std::chrono::system_clock::now(); }
 
-	//  ð   ȯѴ.
+	// 측정된 시간을 각 단위로 변환한다.
 	long long Nanosecond() const { return std::chrono::duration_cast<std::chrono::nanoseconds>(end - start).count(); }
 	long long Microsecond() const { return std::chrono::duration_cast<std::chrono::microseconds>(end - start).count(); }
 	long long Millisecond() const { return std::chrono::duration_cast<std::chrono::milliseconds>(end - start).count(); }
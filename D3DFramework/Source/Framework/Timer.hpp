@@ -1,7 +1,7 @@
 #pragma once
 
 /*
- ð Լ ϴ Ŭ
+설정한 시간에 함수를 수행하는 클래스
 */
 class Timer
 {
@@ -10,20 +10,20 @@ public:
 	~Timer() = default;
 
 public:
-	// ش ð ϸ Լ ϴ Ÿ̸Ӹ Ѵ.
+	// 해당 시간에 도달하면 함수를 수행하는 타이머를 설정한다.
 	template<typename function>
-	void SetTimeout(function function, int delay); // milisecond 
+	void SetTimeout(function function, int delay); // milisecond 단위
 
-	// interval ð   Լ ݺ ϴ
-	// Ÿ̸Ӹ Ѵ.
+	// interval 시간 간격 동안 함수를 반복적으로 수행하는
+	// 타이머를 설정한다.
 	template<typename function>
-	void SetInterval(function function, int interval); // milisecond 
+	void SetInterval(function function, int interval); // milisecond 단위
 
 	void Stop();
 	bool IsClear();
 
 private:
-	// Ÿ̸Ӱ    ǴѴ.
+	// 타이머가 계속 수행할 것인지 판단한다.
 	bool clear = false;
 };
 
@@ -0,0 +1,119 @@
+#include "../PrecompiledHeader/pch.h"
+#include "TransformBenchmark.h"
+#include "TransformStore.h"
+#include "StopWatch.h"
+#include <random>
+
+namespace
+{
+	// 벤치마크에서 비교할 기존 방식의 트랜스폼. 객체마다 힙에 할당되고
+	// 오일러 각으로부터 가상 함수를 통해 월드 행렬을 계산한다.
+	struct LegacyTransform
+	{
+		virtual ~LegacyTransform() = default;
+		virtual void CalculateWorld()
+		{
+			XMMATRIX translation = XMMatrixTranslation(position.x, position.y, position.z);
+			XMMATRIX rotationMatrix = XMMatrixRotationRollPitchYaw(rotation.x, rotation.y, rotation.z);
+			XMMATRIX scailing = XMMatrixScaling(scale.x, scale.y, scale.z);
+
+			XMStoreFloat4x4(&world, scailing * (rotationMatrix * translation));
+			XMStoreFloat4x4(&worldNoScailing, rotationMatrix * translation);
+
+			BoundingBox outAABB;
+			localAABB.Transform(outAABB, XMLoadFloat4x4(&world));
+			worldAABB = outAABB;
+		}
+
+		XMFLOAT4X4 world;
+		XMFLOAT4X4 worldNoScailing;
+		XMFLOAT3 position;
+		XMFLOAT3 rotation;
+		XMFLOAT3 scale;
+		BoundingBox localAABB;
+		std::any worldAABB;
+		bool isWorldUpdate = true;
+	};
+}
+
+void RunTransformBenchmark(const UINT32 objectCount)
+{
+	// 프레임워크의 난수 시드에 영향을 주지 않도록 따로 난수 생성기를 사용한다.
+	std::mt19937 mt(2014182016);
+	std::uniform_real_distribution<float> posDist(-500.0f, 500.0f);
+	std::uniform_real_distribution<float> angleDist(-XM_PI, XM_PI);
+	std::uniform_real_distribution<float> scaleDist(0.5f, 2.0f);
+
+	const BoundingBox localAABB(XMFLOAT3(0.0f, 0.0f, 0.0f), XMFLOAT3(1.0f, 1.0f, 1.0f));
+
+	std::vector<std::unique_ptr<LegacyTransform>> legacy;
+	TransformStore store(objectCount);
+
+	legacy.reserve(objectCount);
+	for (UINT32 i = 0; i < objectCount; ++i)
+	{
+		XMFLOAT3 position(posDist(mt), posDist(mt), posDist(mt));
+		XMFLOAT3 rotation(angleDist(mt), angleDist(mt), angleDist(mt));
+		XMFLOAT3 scale(scaleDist(mt), scaleDist(mt), scaleDist(mt));
+
+		auto transform = std::make_unique<LegacyTransform>();
+		transform->position = position;
+		transform->rotation = rotation;
+		transform->scale = scale;
+		transform->localAABB = localAABB;
+		legacy.push_back(std::move(transform));
+
+		XMFLOAT4 quaternion;
+		XMStoreFloat4(&quaternion, XMQuaternionRotationRollPitchYaw(rotation.x, rotation.y, rotation.z));
+
+		const UINT32 index = store.Allocate();
+		store.SetPosition(index, position);
+		store.SetRotation(index, quaternion);
+		store.SetScale(index, scale);
+		store.SetLocalBounds(index, CollisionType::AABB, localAABB);
+	}
+
+	StopWatch stopWatch;
+
+	// 모든 트랜스폼이 바뀐 경우
+	stopWatch.Start();
+	for (auto& transform : legacy)
+	{
+		if (transform->isWorldUpdate)
+			transform->CalculateWorld();
+	}
+	stopWatch.End();
+	const double legacyAllTime = stopWatch.Microsecond() / 1000.0;
+
+	stopWatch.Start();
+	store.UpdateWorlds();
+	stopWatch.End();
+	const double storeAllTime = stopWatch.Microsecond() / 1000.0;
+
+	// 10%의 트랜스폼만 바뀐 경우. 기존 방식은 모든 객체를 순회하며 플래그를 확인해야 한다.
+	for (UINT32 i = 0; i < objectCount; ++i)
+	{
+		const bool isMoved = (i % 10) == 0;
+		legacy[i]->isWorldUpdate = isMoved;
+		if (isMoved)
+			store.SetPosition(i, store.GetPosition(i));
+	}
+
+	stopWatch.Start();
+	for (auto& transform : legacy)
+	{
+		if (transform->isWorldUpdate)
+			transform->CalculateWorld();
+	}
+	stopWatch.End();
+	const double legacyPartialTime = stopWatch.Microsecond() / 1000.0;
+
+	stopWatch.Start();
+	store.UpdateWorlds();
+	stopWatch.End();
+	const double storePartialTime = stopWatch.Microsecond() / 1000.0;
+
+	std::cout << "TransformStore Benchmark (" << objectCount << " objects)" << std::endl;
+	std::cout << "  All dirty : legacy " << legacyAllTime << "ms, store " << storeAllTime << "ms" << std::endl;
+	std::cout << "  10% dirty : legacy " << legacyPartialTime << "ms, store " << storePartialTime << "ms" << std::endl;
+}
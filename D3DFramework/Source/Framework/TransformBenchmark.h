@@ -0,0 +1,7 @@
+#pragma once
+
+#include <basetsd.h>
+
+// objectCount개의 트랜스폼으로 객체마다 따로 계산하던 기존 방식과
+// TransformStore의 일괄 계산의 속도를 비교하여 출력한다. 프레임워크와 독립된 저장소를 사용한다.
+void RunTransformBenchmark(const UINT32 objectCount);
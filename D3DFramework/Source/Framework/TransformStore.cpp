@@ -0,0 +1,479 @@
+#include "../PrecompiledHeader/pch.h"
+#include "TransformStore.h"
+#include <bit>
+#include <atomic>
+
+TransformStore::TransformStore(const UINT32 capacity)
+{
+	Reserve(capacity);
+}
+
+TransformStore::~TransformStore() { }
+
+void TransformStore::Reserve(const UINT32 capacity)
+{
+	positions.reserve(capacity);
+	rotations.reserve(capacity);
+	scales.reserve(capacity);
+	worlds.reserve(capacity);
+	worldsNoScailing.reserve(capacity);
+	localBounds.reserve(capacity);
+	worldBounds.reserve(capacity);
+	parents.reserve(capacity);
+	firstChildren.reserve(capacity);
+	nextSiblings.reserve(capacity);
+	depths.reserve(capacity);
+	dirtyBits.reserve((capacity + 63) / 64);
+	changedBits.reserve((capacity + 63) / 64);
+}
+
+TransformStore* TransformStore::GetInstance()
+{
+	static TransformStore* instance = nullptr;
+	if (instance == nullptr)
+		instance = new TransformStore(1024);
+	return instance;
+}
+
+UINT32 TransformStore::Allocate()
+{
+	UINT32 index;
+
+	if (!freeIndices.empty())
+	{
+		index = freeIndices.back();
+		freeIndices.pop_back();
+	}
+	else
+	{
+		index = count++;
+
+		positions.emplace_back();
+		rotations.emplace_back();
+		scales.emplace_back();
+		worlds.emplace_back();
+		worldsNoScailing.emplace_back();
+		localBounds.emplace_back();
+		worldBounds.emplace_back();
+		parents.emplace_back();
+		firstChildren.emplace_back();
+		nextSiblings.emplace_back();
+		depths.emplace_back();
+
+		if (dirtyBits.size() * 64 < count)
+		{
+			dirtyBits.push_back(0);
+			changedBits.push_back(0);
+		}
+	}
+
+	positions[index] = XMFLOAT3(0.0f, 0.0f, 0.0f);
+	rotations[index] = XMFLOAT4(0.0f, 0.0f, 0.0f, 1.0f);
+	scales[index] = XMFLOAT3(1.0f, 1.0f, 1.0f);
+	worlds[index] = Matrix4x4::Identity();
+	worldsNoScailing[index] = Matrix4x4::Identity();
+	localBounds[index] = Bounds();
+	worldBounds[index] = Bounds();
+	parents[index] = invalidIndex;
+	firstChildren[index] = invalidIndex;
+	nextSiblings[index] = invalidIndex;
+	depths[index] = 0;
+
+	MarkDirty(index);
+
+	return index;
+}
+
+void TransformStore::Release(const UINT32 index)
+{
+	// 자식들은 부모를 잃고 최상위 트랜스폼이 된다.
+	UINT32 child = firstChildren[index];
+	while (child != invalidIndex)
+	{
+		const UINT32 next = nextSiblings[child];
+		parents[child] = invalidIndex;
+		nextSiblings[child] = invalidIndex;
+		UpdateSubtreeDepth(child);
+		MarkDirty(child);
+		child = next;
+	}
+	firstChildren[index] = invalidIndex;
+	Unlink(index);
+
+	// 해제된 트랜스폼은 일괄 계산에서 제외한다.
+	dirtyBits[index / 64] &= ~(1ull << (index % 64));
+	changedBits[index / 64] &= ~(1ull << (index % 64));
+	freeIndices.push_back(index);
+}
+
+void TransformStore::UpdateWorlds()
+{
+	dirtyRoots.clear();
+	for (auto& list : dirtyByDepth)
+		list.clear();
+
+	auto pushDirty = [this](UINT32 index) {
+		const UINT32 depth = depths[index];
+		if (dirtyByDepth.size() <= depth)
+			dirtyByDepth.resize(depth + 1);
+		dirtyByDepth[depth].push_back(index); };
+
+	// 더티 비트가 켜진 워드만 살펴보고, 켜진 비트만 모은다.
+	for (UINT32 word = 0; word < (UINT32)dirtyBits.size(); ++word)
+	{
+		UINT64 bits = dirtyBits[word];
+		while (bits)
+		{
+			const UINT32 index = word * 64 + (UINT32)std::countr_zero(bits);
+			bits &= bits - 1;
+
+			dirtyRoots.push_back(index);
+			pushDirty(index);
+		}
+	}
+
+	// 더러워진 트랜스폼의 하위 트리만 더럽게 표시한다. 바뀌지 않은 가지는 건드리지 않는다.
+	for (const UINT32 root : dirtyRoots)
+	{
+		if (firstChildren[root] == invalidIndex)
+			continue;
+
+		traverseStack.clear();
+		traverseStack.push_back(firstChildren[root]);
+		while (!traverseStack.empty())
+		{
+			const UINT32 index = traverseStack.back();
+			traverseStack.pop_back();
+
+			if (!IsDirty(index))
+			{
+				MarkDirty(index);
+				pushDirty(index);
+			}
+
+			if (nextSiblings[index] != invalidIndex)
+				traverseStack.push_back(nextSiblings[index]);
+			if (firstChildren[index] != invalidIndex)
+				traverseStack.push_back(firstChildren[index]);
+		}
+	}
+
+	// 깊이 순서대로 계산하여 부모의 월드 행렬이 항상 먼저 계산되도록 한다.
+	for (UINT32 depth = 0; depth < (UINT32)dirtyByDepth.size(); ++depth)
+	{
+		const auto& list = dirtyByDepth[depth];
+		UINT32 i = 0;
+
+		// 깊이가 0인 트랜스폼은 부모가 없으므로 4개씩 묶어 계산한다.
+		if (depth == 0)
+		{
+			for (; i + 4 <= (UINT32)list.size(); i += 4)
+				CalculateRootWorlds(&list[i]);
+		}
+
+		for (; i < (UINT32)list.size(); ++i)
+			CalculateWorld(list[i]);
+
+		for (const UINT32 index : list)
+			dirtyBits[index / 64] &= ~(1ull << (index % 64));
+	}
+}
+
+void TransformStore::UpdateWorld(const UINT32 index)
+{
+	if (!IsDirty(index))
+		return;
+
+	// 객체의 Tick은 병렬로 수행되므로 부모의 월드 행렬이 동시에 다시 계산되고 있을 수 있다.
+	// 부모가 있는 트랜스폼은 더러운 채로 남겨두어 다음 UpdateWorlds에서 깊이 순서대로 계산한다.
+	if (parents[index] != invalidIndex)
+		return;
+
+	CalculateWorld(index);
+	std::atomic_ref<UINT64>(dirtyBits[index / 64]).fetch_and(~(1ull << (index % 64)), std::memory_order_relaxed);
+
+	for (UINT32 child = firstChildren[index]; child != invalidIndex; child = nextSiblings[child])
+		MarkDirty(child);
+}
+
+void TransformStore::CalculateWorld(const UINT32 index)
+{
+	// 회전 행렬의 각 행에 크기를 곱하고 마지막 행에 위치를 넣으면 S * R * T와 같다.
+	XMMATRIX rotation = XMMatrixRotationQuaternion(XMLoadFloat4(&rotations[index]));
+	rotation.r[3] = XMVectorSetW(XMLoadFloat3(&positions[index]), 1.0f);
+
+	const XMVECTOR scale = XMLoadFloat3(&scales[index]);
+	XMMATRIX world;
+	world.r[0] = XMVectorMultiply(rotation.r[0], XMVectorSplatX(scale));
+	world.r[1] = XMVectorMultiply(rotation.r[1], XMVectorSplatY(scale));
+	world.r[2] = XMVectorMultiply(rotation.r[2], XMVectorSplatZ(scale));
+	world.r[3] = rotation.r[3];
+
+	const UINT32 parent = parents[index];
+	if (parent == invalidIndex)
+	{
+		XMStoreFloat4x4(&worldsNoScailing[index], rotation);
+	}
+	else
+	{
+		// 지역 행렬에 부모의 월드 행렬을 곱한다. 크기가 없는 행렬은 각 축을 정규화하여 구한다.
+		world = XMMatrixMultiply(world, XMLoadFloat4x4(&worlds[parent]));
+
+		XMMATRIX worldNoScailing;
+		worldNoScailing.r[0] = XMVector3Normalize(world.r[0]);
+		worldNoScailing.r[1] = XMVector3Normalize(world.r[1]);
+		worldNoScailing.r[2] = XMVector3Normalize(world.r[2]);
+		worldNoScailing.r[3] = world.r[3];
+		XMStoreFloat4x4(&worldsNoScailing[index], worldNoScailing);
+	}
+
+	XMStoreFloat4x4(&worlds[index], world);
+	FinishWorld(index, world);
+}
+
+void TransformStore::CalculateRootWorlds(const UINT32* indices)
+{
+	// 4개의 사원수, 위치, 크기를 전치하여 각 성분마다 하나의 벡터에 모은다.
+	// 이후의 계산에서 벡터의 각 레인은 하나의 트랜스폼이다.
+	const XMVECTOR one = XMVectorSplatOne();
+	const XMMATRIX q = XMMatrixTranspose(XMMATRIX(
+		XMLoadFloat4(&rotations[indices[0]]), XMLoadFloat4(&rotations[indices[1]]),
+		XMLoadFloat4(&rotations[indices[2]]), XMLoadFloat4(&rotations[indices[3]])));
+	const XMMATRIX p = XMMatrixTranspose(XMMATRIX(
+		XMLoadFloat3(&positions[indices[0]]), XMLoadFloat3(&positions[indices[1]]),
+		XMLoadFloat3(&positions[indices[2]]), XMLoadFloat3(&positions[indices[3]])));
+	const XMMATRIX s = XMMatrixTranspose(XMMATRIX(
+		XMLoadFloat3(&scales[indices[0]]), XMLoadFloat3(&scales[indices[1]]),
+		XMLoadFloat3(&scales[indices[2]]), XMLoadFloat3(&scales[indices[3]])));
+
+	const XMVECTOR qx = q.r[0], qy = q.r[1], qz = q.r[2], qw = q.r[3];
+	const XMVECTOR x2 = qx + qx, y2 = qy + qy, z2 = qz + qz;
+	const XMVECTOR xx = qx * x2, yy = qy * y2, zz = qz * z2;
+	const XMVECTOR xy = qx * y2, xz = qx * z2, yz = qy * z2;
+	const XMVECTOR wx = qw * x2, wy = qw * y2, wz = qw * z2;
+
+	// XMMatrixRotationQuaternion과 같은 회전 행렬의 성분들
+	const XMVECTOR m00 = one - (yy + zz), m01 = xy + wz, m02 = xz - wy;
+	const XMVECTOR m10 = xy - wz, m11 = one - (xx + zz), m12 = yz + wx;
+	const XMVECTOR m20 = xz + wy, m21 = yz - wx, m22 = one - (xx + yy);
+
+	// 다시 전치하면 r[i]가 i번째 트랜스폼의 행이 된다.
+	const XMVECTOR zero = XMVectorZero();
+	const XMMATRIX row0 = XMMatrixTranspose(XMMATRIX(m00, m01, m02, zero));
+	const XMMATRIX row1 = XMMatrixTranspose(XMMATRIX(m10, m11, m12, zero));
+	const XMMATRIX row2 = XMMatrixTranspose(XMMATRIX(m20, m21, m22, zero));
+	const XMMATRIX scaledRow0 = XMMatrixTranspose(XMMATRIX(m00 * s.r[0], m01 * s.r[0], m02 * s.r[0], zero));
+	const XMMATRIX scaledRow1 = XMMatrixTranspose(XMMATRIX(m10 * s.r[1], m11 * s.r[1], m12 * s.r[1], zero));
+	const XMMATRIX scaledRow2 = XMMatrixTranspose(XMMATRIX(m20 * s.r[2], m21 * s.r[2], m22 * s.r[2], zero));
+	const XMMATRIX row3 = XMMatrixTranspose(XMMATRIX(p.r[0], p.r[1], p.r[2], one));
+
+	for (UINT32 i = 0; i < 4; ++i)
+	{
+		const UINT32 index = indices[i];
+		XMStoreFloat4x4(&worldsNoScailing[index], XMMATRIX(row0.r[i], row1.r[i], row2.r[i], row3.r[i]));
+
+		const XMMATRIX world(scaledRow0.r[i], scaledRow1.r[i], scaledRow2.r[i], row3.r[i]);
+		XMStoreFloat4x4(&worlds[index], world);
+		FinishWorld(index, world);
+	}
+}
+
+void TransformStore::FinishWorld(const UINT32 index, FXMMATRIX world)
+{
+	std::atomic_ref<UINT64>(changedBits[index / 64]).fetch_or(1ull << (index % 64), std::memory_order_relaxed);
+
+	const Bounds& local = localBounds[index];
+	Bounds& out = worldBounds[index];
+	out.type = local.type;
+
+	switch (local.type)
+	{
+		case CollisionType::AABB:
+			local.aabb.Transform(out.aabb, world);
+			break;
+		case CollisionType::OBB:
+			local.obb.Transform(out.obb, world);
+			break;
+		case CollisionType::Sphere:
+			local.sphere.Transform(out.sphere, world);
+			break;
+	}
+}
+
+void TransformStore::MarkDirty(const UINT32 index)
+{
+	std::atomic_ref<UINT64>(dirtyBits[index / 64]).fetch_or(1ull << (index % 64), std::memory_order_relaxed);
+}
+
+void TransformStore::SetPosition(const UINT32 index, const XMFLOAT3& position)
+{
+	positions[index] = position;
+	MarkDirty(index);
+}
+
+void TransformStore::SetRotation(const UINT32 index, const XMFLOAT4& rotation)
+{
+	rotations[index] = rotation;
+	MarkDirty(index);
+}
+
+void TransformStore::SetScale(const UINT32 index, const XMFLOAT3& scale)
+{
+	scales[index] = scale;
+	MarkDirty(index);
+}
+
+void TransformStore::SetLocalBounds(const UINT32 index, const CollisionType type, const std::any& bounding)
+{
+	Bounds& local = localBounds[index];
+	local.type = type;
+
+	switch (type)
+	{
+		case CollisionType::AABB:
+			local.aabb = std::any_cast<BoundingBox>(bounding);
+			break;
+		case CollisionType::OBB:
+			local.obb = std::any_cast<BoundingOrientedBox>(bounding);
+			break;
+		case CollisionType::Sphere:
+			local.sphere = std::any_cast<BoundingSphere>(bounding);
+			break;
+		default:
+			local.type = CollisionType::None;
+			break;
+	}
+
+	MarkDirty(index);
+}
+
+const XMFLOAT3& TransformStore::GetPosition(const UINT32 index) const
+{
+	return positions[index];
+}
+
+const XMFLOAT4& TransformStore::GetRotation(const UINT32 index) const
+{
+	return rotations[index];
+}
+
+const XMFLOAT3& TransformStore::GetScale(const UINT32 index) const
+{
+	return scales[index];
+}
+
+const XMFLOAT4X4& TransformStore::GetWorld(const UINT32 index) const
+{
+	return worlds[index];
+}
+
+const XMFLOAT4X4& TransformStore::GetWorldWithoutScailing(const UINT32 index) const
+{
+	return worldsNoScailing[index];
+}
+
+const TransformStore::Bounds& TransformStore::GetWorldBounds(const UINT32 index) const
+{
+	return worldBounds[index];
+}
+
+bool TransformStore::SetParent(const UINT32 index, const UINT32 parentIndex)
+{
+	if (parents[index] == parentIndex)
+		return true;
+
+	// 부모가 자기 자신이나 자손이라면 순환이 생기므로 거부한다.
+	for (UINT32 ancestor = parentIndex; ancestor != invalidIndex; ancestor = parents[ancestor])
+	{
+		if (ancestor == index)
+			return false;
+	}
+
+	Unlink(index);
+
+	parents[index] = parentIndex;
+	if (parentIndex != invalidIndex)
+	{
+		nextSiblings[index] = firstChildren[parentIndex];
+		firstChildren[parentIndex] = index;
+	}
+
+	UpdateSubtreeDepth(index);
+	MarkDirty(index);
+
+	return true;
+}
+
+UINT32 TransformStore::GetParent(const UINT32 index) const
+{
+	return parents[index];
+}
+
+UINT32 TransformStore::GetDepth(const UINT32 index) const
+{
+	return depths[index];
+}
+
+bool TransformStore::ConsumeWorldChanged(const UINT32 index)
+{
+	const UINT64 mask = 1ull << (index % 64);
+	const bool isChanged = std::atomic_ref<UINT64>(changedBits[index / 64]).fetch_and(~mask, std::memory_order_relaxed) & mask;
+	return isChanged;
+}
+
+void TransformStore::Unlink(const UINT32 index)
+{
+	const UINT32 parent = parents[index];
+	if (parent == invalidIndex)
+		return;
+
+	if (firstChildren[parent] == index)
+	{
+		firstChildren[parent] = nextSiblings[index];
+	}
+	else
+	{
+		UINT32 sibling = firstChildren[parent];
+		while (nextSiblings[sibling] != index)
+			sibling = nextSiblings[sibling];
+		nextSiblings[sibling] = nextSiblings[index];
+	}
+
+	parents[index] = invalidIndex;
+	nextSiblings[index] = invalidIndex;
+}
+
+void TransformStore::UpdateSubtreeDepth(const UINT32 index)
+{
+	const UINT32 parent = parents[index];
+	depths[index] = parent == invalidIndex ? 0 : depths[parent] + 1;
+
+	traverseStack.clear();
+	if (firstChildren[index] != invalidIndex)
+		traverseStack.push_back(firstChildren[index]);
+
+	while (!traverseStack.empty())
+	{
+		const UINT32 child = traverseStack.back();
+		traverseStack.pop_back();
+
+		depths[child] = depths[parents[child]] + 1;
+
+		if (nextSiblings[child] != invalidIndex)
+			traverseStack.push_back(nextSiblings[child]);
+		if (firstChildren[child] != invalidIndex)
+			traverseStack.push_back(firstChildren[child]);
+	}
+}
+
+bool TransformStore::IsDirty(const UINT32 index) const
+{
+	// 읽기만 하므로 const를 벗겨도 안전하다.
+	UINT64& word = const_cast<UINT64&>(dirtyBits[index / 64]);
+	return (std::atomic_ref<UINT64>(word).load(std::memory_order_relaxed) >> (index % 64)) & 1ull;
+}
+
+UINT32 TransformStore::GetCount() const
+{
+	return count;
+}
@@ -0,0 +1,125 @@
+#pragma once
+
+#include "Enumeration.h"
+#include "Vector.h"
+#include <DirectXCollision.h>
+#include <any>
+
+/*
+모든 Object의 트랜스폼을 속성별로 연속된 배열에 저장하는 클래스
+회전은 사원수로 저장하며, 트랜스폼이 바뀌면 더티 비트만 표시해두었다가
+UpdateWorlds에서 더러워진 월드 행렬과 충돌 바운드만을 한 번에 다시 계산한다.
+Object는 이 저장소의 인덱스를 핸들로 가진다.
+트랜스폼은 부모를 가질 수 있으며, 이때 위치, 회전, 크기는 부모에 대한 지역 값이다.
+더러워진 트랜스폼의 하위 트리만 더럽게 표시하고, 깊이별로 모아 부모부터 계산한다.
+부모가 없는 트랜스폼은 4개씩 묶어 SIMD 레인 하나에 트랜스폼 하나를 두고 월드 행렬을 함께 계산한다.
+여러 트랜스폼이 하나의 비트 워드를 공유하므로 비트는 원자적으로 수정하며,
+서로 다른 인덱스의 트랜스폼은 여러 스레드에서 동시에 수정할 수 있다.
+*/
+class TransformStore
+{
+public:
+	// 충돌 바운드는 메쉬의 타입에 따라 하나만 유효하다.
+	struct Bounds
+	{
+		CollisionType type = CollisionType::None;
+		BoundingBox aabb;
+		BoundingOrientedBox obb;
+		BoundingSphere sphere;
+	};
+
+public:
+	static constexpr UINT32 invalidIndex = UINT32_MAX;
+
+public:
+	TransformStore(const UINT32 capacity = 0);
+	TransformStore(const TransformStore& rhs) = delete;
+	TransformStore& operator=(const TransformStore& rhs) = delete;
+	~TransformStore();
+
+public:
+	static TransformStore* GetInstance();
+
+public:
+	// 새로운 트랜스폼을 할당하고 인덱스를 반환한다.
+	UINT32 Allocate();
+	// 트랜스폼을 해제하여 다른 객체가 재사용할 수 있게 한다.
+	void Release(const UINT32 index);
+	// 전체 capacity개의 트랜스폼을 재할당 없이 저장할 수 있도록 공간을 확보한다.
+	void Reserve(const UINT32 capacity);
+
+	// 더러워진 트랜스폼들의 월드 행렬과 충돌 바운드를 다시 계산한다.
+	void UpdateWorlds();
+	// 부모가 없는 하나의 트랜스폼이 더럽다면 즉시 다시 계산한다.
+	// 부모가 있는 트랜스폼과 자식들은 더러운 채로 남아 다음 UpdateWorlds에서 계산된다.
+	void UpdateWorld(const UINT32 index);
+
+	// 부모를 설정한다. invalidIndex라면 부모에서 분리된다.
+	// 자기 자신이나 자손을 부모로 설정할 수는 없다.
+	bool SetParent(const UINT32 index, const UINT32 parentIndex);
+	UINT32 GetParent(const UINT32 index) const;
+	UINT32 GetDepth(const UINT32 index) const;
+
+	// 마지막으로 확인한 이후 월드 행렬이 다시 계산되었는지 확인하고 표시를 지운다.
+	// 부모가 움직여 월드 행렬이 바뀐 객체도 자신의 상수 버퍼를 갱신할 수 있게 한다.
+	bool ConsumeWorldChanged(const UINT32 index);
+
+	void SetPosition(const UINT32 index, const XMFLOAT3& position);
+	void SetRotation(const UINT32 index, const XMFLOAT4& rotation);
+	void SetScale(const UINT32 index, const XMFLOAT3& scale);
+	// 메쉬의 모델 좌표계 충돌 바운드를 설정한다.
+	void SetLocalBounds(const UINT32 index, const CollisionType type, const std::any& bounding);
+
+	const XMFLOAT3& GetPosition(const UINT32 index) const;
+	const XMFLOAT4& GetRotation(const UINT32 index) const;
+	const XMFLOAT3& GetScale(const UINT32 index) const;
+	const XMFLOAT4X4& GetWorld(const UINT32 index) const;
+	const XMFLOAT4X4& GetWorldWithoutScailing(const UINT32 index) const;
+	const Bounds& GetWorldBounds(const UINT32 index) const;
+
+	bool IsDirty(const UINT32 index) const;
+	UINT32 GetCount() const;
+
+private:
+	void MarkDirty(const UINT32 index);
+	void CalculateWorld(const UINT32 index);
+	// 부모가 없는 4개의 트랜스폼의 월드 행렬을 한 번에 계산한다.
+	void CalculateRootWorlds(const UINT32* indices);
+	// 계산된 월드 행렬로 충돌 바운드를 변환하고 바뀌었음을 표시한다.
+	void FinishWorld(const UINT32 index, FXMMATRIX world);
+
+	// 부모의 자식 목록에서 분리한다.
+	void Unlink(const UINT32 index);
+	// 하위 트리의 깊이를 다시 계산한다.
+	void UpdateSubtreeDepth(const UINT32 index);
+
+private:
+	std::vector<XMFLOAT3> positions;
+	std::vector<XMFLOAT4> rotations;
+	std::vector<XMFLOAT3> scales;
+
+	std::vector<XMFLOAT4X4> worlds;
+	std::vector<XMFLOAT4X4> worldsNoScailing;
+
+	std::vector<Bounds> localBounds;
+	std::vector<Bounds> worldBounds;
+
+	// 계층 구조. 자식들은 첫 번째 자식과 다음 형제로 연결된다.
+	std::vector<UINT32> parents;
+	std::vector<UINT32> firstChildren;
+	std::vector<UINT32> nextSiblings;
+	std::vector<UINT32> depths;
+
+	// 64개의 트랜스폼마다 하나의 워드를 사용하는 더티 비트셋
+	std::vector<UINT64> dirtyBits;
+	// 월드 행렬이 다시 계산된 트랜스폼의 비트셋
+	std::vector<UINT64> changedBits;
+
+	// UpdateWorlds에서 더러워진 트랜스폼을 깊이별로 모으는 배열
+	std::vector<std::vector<UINT32>> dirtyByDepth;
+	std::vector<UINT32> dirtyRoots;
+	std::vector<UINT32> traverseStack;
+	// 해제되어 재사용할 수 있는 인덱스들
+	std::vector<UINT32> freeIndices;
+	UINT32 count = 0;
+};
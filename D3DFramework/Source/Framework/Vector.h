@@ -4,7 +4,7 @@
 
 using namespace DirectX;
 
-//3   
+//3차원 벡터의 연산 
 namespace Vector3 {
 	inline XMFLOAT3 XMVectorToFloat3(const XMVECTOR& xmvVector) {
 		XMFLOAT3 xmf3Result;
@@ -122,7 +122,7 @@ namespace Vector3 {
 	}
 }
 
-//4  
+//4차원 벡터의 연산
 namespace Vector4 {
 	inline XMFLOAT4 Add(const XMFLOAT4& xmf4Vector1, const XMFLOAT4& xmf4Vector2) {
 		XMFLOAT4 xmf4Result;
@@ -131,7 +131,7 @@ namespace Vector4 {
 	}
 }
 
-//  
+//행렬의 연산 
 namespace Matrix4x4 {
 	inline XMFLOAT4X4 XMMatrixToFloat4X4(const XMMATRIX& xmmtxMatrix) {
 		XMFLOAT4X4 xmmtx4x4Result;
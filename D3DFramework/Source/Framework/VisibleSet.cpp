@@ -0,0 +1,142 @@
+#include "../PrecompiledHeader/pch.h"
+#include "VisibleSet.h"
+#include "OcclusionBuffer.h"
+#include "ParallelFor.hpp"
+
+CullingStats& CullingStats::operator+=(const CullingStats& rhs)
+{
+	testedCount += rhs.testedCount;
+	culledCount += rhs.culledCount;
+	occludedCount += rhs.occludedCount;
+	visibleCount += rhs.visibleCount;
+	return *this;
+}
+
+VisibleSet::VisibleSet() { }
+
+VisibleSet::~VisibleSet() { }
+
+void VisibleSet::Cull(const DrawLists& drawLists, const DirectX::BoundingFrustum* frustum,
+	const OcclusionBuffer* occlusionBuffer, const UINT32 partitionNum)
+{
+	chunks.clear();
+	for (int layer = 0; layer < (int)RenderLayer::Count; ++layer)
+	{
+		const UINT32 recordCount = drawLists[layer].GetCount();
+
+		// 청크가 자신의 시작 위치에 바로 쓸 수 있도록 레코드의 개수만큼 공간을 둔다.
+		layers[layer].indices.resize(recordCount);
+		for (UINT32 begin = 0; begin < recordCount; begin += cullChunkSize)
+			chunks.push_back({ layer, begin, (std::min)(begin + cullChunkSize, recordCount), 0, 0, 0 });
+	}
+
+	ParallelFor((UINT32)chunks.size(), 1, [this, &drawLists, frustum, occlusionBuffer](const UINT32 chunkIndex)
+	{
+		CullChunk& chunk = chunks[chunkIndex];
+		const auto& records = drawLists[chunk.layer].GetRecords();
+		UINT32* output = layers[chunk.layer].indices.data() + chunk.begin;
+
+		for (UINT32 i = chunk.begin; i < chunk.end; ++i)
+		{
+			const DrawRecord& record = records[i];
+			if (frustum && record.isCullable)
+			{
+				++chunk.testedCount;
+				if (frustum->Contains(record.bounds) == DirectX::DISJOINT)
+					continue;
+
+				if (occlusionBuffer && occlusionBuffer->IsOccluded(record.bounds))
+				{
+					++chunk.occludedCount;
+					continue;
+				}
+			}
+
+			output[chunk.visibleCount++] = i;
+		}
+	});
+
+	// 청크 순서대로 앞으로 당긴다. 쓰는 위치가 읽는 위치보다 항상 앞이므로 제자리에서 옮길 수 있다.
+	std::array<UINT32, (int)RenderLayer::Count> visibleCounts = {};
+	stats = {};
+	for (const CullChunk& chunk : chunks)
+	{
+		auto& indices = layers[chunk.layer].indices;
+		UINT32& visibleCount = visibleCounts[chunk.layer];
+		if (visibleCount != chunk.begin)
+			std::copy_n(indices.begin() + chunk.begin, chunk.visibleCount, indices.begin() + visibleCount);
+		visibleCount += chunk.visibleCount;
+
+		stats.testedCount += chunk.testedCount;
+		stats.culledCount += (chunk.end - chunk.begin) - chunk.visibleCount;
+		stats.occludedCount += chunk.occludedCount;
+		stats.visibleCount += chunk.visibleCount;
+	}
+
+	for (int layer = 0; layer < (int)RenderLayer::Count; ++layer)
+	{
+		layers[layer].indices.resize(visibleCounts[layer]);
+		Partition(layer, drawLists[layer], partitionNum);
+	}
+
+	totalStats += stats;
+}
+
+void VisibleSet::Partition(const int layer, const DrawList& drawList, const UINT32 partitionNum)
+{
+	const auto& records = drawList.GetRecords();
+	const auto& indices = layers[layer].indices;
+	auto& partitionOffsets = layers[layer].partitionOffsets;
+
+	const UINT32 visibleCount = (UINT32)indices.size();
+	UINT64 totalCost = 0;
+	for (const UINT32 index : indices)
+		totalCost += records[index].cost;
+
+	partitionOffsets.resize(partitionNum + 1);
+	partitionOffsets[0] = 0;
+
+	// i번째 경계는 보이는 레코드를 순서대로 더한 비용이 전체 비용의 i / partitionNum을 처음 넘는 레코드이다.
+	// 그 레코드는 다음 구간에 속하므로 경계 앞의 누적 비용은 목표를 넘지 않으며, 비어 있는 구간이 생길 수도 있다.
+	UINT64 accumCost = 0;
+	UINT32 position = 0;
+	for (UINT32 i = 1; i < partitionNum; ++i)
+	{
+		const UINT64 targetCost = totalCost * i / partitionNum;
+		while (position < visibleCount && accumCost + records[indices[position]].cost <= targetCost)
+			accumCost += records[indices[position++]].cost;
+
+		partitionOffsets[i] = position;
+	}
+	partitionOffsets[partitionNum] = visibleCount;
+}
+
+std::span<const UINT32> VisibleSet::GetIndices(const RenderLayer layer) const
+{
+	return layers[(int)layer].indices;
+}
+
+std::pair<UINT32, UINT32> VisibleSet::GetRange(const RenderLayer layer, const UINT32 index, const UINT32 partitionNum) const
+{
+	const auto& partitionOffsets = layers[(int)layer].partitionOffsets;
+	if (partitionOffsets.size() == partitionNum + 1)
+		return { partitionOffsets[index], partitionOffsets[index + 1] };
+
+	const UINT32 visibleCount = (UINT32)layers[(int)layer].indices.size();
+	return { visibleCount * index / partitionNum, visibleCount * (index + 1) / partitionNum };
+}
+
+const CullingStats& VisibleSet::GetStats() const
+{
+	return stats;
+}
+
+const CullingStats& VisibleSet::GetTotalStats() const
+{
+	return totalStats;
+}
+
+void VisibleSet::ResetTotalStats()
+{
+	totalStats = {};
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "DrawList.h"
+#include "Enumeration.h"
+#include <array>
+#include <span>
+#include <vector>
+
+class OcclusionBuffer;
+
+// 하나의 뷰를 컬링한 결과의 통계
+struct CullingStats
+{
+	// 프러스텀과 검사한 레코드의 개수. 항상 그리는 레코드는 검사하지 않는다.
+	UINT64 testedCount = 0;
+	// 프러스텀 밖에 있거나 가려져 걸러진 레코드의 개수
+	UINT64 culledCount = 0;
+	// 걸러진 레코드 중 오클루더에 가려진 레코드의 개수
+	UINT64 occludedCount = 0;
+	// 기록 단계로 넘어간 레코드의 개수
+	UINT64 visibleCount = 0;
+
+	CullingStats& operator+=(const CullingStats& rhs);
+};
+
+/*
+하나의 뷰(카메라 혹은 그림자를 그리는 조명)에서 보이는 DrawList 레코드의 인덱스를 렌더 레이어마다 모은 클래스
+매 프레임 기록 단계 전에 Cull로 뷰마다 한 번만 컬링하며, 인덱스는 DrawList의 정렬 순서를 유지하므로
+기록 단계는 프러스텀을 다시 검사하지 않고 자신의 구간의 인덱스를 순서대로 읽어 그린다.
+Cull은 모든 레이어의 레코드를 cullChunkSize개씩 나눈 청크마다 병렬로 검사하여 청크의 시작 위치에
+보이는 인덱스를 쓰고, 이후 청크들을 앞으로 당겨 빈틈없는 배열로 만든다.
+*/
+class VisibleSet
+{
+public:
+	// 하나의 작업이 검사할 레코드의 개수
+	static constexpr UINT32 cullChunkSize = 1024;
+
+	using DrawLists = std::array<DrawList, (int)RenderLayer::Count>;
+
+public:
+	VisibleSet();
+	~VisibleSet();
+
+public:
+	// frustum 밖에 있는 레코드를 걸러낸다. frustum이 nullptr이라면 모든 레코드가 보인다.
+	// occlusionBuffer가 있다면 프러스텀 안의 레코드 중 오클루더에 가려진 레코드도 걸러낸다.
+	// 보이는 인덱스는 추정 비용이 비슷하도록 partitionNum개의 구간으로 나누어 둔다.
+	void Cull(const DrawLists& drawLists, const DirectX::BoundingFrustum* frustum,
+		const OcclusionBuffer* occlusionBuffer, const UINT32 partitionNum);
+
+	// 레이어에서 보이는 레코드의 DrawList 인덱스를 반환한다.
+	std::span<const UINT32> GetIndices(const RenderLayer layer) const;
+	// GetIndices의 index번째 구간의 [begin, end)를 반환한다.
+	// partitionNum이 Cull에 넘긴 값과 다르다면 전체를 partitionNum개로 균등하게 나눈다.
+	std::pair<UINT32, UINT32> GetRange(const RenderLayer layer, const UINT32 index, const UINT32 partitionNum) const;
+
+	// 마지막 Cull의 통계
+	const CullingStats& GetStats() const;
+	// ResetTotalStats 이후 Cull마다 누적된 통계
+	const CullingStats& GetTotalStats() const;
+	void ResetTotalStats();
+
+private:
+	void Partition(const int layer, const DrawList& drawList, const UINT32 partitionNum);
+
+private:
+	struct LayerVisibility
+	{
+		std::vector<UINT32> indices;
+		// 각 구간의 시작 위치. 마지막 원소는 보이는 레코드의 개수이다.
+		std::vector<UINT32> partitionOffsets;
+	};
+
+	struct CullChunk
+	{
+		int layer;
+		UINT32 begin;
+		UINT32 end;
+		UINT32 testedCount;
+		UINT32 occludedCount;
+		UINT32 visibleCount;
+	};
+
+	std::array<LayerVisibility, (int)RenderLayer::Count> layers;
+	// 컬링에 사용되는 작업 공간으로, 매 프레임 재사용된다.
+	std::vector<CullChunk> chunks;
+
+	CullingStats stats;
+	CullingStats totalStats;
+};
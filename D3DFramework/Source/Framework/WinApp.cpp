@@ -43,13 +43,13 @@ int WinApp::Run()
 
 	while (msg.message != WM_QUIT)
 	{
-		//  ޽ ִٸ װ͵ óѴ.
+		// 윈도우 메시지가 있다면 그것들을 처리한다.
 		if (PeekMessage(&msg, 0, 0, 0, PM_REMOVE))
 		{
 			TranslateMessage(&msg);
 			DispatchMessage(&msg);
 		}
-		// ƴϸ  Ѵ.
+		// 아니면 게임을 진행한다.
 		else
 		{
 			gameTimer->Tick();
@@ -81,7 +81,7 @@ bool WinApp::Initialize()
 			return false;
 	}
 
-	// pdh ʱȭѴ.
+	// pdh를 초기화한다.
 	PdhOpenQuery(NULL, NULL, &queryHandle);
 	PdhAddCounter(queryHandle, L"\\Processor(_Total)\\% Processor Time", NULL, &counterHandle);
 	PdhCollectQueryData(queryHandle);
@@ -140,7 +140,7 @@ LRESULT WinApp::MsgProc(HWND hwnd, UINT msg, WPARAM wParam, LPARAM lParam)
 		PostQuitMessage(0);
 		return 0;
 	case WM_MENUCHAR:
-		// Alt-Enter  , - Ҹ  ʰ Ѵ.
+		// Alt-Enter를 누를 때, 삐- 소리가 나지 않게 한다.
 		return MAKELRESULT(0, MNC_CLOSE);
 	case WM_LBUTTONDOWN:
 	case WM_MBUTTONDOWN:
@@ -186,7 +186,7 @@ bool WinApp::InitMainWindow()
 		return false;
 	}
 
-	//  â Ŭ̾Ʈ  Ѵ.
+	// 윈도우 창에서 클라이언트 영역을 계산한다.
 	RECT R = { 0, 0, screenWidth, screenHeight };
 	AdjustWindowRect(&R, WS_OVERLAPPEDWINDOW ^ WS_THICKFRAME ^ WS_MAXIMIZEBOX, false);
 	int width = R.right - R.left;
@@ -209,21 +209,21 @@ bool WinApp::InitMainWindow()
 
 void WinApp::CalculateFrameStats()
 {
-	// 1ʿ  Ӱ  ӿ ׸ ð ϰ,
-	// Window Caption ̸ ǥѴ.
+	// 1초에 평균 프레임과 한 프레임에 그리는 시간을 계산하고,
+	// Window Caption에 이를 표시한다.
 
 	static int frameCnt = 0;
 	static float timeElapsed = 0.0f;
 
 	frameCnt++;
 
-	// 1ʰ Ѿ Ѵ.
+	// 1초가 넘어가면 계산한다.
 	if ((gameTimer->GetTotalTime() - timeElapsed) >= 1.0f)
 	{
 		float fps = (float)frameCnt; // fps = frameCnt / 1
 		float mspf = 1000.0f / fps;
 
-		// cpu 뷮 Ѵ.
+		// cpu 사용량을 계산한다.
 		PDH_FMT_COUNTERVALUE counterValue;
 		PdhCollectQueryData(queryHandle);
 		PdhGetFormattedCounterValue(counterHandle, PDH_FMT_LONG, NULL, &counterValue);
@@ -239,7 +239,7 @@ void WinApp::CalculateFrameStats()
 
 		SetWindowText(hMainWnd, windowText.c_str());
 
-		//   ϱ  Ѵ.
+		// 다음 평균을 계산하기 위해 리셋한다.
 		frameCnt = 0;
 		timeElapsed += 1.0f;
 	}
@@ -252,7 +252,7 @@ void WinApp::OnResize(const INT32 screenWidth, const INT32 screenHeight)
 
 	if (useWinApi)
 	{
-		//  â Ŭ̾Ʈ  Ѵ.
+		// 윈도우 창에서 클라이언트 영역을 계산한다.
 		RECT R = { 0, 0, screenWidth, screenHeight };
 		AdjustWindowRect(&R, WS_OVERLAPPEDWINDOW ^ WS_THICKFRAME ^ WS_MAXIMIZEBOX, false);
 		int width = R.right - R.left;
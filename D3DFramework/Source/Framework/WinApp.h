@@ -8,7 +8,7 @@
 #include <string>
 #include <Windows.h>
 
-//   ʴ  Windows  մϴ.
+// 거의 사용되지 않는 내용은 Windows 헤더에서 제외합니다.
 #ifndef WIN32_LEAN_AND_MEAN
 #define WIN32_LEAN_AND_MEAN
 #endif
@@ -16,8 +16,8 @@
 class GameTimer;
 
 /*
-WinApi ϱ  Ŭ
- ¸ ϰ,   Ѵ.
+WinApi를 사용하기 위한 클래스
+윈도우 상태를 정의하고, 게임 루프를 수행한다.
 */
 class WinApp
 {
@@ -59,7 +59,7 @@ private:
 	void CalculateFrameStats();
 
 protected:
-	//  α׷ 
+	// 응용 프로그램 상태
 	bool appPaused = false;
 	bool minimized = false;
 	bool maximized = false;
@@ -68,11 +68,11 @@ protected:
 	HINSTANCE hAppInst = nullptr; 
 	HWND hMainWnd = nullptr; 
 
-	// cpu 뷮 ϱ  PDH(Performance Data Helper) ̿Ѵ.
+	// cpu 사용량을 계산하기 위해 PDH(Performance Data Helper)를 이용한다.
 	HQUERY queryHandle;
 	HCOUNTER counterHandle;
 
-	//  Ӽ
+	// 윈도우 속성
 	std::wstring applicationName = L"D3DFramework";
 	INT32 screenWidth = 800;
 	INT32 screenHeight = 600;
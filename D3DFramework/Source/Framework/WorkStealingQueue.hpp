@@ -0,0 +1,100 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <cassert>
+#include <basetsd.h>
+
+/*
+Chase-Lev 방식의 작업 훔치기 덱이다.
+소유한 스레드만이 아래쪽(bottom)에 넣고 빼며(LIFO), 다른 스레드들은
+위쪽(top)에서 CAS로 훔쳐간다(FIFO). 마지막 하나가 남았을 때만 경쟁한다.
+T는 포인터처럼 원자적으로 복사할 수 있는 타입이어야 하고, 용량은 2의 제곱수이어야 한다.
+*/
+template <typename T>
+class WorkStealingQueue
+{
+public:
+	WorkStealingQueue(const size_t capacity) : mask(capacity - 1)
+	{
+		assert(capacity >= 2 && (capacity & (capacity - 1)) == 0);
+
+		buffer = std::make_unique<std::atomic<T>[]>(capacity);
+		top.store(0, std::memory_order_relaxed);
+		bottom.store(0, std::memory_order_relaxed);
+	}
+	WorkStealingQueue(const WorkStealingQueue& rhs) = delete;
+	WorkStealingQueue& operator=(const WorkStealingQueue& rhs) = delete;
+	~WorkStealingQueue() { }
+
+public:
+	// 소유한 스레드에서만 호출한다. 덱이 가득 찼다면 false를 반환한다.
+	bool Push(const T data)
+	{
+		const INT64 b = bottom.load(std::memory_order_relaxed);
+		const INT64 t = top.load(std::memory_order_acquire);
+		if (b - t > (INT64)mask)
+			return false;
+
+		buffer[b & mask].store(data, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_release);
+		bottom.store(b + 1, std::memory_order_relaxed);
+		return true;
+	}
+
+	// 소유한 스레드에서만 호출한다. 덱이 비어있다면 false를 반환한다.
+	bool Pop(T& data)
+	{
+		const INT64 b = bottom.load(std::memory_order_relaxed) - 1;
+		bottom.store(b, std::memory_order_relaxed);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		INT64 t = top.load(std::memory_order_relaxed);
+
+		// 비어있다면 bottom을 되돌린다.
+		if (t > b)
+		{
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return false;
+		}
+
+		data = buffer[b & mask].load(std::memory_order_relaxed);
+		if (t == b)
+		{
+			// 마지막 하나는 훔치려는 스레드와 top을 두고 경쟁한다.
+			const bool isWon = top.compare_exchange_strong(t, t + 1,
+				std::memory_order_seq_cst, std::memory_order_relaxed);
+			bottom.store(b + 1, std::memory_order_relaxed);
+			return isWon;
+		}
+
+		return true;
+	}
+
+	// 다른 스레드에서 호출한다. 비어있거나 경쟁에서 졌다면 false를 반환한다.
+	bool Steal(T& data)
+	{
+		INT64 t = top.load(std::memory_order_acquire);
+		std::atomic_thread_fence(std::memory_order_seq_cst);
+		const INT64 b = bottom.load(std::memory_order_acquire);
+
+		if (t >= b)
+			return false;
+
+		data = buffer[t & mask].load(std::memory_order_relaxed);
+		return top.compare_exchange_strong(t, t + 1,
+			std::memory_order_seq_cst, std::memory_order_relaxed);
+	}
+
+	bool IsEmpty() const
+	{
+		return bottom.load(std::memory_order_relaxed) <= top.load(std::memory_order_relaxed);
+	}
+
+private:
+	std::unique_ptr<std::atomic<T>[]> buffer;
+	const size_t mask;
+
+	// 훔치는 쪽과 소유한 쪽이 서로 다른 캐시 라인을 사용하도록 한다.
+	alignas(64) std::atomic<INT64> top;
+	alignas(64) std::atomic<INT64> bottom;
+};
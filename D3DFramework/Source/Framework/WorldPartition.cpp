@@ -0,0 +1,636 @@
+#include "../PrecompiledHeader/pch.h"
+#include "WorldPartition.h"
+#include "AssetManager.h"
+#include "AssetLoader.h"
+#include "Broadphase.h"
+#include "JobSystem.h"
+#include "TransformStore.h"
+#include "FrameAllocator.h"
+#include "StaticBatcher.h"
+#include "../Component/Mesh.h"
+#include "../Component/Material.h"
+#include "../Object/GameObject.h"
+
+WorldPartition::WorldPartition(ID3D12Device* device)
+{
+	d3dDevice = device;
+
+	// 명령어 큐를 생성한다.
+	D3D12_COMMAND_QUEUE_DESC queueDesc = {};
+	queueDesc.Type = D3D12_COMMAND_LIST_TYPE_DIRECT;
+	queueDesc.Flags = D3D12_COMMAND_QUEUE_FLAG_NONE;
+	ThrowIfFailed(d3dDevice->CreateCommandQueue(&queueDesc, IID_PPV_ARGS(&cmdQueue)));
+
+	// 명령어 할당자를 생성한다.
+	ThrowIfFailed(d3dDevice->CreateCommandAllocator(
+		D3D12_COMMAND_LIST_TYPE_DIRECT,
+		IID_PPV_ARGS(cmdAlloc.GetAddressOf())));
+
+	// 명령어 리스트를 생성한다. 업로드할 메쉬가 생길 때 리셋하므로 닫아둔다.
+	ThrowIfFailed(d3dDevice->CreateCommandList(
+		0,
+		D3D12_COMMAND_LIST_TYPE_DIRECT,
+		cmdAlloc.Get(),
+		nullptr,
+		IID_PPV_ARGS(cmdList.GetAddressOf())));
+	ThrowIfFailed(cmdList->Close());
+
+	// 펜스를 생성한다.
+	ThrowIfFailed(d3dDevice->CreateFence(0, D3D12_FENCE_FLAG_NONE, IID_PPV_ARGS(&fence)));
+
+	alwaysLoadedCell.isAlwaysLoaded = true;
+}
+
+WorldPartition::~WorldPartition()
+{
+	// 워커 스레드가 아직 메쉬의 정점을 쓰고 있을 수 있다.
+	for (auto& streamedMesh : meshes)
+	{
+		if (streamedMesh.decodeCounter)
+			JobSystem::GetInstance()->Wait(*streamedMesh.decodeCounter);
+	}
+
+	if (isRecording)
+		SubmitUploads();
+	WaitForUploads();
+}
+
+bool WorldPartition::Open(const std::wstring& fileName)
+{
+	if (!sceneFile.Open(fileName))
+		return false;
+
+	AssetManager* assetManager = AssetManager::GetInstance();
+
+	// 상주하는 메쉬는 그대로 사용하고, 스트리밍되는 메쉬는 처음 참조될 때 로드한다.
+	const UINT32 meshCount = sceneFile.GetMeshCount();
+	meshes.resize(meshCount);
+	for (UINT32 i = 0; i < meshCount; ++i)
+	{
+		const std::string meshName(sceneFile.GetMeshName(i));
+		StreamedMesh& streamedMesh = meshes[i];
+
+		auto iter = assetManager->meshes.find(meshName);
+		if (iter != assetManager->meshes.end())
+		{
+			streamedMesh.mesh = iter->second.get();
+			streamedMesh.state = MeshState::Resident;
+			continue;
+		}
+
+		streamedMesh.info = assetManager->FindMeshInfo(meshName);
+		if (streamedMesh.info == nullptr || !streamedMesh.info->isStreamed)
+			streamedMesh.state = MeshState::Failed;
+	}
+
+	// 텍스처의 서술자 인덱스가 고정되어 있으므로 재질은 항상 상주한다.
+	const UINT32 materialCount = sceneFile.GetMaterialCount();
+	materials.resize(materialCount, nullptr);
+	for (UINT32 i = 0; i < materialCount; ++i)
+	{
+		auto iter = assetManager->materials.find(std::string(sceneFile.GetMaterialName(i)));
+		if (iter != assetManager->materials.end())
+			materials[i] = iter->second.get();
+	}
+
+	// 레코드를 위치에 따라 셀로 나눈다.
+	const auto transforms = sceneFile.GetTransforms();
+	const auto records = sceneFile.GetObjects();
+	for (UINT32 i = 0; i < sceneFile.GetObjectCount(); ++i)
+	{
+		const SceneObjectRecord& record = records[i];
+		if (!sceneFile.IsValidRecord(record) || materials[record.materialIndex] == nullptr ||
+			meshes[record.meshIndex].state == MeshState::Failed)
+		{
+#if defined(DEBUG) || defined(_DEBUG)
+			std::cout << "Scene Object " << i << " is Invalid" << std::endl;
+#endif
+			continue;
+		}
+
+		// 하늘은 카메라를 따라다니므로 위치와 상관없이 항상 로드한다.
+		if (record.renderLayer == (UINT8)RenderLayer::Sky)
+		{
+			alwaysLoadedCell.records.push_back(i);
+			continue;
+		}
+
+		const XMFLOAT3& pos = transforms[i].position;
+		const INT32 x = (INT32)std::floor(pos.x / cellSize);
+		const INT32 z = (INT32)std::floor(pos.z / cellSize);
+
+		Cell& cell = cells[{ x, z }];
+		cell.x = x;
+		cell.z = z;
+		cell.records.push_back(i);
+	}
+
+#if defined(DEBUG) || defined(_DEBUG)
+	std::cout << "WorldPartition : " << sceneFile.GetObjectCount() << " objects in " << cells.size() << " cells" << std::endl;
+#endif
+
+	return true;
+}
+
+void WorldPartition::Update(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase)
+{
+	UpdateInternal(position, objects, renderLayers, broadphase, true);
+}
+
+void WorldPartition::Preload(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers)
+{
+	while (true)
+	{
+		UpdateInternal(position, objects, renderLayers, nullptr, false);
+
+		bool isLoading = alwaysLoadedCell.state == CellState::Loading || alwaysLoadedCell.state == CellState::Batching;
+		for (const auto& [key, cell] : cells)
+			isLoading |= cell.state == CellState::Loading || cell.state == CellState::Batching;
+
+		if (!isLoading)
+			break;
+
+		// 파일을 읽는 작업과 업로드가 끝나기를 기다린 뒤 다시 진행한다.
+		for (auto& streamedMesh : meshes)
+		{
+			if (streamedMesh.state == MeshState::Decoding)
+				JobSystem::GetInstance()->Wait(*streamedMesh.decodeCounter);
+		}
+		WaitForUploads();
+	}
+}
+
+void WorldPartition::UpdateInternal(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers,
+	Broadphase* broadphase, const bool hasBudget)
+{
+	if (!sceneFile.IsOpen())
+		return;
+
+	stopWatch.Start();
+
+	UpdateCellStates(position, objects, renderLayers, broadphase);
+	UpdateMeshes(hasBudget);
+
+	// 로드 중인 셀을 가까운 순서로 생성한다.
+	FrameVector<std::pair<float, Cell*>> loadingCells;
+	if (alwaysLoadedCell.state == CellState::Loading)
+		loadingCells.emplace_back(0.0f, &alwaysLoadedCell);
+	for (auto& [key, cell] : cells)
+	{
+		if (cell.state == CellState::Loading)
+			loadingCells.emplace_back(GetDistance(cell, position), &cell);
+	}
+
+	std::sort(loadingCells.begin(), loadingCells.end(), [](const auto& lhs, const auto& rhs)
+	{
+		return lhs.first < rhs.first;
+	});
+
+	bool isCreated = false;
+	for (auto& [distance, cell] : loadingCells)
+	{
+		if (IsOverBudget(hasBudget))
+			break;
+
+		isCreated |= InstantiateCell(*cell, objects, renderLayers, broadphase, hasBudget);
+	}
+
+	UpdateBatches(objects, renderLayers, broadphase);
+
+	// 새로 생성된 객체들의 월드 행렬을 이번 프레임의 상수 버퍼에 반영한다.
+	if (isCreated)
+		TransformStore::GetInstance()->UpdateWorlds();
+}
+
+void WorldPartition::UpdateCellStates(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase)
+{
+	if (alwaysLoadedCell.state == CellState::Unloaded)
+		RequestCell(alwaysLoadedCell);
+
+	for (auto& [key, cell] : cells)
+	{
+		const float distance = GetDistance(cell, position);
+
+		if (cell.state == CellState::Unloaded && distance <= loadDistance)
+			RequestCell(cell);
+		else if (cell.state != CellState::Unloaded && distance > unloadDistance)
+			UnloadCell(cell, objects, renderLayers, broadphase);
+	}
+}
+
+void WorldPartition::RequestCell(Cell& cell)
+{
+	const auto records = sceneFile.GetObjects();
+	for (const UINT32 index : cell.records)
+		AcquireMesh(records[index].meshIndex);
+
+	cell.state = CellState::Loading;
+	cell.nextRecord = 0;
+
+#if defined(DEBUG) || defined(_DEBUG)
+	if (!cell.isAlwaysLoaded)
+		std::cout << "WorldPartition : Load Cell (" << cell.x << ", " << cell.z << ")" << std::endl;
+#endif
+}
+
+void WorldPartition::UnloadCell(Cell& cell, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase)
+{
+	// 렌더 레이어에서 한 번에 지울 수 있도록 레이어마다 핸들을 모아 정렬한다.
+	std::array<FrameVector<UINT32>, (int)RenderLayer::Count> removedHandles;
+	bool isStaticRemoved = false;
+
+	for (const auto& [handle, layer] : cell.instances)
+	{
+		// 게임 도중 이미 파괴된 객체는 건너뛴다.
+		GameObject* obj = objects.Get(handle);
+		if (obj == nullptr)
+			continue;
+
+		isStaticRemoved |= obj->isStatic;
+		removedHandles[layer].push_back(handle.value);
+		objects.Remove(handle);
+	}
+
+	for (int layer = 0; layer < (int)RenderLayer::Count; ++layer)
+	{
+		auto& removed = removedHandles[layer];
+		if (removed.empty())
+			continue;
+
+		std::sort(removed.begin(), removed.end());
+		std::erase_if(renderLayers[layer], [&removed](const ObjectHandle handle)
+		{
+			return std::binary_search(removed.begin(), removed.end(), handle.value);
+		});
+	}
+
+	// 제거된 동적 객체는 광역 단계가 스스로 걸러내지만 정적 트리는 다시 만들어야 한다.
+	if (broadphase && isStaticRemoved)
+		broadphase->MarkStaticDirty();
+
+	const auto records = sceneFile.GetObjects();
+	for (const UINT32 index : cell.records)
+		ReleaseMesh(records[index].meshIndex);
+
+	// 합쳐진 객체들은 instances에 함께 있으므로 이미 제거되었다.
+	if (cell.batcher)
+	{
+		RetiredBatcher retired;
+		retired.batcher = std::move(cell.batcher);
+		retired.fenceValue = currentFence;
+		retired.releaseFrame = NUM_FRAME_RESOURCES;
+		retiredBatchers.push_back(std::move(retired));
+	}
+	cell.batchedHandles.clear();
+	cell.batchHandles.clear();
+	cell.batchFence = 0;
+
+	cell.instances.clear();
+	cell.nextRecord = 0;
+	cell.state = CellState::Unloaded;
+
+#if defined(DEBUG) || defined(_DEBUG)
+	std::cout << "WorldPartition : Unload Cell (" << cell.x << ", " << cell.z << ")" << std::endl;
+#endif
+}
+
+void WorldPartition::AcquireMesh(const UINT32 meshIndex)
+{
+	StreamedMesh& streamedMesh = meshes[meshIndex];
+	++streamedMesh.refCount;
+	streamedMesh.releaseFrame = 0;
+
+	if (streamedMesh.state != MeshState::Unloaded)
+		return;
+
+	// 파일을 읽고 해석하는 작업은 워커 스레드에서 수행한다.
+	streamedMesh.state = MeshState::Decoding;
+	streamedMesh.decodeCounter = std::make_unique<JobCounter>();
+
+	StreamedMesh* target = &streamedMesh;
+	std::wstring filePath = AssetManager::GetInstance()->GetModelFilePath(*streamedMesh.info);
+	JobSystem::GetInstance()->Run([this, target, filePath = std::move(filePath)]()
+	{
+		target->decodeResult = AssetLoader::LoadH3d(d3dDevice, nullptr, filePath, target->vertices, target->indices);
+	}, streamedMesh.decodeCounter.get());
+}
+
+void WorldPartition::ReleaseMesh(const UINT32 meshIndex)
+{
+	StreamedMesh& streamedMesh = meshes[meshIndex];
+	if (--streamedMesh.refCount > 0 || !streamedMesh.ownedMesh)
+		return;
+
+	// 이전 프레임들의 명령이 아직 이 메쉬를 그리고 있을 수 있다.
+	streamedMesh.releaseFrame = NUM_FRAME_RESOURCES;
+}
+
+void WorldPartition::UpdateMeshes(const bool hasBudget)
+{
+	// 업로드가 끝난 메쉬는 업로드 버퍼를 해제하고 사용할 수 있는 상태가 된다.
+	if (!uploadingMeshes.empty() && fence->GetCompletedValue() >= currentFence)
+	{
+		for (const UINT32 meshIndex : uploadingMeshes)
+		{
+			StreamedMesh& streamedMesh = meshes[meshIndex];
+			streamedMesh.ownedMesh->DisposeUploaders();
+			streamedMesh.state = MeshState::Resident;
+
+			// 업로드하는 동안 모든 참조가 사라졌을 수 있다.
+			if (streamedMesh.refCount == 0)
+				streamedMesh.releaseFrame = NUM_FRAME_RESOURCES;
+		}
+		uploadingMeshes.clear();
+	}
+
+	// 명령 할당자는 이전 업로드가 끝나야 재사용할 수 있으므로 한 번에 하나의 업로드만 진행한다.
+	// 셀의 합쳐진 메쉬도 같은 명령 리스트로 업로드되므로 울타리로 확인한다.
+	if (uploadingMeshes.empty() && fence->GetCompletedValue() >= currentFence)
+	{
+		for (UINT32 i = 0; i < (UINT32)meshes.size(); ++i)
+		{
+			StreamedMesh& streamedMesh = meshes[i];
+			if (streamedMesh.state != MeshState::Decoding || !streamedMesh.decodeCounter->IsDone())
+				continue;
+
+			if (!streamedMesh.decodeResult)
+			{
+#if defined(DEBUG) || defined(_DEBUG)
+				std::cout << "WorldPartition : Failed to load " << streamedMesh.info->name << std::endl;
+#endif
+				streamedMesh.state = MeshState::Failed;
+				streamedMesh.decodeCounter = nullptr;
+				continue;
+			}
+
+			if (IsOverBudget(hasBudget))
+				break;
+
+			BeginRecording();
+
+			streamedMesh.ownedMesh = AssetManager::BuildMesh(d3dDevice, cmdList.Get(),
+				*streamedMesh.info, streamedMesh.vertices, streamedMesh.indices);
+			streamedMesh.mesh = streamedMesh.ownedMesh.get();
+			streamedMesh.state = MeshState::Uploading;
+			streamedMesh.decodeCounter = nullptr;
+
+			// 메쉬가 CPU 쪽 복사본을 가지므로 해석된 데이터는 바로 해제한다.
+			std::vector<Vertex>().swap(streamedMesh.vertices);
+			std::vector<UINT16>().swap(streamedMesh.indices);
+
+			uploadingMeshes.push_back(i);
+		}
+
+		if (isRecording)
+			SubmitUploads();
+	}
+
+	// 참조가 없어진 메쉬는 GPU가 더 이상 그리지 않을 때 해제한다.
+	for (auto& streamedMesh : meshes)
+	{
+		if (streamedMesh.releaseFrame == 0 || streamedMesh.refCount > 0 || streamedMesh.state != MeshState::Resident)
+			continue;
+
+		if (--streamedMesh.releaseFrame == 0)
+		{
+			streamedMesh.ownedMesh = nullptr;
+			streamedMesh.mesh = nullptr;
+			streamedMesh.state = MeshState::Unloaded;
+		}
+	}
+}
+
+bool WorldPartition::BeginRecording()
+{
+	if (isRecording)
+		return true;
+
+	if (fence->GetCompletedValue() < currentFence)
+		return false;
+
+	ThrowIfFailed(cmdAlloc->Reset());
+	ThrowIfFailed(cmdList->Reset(cmdAlloc.Get(), nullptr));
+	isRecording = true;
+	return true;
+}
+
+void WorldPartition::SubmitUploads()
+{
+	ThrowIfFailed(cmdList->Close());
+	ID3D12CommandList* cmdLists[] = { cmdList.Get() };
+	cmdQueue->ExecuteCommandLists(_countof(cmdLists), cmdLists);
+
+	// 업로드가 끝나는 지점에 울타리를 설정한다. 기다리지 않고 다음 프레임에 확인한다.
+	ThrowIfFailed(cmdQueue->Signal(fence.Get(), ++currentFence));
+	isRecording = false;
+}
+
+void WorldPartition::WaitForUploads()
+{
+	if (fence->GetCompletedValue() < currentFence)
+	{
+		HANDLE eventHandle = CreateEventEx(nullptr, false, false, EVENT_ALL_ACCESS);
+		ThrowIfFailed(fence->SetEventOnCompletion(currentFence, eventHandle));
+		WaitForSingleObject(eventHandle, INFINITE);
+		CloseHandle(eventHandle);
+	}
+}
+
+bool WorldPartition::InstantiateCell(Cell& cell, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase, const bool hasBudget)
+{
+	const auto records = sceneFile.GetObjects();
+	bool isCreated = false;
+
+	while (cell.nextRecord < (UINT32)cell.records.size())
+	{
+		const UINT32 index = cell.records[cell.nextRecord];
+		const SceneObjectRecord& record = records[index];
+		const StreamedMesh& streamedMesh = meshes[record.meshIndex];
+
+		// 메쉬가 아직 준비되지 않았다면 레코드의 순서대로 기다린다.
+		if (streamedMesh.state == MeshState::Decoding || streamedMesh.state == MeshState::Uploading)
+			break;
+
+		if (IsOverBudget(hasBudget))
+			break;
+
+		++cell.nextRecord;
+		if (streamedMesh.state == MeshState::Failed)
+			continue;
+
+		GameObject* obj = sceneFile.CreateObject(index, objects, streamedMesh.mesh, materials[record.materialIndex]);
+		renderLayers[record.renderLayer].push_back(obj->GetHandle());
+		cell.instances.emplace_back(obj->GetHandle(), record.renderLayer);
+		isCreated = true;
+
+		if (broadphase)
+		{
+			obj->BeginPlay();
+			broadphase->AddObject(obj);
+		}
+	}
+
+	if (cell.nextRecord == (UINT32)cell.records.size())
+	{
+#ifdef STATIC_BATCHING
+		cell.state = CellState::Batching;
+#else
+		cell.state = CellState::Loaded;
+#endif
+	}
+
+	return isCreated;
+}
+
+void WorldPartition::UpdateBatches(ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase)
+{
+	const UINT64 completedFence = fence->GetCompletedValue();
+
+	auto updateCell = [&](Cell& cell)
+	{
+		if (cell.state != CellState::Batching)
+			return;
+
+		if (cell.batchFence == 0)
+		{
+			if (!BeginRecording())
+				return;
+
+			BuildCellBatches(cell, objects, broadphase);
+
+			// 합칠 객체가 없다면 교체할 것도 없다.
+			if (cell.batchHandles.empty())
+			{
+				cell.batcher = nullptr;
+				cell.batchedHandles.clear();
+				cell.state = CellState::Loaded;
+				return;
+			}
+
+			// 아래에서 제출될 업로드의 울타리 값
+			cell.batchFence = currentFence + 1;
+			return;
+		}
+
+		if (completedFence < cell.batchFence)
+			return;
+
+		cell.batcher->DisposeUploaders();
+
+		// 합쳐진 객체들을 렌더 레이어에서 빼고 합쳐진 객체를 대신 넣는다.
+		auto& opaqueHandles = renderLayers[(int)RenderLayer::Opaque];
+		FrameVector<UINT32> batched;
+		for (const ObjectHandle handle : cell.batchedHandles)
+			batched.push_back(handle.value);
+		std::sort(batched.begin(), batched.end());
+
+		std::erase_if(opaqueHandles, [&batched](const ObjectHandle handle)
+		{
+			return std::binary_search(batched.begin(), batched.end(), handle.value);
+		});
+		opaqueHandles.insert(opaqueHandles.end(), cell.batchHandles.begin(), cell.batchHandles.end());
+
+		cell.batchedHandles.clear();
+		cell.batchHandles.clear();
+		cell.state = CellState::Loaded;
+	};
+
+	updateCell(alwaysLoadedCell);
+	for (auto& [key, cell] : cells)
+		updateCell(cell);
+
+	if (isRecording)
+		SubmitUploads();
+
+	// 해제된 셀의 합쳐진 메쉬는 업로드가 끝나고 GPU가 더 이상 그리지 않을 때 해제한다.
+	std::erase_if(retiredBatchers, [completedFence](RetiredBatcher& retired)
+	{
+		if (retired.releaseFrame > 0)
+			--retired.releaseFrame;
+		return retired.releaseFrame == 0 && completedFence >= retired.fenceValue;
+	});
+}
+
+void WorldPartition::BuildCellBatches(Cell& cell, ObjectTable& objects, Broadphase* broadphase)
+{
+	std::vector<ObjectHandle> handles;
+	for (const auto& [handle, layer] : cell.instances)
+	{
+		if (layer == (UINT8)RenderLayer::Opaque && objects.IsValid(handle))
+			handles.push_back(handle);
+	}
+
+	if (handles.empty())
+		return;
+
+	// Build는 합쳐진 객체들을 handles에서 순서를 유지한 채 지우고 합쳐진 객체들을 뒤에 추가한다.
+	const std::vector<ObjectHandle> originalHandles = handles;
+	cell.batcher = std::make_unique<StaticBatcher>();
+	cell.batcher->Build(d3dDevice, cmdList.Get(), objects, handles);
+
+	const UINT32 batchCount = cell.batcher->GetBatchCount();
+	const auto keptEnd = handles.end() - batchCount;
+	cell.batchHandles.assign(keptEnd, handles.end());
+
+	FrameVector<UINT32> kept;
+	for (auto iter = handles.begin(); iter != keptEnd; ++iter)
+		kept.push_back(iter->value);
+	std::sort(kept.begin(), kept.end());
+
+	for (const ObjectHandle handle : originalHandles)
+	{
+		if (!std::binary_search(kept.begin(), kept.end(), handle.value))
+			cell.batchedHandles.push_back(handle);
+	}
+
+	// 합쳐진 객체도 셀의 객체이므로 셀이 해제될 때 함께 제거된다.
+	for (const ObjectHandle handle : cell.batchHandles)
+	{
+		cell.instances.emplace_back(handle, (UINT8)RenderLayer::Opaque);
+
+		if (broadphase)
+			objects.Get(handle)->BeginPlay();
+	}
+}
+
+float WorldPartition::GetDistance(const Cell& cell, const XMFLOAT3& position) const
+{
+	const float minX = cell.x * cellSize;
+	const float minZ = cell.z * cellSize;
+
+	const float dx = (std::max)({ minX - position.x, 0.0f, position.x - (minX + cellSize) });
+	const float dz = (std::max)({ minZ - position.z, 0.0f, position.z - (minZ + cellSize) });
+
+	return std::sqrt(dx * dx + dz * dz);
+}
+
+bool WorldPartition::IsOverBudget(const bool hasBudget)
+{
+	if (!hasBudget)
+		return false;
+
+	stopWatch.End();
+	return stopWatch.Nanosecond() / 1000000.0 > loadBudget;
+}
+
+UINT32 WorldPartition::GetLoadedCellCount() const
+{
+	UINT32 count = 0;
+	for (const auto& [key, cell] : cells)
+	{
+		if (cell.state == CellState::Loaded)
+			++count;
+	}
+	return count;
+}
+
+UINT32 WorldPartition::GetResidentMeshCount() const
+{
+	UINT32 count = 0;
+	for (const auto& streamedMesh : meshes)
+	{
+		if (streamedMesh.ownedMesh && streamedMesh.state == MeshState::Resident)
+			++count;
+	}
+	return count;
+}
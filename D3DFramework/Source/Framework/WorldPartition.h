@@ -0,0 +1,190 @@
+#pragma once
+
+#include "SceneFile.h"
+#include "D3DStructure.h"
+#include "StopWatch.h"
+#include <map>
+#include <memory>
+#include <utility>
+
+class Mesh;
+class Material;
+class Broadphase;
+class JobCounter;
+class StaticBatcher;
+struct MeshInfo;
+
+/*
+씬 파일의 객체들을 XZ 평면의 격자 셀로 나누어 카메라 주변의 셀만 메모리에 두는 클래스
+카메라로부터 loadDistance 안에 들어온 셀은 가까운 순서로 로드하고,
+unloadDistance 밖으로 나간 셀은 객체와 더 이상 쓰이지 않는 메쉬를 해제한다.
+두 거리의 차이만큼 여유를 두어 경계에서 셀이 반복해서 로드되고 해제되지 않게 한다.
+스트리밍되는 메쉬는 JobSystem에서 파일을 읽고, 자신의 명령 큐로 업로드하므로
+메인 명령 리스트를 기다리게 하지 않는다. 메쉬가 모두 올라간 셀의 객체는
+프레임마다 정해진 시간 안에서만 생성하여 로드가 한 프레임에 몰리지 않게 한다.
+하늘처럼 카메라를 따라다니는 객체는 항상 로드되는 셀에 넣는다.
+STATIC_BATCHING이 켜져 있다면 객체를 모두 생성한 셀의 정적 객체들을 셀 단위로 합치고,
+합쳐진 메쉬의 업로드가 끝난 뒤에 렌더 레이어에서 원래 객체들과 교체한다.
+*/
+class WorldPartition
+{
+private:
+	enum class CellState
+	{
+		Unloaded,
+		// 메쉬를 기다리거나 객체를 생성하는 중
+		Loading,
+		// 정적 객체들을 합친 메쉬를 업로드하는 중. 그동안은 원래 객체들을 그린다.
+		Batching,
+		Loaded,
+	};
+
+	struct Cell
+	{
+		INT32 x = 0;
+		INT32 z = 0;
+		bool isAlwaysLoaded = false;
+		CellState state = CellState::Unloaded;
+
+		// 이 셀에 속하는 씬 파일의 레코드 인덱스
+		std::vector<UINT32> records;
+		// 생성된 객체의 핸들과 렌더 레이어
+		std::vector<std::pair<ObjectHandle, UINT8>> instances;
+		// 다음에 생성할 레코드의 위치
+		UINT32 nextRecord = 0;
+
+		// 셀의 정적 객체들을 합친 메쉬를 소유한다.
+		std::unique_ptr<StaticBatcher> batcher;
+		// 합쳐져서 렌더 레이어에서 빠질 객체들과 이를 대신할 합쳐진 객체들
+		std::vector<ObjectHandle> batchedHandles;
+		std::vector<ObjectHandle> batchHandles;
+		// 합쳐진 메쉬의 업로드가 끝나는 울타리 값. 0이라면 아직 합치지 않았다.
+		UINT64 batchFence = 0;
+	};
+
+	// 해제된 셀의 합쳐진 메쉬는 GPU가 더 이상 사용하지 않을 때 해제한다.
+	struct RetiredBatcher
+	{
+		std::unique_ptr<StaticBatcher> batcher;
+		UINT64 fenceValue = 0;
+		UINT32 releaseFrame = 0;
+	};
+
+	enum class MeshState
+	{
+		Unloaded,
+		// 워커 스레드에서 파일을 읽는 중
+		Decoding,
+		// GPU로 업로드하는 중
+		Uploading,
+		Resident,
+		// 파일을 읽지 못하여 이 메쉬를 사용하는 객체는 생성하지 않는다.
+		Failed,
+	};
+
+	struct StreamedMesh
+	{
+		const MeshInfo* info = nullptr;
+		MeshState state = MeshState::Unloaded;
+		Mesh* mesh = nullptr;
+		// 스트리밍된 메쉬만 소유한다. AssetManager의 메쉬는 mesh만 가리킨다.
+		std::unique_ptr<Mesh> ownedMesh;
+
+		// 이 메쉬를 사용하는 로드 중이거나 로드된 레코드의 개수
+		UINT32 refCount = 0;
+		// 참조가 없어진 뒤 해제될 때까지 남은 프레임. GPU가 이전 프레임을 그리는 동안 유지한다.
+		UINT32 releaseFrame = 0;
+
+		std::unique_ptr<JobCounter> decodeCounter;
+		std::vector<Vertex> vertices;
+		std::vector<UINT16> indices;
+		bool decodeResult = false;
+	};
+
+public:
+	WorldPartition(ID3D12Device* device);
+	WorldPartition(const WorldPartition& rhs) = delete;
+	WorldPartition& operator=(const WorldPartition& rhs) = delete;
+	~WorldPartition();
+
+public:
+	// 씬 파일을 열고 레코드들을 셀로 나눈다. 객체는 Update에서 생성된다.
+	bool Open(const std::wstring& fileName);
+
+	// 카메라의 위치로 셀을 요청하거나 해제하고, 예산 안에서 로드를 진행한다.
+	// broadphase가 nullptr라면 초기화 중으로 보고 BeginPlay와 광역 단계의 등록은 호출자에게 맡긴다.
+	void Update(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase);
+
+	// 시작 위치 주변의 셀이 모두 로드될 때까지 예산 없이 기다린다.
+	void Preload(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers);
+
+	UINT32 GetLoadedCellCount() const;
+	UINT32 GetResidentMeshCount() const;
+
+private:
+	// hasBudget이 false라면 시간 예산을 확인하지 않고 가능한 만큼 로드한다.
+	void UpdateInternal(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers,
+		Broadphase* broadphase, const bool hasBudget);
+	// 거리에 따라 셀을 로드 요청하거나 해제한다.
+	void UpdateCellStates(const XMFLOAT3& position, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase);
+	void RequestCell(Cell& cell);
+	void UnloadCell(Cell& cell, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase);
+
+	void AcquireMesh(const UINT32 meshIndex);
+	void ReleaseMesh(const UINT32 meshIndex);
+
+	// 파일을 다 읽은 메쉬를 업로드하고, 업로드가 끝난 메쉬를 상주 상태로 바꾼다.
+	void UpdateMeshes(const bool hasBudget);
+	// 업로드 명령을 제출하고 펜스를 설정한다.
+	void SubmitUploads();
+	void WaitForUploads();
+
+	// 셀의 메쉬가 모두 준비되었다면 예산 안에서 객체를 생성한다.
+	bool InstantiateCell(Cell& cell, ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase, const bool hasBudget);
+
+	// 객체를 모두 생성한 셀의 정적 객체들을 합치고, 업로드가 끝난 셀은 렌더 레이어의 객체들을 교체한다.
+	void UpdateBatches(ObjectTable& objects, SceneFile::RenderLayers& renderLayers, Broadphase* broadphase);
+	// 셀의 불투명 정적 객체들을 합치는 업로드 명령을 기록한다.
+	void BuildCellBatches(Cell& cell, ObjectTable& objects, Broadphase* broadphase);
+	// 업로드 명령을 기록할 수 있도록 명령 리스트를 리셋한다. 이전 업로드가 끝나지 않았다면 false를 반환한다.
+	bool BeginRecording();
+
+	// 카메라로부터 셀의 사각형까지의 XZ 평면 거리
+	float GetDistance(const Cell& cell, const XMFLOAT3& position) const;
+	bool IsOverBudget(const bool hasBudget);
+
+public:
+	// 셀 한 칸의 크기
+	float cellSize = 100.0f;
+	// 이 거리 안의 셀을 로드한다.
+	float loadDistance = 150.0f;
+	// 이 거리 밖의 셀을 해제한다. loadDistance보다 커야 한다.
+	float unloadDistance = 200.0f;
+	// 한 프레임에 로드에 사용할 수 있는 시간(ms)
+	double loadBudget = 2.0;
+
+private:
+	ID3D12Device* d3dDevice = nullptr;
+	SceneFile sceneFile;
+
+	std::map<std::pair<INT32, INT32>, Cell> cells;
+	Cell alwaysLoadedCell;
+
+	std::vector<StreamedMesh> meshes;
+	std::vector<Material*> materials;
+
+	// 스트리밍되는 메쉬를 업로드하는 명령 오브젝트는 프레임워크와 따로 둔다.
+	Microsoft::WRL::ComPtr<ID3D12CommandQueue> cmdQueue;
+	Microsoft::WRL::ComPtr<ID3D12CommandAllocator> cmdAlloc;
+	Microsoft::WRL::ComPtr<ID3D12GraphicsCommandList> cmdList;
+	Microsoft::WRL::ComPtr<ID3D12Fence> fence;
+	UINT64 currentFence = 0;
+	// 명령 리스트에 기록 중인 업로드가 있는지 여부
+	bool isRecording = false;
+	// 제출되어 펜스를 기다리는 메쉬들
+	std::vector<UINT32> uploadingMeshes;
+	std::vector<RetiredBatcher> retiredBatchers;
+
+	// 이번 프레임에 로드에 사용한 시간을 잰다.
+	StopWatch stopWatch;
+};
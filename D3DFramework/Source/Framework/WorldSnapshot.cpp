@@ -0,0 +1,223 @@
+#include "../PrecompiledHeader/pch.h"
+#include "WorldSnapshot.h"
+#include "Broadphase.h"
+#include "Random.h"
+#include "../Object/GameObject.h"
+#include "../Object/Particle.h"
+
+template<typename T>
+static bool IsBitwiseEqual(const T& lhs, const T& rhs)
+{
+	return std::memcmp(&lhs, &rhs, sizeof(T)) == 0;
+}
+
+WorldSnapshot::WorldSnapshot() { }
+
+WorldSnapshot::~WorldSnapshot() { }
+
+void WorldSnapshot::Reserve(const UINT32 objectCount, const UINT32 particleCount, const UINT32 staticObjectCount)
+{
+	// 델타 스냅샷은 마지막 청크까지 통째로 쓰므로 청크 단위로 올림한다.
+	const UINT32 chunkCount = (objectCount + chunkSize - 1) / chunkSize;
+	if (objectStates.size() < (size_t)chunkCount * chunkSize)
+		objectStates.resize((size_t)chunkCount * chunkSize);
+	if (chunkSlots.size() < chunkCount)
+		chunkSlots.resize(chunkCount);
+
+	particleStates.reserve(particleCount);
+	staticObjects.reserve(staticObjectCount);
+}
+
+void WorldSnapshot::Capture(const ObjectTable& objects, std::span<const std::shared_ptr<Particle>> particles,
+	const Broadphase* broadphase)
+{
+	// 공간이 모자랄 때만 할당한다.
+	Reserve(objects.GetCount(), (UINT32)particles.size(), broadphase ? broadphase->GetStaticObjectCount() : 0);
+
+	UINT32 index = 0;
+	for (GameObject* obj : objects)
+		WriteState(objectStates[index++], obj);
+
+	objectCount = index;
+	changedChunkCount = 0;
+	base = nullptr;
+
+	CaptureShared(particles, broadphase);
+}
+
+void WorldSnapshot::CaptureDelta(const WorldSnapshot& base, const ObjectTable& objects, std::span<const std::shared_ptr<Particle>> particles,
+	const Broadphase* broadphase)
+{
+	assert(!base.IsDelta() && base.IsValid());
+
+	Reserve(objects.GetCount(), (UINT32)particles.size(), broadphase ? broadphase->GetStaticObjectCount() : 0);
+
+	UINT32 index = 0;
+	UINT32 chunkIndex = 0;
+	// 다음으로 달라진 청크를 저장할 위치
+	UINT32 usedCount = 0;
+	changedChunkCount = 0;
+
+	// 객체의 상태를 저장할 위치에 바로 쓰고, 기준 스냅샷과 같다면 다음 청크가 그 위치를 덮어쓴다.
+	auto endChunk = [this, &base, &index, &chunkIndex, &usedCount]()
+	{
+		const UINT32 chunkStart = chunkIndex * chunkSize;
+		const UINT32 stateCount = index - chunkStart;
+
+		const bool isSame = chunkStart + stateCount <= base.objectCount &&
+			std::memcmp(&objectStates[usedCount], &base.objectStates[chunkStart], sizeof(ObjectState) * stateCount) == 0;
+
+		if (isSame)
+		{
+			chunkSlots[chunkIndex] = unchangedChunk;
+		}
+		else
+		{
+			chunkSlots[chunkIndex] = usedCount;
+			usedCount += chunkSize;
+			++changedChunkCount;
+		}
+
+		++chunkIndex;
+	};
+
+	for (GameObject* obj : objects)
+	{
+		WriteState(objectStates[usedCount + index - chunkIndex * chunkSize], obj);
+		++index;
+
+		if (index % chunkSize == 0)
+			endChunk();
+	}
+
+	if (index % chunkSize != 0)
+		endChunk();
+
+	objectCount = index;
+	this->base = &base;
+
+	CaptureShared(particles, broadphase);
+}
+
+void WorldSnapshot::CaptureShared(std::span<const std::shared_ptr<Particle>> particles, const Broadphase* broadphase)
+{
+	particleStates.clear();
+	for (const auto& particle : particles)
+		particleStates.push_back({ particle->remainingSpawnTime, particle->isActive });
+
+	staticObjects.clear();
+	if (broadphase)
+	{
+		const auto& handles = broadphase->GetStaticObjects();
+		staticObjects.insert(staticObjects.end(), handles.begin(), handles.end());
+	}
+
+	randomEngine = Random::GetEngine();
+	isValid = true;
+}
+
+bool WorldSnapshot::Restore(ObjectTable& objects, std::span<const std::shared_ptr<Particle>> particles,
+	Broadphase* broadphase) const
+{
+	if (!isValid)
+		return false;
+
+	bool isRestored = true;
+
+	const UINT32 chunkCount = (objectCount + chunkSize - 1) / chunkSize;
+	for (UINT32 chunkIndex = 0; chunkIndex < chunkCount; ++chunkIndex)
+	{
+		const ObjectState* states = GetChunk(chunkIndex);
+		const UINT32 stateCount = (std::min)(chunkSize, objectCount - chunkIndex * chunkSize);
+
+		for (UINT32 i = 0; i < stateCount; ++i)
+			isRestored &= ReadState(states[i], objects);
+	}
+
+	// 파티클은 스냅샷을 만든 이후에 추가되거나 제거되지 않는다고 가정한다.
+	if (particles.size() != particleStates.size())
+		isRestored = false;
+
+	const size_t particleCount = (std::min)(particles.size(), particleStates.size());
+	for (size_t i = 0; i < particleCount; ++i)
+	{
+		particles[i]->remainingSpawnTime = particleStates[i].remainingSpawnTime;
+		particles[i]->isActive = particleStates[i].isActive;
+	}
+
+	if (broadphase)
+		broadphase->SetStaticObjects(staticObjects);
+
+	Random::SetEngine(randomEngine);
+
+	return isRestored;
+}
+
+void WorldSnapshot::WriteState(ObjectState& state, const GameObject* obj)
+{
+	state.handle = obj->GetHandle();
+	state.position = obj->GetPosition();
+	state.rotation = obj->GetRotation();
+	state.scale = obj->GetScale();
+	state.velocity = obj->velocity;
+	state.angularVelocity = obj->angularVelocity;
+	state.acceleration = obj->acceleration;
+	state.angularAcceleration = obj->angularAcceleration;
+	state.forceAccum = obj->forceAccum;
+	state.torqueAccum = obj->torqueAccum;
+}
+
+bool WorldSnapshot::ReadState(const ObjectState& state, ObjectTable& objects)
+{
+	GameObject* obj = objects.Get(state.handle);
+	if (obj == nullptr)
+		return false;
+
+	if (!IsBitwiseEqual(obj->GetPosition(), state.position))
+		obj->SetPosition(state.position);
+	if (!IsBitwiseEqual(obj->GetRotation(), state.rotation))
+		obj->SetRotation(state.rotation);
+	if (!IsBitwiseEqual(obj->GetScale(), state.scale))
+		obj->SetScale(state.scale);
+
+	obj->velocity = state.velocity;
+	obj->angularVelocity = state.angularVelocity;
+	obj->acceleration = state.acceleration;
+	obj->angularAcceleration = state.angularAcceleration;
+	obj->forceAccum = state.forceAccum;
+	obj->torqueAccum = state.torqueAccum;
+
+	return true;
+}
+
+const WorldSnapshot::ObjectState* WorldSnapshot::GetChunk(const UINT32 chunkIndex) const
+{
+	if (base == nullptr)
+		return &objectStates[(size_t)chunkIndex * chunkSize];
+
+	const UINT32 slot = chunkSlots[chunkIndex];
+	if (slot == unchangedChunk)
+		return &base->objectStates[(size_t)chunkIndex * chunkSize];
+
+	return &objectStates[slot];
+}
+
+bool WorldSnapshot::IsValid() const
+{
+	return isValid;
+}
+
+bool WorldSnapshot::IsDelta() const
+{
+	return base != nullptr;
+}
+
+UINT32 WorldSnapshot::GetObjectCount() const
+{
+	return objectCount;
+}
+
+UINT32 WorldSnapshot::GetChangedChunkCount() const
+{
+	return changedChunkCount;
+}
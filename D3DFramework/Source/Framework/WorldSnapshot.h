@@ -0,0 +1,106 @@
+#pragma once
+
+#include "Vector.h"
+#include "ObjectTable.h"
+#include <memory>
+#include <random>
+#include <span>
+#include <vector>
+
+class Particle;
+class Broadphase;
+
+/*
+되감기와 재시뮬레이션을 위해 시뮬레이션 상태를 미리 할당한 버퍼에 복사하는 클래스
+객체마다 트랜스폼과 속도, 가속도, 누적된 힘을 고정된 크기의 레코드로 연속해서 저장하고,
+정적 트리에 들어간 객체의 목록과 파티클의 스폰 타이머, 난수 생성기의 상태를 함께 저장한다.
+Reserve로 공간을 확보해두면 Capture와 Restore는 메모리를 할당하지 않는다.
+델타 스냅샷은 기준 스냅샷과 비교하여 chunkSize개의 객체 단위로 달라진 청크만 복사하며,
+복원할 때는 기준 스냅샷의 청크 위에 달라진 청크를 덮어쓴다.
+객체의 생성과 파괴는 되돌리지 않으므로 복원할 때 파괴된 객체의 상태는 건너뛴다.
+파티클의 GPU 버퍼와 천의 정점은 저장하지 않는다.
+*/
+class WorldSnapshot
+{
+private:
+	// 비교와 복사를 memcmp, memcpy로 할 수 있도록 패딩이 없는 타입만 사용한다.
+	struct ObjectState
+	{
+		ObjectHandle handle;
+		XMFLOAT3 position;
+		XMFLOAT4 rotation;
+		XMFLOAT3 scale;
+		XMFLOAT3 velocity;
+		XMFLOAT3 angularVelocity;
+		XMFLOAT3 acceleration;
+		XMFLOAT3 angularAcceleration;
+		XMFLOAT3 forceAccum;
+		XMFLOAT3 torqueAccum;
+	};
+	static_assert(sizeof(ObjectState) == sizeof(ObjectHandle) + sizeof(float) * 28, "ObjectState must not have padding.");
+
+	struct ParticleState
+	{
+		float remainingSpawnTime;
+		bool isActive;
+	};
+
+public:
+	// 델타 스냅샷이 비교하고 복사하는 단위
+	static constexpr UINT32 chunkSize = 64;
+
+public:
+	WorldSnapshot();
+	WorldSnapshot(const WorldSnapshot& rhs) = delete;
+	WorldSnapshot& operator=(const WorldSnapshot& rhs) = delete;
+	~WorldSnapshot();
+
+public:
+	// 스냅샷에 필요한 공간을 미리 할당한다.
+	void Reserve(const UINT32 objectCount, const UINT32 particleCount, const UINT32 staticObjectCount);
+
+	// 모든 상태를 복사한다.
+	void Capture(const ObjectTable& objects, std::span<const std::shared_ptr<Particle>> particles,
+		const Broadphase* broadphase);
+	// base와 달라진 청크만 복사한다. base는 전체 스냅샷이어야 하며 이 스냅샷보다 오래 유지되어야 한다.
+	void CaptureDelta(const WorldSnapshot& base, const ObjectTable& objects, std::span<const std::shared_ptr<Particle>> particles,
+		const Broadphase* broadphase);
+
+	// 저장된 상태로 되돌린다. 월드 행렬은 다음 TransformStore::UpdateWorlds에서 계산된다.
+	// 되돌리지 못한 객체가 있다면 false를 반환한다.
+	bool Restore(ObjectTable& objects, std::span<const std::shared_ptr<Particle>> particles,
+		Broadphase* broadphase) const;
+
+	bool IsValid() const;
+	bool IsDelta() const;
+	UINT32 GetObjectCount() const;
+	// 델타 스냅샷에서 복사된 청크의 개수
+	UINT32 GetChangedChunkCount() const;
+
+private:
+	void CaptureShared(std::span<const std::shared_ptr<Particle>> particles, const Broadphase* broadphase);
+
+	static void WriteState(ObjectState& state, const GameObject* obj);
+	// 값이 바뀐 트랜스폼만 설정하여 움직이지 않은 객체의 월드 행렬을 다시 계산하지 않게 한다.
+	static bool ReadState(const ObjectState& state, ObjectTable& objects);
+
+	// 저장된 청크의 시작을 반환한다. 델타 스냅샷이라면 바뀌지 않은 청크는 기준 스냅샷에서 찾는다.
+	const ObjectState* GetChunk(const UINT32 chunkIndex) const;
+
+	static constexpr UINT32 unchangedChunk = UINT32_MAX;
+
+private:
+	// 전체 스냅샷이라면 객체 순서대로, 델타 스냅샷이라면 달라진 청크들만 이어서 저장한다.
+	std::vector<ObjectState> objectStates;
+	// 델타 스냅샷에서 청크마다 objectStates에서의 위치. 달라지지 않은 청크는 unchangedChunk이다.
+	std::vector<UINT32> chunkSlots;
+	UINT32 changedChunkCount = 0;
+	UINT32 objectCount = 0;
+
+	std::vector<ParticleState> particleStates;
+	std::vector<ObjectHandle> staticObjects;
+	std::mt19937_64 randomEngine;
+
+	const WorldSnapshot* base = nullptr;
+	bool isValid = false;
+};
@@ -60,7 +60,24 @@ void AnimationObject::Animate(const float deltaTime)
 		animTimePos = 0.0f;
 	}
 
+	XMFLOAT4X4 world;
 	boneAnimation.Interpolate(animTimePos, world);
 
-	isWorldUpdate = true;
+	// 보간된 행렬을 분해하여 트랜스폼에 적용한다.
+	XMVECTOR scale, rotation, translation;
+	XMMatrixDecompose(&scale, &rotation, &translation, XMLoadFloat4x4(&world));
+
+	// 보간은 병렬 Tick에서 계산하고, 공유하는 TransformStore에 쓰는 것은 병렬 구간이 끝난 뒤로 미룬다.
+	XMFLOAT3 animScale, animPosition;
+	XMFLOAT4 quaternion;
+	XMStoreFloat3(&animScale, scale);
+	XMStoreFloat4(&quaternion, rotation);
+	XMStoreFloat3(&animPosition, translation);
+
+	Defer([this, animScale, quaternion, animPosition]()
+	{
+		SetScale(animScale);
+		SetRotation(quaternion);
+		SetPosition(animPosition);
+	});
 }
\ No newline at end of file
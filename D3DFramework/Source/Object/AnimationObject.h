@@ -18,9 +18,9 @@ private:
 	void Animate(const float deltaTime);
 
 private:
-	//  ִϸ̼ϴ ð ġ
+	// 현재 애니메이션하는 시간 위치
 	float animTimePos = 0.0f;
 
-	// ޽ ȭŰ  ִϸ̼
+	// 메쉬를 변화시키는 뼈대 애니메이션
 	BoneAnimation boneAnimation;
 };
\ No newline at end of file
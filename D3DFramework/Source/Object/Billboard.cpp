@@ -1,6 +1,7 @@
 #include "../PrecompiledHeader/pch.h"
 #include "Billboard.h"
 #include "../Component/Mesh.h"
+#include "../Framework/DrawList.h"
 
 
 Billboard::Billboard(std::string&& name) : GameObject(std::move(name)) 
@@ -30,4 +31,17 @@ void Billboard::Render(ID3D12GraphicsCommandList* cmdList, BoundingFrustum* frus
 	{
 		GetMesh()->Render(cmdList, 1, false);
 	}
-}
\ No newline at end of file
+}
+
+bool Billboard::BuildDrawRecord(DrawRecord& outRecord) const
+{
+	if (!__super::BuildDrawRecord(outRecord))
+		return false;
+
+	// 빌보드는 하나의 점으로 그려지며 프러스텀 컬링을 하지 않는다.
+	outRecord.cost = GetMesh()->GetVertexCount() + DrawList::drawCallCost;
+	outRecord.isIndexed = false;
+	outRecord.isCullable = false;
+
+	return true;
+}
@@ -5,8 +5,8 @@
 class Mesh;
 
 /*
-ü  , 2D  ׻ ī޶
-ϵ ϴ ü
+객체가 렌더링될 때, 2D 평면으로 항상 카메라를
+향하도록 하는 물체
 */
 class Billboard : public GameObject
 {
@@ -16,9 +16,10 @@ public:
 
 public:
 	virtual void Render(ID3D12GraphicsCommandList* cmdList, BoundingFrustum* frustum = nullptr) const override;
+	virtual bool BuildDrawRecord(DrawRecord& outRecord) const override;
 
 public:
-	//   ޽ Ѵ.
+	// 빌보드 전용 메쉬를 생성한다.
 	void BuildBillboardMesh(ID3D12Device* device, ID3D12GraphicsCommandList* commandList);
 
 public:
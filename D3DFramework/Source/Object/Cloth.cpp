@@ -0,0 +1,140 @@
+#include "../PrecompiledHeader/pch.h"
+#include "Cloth.h"
+#include "../Component/Mesh.h"
+#include "../Framework/UploadBuffer.h"
+#include "../Framework/D3DStructure.h"
+
+
+Cloth::Cloth(std::string&& name, const UINT32 width, const UINT32 height, const float spacing)
+	: GameObject(std::move(name)), width(width), height(height), spacing(spacing)
+{
+	// 천은 다른 물체를 밀어내지 않는다. 충돌 바운드는 프러스텀 컬링에만 사용된다.
+	collisionType = CollisionType::None;
+	isPinned.assign(width * height, false);
+}
+
+Cloth::~Cloth() { }
+
+void Cloth::BeginPlay()
+{
+	__super::BeginPlay();
+
+	ClothSolver::BuildCloth(clothData, width, height, spacing, isPinned, GetWorld(),
+		stretchStiffness, bendStiffness, iterations);
+	UpdateBounds();
+}
+
+void Cloth::CalculateWorld()
+{
+	__super::CalculateWorld();
+
+	// 메쉬의 바운드 대신 시뮬레이션된 입자들의 바운드를 사용한다.
+	if (clothData.particleCount > 0)
+		collisionBounding = clothData.bounds;
+}
+
+void Cloth::BuildClothMesh(ID3D12Device* device, ID3D12GraphicsCommandList* commandList)
+{
+	// 인덱스 버퍼가 16비트이므로 정점의 개수가 제한된다.
+	assert(width * height <= UINT16_MAX && width >= 2 && height >= 2);
+
+	clothMesh.reset();
+	clothMesh = ObjectPool<Mesh>::GetInstance()->MakeUnique(GetName() + R"("Mesh")" + std::to_string(GetUID()));
+
+	std::vector<UINT16> indices;
+	indices.reserve((width - 1) * (height - 1) * 6);
+	for (UINT32 y = 0; y + 1 < height; ++y)
+	{
+		for (UINT32 x = 0; x + 1 < width; ++x)
+		{
+			const UINT16 i = (UINT16)(y * width + x);
+			indices.emplace_back(i);
+			indices.emplace_back((UINT16)(i + 1));
+			indices.emplace_back((UINT16)(i + width));
+
+			indices.emplace_back((UINT16)(i + width));
+			indices.emplace_back((UINT16)(i + 1));
+			indices.emplace_back((UINT16)(i + width + 1));
+		}
+	}
+
+	clothMesh->BuildIndices(device, commandList, indices.data(), (UINT32)indices.size(), (UINT32)sizeof(UINT16));
+
+	// 프러스텀 컬링을 위해 메쉬의 충돌 타입을 AABB로 지정한다.
+	std::vector<XMFLOAT3> positions;
+	positions.reserve(width * height);
+	for (UINT32 y = 0; y < height; ++y)
+		for (UINT32 x = 0; x < width; ++x)
+			positions.emplace_back(x * spacing, -(y * spacing), 0.0f);
+	clothMesh->BuildCollisionBound(positions.data(), (UINT32)positions.size(), (UINT32)sizeof(XMFLOAT3), CollisionType::AABB);
+
+	SetMesh(clothMesh.get());
+}
+
+void Cloth::SetPinned(const UINT32 x, const UINT32 y, const bool isPinned)
+{
+	if (x >= width || y >= height)
+		return;
+
+	this->isPinned[y * width + x] = isPinned;
+}
+
+void Cloth::PinTopEdge()
+{
+	for (UINT32 x = 0; x < width; ++x)
+		SetPinned(x, 0);
+}
+
+void Cloth::UpdateVertices(UploadBuffer<Vertex>* vb)
+{
+	const ClothData& data = clothData;
+	if (data.particleCount == 0)
+		return;
+
+	// 입자는 월드 공간에서 시뮬레이션되므로 객체의 지역 공간으로 되돌린다.
+	XMMATRIX world = GetWorld();
+	XMMATRIX invWorld = XMMatrixInverse(&XMMatrixDeterminant(world), world);
+
+	auto loadParticle = [&data](UINT32 x, UINT32 y) {
+		const UINT32 i = y * data.width + x;
+		return XMVectorSet(data.posX[i], data.posY[i], data.posZ[i], 1.0f); };
+
+	for (UINT32 y = 0; y < height; ++y)
+	{
+		for (UINT32 x = 0; x < width; ++x)
+		{
+			// 이웃한 입자의 차이로 탄젠트와 노멀을 구한다.
+			XMVECTOR tangent = loadParticle((std::min)(x + 1, width - 1), y) - loadParticle(x > 0 ? x - 1 : 0, y);
+			XMVECTOR down = loadParticle(x, (std::min)(y + 1, height - 1)) - loadParticle(x, y > 0 ? y - 1 : 0);
+
+			tangent = XMVector3Normalize(XMVector3TransformNormal(tangent, invWorld));
+			down = XMVector3TransformNormal(down, invWorld);
+			XMVECTOR normal = XMVector3Normalize(XMVector3Cross(tangent, down));
+			XMVECTOR binormal = XMVector3Cross(normal, tangent);
+			XMVECTOR pos = XMVector3TransformCoord(loadParticle(x, y), invWorld);
+
+			XMFLOAT2 tex((float)x / (width - 1), (float)y / (height - 1));
+			Vertex vertex(Vector3::XMVectorToFloat3(pos), Vector3::XMVectorToFloat3(normal),
+				Vector3::XMVectorToFloat3(tangent), Vector3::XMVectorToFloat3(binormal), tex);
+
+			vb->CopyData(y * width + x, vertex);
+		}
+	}
+
+	clothMesh->SetDynamicVertexBuffer(vb->GetResource(), data.particleCount, (UINT32)sizeof(Vertex));
+}
+
+void Cloth::UpdateBounds()
+{
+	collisionBounding = clothData.bounds;
+}
+
+ClothData& Cloth::GetClothData()
+{
+	return clothData;
+}
+
+UINT32 Cloth::GetVertexCount() const
+{
+	return width * height;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "GameObject.h"
+#include "../Framework/ClothSolver.h"
+#include "../Framework/ObjectPool.hpp"
+
+class Mesh;
+template<typename T> class UploadBuffer;
+struct Vertex;
+
+/*
+ClothSolver로 시뮬레이션되는 격자 형태의 천
+깃발이나 현수막처럼 일부 입자를 고정하여 사용하며, 고정된 입자는 객체를 따라 움직인다.
+인덱스 버퍼는 한 번만 생성하고, 정점은 매 프레임 CPU에서 만들어 동적 정점 버퍼에 쓴다.
+*/
+class Cloth : public GameObject
+{
+public:
+	Cloth(std::string&& name, const UINT32 width, const UINT32 height, const float spacing);
+	virtual ~Cloth();
+
+public:
+	// 객체의 현재 월드 행렬로 입자들과 제약 조건을 생성한다.
+	virtual void BeginPlay() override;
+	virtual void CalculateWorld() override;
+
+public:
+	// 천 전용 메쉬(인덱스 버퍼)를 생성한다.
+	void BuildClothMesh(ID3D12Device* device, ID3D12GraphicsCommandList* commandList);
+
+	// 격자의 (x, y) 입자를 고정한다. BeginPlay 이전에 불려져야 한다.
+	void SetPinned(const UINT32 x, const UINT32 y, const bool isPinned = true);
+	// 격자의 윗변을 모두 고정한다.
+	void PinTopEdge();
+
+	// 시뮬레이션된 입자로 위치, 노멀, 탄젠트를 계산하여 동적 정점 버퍼에 쓴다.
+	// 정점은 객체의 지역 공간으로 변환되어 기존 렌더링 경로를 그대로 사용한다.
+	void UpdateVertices(UploadBuffer<Vertex>* vb);
+	// 시뮬레이션이 끝난 후 충돌 바운드를 입자들의 AABB로 갱신한다.
+	void UpdateBounds();
+
+	ClothData& GetClothData();
+	UINT32 GetVertexCount() const;
+
+public:
+	// 중력 외에 천에 가해지는 가속도이다.
+	XMFLOAT3 wind = { 0.0f, 0.0f, 0.0f };
+	// 매 스텝마다 속도를 줄여준다.
+	float damping = 0.99f;
+	// 충돌체 표면으로부터 유지할 두께이다.
+	float thickness = 0.05f;
+
+	// [0, 1] 사이의 강성으로 1에 가까울수록 늘어나거나 굽혀지지 않는다.
+	float stretchStiffness = 1.0f;
+	float bendStiffness = 0.3f;
+	UINT32 iterations = 4;
+
+private:
+	PoolPtr<Mesh> clothMesh = nullptr;
+	ClothData clothData;
+
+	UINT32 width = 0;
+	UINT32 height = 0;
+	float spacing = 0.0f;
+	std::vector<bool> isPinned;
+};
@@ -3,6 +3,8 @@
 #include "../Component/Mesh.h"
 #include "../Framework/Physics.h"
 #include "../Framework/D3DInfo.h"
+#include "../Framework/TransformStore.h"
+#include "../Framework/DrawList.h"
 
 GameObject::GameObject(std::string&& name) : Object(std::move(name)) { }
 
@@ -10,6 +12,10 @@ GameObject::~GameObject() { }
 
 void GameObject::BeginPlay()
 {
+	// 메쉬의 충돌 바운드가 SetMesh 이후에 바뀌었을 수 있으므로 다시 설정한다.
+	if (mesh)
+		TransformStore::GetInstance()->SetLocalBounds(transformIndex, mesh->GetCollisionType(), mesh->GetCollisionBounding());
+
 	CalculateWorld();
 }
 
@@ -17,46 +23,35 @@ void GameObject::CalculateWorld()
 {
 	__super::CalculateWorld();
 
-	switch (GetMeshCollisionType())
+	// 충돌 바운드는 TransformStore에서 월드 행렬과 함께 변환된다.
+	const TransformStore::Bounds& bounds = TransformStore::GetInstance()->GetWorldBounds(transformIndex);
+	switch (bounds.type)
 	{
 		case CollisionType::AABB:
-		{
-			const BoundingBox& aabb = std::any_cast<BoundingBox>(mesh->GetCollisionBounding());
-			BoundingBox outAABB;
-			aabb.Transform(outAABB, GetWorld());
-			collisionBounding = std::move(outAABB);
+			collisionBounding = bounds.aabb;
 			break;
-		}
 		case CollisionType::OBB:
-		{
-			const BoundingOrientedBox& obb = std::any_cast<BoundingOrientedBox>(mesh->GetCollisionBounding());
-			BoundingOrientedBox outOBB;
-			obb.Transform(outOBB, GetWorld());
-			collisionBounding = std::move(outOBB);
+			collisionBounding = bounds.obb;
 			break;
-		}
 		case CollisionType::Sphere:
-		{
-			const BoundingSphere& sphere = std::any_cast<BoundingSphere>(mesh->GetCollisionBounding());
-			BoundingSphere outSphere;
-			sphere.Transform(outSphere, GetWorld());
-			collisionBounding = std::move(outSphere);
+			collisionBounding = bounds.sphere;
 			break;
-		}
 	}
 }
 
 void GameObject::Tick(float deltaTime)
 {
 	__super::Tick(deltaTime);
+}
 
+void GameObject::Integrate(float deltaTime)
+{
 	if (isPhysics)
 	{
 		AddForce(Vector3::Multiply(Physics::gravity, mass));
 
-		// Ģ  ġ  ӵ ƮѴ.
+		// 물리법칙에 따라 위치 및 속도를 업데이트한다.
 		PhysicsUpdate(deltaTime);
-		SetPosition(position);
 	}
 }
 
@@ -65,8 +60,10 @@ void GameObject::PhysicsUpdate(float deltaTime)
 	if (invMass <= FLT_EPSILON)
 		return;
 
+	XMFLOAT3 position = GetPosition();
+	XMFLOAT4 rotation = GetRotation();
 	XMVECTOR pos = XMLoadFloat3(&position);
-	XMVECTOR rot = XMLoadFloat3(&rotation);
+	XMVECTOR rot = XMLoadFloat4(&rotation);
 
 	XMVECTOR vel = XMLoadFloat3(&velocity);
 	XMVECTOR angVel = XMLoadFloat3(&angularVelocity);
@@ -77,31 +74,35 @@ void GameObject::PhysicsUpdate(float deltaTime)
 	XMVECTOR force = XMLoadFloat3(&forceAccum);
 	XMVECTOR torque = XMLoadFloat3(&torqueAccum);
 	
-	// ӵ  Ѵ.
+	// 가속도에 힘을 적용한다.
 	acc += force * invMass;
-	// ũ  ӵ Ѵ.
+	// 토크에 의해 각가속도를 계산한다.
 	angVel += XMVector3Transform(torque, XMLoadFloat4x4(&invInertiaTensor));
 
-	// ӵ ƮѴ.
+	// 속도를 업데이트한다.
 	vel += acc * deltaTime;
-	// ӵ ƮѴ.
+	// 각속도를 업데이트한다.
 	angVel += angAcc * deltaTime;
 
-	// 巡() Ѵ.
+	// 드래그(마찰저항)을 적용한다.
 	vel *= pow(linearDamping, deltaTime);
 	angVel *= pow(angularDamping, deltaTime);
 
-	// ġ ƮѴ.
+	// 위치를 업데이트한다.
 	pos += vel * deltaTime;
-	rot += angVel * deltaTime;
+	// 각속도로 사원수를 적분한다. q' = q + 0.5 * w * q * dt
+	XMVECTOR spin = XMQuaternionMultiply(rot, XMVectorSetW(angVel, 0.0f));
+	rot = XMQuaternionNormalize(rot + spin * (0.5f * deltaTime));
 
-	position = Vector3::XMVectorToFloat3(pos);
-	rotation = Vector3::XMVectorToFloat3(rot);
+	XMStoreFloat3(&position, pos);
+	XMStoreFloat4(&rotation, rot);
+	SetPosition(position);
+	SetRotation(rotation);
 
 	velocity = Vector3::XMVectorToFloat3(vel);
 	angularVelocity = Vector3::XMVectorToFloat3(angVel);
 
-	//  ӵ   ʱȭѴ.
+	// 한 프레임동안 누적한 힘을 초기화한다.
 	forceAccum = { 0.0f, 0.0f, 0.0f };
 	torqueAccum = { 0.0f, 0.0f, 0.0f };
 }
@@ -227,6 +228,47 @@ void GameObject::Render(ID3D12GraphicsCommandList* commandList, BoundingFrustum*
 	mesh->Render(commandList);
 }
 
+bool GameObject::BuildDrawRecord(DrawRecord& outRecord) const
+{
+	if (!isVisible || !mesh)
+		return false;
+
+	outRecord.mesh = mesh;
+	outRecord.material = material;
+	outRecord.cbIndex = cbIndex;
+	outRecord.transformIndex = transformIndex;
+	outRecord.cost = mesh->GetIndexCount() + DrawList::drawCallCost;
+	outRecord.isIndexed = true;
+	outRecord.isCullable = true;
+
+	// 프러스텀 컬링은 메쉬의 충돌 바운드를 감싸는 AABB로 수행한다.
+	switch (GetMeshCollisionType())
+	{
+		case CollisionType::AABB:
+			outRecord.bounds = std::any_cast<BoundingBox>(collisionBounding);
+			break;
+		case CollisionType::OBB:
+		{
+			const BoundingOrientedBox& obb = std::any_cast<BoundingOrientedBox>(collisionBounding);
+			XMFLOAT3 corners[BoundingOrientedBox::CORNER_COUNT];
+			obb.GetCorners(corners);
+			BoundingBox::CreateFromPoints(outRecord.bounds, BoundingOrientedBox::CORNER_COUNT, corners, sizeof(XMFLOAT3));
+			break;
+		}
+		case CollisionType::Sphere:
+			BoundingBox::CreateFromSphere(outRecord.bounds, std::any_cast<BoundingSphere>(collisionBounding));
+			break;
+		case CollisionType::Point:
+			outRecord.bounds = BoundingBox(GetWorldPosition(), XMFLOAT3(0.0f, 0.0f, 0.0f));
+			break;
+		default:
+			outRecord.isCullable = false;
+			break;
+	}
+
+	return true;
+}
+
 void GameObject::SetConstantBuffer(ID3D12GraphicsCommandList* cmdList, D3D12_GPU_VIRTUAL_ADDRESS startAddress) const
 {
 	D3D12_GPU_VIRTUAL_ADDRESS cbAddress = startAddress + cbIndex * ConstantsSize::objectCBByteSize;
@@ -305,19 +347,19 @@ void GameObject::SetInverseInertiaTensor()
 
 void GameObject::TransformInverseInertiaTensorToWorld()
 {
-	invInertiaTensor = Matrix4x4::Multiply(invInertiaTensor, world);
+	invInertiaTensor = Matrix4x4::Multiply(invInertiaTensor, GetWorld4x4f());
 }
 
 void GameObject::AddForceAtLocalPoint(const XMFLOAT3& force, const XMFLOAT3& point)
 {
-	XMFLOAT3 pt = Vector3::TransformNormal(point, XMLoadFloat4x4(&world));
+	XMFLOAT3 pt = Vector3::TransformNormal(point, GetWorld());
 
 	AddForceAtWorldPoint(force, pt);
 }
 
 void GameObject::AddForceAtWorldPoint(const XMFLOAT3& force, const XMFLOAT3& point)
 {
-	XMFLOAT3 pt = Vector3::Subtract(point, position);
+	XMFLOAT3 pt = Vector3::Subtract(point, GetPosition());
 	XMFLOAT3 addForce = Vector3::CrossProduct(pt, force);
 
 	forceAccum = Vector3::Add(forceAccum, addForce);
@@ -334,16 +376,66 @@ const std::any GameObject::GetCollisionBounding() const
 	return collisionBounding;
 }
 
+BoundingBox GameObject::GetCollisionAabb() const
+{
+	BoundingBox outAABB;
+
+	switch (collisionType)
+	{
+		case CollisionType::AABB:
+		{
+			outAABB = std::any_cast<BoundingBox>(collisionBounding);
+			break;
+		}
+		case CollisionType::OBB:
+		{
+			const BoundingOrientedBox& obb = std::any_cast<BoundingOrientedBox>(collisionBounding);
+			XMFLOAT3 corners[BoundingOrientedBox::CORNER_COUNT];
+			obb.GetCorners(corners);
+			BoundingBox::CreateFromPoints(outAABB, BoundingOrientedBox::CORNER_COUNT, corners, sizeof(XMFLOAT3));
+			break;
+		}
+		case CollisionType::Sphere:
+		{
+			const BoundingSphere& sphere = std::any_cast<BoundingSphere>(collisionBounding);
+			BoundingBox::CreateFromSphere(outAABB, sphere);
+			break;
+		}
+		default:
+		{
+			outAABB = BoundingBox(GetPosition(), XMFLOAT3(0.0f, 0.0f, 0.0f));
+			break;
+		}
+	}
+
+	return outAABB;
+}
+
 XMFLOAT3 GameObject::GetVelocity() const
 {
 	return velocity;
 }
 
+XMFLOAT3 GameObject::GetAngularVelocity() const
+{
+	return angularVelocity;
+}
+
 XMFLOAT3 GameObject::GetAcceleration() const
 {
 	return acceleration;
 }
 
+void GameObject::SetVelocity(const XMFLOAT3& velocity)
+{
+	this->velocity = velocity;
+}
+
+void GameObject::SetAngularVelocity(const XMFLOAT3& angularVelocity)
+{
+	this->angularVelocity = angularVelocity;
+}
+
 float GameObject::GetMass() const
 {
 	return mass;
@@ -357,6 +449,12 @@ float GameObject::GetInvMass() const
 void GameObject::SetMesh(Mesh* mesh)
 {
 	this->mesh = mesh;
+
+	if (mesh)
+		TransformStore::GetInstance()->SetLocalBounds(transformIndex, mesh->GetCollisionType(), mesh->GetCollisionBounding());
+	else
+		TransformStore::GetInstance()->SetLocalBounds(transformIndex, CollisionType::None, nullptr);
+	isWorldUpdate = true;
 }
 
 Mesh* GameObject::GetMesh() const
@@ -372,4 +470,9 @@ void GameObject::SetMaterial(Material* material)
 Material* GameObject::GetMaterial() const
 {
 	return material;
-}
\ No newline at end of file
+}
+
+ObjectHandle GameObject::GetHandle() const
+{
+	return handle;
+}
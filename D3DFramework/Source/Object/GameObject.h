@@ -2,14 +2,16 @@
 
 #include "Object.h."
 #include "../Framework/Renderable.h"
+#include "../Framework/ObjectTable.h"
 #include <optional>
 #include <any>
 
 class Mesh;
 class Material;
+struct DrawRecord;
 
 /*
-پ ޽ ׸ų  ϴ Ŭ
+다양한 메쉬를 그리거나 물리를 수행하는 클래스
 */
 class GameObject : public Object, public Renderable
 {
@@ -21,34 +23,42 @@ public:
 	virtual void BeginPlay() override;
 	virtual void Tick(float deltaTime) override;
 
-	//  Ӹ ü ȭߴ  üũϰ   Ѵ. 
+	// 매 프레임마다 객체가 변화했는 지 체크하고 월드 행렬을 계산한다. 
 	virtual void CalculateWorld() override;
 
 	virtual void Render(ID3D12GraphicsCommandList* cmdList, BoundingFrustum* frustum = nullptr) const override;
 	virtual void SetConstantBuffer(ID3D12GraphicsCommandList* cmdList, D3D12_GPU_VIRTUAL_ADDRESS startAddress) const override;
 
 public:
-	//  ޽ ҿ ԵǾ ִ ȮѴ.
+	// 현재 메쉬가 프러스텀에 포함되어 있는지 확인한다.
 	bool IsInFrustum(BoundingFrustum* frustum) const;
 
-	//  ־ ӵ ȭŲ.
+	// 렌더 레이어의 DrawList에 들어갈 레코드를 채운다. 그릴 것이 없다면 false를 반환한다.
+	// Render를 오버라이딩한 객체는 이 함수도 같은 방식으로 그리도록 오버라이딩한다.
+	virtual bool BuildDrawRecord(DrawRecord& outRecord) const;
+
+	// 중력과 누적된 힘을 적용하여 위치 및 속도를 적분한다.
+	// 물리 스텝에서 불리며, 물리가 꺼져 있다면 아무것도 하지 않는다.
+	void Integrate(float deltaTime);
+
+	// 힘을 주어 가속도를 변화시킨다.
 	void AddForce(const DirectX::XMFLOAT3& force);
 	void AddForce(const float forceX, const float forceY, const float forceZ);
 	void AddForceAtLocalPoint(const XMFLOAT3& force, const XMFLOAT3& point);
 	void AddForceAtWorldPoint(const XMFLOAT3& force, const XMFLOAT3& point);
 
-	//  ־ ӵ ȭŲ.
+	// 충격을 주어 속도를 변화시킨다.
 	void Impulse(const XMFLOAT3& impulse);
 	void Impulse(const float impulseX, const float impulseY, const float impulseZ);
 
 	void SetMass(const float mass);
 	void SetCollisionEnabled(const bool value);
 
-	//   ټ Ѵ.  ټ ϱ ؼ
-	//   浹 Ÿ  Ǿ ־ Ѵ.
+	// 역 관성 텐서를 적용한다. 관성 텐서를 계산하기 위해선
+	// 질량 및 충돌 타입이 먼저 설정되어 있어야 한다.
 	void SetInverseInertiaTensor();
 
-	//   ټ   ȯѴ.
+	// 역 관성 텐서를 세계 공간으로 변환한다.
 	void TransformInverseInertiaTensorToWorld();
 
 	CollisionType GetMeshCollisionType() const;
@@ -56,10 +66,16 @@ public:
 
 	CollisionType GetCollisionType() const;
 	const std::any GetCollisionBounding() const;
+	// 충돌 바운딩을 감싸는 월드 공간의 AABB를 반환한다.
+	BoundingBox GetCollisionAabb() const;
 
 	XMFLOAT3 GetVelocity() const;
+	XMFLOAT3 GetAngularVelocity() const;
 	XMFLOAT3 GetAcceleration() const;
 
+	void SetVelocity(const XMFLOAT3& velocity);
+	void SetAngularVelocity(const XMFLOAT3& angularVelocity);
+
 	float GetMass() const;
 	float GetInvMass() const;
 
@@ -69,8 +85,11 @@ public:
 	void SetMaterial(Material* material);
 	Material* GetMaterial() const;
 
+	// 이 객체를 소유한 ObjectTable에서의 핸들을 반환한다.
+	ObjectHandle GetHandle() const;
+
 protected:
-	//  Ʈ Ѵ.
+	// 물리 업데이트를 수행한다.
 	void PhysicsUpdate(float deltaTime);
 
 public:
@@ -79,39 +98,47 @@ public:
 	bool isVisible = true;
 	bool isPhysics = false;
 
-	//  Ʈ   ӵ Ϻκ ٿش.
+	// 움직이지 않는 객체라면 true로 설정한다. 정적 객체는 Broadphase의
+	// 정적 트리에 들어가며, 정적 객체끼리는 충돌 검사를 하지 않는다.
+	bool isStatic = false;
+
+	// 물리 업데이트를 할 때마다 속도의 일부분을 줄여준다.
 	float linearDamping = 0.9f;
 	float angularDamping = 0.9f;
 
-	// ٸ ü 浹  иӵ ϴ ݹ 
-	// [0, 1] ̷ 1   ƨ, 0  ƨ ʴ´.
+	// 다른 물체가 충돌 후 분리속도를 결정하는 반발 계수
+	// [0, 1] 사이로 1에 가까울수록 잘 튕기고, 0에 가까울수록 튕기지 않는다.
 	float restitution = 1.0f;
 
 protected:
 	std::any collisionBounding = nullptr;
 
-	//  ټ Ͽ ü ȸ   ִ.
+	// 역관성 텐서를 사용하여 물체의 회전을 계산할 수 있다.
 	XMFLOAT4X4 invInertiaTensor = Matrix4x4::Identity();
 	
-	// ü ӵ̴.
+	// 물체의 속도이다.
 	XMFLOAT3 velocity = { 0.0f, 0.0f, 0.0f };
 	XMFLOAT3 angularVelocity = { 0.0f, 0.0f, 0.0f };
 
-	// ü ӵ̴.
+	// 물체의 가속도이다.
 	XMFLOAT3 acceleration = { 0.0f, 0.0f, 0.0f };
 	XMFLOAT3 angularAcceleration = { 0.0f, 0.0f, 0.0f };
 
-	// ü   ̴. ޶   
-	//  Ͽ ѹ     ִ.
+	// 물체가 가해지는 힘의 누적이다. 달랑베르의 원리에 따라 
+	// 힘을 누적하여 한번에 물리 계산을 수행할 수 있다.
 	XMFLOAT3 forceAccum = { 0.0f, 0.0f, 0.0f };
 	XMFLOAT3 torqueAccum = { 0.0f, 0.0f, 0.0f };
 
-	//  Ʈ     ȴ.
-	// , Ѵ  Ÿ  ִ.
+	// 물리 업데이트에선 질량의 역수를 취한 값이 사용된다.
+	// 또한, 무한대의 질량을 나타낼 수 있다.
 	float invMass = 0.0f;
 	float mass = 0.0f;
 
 private:
+	friend class ObjectTable;
+	friend class WorldSnapshot;
+
 	Mesh* mesh = nullptr;
 	Material* material = nullptr;
+	ObjectHandle handle;
 };
\ No newline at end of file
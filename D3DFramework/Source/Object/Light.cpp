@@ -9,7 +9,7 @@ Light::~Light() { }
 
 void Light::SetLightData(LightData& lightData)
 {
-	lightData.position = position;
+	lightData.position = GetWorldPosition();
 	lightData.direction = GetLook();
 	lightData.strength = strength;
 	lightData.falloffStart = falloffStart;
@@ -19,9 +19,9 @@ void Light::SetLightData(LightData& lightData)
 	lightData.enabled = enabled;
 }
 
-void Light::RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList)
+void Light::RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList, const VisibleSet& visibleSet)
 {
-	shadowMap->RenderSceneToShadowMap(cmdList, &lightFrustum);
+	shadowMap->RenderSceneToShadowMap(cmdList, visibleSet);
 }
 
 ShadowMap* Light::GetShadowMap()
@@ -29,6 +29,11 @@ ShadowMap* Light::GetShadowMap()
 	return shadowMap.get();
 }
 
+const BoundingFrustum& Light::GetFrustum() const
+{
+	return lightFrustum;
+}
+
 XMMATRIX Light::GetView() const
 {
 	return XMLoadFloat4x4(&view);
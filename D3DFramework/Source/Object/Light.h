@@ -3,12 +3,13 @@
 #include "Object.h"
 
 class ShadowMap;
+class VisibleSet;
 
 #define SHADOW_MAP_SIZE 1024
 
 /*
- Ӽ ϴ ⺻ Ŭ
-3    Ŭ  ޴´.
+빛의 속성을 정의하는 기본 클래스
+3가지 종류의 빛은 이 클래스를 상속 받는다.
 */
 class Light : public Object
 {
@@ -17,31 +18,32 @@ public:
 	virtual ~Light();
 
 public:
-	// Light ŸԿ  LightConstants ä   ٸ.
-	//  Լ overrideϿ ŸԿ ´ ͸ ä־ش.
+	// Light의 타입에 따라 LightConstants에 채워야 할 정보는 다르다.
+	// 이 함수를 override하여 타입에 맞는 데이터를 채워넣어준다.
 	virtual void SetLightData(LightData& lightData);
 
 public:
-	//   ׸.
-	void RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList);
+	// 컬링 단계에서 이 라이트의 프러스텀으로 만든 visibleSet으로 쉐도우 맵을 그린다.
+	void RenderSceneToShadowMap(ID3D12GraphicsCommandList* cmdList, const VisibleSet& visibleSet);
 	ShadowMap* GetShadowMap();
+	const BoundingFrustum& GetFrustum() const;
 
 	XMMATRIX GetView() const;
 	XMMATRIX GetProj() const;
 
 public:
-	// ̴ ϱ  Ʈ Ӽ
+	// 쉐이더에서 사용하기 위한 라이트 속성들
 	XMFLOAT3 strength = { 0.5f, 0.5f, 0.5f };
 	float falloffStart = 1.0f;
 	float falloffEnd = 10.0f;
 	float spotAngle = 1.0f;
 	bool enabled = true;
 
-	//  ʿ   ũ
+	// 쉐도우 맵에서 투영 행렬의 크기
 	XMFLOAT2 shadowMapSize = { 50.0f, 50.0f };
 
 protected:
-	// NDC  [-1, 1]^2 ؽó  [0, 1]^2 ȯϴ 
+	// NDC 공간 [-1, 1]^2을 텍스처 공간 [0, 1]^2으로 변환하는 행렬
 	static inline const XMMATRIX toTextureTransform =
 		XMMATRIX(
 		0.5f, 0.0f, 0.0f, 0.0f,
@@ -49,12 +51,12 @@ protected:
 		0.0f, 0.0f, 1.0f, 0.0f,
 		0.5f, 0.5f, 0.0f, 1.0f);
 
-	// Ʈ   
+	// 라이트 고유의 쉐도우 맵
 	std::unique_ptr<ShadowMap> shadowMap = nullptr;
-	//   ׸  ü  øϱ  
+	// 쉐도우 맵을 그리기 위해 객체를 프러스텀 컬링하기 위해 사용
 	BoundingFrustum lightFrustum;
 
-	// Ʈ   İ  .  ʿ 
+	// 라이트 시점에서의 뷰 행렬과 투영 행렬. 쉐도우 맵에 사용
 	XMFLOAT4X4 view = Matrix4x4::Identity();
 	XMFLOAT4X4 proj = Matrix4x4::Identity();
 
@@ -1,9 +1,16 @@
 #include "../PrecompiledHeader/pch.h"
 #include "Object.h"
+#include "../Framework/TransformStore.h"
 
-Object::Object(std::string&& name) : Component(std::move(name)) { }
+Object::Object(std::string&& name) : Component(std::move(name))
+{
+	transformIndex = TransformStore::GetInstance()->Allocate();
+}
 
-Object::~Object() { }
+Object::~Object()
+{
+	TransformStore::GetInstance()->Release(transformIndex);
+}
 
 void Object::Destroy()
 {
@@ -12,11 +19,14 @@ void Object::Destroy()
 
 void Object::Tick(float deltaTime)
 {
-	if (isWorldUpdate)
+	// 자신이 움직이지 않았더라도 부모가 움직였다면 월드 행렬이 바뀌었으므로 갱신한다.
+	TransformStore* store = TransformStore::GetInstance();
+	if (isWorldUpdate || store->ConsumeWorldChanged(transformIndex))
 	{
 		CalculateWorld();
 		UpdateNumFrames();
 
+		store->ConsumeWorldChanged(transformIndex);
 		isWorldUpdate = false;
 	}
 }
@@ -24,26 +34,41 @@ void Object::Tick(float deltaTime)
 
 XMMATRIX Object::GetWorld() const
 {
-	XMMATRIX matWorld = XMLoadFloat4x4(&world);
+	XMMATRIX matWorld = XMLoadFloat4x4(&TransformStore::GetInstance()->GetWorld(transformIndex));
 	return matWorld;
 }
 
 XMMATRIX Object::GetWorldWithoutScailing() const
 {
-	XMMATRIX matWorld = XMLoadFloat4x4(&worldNoScailing);
+	XMMATRIX matWorld = XMLoadFloat4x4(&TransformStore::GetInstance()->GetWorldWithoutScailing(transformIndex));
 	return matWorld;
 }
 
 XMVECTOR Object::GetAxis(const INT32 index) const
 {
-	XMMATRIX matWorld = XMLoadFloat4x4(&worldNoScailing);
+	XMMATRIX matWorld = GetWorldWithoutScailing();
 	return matWorld.r[index];
 }
 
+bool Object::SetParent(Object* parent)
+{
+	const UINT32 parentIndex = parent ? parent->GetTransformIndex() : TransformStore::invalidIndex;
+	if (!TransformStore::GetInstance()->SetParent(transformIndex, parentIndex))
+		return false;
+
+	isWorldUpdate = true;
+	return true;
+}
+
+bool Object::HasParent() const
+{
+	return TransformStore::GetInstance()->GetParent(transformIndex) != TransformStore::invalidIndex;
+}
+
 XMFLOAT3 Object::TransformWorldToLocal(const XMFLOAT3& pos) const
 {
 	XMVECTOR position = XMLoadFloat3(&pos);
-	XMMATRIX world = XMLoadFloat4x4(&worldNoScailing);
+	XMMATRIX world = GetWorldWithoutScailing();
 	position = XMVector3Transform(position, XMMatrixInverse(&XMMatrixDeterminant(world), world));
 
 	return Vector3::XMVectorToFloat3(position);
@@ -52,7 +77,7 @@ XMFLOAT3 Object::TransformWorldToLocal(const XMFLOAT3& pos) const
 XMFLOAT3 Object::TransformLocalToWorld(const XMFLOAT3& pos) const
 {
 	XMVECTOR position = XMLoadFloat3(&pos);
-	XMMATRIX world = XMLoadFloat4x4(&worldNoScailing);
+	XMMATRIX world = GetWorldWithoutScailing();
 	position = XMVector3Transform(position, world);
 
 	return 	Vector3::XMVectorToFloat3(position);
@@ -60,6 +85,7 @@ XMFLOAT3 Object::TransformLocalToWorld(const XMFLOAT3& pos) const
 
 XMFLOAT3 Object::GetRight() const
 {
+	const XMFLOAT4X4& world = TransformStore::GetInstance()->GetWorld(transformIndex);
 	XMFLOAT3 right(world._11, world._12, world._13);
 	XMVECTOR vecRight = XMLoadFloat3(&right);
 	vecRight = XMVector3Normalize(vecRight);
@@ -69,6 +95,7 @@ XMFLOAT3 Object::GetRight() const
 
 XMFLOAT3 Object::GetUp() const
 {
+	const XMFLOAT4X4& world = TransformStore::GetInstance()->GetWorld(transformIndex);
 	XMFLOAT3 up(world._21, world._22, world._23);
 	XMVECTOR vecUp = XMLoadFloat3(&up);
 	vecUp = XMVector3Normalize(vecUp);
@@ -78,6 +105,7 @@ XMFLOAT3 Object::GetUp() const
 
 XMFLOAT3 Object::GetLook() const
 {
+	const XMFLOAT4X4& world = TransformStore::GetInstance()->GetWorld(transformIndex);
 	XMFLOAT3 look(world._31, world._32, world._33);
 	XMVECTOR vecLook = XMLoadFloat3(&look);
 	vecLook = XMVector3Normalize(vecLook);
@@ -87,60 +115,51 @@ XMFLOAT3 Object::GetLook() const
 
 void Object::SetPosition(float posX, float posY, float posZ)
 {
-	position.x = posX;
-	position.y = posY;
-	position.z = posZ;
-
-	isWorldUpdate = true;
+	SetPosition(XMFLOAT3(posX, posY, posZ));
 }
 
 void Object::SetPosition(const XMFLOAT3& pos)
 {
-	position = pos;
+	TransformStore::GetInstance()->SetPosition(transformIndex, pos);
 
 	isWorldUpdate = true;
 }
 
 void Object::SetRotation(float rotX, float rotY, float rotZ)
 {
-	rotation.x = rotX;
-	rotation.y = rotY;
-	rotation.z = rotZ;
-
-	isWorldUpdate = true;
+	XMFLOAT4 quaternion;
+	XMStoreFloat4(&quaternion, XMQuaternionRotationRollPitchYaw(rotX, rotY, rotZ));
+	SetRotation(quaternion);
 }
 
 
 void Object::SetRotation(const XMFLOAT3& rot)
 {
-	rotation = rot;
+	SetRotation(rot.x, rot.y, rot.z);
+}
+
+void Object::SetRotation(const XMFLOAT4& quaternion)
+{
+	TransformStore::GetInstance()->SetRotation(transformIndex, quaternion);
 
 	isWorldUpdate = true;
 }
 
 void Object::SetScale(float scaleX, float scaleY, float scaleZ)
 {
-	scale.x = scaleX;
-	scale.y = scaleY;
-	scale.z = scaleZ;
-
-	isWorldUpdate = true;
+	SetScale(XMFLOAT3(scaleX, scaleY, scaleZ));
 }
 
 void Object::SetScale(const XMFLOAT3& scale)
 {
-	this->scale = scale;
+	TransformStore::GetInstance()->SetScale(transformIndex, scale);
 
 	isWorldUpdate = true;
 }
 
 void Object::Move(float x, float y, float z)
 {
-	position.x += x;
-	position.y += y;
-	position.z += z;
-
-	isWorldUpdate = true;
+	SetPosition(Vector3::Add(GetPosition(), XMFLOAT3(x, y, z)));
 }
 
 void Object::Move(const XMFLOAT3& distance)
@@ -151,70 +170,72 @@ void Object::Move(const XMFLOAT3& distance)
 void Object::MoveStrafe(float distance)
 {
 	XMFLOAT3 dir = Vector3::Multiply(GetRight(), distance);
-	position = Vector3::Add(position, dir);
-
-	isWorldUpdate = true;
+	SetPosition(Vector3::Add(GetPosition(), dir));
 }
 
 void Object::MoveUp(float distance) 
 {
 	XMFLOAT3 dir = Vector3::Multiply(GetUp(), distance);
-	position = Vector3::Add(position, dir);
-
-	isWorldUpdate = true;
+	SetPosition(Vector3::Add(GetPosition(), dir));
 }
 
 void Object::MoveForward(float distance) 
 {
 	XMFLOAT3 dir = Vector3::Multiply(GetLook(), distance);
-	position = Vector3::Add(position, dir);
-
-	isWorldUpdate = true;
+	SetPosition(Vector3::Add(GetPosition(), dir));
 }
 
 void Object::Rotate(float pitch, float yaw, float roll)
 {
-	rotation.x += XMConvertToRadians(pitch);
-	rotation.y += XMConvertToRadians(yaw);
-	rotation.z += XMConvertToRadians(roll);
+	// 물체의 지역 축을 기준으로 회전을 덧붙인다.
+	XMVECTOR delta = XMQuaternionRotationRollPitchYaw(
+		XMConvertToRadians(pitch), XMConvertToRadians(yaw), XMConvertToRadians(roll));
+	XMFLOAT4 rotation = GetRotation();
+	XMVECTOR quaternion = XMQuaternionNormalize(XMQuaternionMultiply(delta, XMLoadFloat4(&rotation)));
 
-	isWorldUpdate = true;
+	XMStoreFloat4(&rotation, quaternion);
+	SetRotation(rotation);
 }
 
 void Object::CalculateWorld()
 {
-	XMMATRIX translation = XMMatrixTranslation(position.x, position.y, position.z);
-	XMMATRIX rotation = XMMatrixRotationRollPitchYaw(this->rotation.x, this->rotation.y, this->rotation.z);
-	XMMATRIX scailing = XMMatrixScaling(scale.x, scale.y, scale.z);
-
-	// S * R * T Ͽ world Ѵ.
-	XMMATRIX world = scailing * (rotation * translation);
-	this->world = Matrix4x4::XMMatrixToFloat4X4(world);
-
-	XMMATRIX worldNoScailing = rotation * translation;
-	this->worldNoScailing = Matrix4x4::XMMatrixToFloat4X4(worldNoScailing);
+	// 월드 행렬은 보통 TransformStore::UpdateWorlds에서 일괄 계산된다.
+	// 그 이후에 트랜스폼이 바뀌었다면 여기서 이 물체만 다시 계산한다.
+	// 부모가 있는 물체는 다음 UpdateWorlds에서 계산되고, 바뀐 월드 행렬은 다음 Tick에서 반영된다.
+	TransformStore::GetInstance()->UpdateWorld(transformIndex);
 }
 
 XMFLOAT4X4 Object::GetWorld4x4f() const
 {
-	return world; 
+	return TransformStore::GetInstance()->GetWorld(transformIndex);
 }
 XMFLOAT4X4 Object::GetWorldWithoutScailing4x4f() const 
 {
-	return worldNoScailing; 
+	return TransformStore::GetInstance()->GetWorldWithoutScailing(transformIndex);
 }
 
 XMFLOAT3 Object::GetPosition() const
 {
-	return position; 
+	return TransformStore::GetInstance()->GetPosition(transformIndex);
 }
-XMFLOAT3 Object::GetRotation() const 
+XMFLOAT3 Object::GetWorldPosition() const
 {
-	return rotation; 
+	const XMFLOAT4X4& world = TransformStore::GetInstance()->GetWorld(transformIndex);
+	return XMFLOAT3(world._41, world._42, world._43);
+}
+
+XMFLOAT4 Object::GetRotation() const 
+{
+	return TransformStore::GetInstance()->GetRotation(transformIndex);
 }
 XMFLOAT3 Object::GetScale() const 
 {
-	return scale; 
+	return TransformStore::GetInstance()->GetScale(transformIndex);
+}
+
+UINT32 Object::GetTransformIndex() const
+{
+	return transformIndex;
 }
 
 bool Object::GetIsDestroyesd() const 
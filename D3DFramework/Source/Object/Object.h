@@ -3,7 +3,10 @@
 #include "../Component/Component.h"
 
 /*
- 󿡼   ִ ü
+공간 상에서 움직일 수 있는 물체
+트랜스폼은 TransformStore에 저장되며, 물체는 저장소의 인덱스만을 가진다.
+부모가 있는 물체의 위치, 회전, 크기는 부모에 대한 상대값이며,
+부모가 움직이면 자식의 월드 행렬도 함께 다시 계산된다.
 */
 class Object : public Component
 {
@@ -15,7 +18,7 @@ public:
 	virtual void Tick(float deltaTime) override;
 	virtual void Destroy() override;
 
-	// ü  , Ʈ ؾ  ̵Ͽ ۼѴ.
+	// 물체가 움직일 때, 업데이트 해야할 것을 오버라이딩하여 작성한다.
 	virtual void CalculateWorld();
 
 public:
@@ -26,20 +29,28 @@ public:
 	void MoveForward(const float distance);
 	void Rotate(const float pitch, const float yaw, const float roll);
 
-	// ü  x- ͸ ȯѴ.
+	//게임 객체의 로컬 x-축 벡터를 반환한다.
 	XMFLOAT3 GetLook() const;
-	// ü  y- ͸ ȯѴ. 
+	//게임 객체의 로컬 y-축 벡터를 반환한다. 
 	XMFLOAT3 GetUp() const;
-	// ü  z- ͸ ȯѴ.
+	//게임 객체의 로컬 z-축 벡터를 반환한다.
 	XMFLOAT3 GetRight() const;
 
 	void SetPosition(const float posX, const float posY, const float posZ);
 	void SetPosition(const XMFLOAT3& pos);
+	// 오일러 각(pitch, yaw, roll)으로 회전을 설정한다. 내부적으로는 사원수로 저장된다.
 	void SetRotation(const float rotX, const float rotY, const float rotZ);
 	void SetRotation(const XMFLOAT3& rotation);
+	void SetRotation(const XMFLOAT4& quaternion);
 	void SetScale(const float scaleX, const float scaleY, const float scaleZ);
 	void SetScale(const XMFLOAT3& scale);
 
+	// 부모 물체를 설정한다. 이후 트랜스폼은 부모에 대한 상대값으로 해석된다.
+	// nullptr이면 부모에서 분리된다. 순환이 생긴다면 false를 반환한다.
+	// 부모가 먼저 소멸되면 자식은 최상위 물체가 된다.
+	bool SetParent(Object* parent);
+	bool HasParent() const;
+
 	XMFLOAT3 TransformWorldToLocal(const XMFLOAT3& pos) const;
 	XMFLOAT3 TransformLocalToWorld(const XMFLOAT3& pos) const;
 
@@ -50,26 +61,25 @@ public:
 	XMFLOAT4X4 GetWorld4x4f() const;
 	XMFLOAT4X4 GetWorldWithoutScailing4x4f() const;
 
+	// 부모에 대한 상대 위치를 반환한다. 부모가 없다면 월드 위치와 같다.
 	XMFLOAT3 GetPosition() const;
-	XMFLOAT3 GetRotation() const;
+	XMFLOAT3 GetWorldPosition() const;
+	// 회전을 사원수로 반환한다.
+	XMFLOAT4 GetRotation() const;
 	XMFLOAT3 GetScale() const;
 
+	UINT32 GetTransformIndex() const;
+
 	bool GetIsDestroyesd() const;
 
-	// Ʈ   θ ˾Ƴ.
-	// , TickԼ Ҹ  ҷ ȿϴ.
+	// 오브젝트가 실질적으로 움직였는지 여부를 알아낸다.
+	// 단, Tick함수가 불리기 이전에 불러야 유효하다.
 	bool GetIsWorldUpdate() const;
 
 protected:
-	//    ü   ϴ  
-	//     ȿ ü ġ, , ũ⸦ Ѵ.
-	// ϳ    , Scale * Rotation * Translation  ȴ.
-	XMFLOAT4X4 world = Matrix4x4::Identity();
-	XMFLOAT4X4 worldNoScailing = Matrix4x4::Identity();
-
-	XMFLOAT3 position = { 0.0f, 0.0f, 0.0f };
-	XMFLOAT3 rotation = { 0.0f, 0.0f, 0.0f };
-	XMFLOAT3 scale = { 1.0f, 1.0f, 1.0f };
+	// TransformStore에서 이 물체의 위치, 회전, 크기와 세계 행렬을 가리키는 인덱스
+	// 세계 행렬은 Scale * Rotation * Translation 순서로 조합된다.
+	UINT32 transformIndex = 0;
 
 	bool isWorldUpdate = true;
 	bool isDestroyed = false;
@@ -31,18 +31,18 @@ void Particle::CreateBuffers(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HANDLE
 	CD3DX12_CPU_DESCRIPTOR_HANDLE bufferCpuUav = hCpuSrv.Offset(1, DescriptorSize::cbvSrvUavDescriptorSize);
 	CD3DX12_CPU_DESCRIPTOR_HANDLE counterCpuUav = hCpuSrv.Offset(1, DescriptorSize::cbvSrvUavDescriptorSize);
 
-	// ƼŬ ͸   ũ⸦ Ѵ.
+	// 파티클 데이터를 담을 버퍼의 크기를 계산한다.
 	const UINT32 particleByteSize = maxParticleNum * sizeof(ParticleData);
-	// 0° ʹ Ȱȭ ƼŬ , 1° ʹ   ƼŬ ε̴.
+	// 0번째 데이터는 활성화된 파티클의 수, 1번째 데이터는 현재 생성할 파티클 인덱스이다.
 	const UINT32 counterByteSize = 2 * sizeof(UINT32);
 
-	// ۸  , UAV  ҽ Flag ϴ Ϳ Ѵ.
+	// 버퍼를 생성할 때, UAV로 묶을 리소스는 Flag를 설정하는 것에 주의한다.
 	D3D12_HEAP_PROPERTIES defaultHeapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT);
 	D3D12_HEAP_PROPERTIES uploadHeapProperties = CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_UPLOAD);
 	D3D12_RESOURCE_DESC bufferDesc = CD3DX12_RESOURCE_DESC::Buffer(particleByteSize, D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS);
 	D3D12_RESOURCE_DESC uploadBufferDesc = CD3DX12_RESOURCE_DESC::Buffer(particleByteSize);
 
-	// ƼŬ  ۸ Ѵ.
+	// 파티클 데이터 버퍼를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&defaultHeapProperties,
 		D3D12_HEAP_FLAG_NONE,
@@ -51,7 +51,7 @@ void Particle::CreateBuffers(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HANDLE
 		nullptr,
 		IID_PPV_ARGS(&particleBuffer)));
 
-	//  ī ۸ Ѵ.
+	// 버퍼 카운터 버퍼를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&defaultHeapProperties,
 		D3D12_HEAP_FLAG_NONE,
@@ -60,7 +60,7 @@ void Particle::CreateBuffers(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HANDLE
 		nullptr,
 		IID_PPV_ARGS(&bufferCounter)));
 
-	//  ī͸   ۸ Ѵ.
+	// 버퍼 카운터를 읽을 리드백 버퍼를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_READBACK),
 		D3D12_HEAP_FLAG_NONE,
@@ -70,7 +70,7 @@ void Particle::CreateBuffers(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HANDLE
 		IID_PPV_ARGS(&readBackCounter)));
 
 #ifdef BUFFER_COPY
-	// ƼŬ  ۸   ۸ Ѵ.
+	// 파티클 데이터 버퍼를 읽을 리드백 버퍼를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_READBACK),
 		D3D12_HEAP_FLAG_NONE,
@@ -80,7 +80,7 @@ void Particle::CreateBuffers(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HANDLE
 		IID_PPV_ARGS(&mReadBackBuffer)));
 #endif
 
-	// ƼŬ  ۿ  SRV  並 Ѵ.
+	// 파티클 데이터 버퍼에 대한 SRV 서술자 뷰를 생성한다.
 	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 	srvDesc.Format = DXGI_FORMAT_UNKNOWN;
@@ -91,7 +91,7 @@ void Particle::CreateBuffers(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HANDLE
 	srvDesc.Buffer.Flags = D3D12_BUFFER_SRV_FLAG_NONE;
 	device->CreateShaderResourceView(particleBuffer.Get(), &srvDesc, bufferCpuSrv);
 
-	// ƼŬ  ۿ  SRV  並 Ѵ.
+	// 파티클 데이터 버퍼에 대한 SRV 서술자 뷰를 생성한다.
 	D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
 	uavDesc.Format = DXGI_FORMAT_UNKNOWN;
 	uavDesc.ViewDimension = D3D12_UAV_DIMENSION_BUFFER;
@@ -102,7 +102,7 @@ void Particle::CreateBuffers(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HANDLE
 	uavDesc.Buffer.Flags = D3D12_BUFFER_UAV_FLAG_NONE;
 	device->CreateUnorderedAccessView(particleBuffer.Get(), nullptr, &uavDesc, bufferCpuUav);
 
-	//  īͿ  UAV  並 Ѵ.
+	// 버퍼 카운터에 대한 UAV 서술자 뷰를 생성한다.
 	D3D12_UNORDERED_ACCESS_VIEW_DESC counterUavDesc = uavDesc;
 	counterUavDesc.Buffer.NumElements = 1;
 	counterUavDesc.Buffer.StructureByteStride = sizeof(std::uint32_t);
@@ -132,14 +132,14 @@ void Particle::Tick(float deltaTime)
 	readRange.Begin = 0;
 	readRange.End = maxParticleNum * sizeof(ParticleData);
 
-	//  ƼŬ ͸ cpu Ѵ.
+	// 모든 파티클 데이터를 cpu로 복사한다.
 	ThrowIfFailed(mReadBackBuffer->Map(0, &readRange, reinterpret_cast<void**>(&mappedData)));
 
-	// ͸   Ѵ.
+	// 데이터를 복사할 파일을 선언한다.
 	auto name = GetName() + ".txt";
 	std::ofstream fout(name.data(), std::ios::app);
 
-	// ƼŬ ͸ Ѵ.
+	// 파티클 데이터를 출력한다.
 	fout << "Particle Num : " << currentParticleNum << std::endl;
 	int n = 0;
 	for (int i = 0; i < maxParticleNum; ++i)
@@ -169,7 +169,7 @@ void Particle::Render(ID3D12GraphicsCommandList* cmdList, BoundingFrustum* frust
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(particleBuffer.Get(),
 		D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_GENERIC_READ));
 
-	// ƼŬ Ѵ.
+	// 파티클을 렌더링한다.
 	cmdList->IASetVertexBuffers(0, 0, nullptr);
 	cmdList->IASetIndexBuffer(nullptr);
 	cmdList->IASetPrimitiveTopology(D3D_PRIMITIVE_TOPOLOGY_POINTLIST);
@@ -198,7 +198,7 @@ void Particle::SetBufferUav(ID3D12GraphicsCommandList* cmdList)
 
 void Particle::Emit(ID3D12GraphicsCommandList* cmdList)
 {
-	// emitNumŭ ƼŬ Ѵ.
+	// emitNum수만큼 파티클을 생성한다.
 	cmdList->Dispatch(static_cast<int>(std::ceilf(emitNum / NUM_EMIT_THREAD)), 1, 1);
 
 	remainingSpawnTime = Random::GetRandomFloat(spawnTimeRange.first, spawnTimeRange.second);
@@ -206,7 +206,7 @@ void Particle::Emit(ID3D12GraphicsCommandList* cmdList)
 
 void Particle::Update(ID3D12GraphicsCommandList* cmdList)
 {
-	//  ƼŬ Ϳ Ͽ ƮѴ.
+	// 모든 파티클 데이터에 대하여 업데이트한다.
 	cmdList->Dispatch(static_cast<int>(std::ceilf(maxParticleNum / NUM_UPDATE_THREAD)), 1, 1);
 }
 
@@ -214,7 +214,7 @@ void Particle::SetParticleConstants(ParticleConstants& constants)
 {
 	constants.start = start;
 	constants.end = end;
-	constants.emitterLocation = position;
+	constants.emitterLocation = GetWorldPosition();
 	constants.enabledGravity = enabledGravity;
 	constants.maxParticleNum = maxParticleNum;
 	constants.particleCount = currentParticleNum;
@@ -227,7 +227,7 @@ void Particle::CopyData(ID3D12GraphicsCommandList* cmdList)
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(bufferCounter.Get(),
 		D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE));
 
-	//  īͷκ  Ȱȭ ƼŬ  о´.
+	// 버퍼 카운터로부터 현재 활성화된 파티클 개수를 읽어온다.
 	cmdList->CopyResource(readBackCounter.Get(), bufferCounter.Get());
 
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(bufferCounter.Get(),
@@ -237,14 +237,14 @@ void Particle::CopyData(ID3D12GraphicsCommandList* cmdList)
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(particleBuffer.Get(),
 		D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_COPY_SOURCE));
 
-	//  ƼŬ ͸ о´.
+	// 복사할 파티클 데이터를 읽어온다.
 	cmdList->CopyResource(ReadBackBuffer.Get(), particleBuffer.Get());
 
 	cmdList->ResourceBarrier(1, &CD3DX12_RESOURCE_BARRIER::Transition(particleBuffer.Get(),
 		D3D12_RESOURCE_STATE_COPY_SOURCE, D3D12_RESOURCE_STATE_UNORDERED_ACCESS));
 #endif
 
-	// Ȱȭ ƼŬ  Ѵ.
+	// 활성화된 파티클 개수를 복사한다.
 	UINT32* count = nullptr;
 	D3D12_RANGE readRange;
 	readRange.Begin = 0;
@@ -3,8 +3,8 @@
 #include "Light.h"
 
 /*
-     մ´.
-߽  ־  .
+한 지점에서 원뿔 모양의 빛을 내뿜는다.
+중심 지점에서부터 멀어질수록 빛은 약해진다.
 */
 class PointLight : public Light
 {
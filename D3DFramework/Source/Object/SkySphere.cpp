@@ -9,6 +9,7 @@ void SkySphere::Tick(float deltaTime)
 {
 	__super::Tick(deltaTime);
 
+	// 회전은 공유하는 TransformStore에 쓰므로 병렬 구간이 끝난 뒤로 미룬다.
 	float speed = rotatingSpeed * deltaTime;
-	Rotate(0.0f, speed, 0.0f);
+	Defer([this, speed]() { Rotate(0.0f, speed, 0.0f); });
 }
\ No newline at end of file
@@ -3,7 +3,7 @@
 #include "GameObject.h"
 
 /*
-Ŀٶ ϴ÷   ϴ 
+커다란 하늘로 주위를 도는 하늘 배경
 */
 class SkySphere : public GameObject
 {
@@ -15,6 +15,6 @@ public:
 	virtual void Tick(float deltaTime) override;
 
 protected:
-	//  ư ӵ
+	// 배경이 돌아가는 속도
 	float rotatingSpeed = 1.0f;
 };
\ No newline at end of file
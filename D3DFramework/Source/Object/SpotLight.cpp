@@ -15,7 +15,7 @@ void SpotLight::SetLightData(LightData& lightData)
 {
 	__super::SetLightData(lightData);
 
-	// ׸ ʿ ϱ   Ѵ.
+	// 그림자 맵에 사용하기 위한 행렬을 계산한다.
 	XMVECTOR lightDir = XMLoadFloat3(&lightData.direction);
 	XMVECTOR lightPos = XMLoadFloat3(&GetPosition());
 	XMVECTOR targetPos = lightPos + lightDir * falloffEnd;
@@ -2,6 +2,7 @@
 #include "Terrain.h"
 #include "../Component/Mesh.h"
 #include "../Framework/D3DInfo.h"
+#include "../Framework/OcclusionBuffer.h"
 
 Terrain::Terrain(std::string&& name) : Object(std::move(name)) 
 {
@@ -33,7 +34,7 @@ void Terrain::BuildMesh(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList
 	std::vector<std::uint16_t> indices;
 	indices.reserve(xLen * zLen * 12);
 
-	// ,  ̿ Ͽ   Ѵ.
+	// 가로, 세로 길이에 대하여 각 정점을 계산한다.
 	for (int i = 0; i < xLen + 1; ++i)
 	{
 		for (int j = 0; j < zLen + 1; ++j)
@@ -49,33 +50,48 @@ void Terrain::BuildMesh(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList
 	{
 		for (int j = 0; j < zLen; ++j)
 		{
-			//  Ÿ 簢  12  Ѵ.
+			// 지형 타일 사각형 당 12개의 제어점을 정의한다.
 
-			// 0 3  簢 ̴.
+			// 0에서 3까지는 실제 사각형 정점들이다.
 			indices.emplace_back((j + 0) + (i + 0) * (xLen + 1));
 			indices.emplace_back((j + 1) + (i + 0) * (xLen + 1));
 			indices.emplace_back((j + 0) + (i + 1) * (xLen + 1));
 			indices.emplace_back((j + 1) + (i + 1) * (xLen + 1));
 
-			// 4 5 +X ̿ Ÿ̴.
+			// 4와 5는 +X방향 이웃 타일이다.
 			indices.emplace_back(std::clamp(j + 0, 0, zLen) + std::clamp(i + 2, 0, xLen) * (xLen + 1));
 			indices.emplace_back(std::clamp(j + 1, 0, zLen) + std::clamp(i + 2, 0, xLen) * (xLen + 1));
 
-			// 6 7 +Z ̿ Ÿ̴.
+			// 6과 7은 +Z방향 이웃 타일이다.
 			indices.emplace_back(std::clamp(j + 2, 0, zLen) + std::clamp(i + 0, 0, xLen) * (xLen + 1));
 			indices.emplace_back(std::clamp(j + 2, 0, zLen) + std::clamp(i + 1, 0, xLen) * (xLen + 1));
 
-			// 8 9 -X ̿ Ÿ̴.
+			// 8과 9은 -X방향 이웃 타일이다.
 			indices.emplace_back(std::clamp(j + 0, 0, zLen) + std::clamp(i - 1, 0, xLen) * (xLen + 1));
 			indices.emplace_back(std::clamp(j + 1, 0, zLen) + std::clamp(i - 1, 0, xLen) * (xLen + 1));
 
-			// 10 11 -Z ̿ Ÿ̴.
+			// 10과 11은 -Z방향 이웃 타일이다.
 			indices.emplace_back(std::clamp(j - 1, 0, zLen) + std::clamp(i + 0, 0, xLen) * (xLen + 1));
 			indices.emplace_back(std::clamp(j - 1, 0, zLen) + std::clamp(i + 1, 0, xLen) * (xLen + 1));
 		}
 	}
 
-	//  Ǵ ޽ Ѵ.
+	// 오클루더로 사용할 때는 각 타일 사각형을 두 개의 삼각형으로 그린다.
+	occluderIndices.clear();
+	occluderIndices.reserve(xLen * zLen * 6);
+	for (int i = 0; i < xLen; ++i)
+	{
+		for (int j = 0; j < zLen; ++j)
+		{
+			const std::uint16_t v0 = (j + 0) + (i + 0) * (xLen + 1);
+			const std::uint16_t v1 = (j + 1) + (i + 0) * (xLen + 1);
+			const std::uint16_t v2 = (j + 0) + (i + 1) * (xLen + 1);
+			const std::uint16_t v3 = (j + 1) + (i + 1) * (xLen + 1);
+			occluderIndices.insert(occluderIndices.end(), { v0, v1, v2, v2, v1, v3 });
+		}
+	}
+
+	// 지형에 사용되는 메쉬를 생성한다.
 	terrainMesh->BuildVertices(device, cmdList, (void*)vertices.data(), (UINT)vertices.size(), (UINT)sizeof(TerrainVertex));
 	terrainMesh->BuildIndices(device, cmdList, indices.data(), (UINT)indices.size(), (UINT)sizeof(std::uint16_t));
 	terrainMesh->SetPrimitiveType(D3D11_PRIMITIVE_TOPOLOGY_12_CONTROL_POINT_PATCHLIST);
@@ -93,7 +109,7 @@ void Terrain::BuildDescriptors(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HAND
 	hResourcesGpuSrv = hGpuSrv;
 	hResourcesGpuUav = hGpuSrv.Offset(2, DescriptorSize::cbvSrvUavDescriptorSize);
 
-	//  LODʰ   SRV 並 Ѵ.
+	// 각 LOD맵과 노멀 맵의 SRV 뷰를 생성한다.
 	D3D12_SHADER_RESOURCE_VIEW_DESC srvDesc = {};
 	srvDesc.Shader4ComponentMapping = D3D12_DEFAULT_SHADER_4_COMPONENT_MAPPING;
 	srvDesc.ViewDimension = D3D12_SRV_DIMENSION_TEXTURE2D;
@@ -103,7 +119,7 @@ void Terrain::BuildDescriptors(ID3D12Device* device, CD3DX12_CPU_DESCRIPTOR_HAND
 	device->CreateShaderResourceView(lodLookupMap.Get(), &srvDesc, lodLookupMapCpuSrv);
 	device->CreateShaderResourceView(normalMap.Get(), &srvDesc, normalMapCpuSrv);
 
-	//  LODʰ   UAV 並 Ѵ.
+	// 각 LOD맵과 노멀 맵의 UAV 뷰를 생성한다.
 	D3D12_UNORDERED_ACCESS_VIEW_DESC uavDesc = {};
 	uavDesc.ViewDimension = D3D12_UAV_DIMENSION_TEXTURE2D;
 	uavDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
@@ -129,7 +145,7 @@ void Terrain::BuildResources(ID3D12Device* device)
 	texDesc.Layout = D3D12_TEXTURE_LAYOUT_UNKNOWN;
 	texDesc.Flags = D3D12_RESOURCE_FLAG_ALLOW_UNORDERED_ACCESS;
 
-	// LOD ҽ Ѵ.
+	// LOD맵 리소스를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -141,7 +157,7 @@ void Terrain::BuildResources(ID3D12Device* device)
 	texDesc.Width = HEIGHT_MAP_SIZE;
 	texDesc.Height = HEIGHT_MAP_SIZE;
 
-	//   ҽ Ѵ.
+	// 노멀 맵 리소스를 생성한다.
 	ThrowIfFailed(device->CreateCommittedResource(
 		&CD3DX12_HEAP_PROPERTIES(D3D12_HEAP_TYPE_DEFAULT),
 		D3D12_HEAP_FLAG_NONE,
@@ -153,19 +169,19 @@ void Terrain::BuildResources(ID3D12Device* device)
 
 void Terrain::SetUavDescriptors(ID3D12GraphicsCommandList* cmdList)
 {
-	// ѹ LODMap Normal  ´.
+	// 한번에 LODMap와 Normal을 같이 묶는다.
 	cmdList->SetComputeRootDescriptorTable((int)RpTerrainCompute::Uav, hResourcesGpuUav);
 }
 
 void Terrain::SetSrvDescriptors(ID3D12GraphicsCommandList* cmdList)
 {
-	// ѹ LODMap Normal  ´.
+	// 한번에 LODMap와 Normal을 같이 묶는다.
 	cmdList->SetGraphicsRootDescriptorTable((int)RpTerrainGraphics::Srv, hResourcesGpuSrv);
 }
 
 void Terrain::LODCompute(ID3D12GraphicsCommandList* cmdList)
 {
-	// ǥ  Ͽ LOD Ѵ.
+	// 표준 편차를 계산하여 LOD를 정한다.
 	cmdList->Dispatch(static_cast<int>(std::ceilf(HEIGHT_MAP_SIZE / 16.0f)),
 		static_cast<int>(std::ceilf(HEIGHT_MAP_SIZE / 16.0f)), 1);
 
@@ -175,7 +191,7 @@ void Terrain::LODCompute(ID3D12GraphicsCommandList* cmdList)
 
 void Terrain::NormalCompute(ID3D12GraphicsCommandList* cmdList)
 {
-	//  Ͽ   .
+	// 노멀을 계산하여 노멀 맵을 만든다.
 	cmdList->Dispatch(static_cast<int>(std::ceilf(HEIGHT_MAP_SIZE / 16.0f)),
 		static_cast<int>(std::ceilf(HEIGHT_MAP_SIZE / 16.0f)), 1);
 
@@ -183,6 +199,18 @@ void Terrain::NormalCompute(ID3D12GraphicsCommandList* cmdList)
 		D3D12_RESOURCE_STATE_UNORDERED_ACCESS, D3D12_RESOURCE_STATE_GENERIC_READ));
 }
 
+OccluderMesh Terrain::GetOccluder() const
+{
+	OccluderMesh occluder;
+	occluder.vertices = terrainMesh->GetVertexData();
+	occluder.vertexCount = terrainMesh->GetVertexCount();
+	occluder.vertexStride = terrainMesh->GetVertexStride();
+	occluder.indices = occluderIndices.data();
+	occluder.indexCount = (UINT32)occluderIndices.size();
+	XMStoreFloat4x4(&occluder.world, GetWorld());
+	return occluder;
+}
+
 XMFLOAT2 Terrain::GetPixelDimesion() const
 {
 	return XMFLOAT2(HEIGHT_MAP_SIZE, HEIGHT_MAP_SIZE); 
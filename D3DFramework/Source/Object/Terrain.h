@@ -5,11 +5,12 @@
 
 class Mesh;
 class Material;
+struct OccluderMesh;
 
 #define HEIGHT_MAP_SIZE 512
 
 /*
-  ͸ ĸȭ Ŭ
+지형에 관한 데이터를 캡슐화한 클래스
 */
 class Terrain : public Object, public Renderable
 {
@@ -22,23 +23,27 @@ public:
 	virtual void SetConstantBuffer(ID3D12GraphicsCommandList* cmdList, D3D12_GPU_VIRTUAL_ADDRESS startAddress) const override;
 
 public:
-	//    ϰ, ޽ Ѵ.
+	// 지형에 사용할 평면을 계산하고, 메쉬를 생성한다.
 	void BuildMesh(ID3D12Device* device, ID3D12GraphicsCommandList* cmdList,
 		const float width, const float depth, const INT32 xLen, const INT32 zLen);
-	//  並 Ѵ.
+	// 서술자 뷰를 생성한다.
 	void BuildDescriptors(ID3D12Device* device, 
 		CD3DX12_CPU_DESCRIPTOR_HANDLE hCpuSrv, 
 		CD3DX12_GPU_DESCRIPTOR_HANDLE hGpuSrv);
-	//  UAV ҽ ο εѴ.
+	// 사용할 UAV 리소스를 파이프라인에 바인딩한다.
 	void SetUavDescriptors(ID3D12GraphicsCommandList* cmdList);
-	//  SRV ҽ ο εѴ.
+	// 사용할 SRV 리소스를 파이프라인에 바인딩한다.
 	void SetSrvDescriptors(ID3D12GraphicsCommandList* cmdList);
 
-	// Ʈ  ̿Ͽ ǥ  ϰ LOD ҽ ´.
+	// 하이트 맵을 이용하여 표준 편차를 계산하고 LOD를 리소스에 담는다.
 	void LODCompute(ID3D12GraphicsCommandList* cmdList);
-	// Ʈ  ̿Ͽ  ϰ   ҽ ´.
+	// 하이트 맵을 이용하여 노멀을 계산하고 노멀 맵 리소스에 담는다.
 	void NormalCompute(ID3D12GraphicsCommandList* cmdList);
 
+	// 높이 맵을 적용하기 전의 평면을 오클루더로 반환한다. 높이는 항상 0 이상이므로
+	// 이 평면은 실제 지형보다 아래에 있고, 위에서 볼 때 가리는 것은 지형도 가린다.
+	OccluderMesh GetOccluder() const;
+
 	XMFLOAT2 GetPixelDimesion() const;
 	XMFLOAT2 GetGeometryDimesion() const;
 
@@ -46,22 +51,24 @@ public:
 	Material* GetMaterial() const;
 
 private:
-	//  ʿ ҽ Ѵ.
+	// 지형에 필요한 리소스를 생성한다.
 	void BuildResources(ID3D12Device* device);
 
 
 protected:
-	//  ޽  
+	// 평면 메쉬가 나누어지는 정도
 	UINT32 xLen = 0;
 	UINT32 zLen = 0;
 
 private:
-	//  Ǵ  ޽
+	// 지형에 사용되는 평면 메쉬
 	std::unique_ptr<Mesh> terrainMesh;
 	Material* material = nullptr;
+	// 평면 메쉬의 인덱스는 패치의 제어점이므로 오클루더는 따로 만든 삼각형 인덱스를 사용한다.
+	std::vector<std::uint16_t> occluderIndices;
 
-	// ̸  ǥ  ̿ LOD .   LOD
-	// Ͽ ȭ ׼̼ ϴ.
+	// 미리 계산된 표준 편차를 이용한 LOD 맵. 지형은 이 LOD맵을
+	// 사용하여 최적화된 테셀레이션이 가능하다.
 	Microsoft::WRL::ComPtr<ID3D12Resource> lodLookupMap;
 	Microsoft::WRL::ComPtr<ID3D12Resource> normalMap;
 
@@ -16,7 +16,7 @@
 #include <DirectXPackedVector.h>
 #include <DirectXColors.h>
 #include <DirectXCollision.h>
-#include <mmsystem.h> // dsound.h Ŭϱ  ʼ
+#include <mmsystem.h> // dsound.h를 인클루드하기 전 필수
 #include <dsound.h>
 #include <dinput.h>
 